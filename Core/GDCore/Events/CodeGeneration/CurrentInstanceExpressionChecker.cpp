@@ -0,0 +1,18 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/CurrentInstanceExpressionChecker.h"
+
+#include "GDCore/Project/ObjectsContainersList.h"
+
+namespace gd {
+
+bool CurrentInstanceExpressionChecker::IsOtherObject(
+    const gd::String &name) const {
+  return !IsCurrentObject(name) &&
+         objectsContainersList.HasObjectOrGroupNamed(name);
+}
+
+}  // namespace gd
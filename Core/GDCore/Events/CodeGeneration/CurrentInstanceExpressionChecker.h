@@ -0,0 +1,119 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class ObjectsContainersList;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Check that an expression used in an instruction run on each instance
+ * of an object only uses the instance it's evaluated for: its object
+ * functions and its variables.
+ *
+ * Expressions using other objects, or giving the objects list to a function
+ * (like `Count(MyObject)`), are rejected.
+ *
+ * Such an expression has the same value when the instructions are run one
+ * after the other on all the instances, or when all the instructions are run
+ * on an instance before the next one (provided the instructions only change
+ * the instance they are run on).
+ */
+class GD_CORE_API CurrentInstanceExpressionChecker
+    : public ExpressionParser2NodeWorker {
+ public:
+  /**
+   * \brief Return true if the expression only uses the instance of the object
+   * (or of the group) it's evaluated for.
+   *
+   * \param objectName The name of the object, or of the group, of the
+   * instruction.
+   * \param realObjectName The name of the object the instruction is run on.
+   */
+  static bool UsesOnlyCurrentInstance(
+      const gd::ObjectsContainersList &objectsContainersList,
+      gd::ExpressionNode &node,
+      const gd::String &objectName,
+      const gd::String &realObjectName) {
+    CurrentInstanceExpressionChecker checker(
+        objectsContainersList, objectName, realObjectName);
+    node.Visit(checker);
+    return checker.usesOnlyCurrentInstance;
+  }
+
+  virtual ~CurrentInstanceExpressionChecker(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode &node) override {}
+  void OnVisitTextNode(TextNode &node) override {}
+  void OnVisitVariableNode(VariableNode &node) override {
+    if (IsOtherObject(node.name)) usesOnlyCurrentInstance = false;
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {
+    // An object alone is the whole objects list, whereas a child of the
+    // object is a variable of the instance.
+    if (IsOtherObject(node.identifierName) ||
+        (IsCurrentObject(node.identifierName) &&
+         node.childIdentifierName.empty()))
+      usesOnlyCurrentInstance = false;
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {
+    usesOnlyCurrentInstance = false;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    if (!node.objectName.empty() && !IsCurrentObject(node.objectName))
+      usesOnlyCurrentInstance = false;
+    for (auto &parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override {}
+
+ private:
+  CurrentInstanceExpressionChecker(
+      const gd::ObjectsContainersList &objectsContainersList_,
+      const gd::String &objectName_,
+      const gd::String &realObjectName_)
+      : objectsContainersList(objectsContainersList_),
+        objectName(objectName_),
+        realObjectName(realObjectName_),
+        usesOnlyCurrentInstance(true){};
+
+  bool IsCurrentObject(const gd::String &name) const {
+    return name == objectName || name == realObjectName;
+  }
+  bool IsOtherObject(const gd::String &name) const;
+
+  const gd::ObjectsContainersList &objectsContainersList;
+  const gd::String &objectName;
+  const gd::String &realObjectName;
+  bool usesOnlyCurrentInstance;
+};
+
+}  // namespace gd
@@ -72,6 +72,35 @@ class GD_CORE_API DiagnosticReport {
 
   const gd::String &GetSceneName() const { return sceneName; }
 
+  /**
+   * \brief Called when the generated code uses an objects list of a parent
+   * event instead of a copy of it.
+   */
+  void AddRemovedObjectsListCopy() { removedObjectsListsCopiesCount++; }
+
+  std::size_t GetRemovedObjectsListsCopiesCount() const {
+    return removedObjectsListsCopiesCount;
+  }
+
+  /**
+   * \brief Called when the generated code evaluates a list of conditions in
+   * another order than the one of the events.
+   *
+   * \param conditionsOrder The types of the conditions, in the order they
+   * are evaluated.
+   */
+  void AddReorderedConditions(const gd::String &conditionsOrder) {
+    reorderedConditions.push_back(conditionsOrder);
+  }
+
+  std::size_t GetReorderedConditionsCount() const {
+    return reorderedConditions.size();
+  }
+
+  const gd::String &GetReorderedConditions(std::size_t index) const {
+    return reorderedConditions[index];
+  }
+
   void SetSceneName(const gd::String &sceneName_) { sceneName = sceneName_; }
 
   void LogAllDiagnostics() {
@@ -87,6 +116,8 @@ class GD_CORE_API DiagnosticReport {
  private:
   std::vector<std::unique_ptr<gd::ProjectDiagnostic>> projectDiagnostics;
   gd::String sceneName;
+  std::size_t removedObjectsListsCopiesCount = 0;
+  std::vector<gd::String> reorderedConditions;
 };
 
 /**
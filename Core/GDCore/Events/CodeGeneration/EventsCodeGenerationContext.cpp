@@ -56,8 +56,26 @@ void EventsCodeGenerationContext::InheritsAsAsyncCallbackFrom(
 void EventsCodeGenerationContext::Reuse(
     EventsCodeGenerationContext& parent_) {
   InheritsFrom(parent_);
-  if (parent_.CanReuse())
+  if (parent_.CanReuse()) {
     contextDepth = parent_.GetContextDepth();  // Keep same context depth
+
+    // The lists are the same as the parent ones, so they are shared in the
+    // same way.
+    shareUnmodifiedObjectsLists = parent_.shareUnmodifiedObjectsLists;
+    modifiedObjectsLists = parent_.modifiedObjectsLists;
+  }
+}
+
+gd::String EventsCodeGenerationContext::AddLoopInvariant(
+    const gd::String& code) {
+  for (const auto& loopInvariant : loopInvariants) {
+    if (loopInvariant.second == code) return loopInvariant.first;
+  }
+
+  gd::String name = "loopInvariant" + gd::String::From(GetContextDepth()) +
+                    "_" + gd::String::From(loopInvariants.size());
+  loopInvariants.push_back(std::make_pair(name, code));
+  return name;
 }
 
 void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName) {
@@ -70,6 +88,13 @@ void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd
 
 void EventsCodeGenerationContext::ObjectsListNeeded(
     const gd::String& objectName) {
+  if (IsObjectsListSharedWithParent(objectName)) {
+    // The list is declared so that children know it's used, but the depth of
+    // its last use is kept: the list of the parent is the one used.
+    objectsListsToBeDeclared.insert(objectName);
+    return;
+  }
+
   if (!IsToBeDeclared(objectName)) {
     objectsListsToBeDeclared.insert(objectName);
 
@@ -132,6 +157,14 @@ bool EventsCodeGenerationContext::IsSameObjectsList(
          otherContext.GetLastDepthObjectListWasNeeded(objectName);
 }
 
+bool EventsCodeGenerationContext::IsObjectsListSharedWithParent(
+    const gd::String& objectName) const {
+  return shareUnmodifiedObjectsLists && parent != nullptr &&
+         !IsInsideAsync() &&
+         modifiedObjectsLists.find(objectName) == modifiedObjectsLists.end() &&
+         ObjectAlreadyDeclaredByParents(objectName);
+}
+
 bool EventsCodeGenerationContext::ShouldUseAsyncObjectsList(
     const gd::String& objectName) const {
   if (!IsInsideAsync()) return false;
@@ -8,6 +8,8 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "GDCore/String.h"
 
@@ -75,6 +77,72 @@ class GD_CORE_API EventsCodeGenerationContext {
     return !reuseExplicitlyForbidden && parent != nullptr;
   }
 
+  /**
+   * \brief Let the context use the objects lists of its parent, instead of
+   * copies, for the objects having lists not in \a modifiedObjectsLists.
+   *
+   * Used when the lists are known to be never modified by the code generated
+   * in the context (see gd::ModifiedObjectsListsFinder).
+   */
+  void ShareUnmodifiedObjectsListsWithParent(
+      const std::set<gd::String>& modifiedObjectsLists_) {
+    shareUnmodifiedObjectsLists = true;
+    modifiedObjectsLists = modifiedObjectsLists_;
+  }
+
+  /**
+   * \brief Return true if the context uses the objects list of its parent
+   * for the object, instead of a copy.
+   *
+   * \see ShareUnmodifiedObjectsListsWithParent
+   */
+  bool IsObjectsListSharedWithParent(const gd::String& objectName) const;
+
+  /**
+   * \brief Compute the invariant parts of the expressions generated in this
+   * context once, before the loop, instead of at each iteration (see
+   * gd::ExpressionConstantFolder::IsInvariant).
+   *
+   * Used by events having a loop. Children contexts don't inherit this, as
+   * their code can be generated in another function. For the same reason,
+   * StopHoistingLoopInvariants must be called before generating the code of
+   * the sub-events (which can use this context as their parent).
+   */
+  void HoistLoopInvariants() { hoistLoopInvariants = true; }
+
+  /**
+   * \brief Stop computing the invariant parts of the expressions before the
+   * loop.
+   *
+   * \see HoistLoopInvariants
+   */
+  void StopHoistingLoopInvariants() { hoistLoopInvariants = false; }
+
+  /**
+   * \brief Return true if the invariant parts of the expressions must be
+   * computed before the loop.
+   *
+   * \see HoistLoopInvariants
+   */
+  bool IsHoistingLoopInvariants() const { return hoistLoopInvariants; }
+
+  /**
+   * \brief Register the code of an invariant part of an expression, to be
+   * computed before the loop.
+   *
+   * \return The name of the variable to be used instead of the code.
+   */
+  gd::String AddLoopInvariant(const gd::String& code);
+
+  /**
+   * \brief Return the invariant parts of the expressions to be computed before
+   * the loop, as pairs of a variable name and the code of its value.
+   */
+  const std::vector<std::pair<gd::String, gd::String>>& GetLoopInvariants()
+      const {
+    return loopInvariants;
+  }
+
   /**
    * \brief Returns the depth of the inheritance of the context.
    *
@@ -273,7 +341,7 @@ class GD_CORE_API EventsCodeGenerationContext {
    * \brief Returns true if the given object is already going to be declared
    * in this context (either as a traditional objects list, or an empty one).
    */
-  bool IsToBeDeclared(const gd::String& objectName) {
+  bool IsToBeDeclared(const gd::String& objectName) const {
     return objectsListsToBeDeclared.find(objectName) !=
                objectsListsToBeDeclared.end() ||
            objectsListsOrEmptyToBeDeclared.find(objectName) !=
@@ -340,6 +408,18 @@ class GD_CORE_API EventsCodeGenerationContext {
       false;  ///< If set to true, this event is followed by an Else event
               ///< in the events list, meaning the else chain tracking variable
               ///< should be updated.
+  bool shareUnmodifiedObjectsLists =
+      false;  ///< If set to true, the objects lists not in
+              ///< modifiedObjectsLists are the ones of the parent.
+  std::set<gd::String>
+      modifiedObjectsLists;  ///< Objects lists that can be modified by the
+                             ///< code generated in this context.
+  bool hoistLoopInvariants =
+      false;  ///< If set to true, the invariant parts of the expressions are
+              ///< computed before the loop of the event.
+  std::vector<std::pair<gd::String, gd::String>>
+      loopInvariants;  ///< The variables names and the codes of the invariant
+                       ///< parts of the expressions.
 };
 
 }  // namespace gd
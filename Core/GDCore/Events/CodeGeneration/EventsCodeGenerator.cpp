@@ -1,11 +1,15 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 
 #include <algorithm>
+#include <set>
 #include <utility>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/CodeGeneration/CurrentInstanceExpressionChecker.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ModifiedObjectsListsFinder.h"
+#include "GDCore/Events/EventsList.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
@@ -14,6 +18,7 @@
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/EventsContextAnalyzer.h"
 #include "GDCore/IDE/Events/ExpressionVariableNameFinder.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/ObjectsContainer.h"
@@ -332,13 +337,10 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
     return "{" + conditionCode + "}\n";
   }
 
-  // Insert code only parameters and be sure there is no lack of parameter.
-  while (condition.GetParameters().size() <
-         instrInfos.parameters.GetParametersCount()) {
-    vector<gd::Expression> parameters = condition.GetParameters();
-    parameters.push_back(gd::Expression(""));
-    condition.SetParameters(parameters);
-  }
+  // The parameters are only read from now on: do it through a const reference
+  // so that they stay shared with the copies of the instruction. Missing
+  // parameters are read as empty expressions.
+  const gd::Instruction& constCondition = condition;
 
   // Verify that there are no mismatches between object type in parameters.
   for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount();
@@ -346,7 +348,7 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
     if (ParameterMetadata::IsObject(
             instrInfos.parameters.GetParameter(pNb).GetType())) {
       gd::String objectInParameter =
-          condition.GetParameter(pNb).GetPlainString();
+          constCondition.GetParameter(pNb).GetPlainString();
 
       const auto& expectedObjectType =
           instrInfos.parameters.GetParameter(pNb).GetExtraInfo();
@@ -380,11 +382,13 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
   }
 
   if (instrInfos.IsObjectInstruction()) {
-    gd::String objectName = condition.GetParameter(0).GetPlainString();
+    gd::String objectName = constCondition.GetParameter(0).GetPlainString();
     if (!objectName.empty() && instrInfos.parameters.GetParametersCount() > 0) {
       std::vector<gd::String> realObjects =
           GetObjectsContainersList().ExpandObjectName(
               objectName, context.GetCurrentObject());
+      std::vector<gd::String> generatedObjects;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Set up the context
         gd::String objectType =
@@ -401,18 +405,22 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
           // Prepare arguments and generate the condition whole code
           vector<gd::String> arguments = GenerateParametersCodes(
               condition.GetParameters(), instrInfos.parameters, context);
-          conditionCode += GenerateObjectCondition(
+          generatedObjects.push_back(realObjects[i]);
+          objectsCodes.push_back(GenerateObjectCondition(
               realObjects[i], objInfo, arguments, instrInfos, returnBoolean,
-              condition.IsInverted(), context);
+              condition.IsInverted(), context));
         }
         context.SetNoCurrentObject();
       }
+      conditionCode += GenerateObjectsInstructionCode(
+          generatedObjects, objectsCodes, context);
     }
   } else if (instrInfos.IsBehaviorInstruction()) {
     if (instrInfos.parameters.GetParametersCount() >= 2) {
-      const gd::String& objectName = condition.GetParameter(0).GetPlainString();
+      const gd::String& objectName =
+          constCondition.GetParameter(0).GetPlainString();
       const gd::String& behaviorName =
-          condition.GetParameter(1).GetPlainString();
+          constCondition.GetParameter(1).GetPlainString();
       const gd::String& actualBehaviorType =
           GetObjectsContainersList().GetTypeOfBehavior(behaviorName);
 
@@ -423,6 +431,8 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
       const BehaviorMetadata& autoInfo =
           MetadataProvider::GetBehaviorMetadata(platform, actualBehaviorType);
 
+      std::vector<gd::String> generatedObjects;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Setup context
         AddIncludeFiles(autoInfo.includeFiles);
@@ -434,12 +444,15 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
           // Prepare arguments and generate the whole condition code
           vector<gd::String> arguments = GenerateParametersCodes(
               condition.GetParameters(), instrInfos.parameters, context);
-          conditionCode += GenerateBehaviorCondition(
+          generatedObjects.push_back(realObjects[i]);
+          objectsCodes.push_back(GenerateBehaviorCondition(
               realObjects[i], behaviorName, autoInfo, arguments, instrInfos,
-              returnBoolean, condition.IsInverted(), context);
+              returnBoolean, condition.IsInverted(), context));
         }
         context.SetNoCurrentObject();
       }
+      conditionCode += GenerateObjectsInstructionCode(
+          generatedObjects, objectsCodes, context);
     }
   } else {
     std::vector<std::pair<gd::String, gd::String> >
@@ -471,12 +484,13 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
     outputCode += GenerateBooleanInitializationToFalse(
         "condition" + gd::String::From(i) + "IsTrue", context);
 
+  std::vector<std::size_t> evaluationOrder =
+      GetConditionsEvaluationOrder(conditions);
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
-    gd::String conditionCode =
-        GenerateConditionCode(conditions[cId],
-                              "condition" + gd::String::From(cId) + "IsTrue",
-                              context);
-    if (!conditions[cId].GetType().empty()) {
+    gd::Instruction& condition = conditions[evaluationOrder[cId]];
+    gd::String conditionCode = GenerateConditionCode(
+        condition, "condition" + gd::String::From(cId) + "IsTrue", context);
+    if (!condition.GetType().empty()) {
       for (std::size_t i = 0; i < cId;
            ++i)  // Skip conditions if one condition is false. //TODO : Can be
                  // optimized
@@ -502,7 +516,7 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
 
   maxConditionsListsSize = std::max(maxConditionsListsSize, conditions.size());
 
-  return outputCode;
+  return GenerateProfiledInstructionsListCode(conditions, true, outputCode);
 }
 
 bool EventsCodeGenerator::AreBehaviorParametersOfAllObjectsValid(
@@ -557,9 +571,7 @@ bool EventsCodeGenerator::AreBehaviorParametersOfFirstObjectValid(
     const gd::String &objectName, const gd::Instruction &instruction,
     const gd::InstructionMetadata &instrInfos, bool isObjectInGroup) {
   bool areBehaviorsValid = true;
-  for (size_t i = 1; i < instruction.GetParametersCount() &&
-                     i < instrInfos.GetParametersCount();
-       i++) {
+  for (size_t i = 1; i < instrInfos.GetParametersCount(); i++) {
     const gd::ParameterMetadata &parameterMetadata = instrInfos.GetParameter(i);
     if (!parameterMetadata.GetValueTypeMetadata().IsBehavior()) {
       break;
@@ -620,20 +632,18 @@ gd::String EventsCodeGenerator::GenerateActionCode(
           ? instrInfos.codeExtraInformation.asyncFunctionCallName
           : instrInfos.codeExtraInformation.functionCallName;
 
-  // Be sure there is no lack of parameter.
-  while (action.GetParameters().size() <
-         instrInfos.parameters.GetParametersCount()) {
-    vector<gd::Expression> parameters = action.GetParameters();
-    parameters.push_back(gd::Expression(""));
-    action.SetParameters(parameters);
-  }
+  // The parameters are only read from now on: do it through a const reference
+  // so that they stay shared with the copies of the instruction. Missing
+  // parameters are read as empty expressions.
+  const gd::Instruction& constAction = action;
 
   // Verify that there are no mismatches between object type in parameters.
   for (std::size_t pNb = 0; pNb < instrInfos.parameters.GetParametersCount();
        ++pNb) {
     if (ParameterMetadata::IsObject(
             instrInfos.parameters.GetParameter(pNb).GetType())) {
-      gd::String objectInParameter = action.GetParameter(pNb).GetPlainString();
+      gd::String objectInParameter =
+          constAction.GetParameter(pNb).GetPlainString();
 
       const auto& expectedObjectType =
           instrInfos.parameters.GetParameter(pNb).GetExtraInfo();
@@ -668,12 +678,14 @@ gd::String EventsCodeGenerator::GenerateActionCode(
 
   // Call free function first if available
   if (instrInfos.IsObjectInstruction()) {
-    gd::String objectName = action.GetParameter(0).GetPlainString();
+    gd::String objectName = constAction.GetParameter(0).GetPlainString();
 
     if (instrInfos.parameters.GetParametersCount() > 0) {
       std::vector<gd::String> realObjects =
           GetObjectsContainersList().ExpandObjectName(
               objectName, context.GetCurrentObject());
+      std::vector<gd::String> generatedObjects;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Setup context
         gd::String objectType =
@@ -690,17 +702,36 @@ gd::String EventsCodeGenerator::GenerateActionCode(
           // Prepare arguments and generate the whole action code
           vector<gd::String> arguments = GenerateParametersCodes(
               action.GetParameters(), instrInfos.parameters, context);
-          actionCode += GenerateObjectAction(
-              realObjects[i], objInfo, functionCallName, arguments, instrInfos,
-              context, optionalAsyncCallbackName, optionalAsyncCallbackId);
+          generatedObjects.push_back(realObjects[i]);
+          gd::String inlinedActionCode =
+              optionalAsyncCallbackName.empty()
+                  ? GenerateInlinedEventsFunctionCall(action.GetType(),
+                                                      instrInfos.parameters,
+                                                      arguments,
+                                                      realObjects[i],
+                                                      "",
+                                                      context)
+                  : "";
+          objectsCodes.push_back(
+              !inlinedActionCode.empty()
+                  ? inlinedActionCode
+                  : GenerateObjectAction(realObjects[i], objInfo,
+                                         functionCallName, arguments,
+                                         instrInfos, context,
+                                         optionalAsyncCallbackName,
+                                         optionalAsyncCallbackId));
         }
         context.SetNoCurrentObject();
       }
+      actionCode += GenerateObjectsInstructionCode(
+          generatedObjects, objectsCodes, context);
     }
   } else if (instrInfos.IsBehaviorInstruction()) {
     if (instrInfos.parameters.GetParametersCount() >= 2) {
-      const gd::String& objectName = action.GetParameter(0).GetPlainString();
-      const gd::String& behaviorName = action.GetParameter(1).GetPlainString();
+      const gd::String& objectName =
+          constAction.GetParameter(0).GetPlainString();
+      const gd::String& behaviorName =
+          constAction.GetParameter(1).GetPlainString();
       const gd::String& actualBehaviorType =
           GetObjectsContainersList().GetTypeOfBehavior(behaviorName);
 
@@ -712,6 +743,8 @@ gd::String EventsCodeGenerator::GenerateActionCode(
           MetadataProvider::GetBehaviorMetadata(platform, actualBehaviorType);
 
       AddIncludeFiles(autoInfo.includeFiles);
+      std::vector<gd::String> generatedObjects;
+      std::vector<gd::String> objectsCodes;
       for (std::size_t i = 0; i < realObjects.size(); ++i) {
         // Setup context
         context.SetCurrentObject(realObjects[i]);
@@ -722,23 +755,52 @@ gd::String EventsCodeGenerator::GenerateActionCode(
           // Prepare arguments and generate the whole action code
           vector<gd::String> arguments = GenerateParametersCodes(
               action.GetParameters(), instrInfos.parameters, context);
-          actionCode += GenerateBehaviorAction(
-              realObjects[i], behaviorName, autoInfo, functionCallName,
-              arguments, instrInfos, context, optionalAsyncCallbackName,
-              optionalAsyncCallbackId);
+          generatedObjects.push_back(realObjects[i]);
+          gd::String inlinedActionCode =
+              optionalAsyncCallbackName.empty()
+                  ? GenerateInlinedEventsFunctionCall(action.GetType(),
+                                                      instrInfos.parameters,
+                                                      arguments,
+                                                      realObjects[i],
+                                                      behaviorName,
+                                                      context)
+                  : "";
+          objectsCodes.push_back(
+              !inlinedActionCode.empty()
+                  ? inlinedActionCode
+                  : GenerateBehaviorAction(realObjects[i], behaviorName,
+                                           autoInfo, functionCallName,
+                                           arguments, instrInfos, context,
+                                           optionalAsyncCallbackName,
+                                           optionalAsyncCallbackId));
         }
         context.SetNoCurrentObject();
       }
+      actionCode += GenerateObjectsInstructionCode(
+          generatedObjects, objectsCodes, context);
     }
   } else {
     vector<gd::String> arguments = GenerateParametersCodes(
         action.GetParameters(), instrInfos.parameters, context);
-    actionCode += GenerateFreeAction(functionCallName,
-                                     arguments,
-                                     instrInfos,
-                                     context,
-                                     optionalAsyncCallbackName,
-                                     optionalAsyncCallbackId);
+
+    // Small functions made with events can be replaced by their body.
+    gd::String inlinedActionCode =
+        optionalAsyncCallbackName.empty()
+            ? GenerateInlinedEventsFunctionCall(action.GetType(),
+                                                instrInfos.parameters,
+                                                arguments,
+                                                "",
+                                                "",
+                                                context)
+            : "";
+    actionCode += !inlinedActionCode.empty()
+                      ? inlinedActionCode
+                      : GenerateFreeAction(functionCallName,
+                                           arguments,
+                                           instrInfos,
+                                           context,
+                                           optionalAsyncCallbackName,
+                                           optionalAsyncCallbackId);
   }
 
   return actionCode;
@@ -754,7 +816,7 @@ gd::String EventsCodeGenerator::GenerateAnyOrSceneVariableGetter(
     const gd::Expression& variableExpression,
     EventsCodeGenerationContext& context) {
   const auto variableName = gd::ExpressionVariableNameFinder::GetVariableName(
-      *variableExpression.GetRootNode());
+      *variableExpression.GetSharedRootNode());
 
   gd::String variableParameterType =
       GetProjectScopedContainers().GetVariablesContainersList().Has(
@@ -865,7 +927,247 @@ gd::String EventsCodeGenerator::GenerateActionsListCode(
     outputCode += "}\n";
   }
 
-  return outputCode;
+  return GenerateProfiledInstructionsListCode(actions, false, outputCode);
+}
+
+std::vector<std::size_t> EventsCodeGenerator::GetConditionsEvaluationOrder(
+    const gd::InstructionsList& conditions) {
+  std::vector<std::size_t> evaluationOrder(conditions.size());
+  for (std::size_t i = 0; i < conditions.size(); ++i) evaluationOrder[i] = i;
+
+  auto getEvaluationCost = [this, &conditions](std::size_t index) {
+    gd::InstructionMetadata::EvaluationCost evaluationCost =
+        MetadataProvider::GetConditionMetadata(platform,
+                                               conditions[index].GetType())
+            .GetEvaluationCost();
+    // Conditions without an estimated cost are kept between the cheap and
+    // the expensive ones.
+    return evaluationCost == gd::InstructionMetadata::UnknownCost
+               ? gd::InstructionMetadata::Medium
+               : evaluationCost;
+  };
+
+  // The real objects picked by each condition, and whether the condition
+  // picks several objects.
+  std::vector<std::set<gd::String>> pickedObjectsNames(conditions.size());
+  std::vector<bool> isPickingSeveralObjects(conditions.size(), false);
+  auto mustKeepOrder = [&pickedObjectsNames, &isPickingSeveralObjects](
+                           std::size_t a, std::size_t b) {
+    if (!isPickingSeveralObjects[a] && !isPickingSeveralObjects[b])
+      return false;
+
+    for (const gd::String& objectName : pickedObjectsNames[a]) {
+      if (pickedObjectsNames[b].count(objectName)) return true;
+    }
+    return false;
+  };
+
+  bool isReordered = false;
+  std::size_t firstIndex = 0;
+  while (firstIndex < conditions.size()) {
+    std::size_t endIndex = firstIndex;
+    std::vector<gd::String> pickedObjectsOrGroupsNames;
+    while (endIndex < conditions.size() &&
+           IsReorderableCondition(conditions[endIndex],
+                                  pickedObjectsOrGroupsNames)) {
+      for (const gd::String& objectOrGroupName : pickedObjectsOrGroupsNames) {
+        std::vector<gd::String> realObjects =
+            GetObjectsContainersList().ExpandObjectName(objectOrGroupName, "");
+        if (realObjects.empty()) realObjects.push_back(objectOrGroupName);
+        pickedObjectsNames[endIndex].insert(realObjects.begin(),
+                                            realObjects.end());
+      }
+      isPickingSeveralObjects[endIndex] = pickedObjectsOrGroupsNames.size() > 1;
+      pickedObjectsOrGroupsNames.clear();
+      endIndex++;
+    }
+
+    // Evaluate first the cheapest condition that is not required to stay
+    // after a condition not evaluated yet.
+    std::vector<std::size_t> remainingConditions;
+    for (std::size_t i = firstIndex; i < endIndex; ++i)
+      remainingConditions.push_back(i);
+    for (std::size_t position = firstIndex; position < endIndex; ++position) {
+      std::size_t bestIndex = 0;
+      for (std::size_t i = 0; i < remainingConditions.size(); ++i) {
+        bool canBeEvaluated = true;
+        for (std::size_t j = 0; j < i && canBeEvaluated; ++j) {
+          if (mustKeepOrder(remainingConditions[j], remainingConditions[i]))
+            canBeEvaluated = false;
+        }
+
+        if (canBeEvaluated &&
+            (i == 0 || getEvaluationCost(remainingConditions[i]) <
+                           getEvaluationCost(remainingConditions[bestIndex])))
+          bestIndex = i;
+      }
+
+      evaluationOrder[position] = remainingConditions[bestIndex];
+      if (evaluationOrder[position] != position) isReordered = true;
+      remainingConditions.erase(remainingConditions.begin() + bestIndex);
+    }
+
+    firstIndex = endIndex + 1;
+  }
+
+  if (isReordered && diagnosticReport) {
+    gd::String conditionsOrder;
+    for (std::size_t index : evaluationOrder) {
+      if (!conditionsOrder.empty()) conditionsOrder += ", ";
+      conditionsOrder += conditions[index].GetType();
+    }
+    diagnosticReport->AddReorderedConditions(conditionsOrder);
+  }
+
+  return evaluationOrder;
+}
+
+bool EventsCodeGenerator::IsReorderableCondition(
+    const gd::Instruction& condition,
+    std::vector<gd::String>& pickedObjectsOrGroupsNames) {
+  if (condition.GetType().empty() || !condition.GetSubInstructions().empty())
+    return false;
+
+  const gd::InstructionMetadata& metadata =
+      MetadataProvider::GetConditionMetadata(platform, condition.GetType());
+  if (MetadataProvider::IsBadInstructionMetadata(metadata) ||
+      !metadata.IsPure())
+    return false;
+
+  bool isReorderable = true;
+  gd::EventsContext parametersContext;
+  gd::ParameterMetadataTools::IterateOverParameters(
+      condition.GetParameters(),
+      metadata.parameters,
+      [this, &isReorderable, &pickedObjectsOrGroupsNames, &parametersContext](
+          const gd::ParameterMetadata& parameterMetadata,
+          const gd::Expression& parameterValue,
+          const gd::String& lastObjectName) {
+        const gd::String& type = parameterMetadata.GetType();
+        if (gd::ParameterMetadata::IsObject(type)) {
+          pickedObjectsOrGroupsNames.push_back(parameterValue.GetPlainString());
+        } else if (gd::ParameterMetadata::IsExpression("variable", type)) {
+          // Variables can be the ones of an object, or have children accessed
+          // with expressions that could use objects.
+          const gd::String& variableName = parameterValue.GetPlainString();
+          if (variableName.find("[") != gd::String::npos ||
+              GetObjectsContainersList().HasObjectOrGroupNamed(
+                  variableName.substr(0, variableName.find("."))))
+            isReorderable = false;
+        } else {
+          gd::EventsContextAnalyzer::AnalyzeParameter(
+              platform,
+              GetProjectScopedContainers(),
+              parameterMetadata,
+              parameterValue,
+              parametersContext,
+              lastObjectName);
+        }
+      });
+
+  // Conditions using objects in expressions depend on the instances picked by
+  // the other conditions.
+  return isReorderable &&
+         parametersContext.GetReferencedObjectOrGroupNames().empty();
+}
+
+gd::String EventsCodeGenerator::GetPerInstanceInstructionObjectName(
+    const gd::Instruction& instruction,
+    bool isCondition,
+    const EventsCodeGenerationContext& context) {
+  if (instruction.GetType().empty() ||
+      !instruction.GetSubInstructions().empty())
+    return "";
+
+  const gd::InstructionMetadata& metadata =
+      isCondition
+          ? MetadataProvider::GetConditionMetadata(platform,
+                                                   instruction.GetType())
+          : MetadataProvider::GetActionMetadata(platform,
+                                                instruction.GetType());
+  if (MetadataProvider::IsBadInstructionMetadata(metadata) ||
+      !metadata.IsPure() || !metadata.IsObjectInstruction() ||
+      metadata.IsAsync() || metadata.HasCustomCodeGenerator() ||
+      metadata.GetParametersCount() == 0 ||
+      instruction.GetParametersCount() < metadata.GetParametersCount())
+    return "";
+
+  const gd::String& objectName = instruction.GetParameter(0).GetPlainString();
+  const gd::String& expectedObjectType = metadata.GetParameter(0).GetExtraInfo();
+  if (!GetObjectsContainersList().HasObjectOrGroupNamed(objectName) ||
+      (!expectedObjectType.empty() &&
+       GetObjectsContainersList().GetTypeOfObject(objectName) !=
+           expectedObjectType))
+    return "";
+
+  // Instructions on groups are run in a loop for each object of the group.
+  std::vector<gd::String> realObjects =
+      GetObjectsContainersList().ExpandObjectName(objectName,
+                                                  context.GetCurrentObject());
+  if (realObjects.size() != 1) return "";
+
+  for (std::size_t i = 1; i < metadata.GetParametersCount(); ++i) {
+    const gd::String& type = metadata.GetParameter(i).GetType();
+    if (gd::ParameterMetadata::IsObject(type) ||
+        gd::ParameterMetadata::IsBehavior(type))
+      return "";
+
+    if (gd::ParameterMetadata::IsExpression("number", type) ||
+        gd::ParameterMetadata::IsExpression("string", type) ||
+        gd::ParameterMetadata::IsExpression("variable", type)) {
+      gd::ExpressionNode* node = instruction.GetParameter(i).GetSharedRootNode();
+      if (node && !gd::CurrentInstanceExpressionChecker::UsesOnlyCurrentInstance(
+                      GetObjectsContainersList(),
+                      *node,
+                      objectName,
+                      realObjects[0]))
+        return "";
+    }
+  }
+
+  return realObjects[0];
+}
+
+void EventsCodeGenerator::IdentifyProfiledEvents(const gd::EventsList& events) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    const gd::BaseEvent& event = events[i];
+
+    if (!event.IsDisabled() && event.IsExecutable() &&
+        !event.GetPersistentUuid().empty()) {
+      const gd::String& eventId = event.GetPersistentUuid();
+      // An event with the same UUID as another one (a copy that was not given
+      // a new UUID) is counted in its parent event.
+      if (profiledEventsIndices.find(eventId) == profiledEventsIndices.end()) {
+        profiledEventsIndices[eventId] = profiledEventsIds.size();
+        profiledEventsIds.push_back(eventId);
+      }
+    }
+    if (event.CanHaveSubEvents()) IdentifyProfiledEvents(event.GetSubEvents());
+  }
+}
+
+gd::String EventsCodeGenerator::GenerateProfiledInstructionsListCode(
+    const gd::InstructionsList& instructions,
+    bool areConditions,
+    const gd::String& code) {
+  if (!generateEventsProfilingCode || !currentProfiledEvent) return code;
+
+  // Only the lists of the event are measured, not the sub-instructions of
+  // the instructions (like the conditions of a "Or" condition).
+  const auto& instructionsLists =
+      areConditions ? currentProfiledEvent->GetAllConditionsVectors()
+                    : currentProfiledEvent->GetAllActionsVectors();
+  if (std::find(instructionsLists.begin(),
+                instructionsLists.end(),
+                &instructions) == instructionsLists.end())
+    return code;
+
+  std::size_t counterIndex =
+      currentProfiledEventIndex * 3 + (areConditions ? 1 : 2);
+  gd::String startTimeName =
+      "eventsProfilingStart" + gd::String::From(eventsProfilingHooksCount++);
+  return GenerateEventsProfilingBegin(counterIndex, startTimeName) + code +
+         GenerateEventsProfilingEnd(counterIndex, startTimeName);
 }
 
 gd::String EventsCodeGenerator::GenerateParameterCodes(
@@ -1103,7 +1405,7 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
       continue;
 
     if (event.HasVariables()) {
-      GetProjectScopedContainers().GetVariablesContainersList().Push(
+      GetProjectScopedContainers().PushVariablesContainer(
           event.GetVariables());
     }
 
@@ -1132,6 +1434,18 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     const bool isElseEvent =
         event.GetType() == "BuiltinCommonInstructions::Else";
 
+    //*Optimization*: when the event can't modify some lists of objects, it
+    // can use the lists of the parent instead of copies of them.
+    if (!reuseParentContext && isStandardEvent && !context.IsInsideAsync()) {
+      std::set<gd::String> modifiedObjectsLists;
+      if (gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+              GetPlatform(),
+              GetObjectsContainersList(),
+              event,
+              modifiedObjectsLists))
+        context.ShareUnmodifiedObjectsListsWithParent(modifiedObjectsLists);
+    }
+
     // Skip transparent events (disabled, comments) when looking for a
     // following Else event.
     bool hasFollowingElseEvent = false;
@@ -1146,8 +1460,24 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
 
     context.SetFollowedByElseEvent(hasFollowingElseEvent);
 
+    const gd::BaseEvent* parentProfiledEvent = currentProfiledEvent;
+    std::size_t parentProfiledEventIndex = currentProfiledEventIndex;
+    auto profiledEventIndex = profiledEventsIndices.end();
+    if (generateEventsProfilingCode && !event.GetPersistentUuid().empty())
+      profiledEventIndex = profiledEventsIndices.find(event.GetPersistentUuid());
+    bool isProfiledEvent = profiledEventIndex != profiledEventsIndices.end();
+    if (isProfiledEvent) {
+      currentProfiledEvent = &event;
+      currentProfiledEventIndex = profiledEventIndex->second;
+    } else {
+      currentProfiledEvent = nullptr;
+    }
+
     gd::String eventCoreCode = event.GenerateEventCode(*this, context);
 
+    currentProfiledEvent = parentProfiledEvent;
+    currentProfiledEventIndex = parentProfiledEventIndex;
+
     if (isElseEvent) {
       hasAnyElseEvent = true;
       if (!elseChainCanContinue) {
@@ -1173,11 +1503,21 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    gd::String eventCode = "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
+                           eventCoreCode + "\n" + scopeEnd + "\n";
+    if (isProfiledEvent) {
+      std::size_t counterIndex = profiledEventIndex->second * 3;
+      gd::String startTimeName = "eventsProfilingStart" +
+                                 gd::String::From(eventsProfilingHooksCount++);
+      eventCode = GenerateEventsProfilingBegin(counterIndex, startTimeName) +
+                  eventCode +
+                  GenerateEventsProfilingEnd(counterIndex, startTimeName);
+    }
+
+    output += eventCode;
 
     if (event.HasVariables()) {
-      GetProjectScopedContainers().GetVariablesContainersList().Pop();
+      GetProjectScopedContainers().PopVariablesContainer();
     }
   }
 
@@ -1437,6 +1777,16 @@ gd::String EventsCodeGenerator::GenerateObjectAction(
   }
 }
 
+gd::String EventsCodeGenerator::GenerateObjectsInstructionCode(
+    const std::vector<gd::String>& objectNames,
+    const std::vector<gd::String>& objectsCodes,
+    gd::EventsCodeGenerationContext& context) {
+  gd::String code;
+  for (const gd::String& objectCode : objectsCodes) code += objectCode;
+
+  return code;
+}
+
 gd::String EventsCodeGenerator::GenerateBehaviorAction(
     const gd::String& objectName,
     const gd::String& behaviorName,
@@ -1571,7 +1921,11 @@ EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project_,
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0),
-      diagnosticReport(nullptr) {};
+      diagnosticReport(nullptr),
+      generateEventsProfilingCode(false),
+      currentProfiledEvent(nullptr),
+      currentProfiledEventIndex(0),
+      eventsProfilingHooksCount(0) {};
 
 EventsCodeGenerator::EventsCodeGenerator(
     const gd::Platform& platform_,
@@ -1586,6 +1940,10 @@ EventsCodeGenerator::EventsCodeGenerator(
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
       eventsListNextUniqueId(0),
-      diagnosticReport(nullptr) {};
+      diagnosticReport(nullptr),
+      generateEventsProfilingCode(false),
+      currentProfiledEvent(nullptr),
+      currentProfiledEventIndex(0),
+      eventsProfilingHooksCount(0) {};
 
 }  // namespace gd
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <map>
 #include <set>
 #include <utility>
 #include <vector>
@@ -24,6 +25,7 @@ class ObjectsContainer;
 class ObjectsContainersList;
 class ExternalEvents;
 class ParameterMetadata;
+class ParameterMetadataContainer;
 class ObjectMetadata;
 class BehaviorMetadata;
 class InstructionMetadata;
@@ -315,6 +317,49 @@ class GD_CORE_API EventsCodeGenerator {
     compilationForRuntime = compilationForRuntime_;
   }
 
+  /**
+   * \brief Return true if hooks measuring the time spent in each event, and in
+   * its conditions and actions, must be generated.
+   */
+  bool ShouldGenerateEventsProfilingCode() const {
+    return generateEventsProfilingCode;
+  }
+
+  /**
+   * \brief Set if hooks measuring the time spent in each event, and in its
+   * conditions and actions, must be generated.
+   *
+   * \see IdentifyProfiledEvents
+   */
+  void SetGenerateEventsProfilingCode(bool enable) {
+    generateEventsProfilingCode = enable;
+  }
+
+  /**
+   * \brief Give an identifier to each event (and sub-event) of the list, so
+   * that the time spent in them can be measured and reported back to the
+   * events in the editor.
+   *
+   * The identifier of an event is its persistent UUID, given to the event
+   * when it's created: it stays the same when other events are added, moved or
+   * removed. The events are not modified, so this can be called on a copy of
+   * the project (copies of the events keep their UUID). Events inserted by the
+   * preprocessing (like the ones included by links) are not profiled on their
+   * own: their time is counted in their parent event.
+   */
+  void IdentifyProfiledEvents(const gd::EventsList& events);
+
+  /**
+   * \brief Get the identifiers of the profiled events.
+   *
+   * The profiling counters of the event at the index `i` are at the index
+   * `i * 3` (the whole event, including its sub-events), `i * 3 + 1` (its
+   * conditions) and `i * 3 + 2` (its actions).
+   */
+  const std::vector<gd::String>& GetProfiledEventsIds() const {
+    return profiledEventsIds;
+  }
+
   /**
    * \brief Report that an error occurred during code generation ( Event code
    * won't be generated )
@@ -449,6 +494,119 @@ class GD_CORE_API EventsCodeGenerator {
     return "";
   };
 
+  /**
+   * \brief Generate the code of a call to an action or an expression defined
+   * by an events function, using the body of the function instead of calling
+   * it.
+   *
+   * The default implementation never inlines anything.
+   *
+   * \param functionType The full type of the events function (for example
+   * "MyExtension::MyFunction" or "MyExtension::MyBehavior::MyFunction").
+   * \param parameters The parameters of the action or of the expression,
+   * including the code-only ones.
+   * \param argumentsCode The code of the argument of each parameter. For
+   * expressions of objects and behaviors, the arguments of the object and of
+   * the behavior are empty: they are given by objectName and behaviorName.
+   * \param objectName The object on which the function is called, if any.
+   * \param behaviorName The behavior on which the function is called, if any.
+   * \return The code to be used instead of the call (an expression for an
+   * expression, statements for an action), or an empty string if the function
+   * can't be inlined.
+   */
+  virtual gd::String GenerateInlinedEventsFunctionCall(
+      const gd::String& functionType,
+      const gd::ParameterMetadataContainer& parameters,
+      const std::vector<gd::String>& argumentsCode,
+      const gd::String& objectName,
+      const gd::String& behaviorName,
+      gd::EventsCodeGenerationContext& context) {
+    return "";
+  };
+
+  /**
+   * \brief Generate the code starting the measure of the time spent in a
+   * profiled event, or in its conditions or actions.
+   *
+   * \param counterIndex The index of the profiling counter to be updated.
+   * \param startTimeName A name, unique in the generated code, that can be
+   * used to store the time when the measure started.
+   * \see GetProfiledEventsIds
+   */
+  virtual gd::String GenerateEventsProfilingBegin(
+      std::size_t counterIndex, const gd::String& startTimeName) {
+    return "";
+  };
+
+  /**
+   * \brief Generate the code ending the measure of the time spent in a
+   * profiled event, or in its conditions or actions.
+   *
+   * \see GenerateEventsProfilingBegin
+   */
+  virtual gd::String GenerateEventsProfilingEnd(
+      std::size_t counterIndex, const gd::String& startTimeName) {
+    return "";
+  };
+
+  /**
+   * \brief Surround the code of a list of conditions or actions with the
+   * profiling hooks, if the list is one of the event being profiled.
+   */
+  gd::String GenerateProfiledInstructionsListCode(
+      const gd::InstructionsList& instructions,
+      bool areConditions,
+      const gd::String& code);
+
+  /**
+   * \brief Return the indices of the conditions of the list, in the order
+   * they must be evaluated.
+   *
+   * Adjacent conditions that can be reordered (see IsReorderableCondition) are
+   * evaluated from the cheapest to the most expensive. Other conditions keep
+   * their position.
+   *
+   * Conditions picking a single object filter each instance on its own, so
+   * they can be evaluated in any order. A condition picking several objects
+   * (like a collision) picks the instances of each object depending on the
+   * instances of the others: it's never moved before or after a condition
+   * using one of its objects.
+   */
+  std::vector<std::size_t> GetConditionsEvaluationOrder(
+      const gd::InstructionsList& conditions);
+
+  /**
+   * \brief Return true if the condition can be evaluated before or after the
+   * other reorderable conditions not using the same objects without changing
+   * the result of the list.
+   *
+   * The condition must be declared as pure (see
+   * gd::InstructionMetadata::MarkAsPure) and not use objects in the
+   * expressions of its parameters.
+   *
+   * \param pickedObjectsOrGroupsNames Filled with the names of the objects (or
+   * groups) picked by the condition.
+   */
+  bool IsReorderableCondition(
+      const gd::Instruction& condition,
+      std::vector<gd::String>& pickedObjectsOrGroupsNames);
+
+  /**
+   * \brief Return the name of the object that the instruction is run on, if
+   * the instruction can be run in the same loop over the instances as the
+   * adjacent instructions run on this object. Return an empty string
+   * otherwise.
+   *
+   * The instruction must be declared as pure (see
+   * gd::InstructionMetadata::MarkAsPure), be run on a single object and only
+   * use the instance it's run on in its parameters (see
+   * gd::CurrentInstanceExpressionChecker).
+   */
+  gd::String GetPerInstanceInstructionObjectName(
+      const gd::Instruction& instruction,
+      bool isCondition,
+      const EventsCodeGenerationContext& context);
+
   /**
    * \brief Get the namespace to be used to store code generated
    * objects/values/functions, with the extra "dot" at the end to be used to
@@ -792,6 +950,21 @@ class GD_CORE_API EventsCodeGenerator {
       const gd::String& optionalAsyncCallbackName = "",
       const gd::String& optionalAsyncCallbackId = "");
 
+  /**
+   * \brief Generate the code of an instruction run on several objects (the
+   * objects of a group), from the code generated for each of them.
+   *
+   * The default implementation runs the code of each object one after the
+   * other.
+   *
+   * \param objectNames The objects for which some code was generated.
+   * \param objectsCodes The code generated for each object.
+   */
+  virtual gd::String GenerateObjectsInstructionCode(
+      const std::vector<gd::String>& objectNames,
+      const std::vector<gd::String>& objectsCodes,
+      gd::EventsCodeGenerationContext& context);
+
   gd::String GenerateRelationalOperatorCall(
       const gd::InstructionMetadata& instrInfos,
       const std::vector<gd::String>& arguments,
@@ -879,6 +1052,17 @@ class GD_CORE_API EventsCodeGenerator {
                                   ///< list function name.
 
   gd::DiagnosticReport* diagnosticReport;
+
+  bool generateEventsProfilingCode;  ///< Is set to true if the time spent in
+                                     ///< events must be measured.
+  std::vector<gd::String> profiledEventsIds;
+  std::map<gd::String, std::size_t>
+      profiledEventsIndices;  ///< The index in profiledEventsIds of the
+                              ///< profiled events, by their persistent UUID.
+  const gd::BaseEvent* currentProfiledEvent;  ///< The event being generated,
+                                              ///< if it is profiled.
+  std::size_t currentProfiledEventIndex;
+  std::size_t eventsProfilingHooksCount;  ///< Used to generate unique names.
 };
 
 }  // namespace gd
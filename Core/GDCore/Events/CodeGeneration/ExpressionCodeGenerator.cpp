@@ -12,6 +12,7 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
@@ -44,7 +45,7 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     const gd::String& extraInfo) {
   ExpressionCodeGenerator generator(rootType, rootObjectName, codeGenerator, context);
 
-  auto node = expression.GetRootNode();
+  auto node = expression.GetSharedRootNode();
   if (!node) {
     std::cout << "Error: error while parsing: \"" << expression.GetPlainString()
               << "\" (" << rootType << ")" << std::endl;
@@ -52,12 +53,19 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     return generator.GenerateDefaultValue(rootType);
   }
 
-  gd::ExpressionValidator validator(codeGenerator.GetPlatform(),
-                                    codeGenerator.GetProjectScopedContainers(),
-                                    rootType,
-                                    extraInfo);
-  node->Visit(validator);
-  if (!validator.GetFatalErrors().empty()) {
+  if (!gd::ExpressionValidator::HasNoFatalErrors(
+          codeGenerator.GetPlatform(),
+          codeGenerator.GetProjectScopedContainers(),
+          rootType,
+          extraInfo,
+          *node)) {
+    // Validate again to report the errors.
+    gd::ExpressionValidator validator(codeGenerator.GetPlatform(),
+                                      codeGenerator.GetProjectScopedContainers(),
+                                      rootType,
+                                      extraInfo);
+    node->Visit(validator);
+
     std::cout << "Error: \"" << validator.GetFatalErrors()[0]->GetMessage()
               << "\" in: \"" << expression.GetPlainString() << "\" ("
               << rootType << ")" << std::endl;
@@ -85,11 +93,49 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     return generator.GenerateDefaultValue(rootType);
   }
 
+  gd::ExpressionConstantFolder constantFolder(
+      codeGenerator.GetPlatform(), codeGenerator.GetObjectsContainersList());
+  node->Visit(constantFolder);
+  generator.constantFolder = &constantFolder;
+
   node->Visit(generator);
   return generator.GetOutput();
 }
 
+bool ExpressionCodeGenerator::GenerateConstantCode(const ExpressionNode& node) {
+  if (!constantFolder) return false;
+
+  const auto* constant = constantFolder->GetConstant(node);
+  if (!constant) return false;
+
+  if (constant->isText) {
+    output += codeGenerator.ConvertToStringExplicit(constant->text);
+  } else if (constant->number < 0) {
+    // Parenthesis avoid things like `1 - -2` to be outputted as `1 --2`.
+    output +=
+        "(" + gd::ExpressionConstantFolder::NumberToString(constant->number) +
+        ")";
+  } else {
+    output += gd::ExpressionConstantFolder::NumberToString(constant->number);
+  }
+  return true;
+}
+
+bool ExpressionCodeGenerator::GenerateLoopInvariantCode(
+    FunctionCallNode& node, const ExpressionMetadata& metadata) {
+  if (!constantFolder || !context.IsHoistingLoopInvariants() ||
+      !constantFolder->IsInvariant(node))
+    return false;
+
+  // Invariant parameters are themselves hoisted, so they are computed first.
+  output += context.AddLoopInvariant(
+      GenerateFreeFunctionCode(node.functionName, node.parameters, metadata));
+  return true;
+}
+
 void ExpressionCodeGenerator::OnVisitOperatorNode(OperatorNode& node) {
+  if (GenerateConstantCode(node)) return;
+
   node.leftHandSide->Visit(*this);
   output += " ";
   output.push_back(node.op);
@@ -99,6 +145,8 @@ void ExpressionCodeGenerator::OnVisitOperatorNode(OperatorNode& node) {
 
 void ExpressionCodeGenerator::OnVisitUnaryOperatorNode(
     UnaryOperatorNode& node) {
+  if (GenerateConstantCode(node)) return;
+
   output.push_back(node.op);
   output += "(";  // Add extra parenthesis to ensure that things like --2 are
                   // properly outputted as -(-2) (GDevelop don't have -- or ++
@@ -109,6 +157,8 @@ void ExpressionCodeGenerator::OnVisitUnaryOperatorNode(
 
 void ExpressionCodeGenerator::OnVisitSubExpressionNode(
     SubExpressionNode& node) {
+  if (GenerateConstantCode(node)) return;
+
   output += "(";
   node.expression->Visit(*this);
   output += ")";
@@ -153,7 +203,7 @@ void ExpressionCodeGenerator::OnVisitVariableNode(VariableNode& node) {
   } else {
     // The node represents a variable or an object variable in an expression waiting for its *value* to be returned.
 
-    codeGenerator.GetProjectScopedContainers().MatchIdentifierWithName<void>(node.name, [&](){
+    codeGenerator.GetProjectScopedContainers().MatchIdentifierWithName<void>(node, node.name, [&](){
       // Generate the code to access the object variables.
 
       // Defer generation of the access to the object and variable to the child,
@@ -209,6 +259,7 @@ void ExpressionCodeGenerator::OnVisitVariableBracketAccessorNode(
   }
 
   ExpressionCodeGenerator generator("number|string", "", codeGenerator, context);
+  generator.constantFolder = constantFolder;
   node.expression->Visit(generator);
   output +=
       codeGenerator.GenerateVariableBracketAccessor(generator.GetOutput());
@@ -252,7 +303,7 @@ void ExpressionCodeGenerator::OnVisitIdentifierNode(IdentifierNode& node) {
     const auto& parametersVectorsList = codeGenerator.GetProjectScopedContainers().GetParametersVectorsList();
 
     // The node represents a variable, property, parameter or an object.
-    codeGenerator.GetProjectScopedContainers().MatchIdentifierWithName<void>(node.identifierName, [&]() {
+    codeGenerator.GetProjectScopedContainers().MatchIdentifierWithName<void>(node, node.identifierName, [&]() {
       // Generate the code to access the object variable.
       output += codeGenerator.GenerateGetVariable(
           node.childIdentifierName, gd::EventsCodeGenerator::OBJECT_VARIABLE,
@@ -283,6 +334,8 @@ void ExpressionCodeGenerator::OnVisitIdentifierNode(IdentifierNode& node) {
 }
 
 void ExpressionCodeGenerator::OnVisitFunctionCallNode(FunctionCallNode& node) {
+  if (GenerateConstantCode(node)) return;
+
   auto type = gd::ExpressionTypeFinder::GetType(codeGenerator.GetPlatform(),
                                             codeGenerator.GetProjectScopedContainers(),
                                             rootType,
@@ -290,7 +343,7 @@ void ExpressionCodeGenerator::OnVisitFunctionCallNode(FunctionCallNode& node) {
 
   const gd::ExpressionMetadata &metadata = MetadataProvider::GetFunctionCallMetadata(
       codeGenerator.GetPlatform(),
-      codeGenerator.GetObjectsContainersList(),
+      codeGenerator.GetProjectScopedContainers(),
       node);
 
   if (gd::MetadataProvider::IsBadExpressionMetadata(metadata)) {
@@ -300,24 +353,31 @@ void ExpressionCodeGenerator::OnVisitFunctionCallNode(FunctionCallNode& node) {
     return;
   }
 
+  if (GenerateLoopInvariantCode(node, metadata)) return;
+
   if (!node.objectName.empty()) {
     if (!node.behaviorName.empty()) {
       output += GenerateBehaviorFunctionCode(type,
+                                             node.functionName,
                                              node.objectName,
                                              node.behaviorName,
                                              node.parameters,
                                              metadata);
     } else {
-      output += GenerateObjectFunctionCode(
-          type, node.objectName, node.parameters, metadata);
+      output += GenerateObjectFunctionCode(type,
+                                           node.functionName,
+                                           node.objectName,
+                                           node.parameters,
+                                           metadata);
     }
   } else {
-    output +=
-        GenerateFreeFunctionCode(node.parameters, metadata);
+    output += GenerateFreeFunctionCode(
+        node.functionName, node.parameters, metadata);
   }
 }
 
 gd::String ExpressionCodeGenerator::GenerateFreeFunctionCode(
+    const gd::String& functionName,
     const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
     const ExpressionMetadata& expressionMetadata) {
   codeGenerator.AddIncludeFiles(
@@ -329,15 +389,26 @@ gd::String ExpressionCodeGenerator::GenerateFreeFunctionCode(
         PrintParameters(parameters), codeGenerator, context);
   }
 
-  gd::String parametersCode =
-      GenerateParametersCodes(parameters, expressionMetadata, 0);
+  std::vector<gd::String> argumentsCode =
+      GenerateParametersCodesList(parameters, expressionMetadata, 0);
+
+  // Small functions made with events can be replaced by their body.
+  gd::String inlinedCallCode = codeGenerator.GenerateInlinedEventsFunctionCall(
+      functionName,
+      expressionMetadata.GetParameters(),
+      argumentsCode,
+      "",
+      "",
+      context);
+  if (!inlinedCallCode.empty()) return inlinedCallCode;
 
   return expressionMetadata.codeExtraInformation.functionCallName + "(" +
-         parametersCode + ")";
+         JoinParametersCodes(argumentsCode) + ")";
 }
 
 gd::String ExpressionCodeGenerator::GenerateObjectFunctionCode(
     const gd::String& type,
+    const gd::String& functionName,
     const gd::String& objectName,
     const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
     const ExpressionMetadata& expressionMetadata) {
@@ -351,7 +422,7 @@ gd::String ExpressionCodeGenerator::GenerateObjectFunctionCode(
   }
 
   // Prepare parameters
-  gd::String parametersCode = GenerateParametersCodes(
+  std::vector<gd::String> argumentsCode = GenerateParametersCodesList(
       parameters,
       expressionMetadata,
       // By convention, the first parameter is the object
@@ -362,6 +433,28 @@ gd::String ExpressionCodeGenerator::GenerateObjectFunctionCode(
   // Get object(s) concerned by function call
   std::vector<gd::String> realObjects =
       codeGenerator.GetObjectsContainersList().ExpandObjectName(objectName, context.GetCurrentObject());
+
+  // Small functions made with events can be replaced by their body.
+  if (realObjects.size() == 1) {
+    context.ObjectsListNeeded(realObjects[0]);
+
+    std::vector<gd::String> inlinedArgumentsCode(1);
+    inlinedArgumentsCode.insert(
+        inlinedArgumentsCode.end(), argumentsCode.begin(), argumentsCode.end());
+    gd::String inlinedCallCode = codeGenerator.GenerateInlinedEventsFunctionCall(
+        codeGenerator.GetObjectsContainersList().GetTypeOfObject(
+            realObjects[0]) +
+            gd::PlatformExtension::GetNamespaceSeparator() + functionName,
+        expressionMetadata.GetParameters(),
+        inlinedArgumentsCode,
+        realObjects[0],
+        "",
+        context);
+    if (!inlinedCallCode.empty()) return inlinedCallCode;
+  }
+
+  gd::String parametersCode = JoinParametersCodes(argumentsCode);
+
   for (std::size_t i = 0; i < realObjects.size(); ++i) {
     context.ObjectsListNeeded(realObjects[i]);
 
@@ -383,6 +476,7 @@ gd::String ExpressionCodeGenerator::GenerateObjectFunctionCode(
 }
 gd::String ExpressionCodeGenerator::GenerateBehaviorFunctionCode(
     const gd::String& type,
+    const gd::String& functionName,
     const gd::String& objectName,
     const gd::String& behaviorName,
     const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
@@ -397,7 +491,7 @@ gd::String ExpressionCodeGenerator::GenerateBehaviorFunctionCode(
   }
 
   // Prepare parameters
-  gd::String parametersCode = GenerateParametersCodes(
+  std::vector<gd::String> argumentsCode = GenerateParametersCodesList(
       parameters,
       expressionMetadata,
       // By convention, the first parameters are the object and behavior
@@ -410,6 +504,27 @@ gd::String ExpressionCodeGenerator::GenerateBehaviorFunctionCode(
   gd::String functionOutput = GenerateDefaultValue(type);
 
   gd::String behaviorType = codeGenerator.GetObjectsContainersList().GetTypeOfBehavior(behaviorName);
+
+  // Small functions made with events can be replaced by their body.
+  if (realObjects.size() == 1) {
+    context.ObjectsListNeeded(realObjects[0]);
+
+    std::vector<gd::String> inlinedArgumentsCode(2);
+    inlinedArgumentsCode.insert(
+        inlinedArgumentsCode.end(), argumentsCode.begin(), argumentsCode.end());
+    gd::String inlinedCallCode = codeGenerator.GenerateInlinedEventsFunctionCall(
+        behaviorType + gd::PlatformExtension::GetNamespaceSeparator() +
+            functionName,
+        expressionMetadata.GetParameters(),
+        inlinedArgumentsCode,
+        realObjects[0],
+        behaviorName,
+        context);
+    if (!inlinedCallCode.empty()) return inlinedCallCode;
+  }
+
+  gd::String parametersCode = JoinParametersCodes(argumentsCode);
+
   const BehaviorMetadata& autoInfo = MetadataProvider::GetBehaviorMetadata(
       codeGenerator.GetPlatform(), behaviorType);
 
@@ -430,17 +545,27 @@ gd::String ExpressionCodeGenerator::GenerateBehaviorFunctionCode(
   return functionOutput;
 }
 
-gd::String ExpressionCodeGenerator::GenerateParametersCodes(
+gd::String ExpressionCodeGenerator::JoinParametersCodes(
+    const std::vector<gd::String>& parametersCodes) {
+  gd::String parametersCode;
+  for (std::size_t i = 0; i < parametersCodes.size(); ++i) {
+    if (i != 0) parametersCode += ", ";
+    parametersCode += parametersCodes[i];
+  }
+
+  return parametersCode;
+}
+
+std::vector<gd::String> ExpressionCodeGenerator::GenerateParametersCodesList(
     const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
     const ExpressionMetadata& expressionMetadata,
     size_t initialParameterIndex) {
   size_t nonCodeOnlyParameterIndex = 0;
-  gd::String parametersCode;
+  std::vector<gd::String> parametersCodes;
   for (std::size_t i = initialParameterIndex;
        i < expressionMetadata.GetParameters().GetParametersCount();
        ++i) {
-    if (i != initialParameterIndex) parametersCode += ", ";
-
+    gd::String parametersCode;
     auto& parameterMetadata = expressionMetadata.GetParameters().GetParameter(i);
     if (!parameterMetadata.IsCodeOnly()) {
       if (nonCodeOnlyParameterIndex < parameters.size()) {
@@ -449,6 +574,7 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
                                               rootObjectName,
                                               *parameters[nonCodeOnlyParameterIndex].get());
         ExpressionCodeGenerator generator(parameterMetadata.GetType(), objectName, codeGenerator, context);
+        generator.constantFolder = constantFolder;
         parameters[nonCodeOnlyParameterIndex]->Visit(generator);
         parametersCode += generator.GetOutput();
       } else if (parameterMetadata.IsOptional()) {
@@ -476,9 +602,10 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
                                                "",
                                                nullptr);
     }
+    parametersCodes.push_back(parametersCode);
   }
 
-  return parametersCode;
+  return parametersCodes;
 }
 
 std::vector<gd::Expression> ExpressionCodeGenerator::PrintParameters(
@@ -20,6 +20,7 @@ class ParameterMetadata;
 class ExpressionMetadata;
 class EventsCodeGenerationContext;
 class EventsCodeGenerator;
+class ExpressionConstantFolder;
 }  // namespace gd
 
 namespace gd {
@@ -30,6 +31,12 @@ namespace gd {
  * Almost all code generation is dedicated to the gd::EventsCodeGenerator,
  * so that it can be adapted to the target.
  *
+ * When used with GenerateExpressionCode, the parts of the expression having a
+ * value known before the game is run are replaced by this value (see
+ * gd::ExpressionConstantFolder). When the context is generating a loop (see
+ * gd::EventsCodeGenerationContext::HoistLoopInvariants), the calls to
+ * functions having a value that doesn't change are computed before the loop.
+ *
  * \see gd::ExpressionParser2
  */
 class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
@@ -81,24 +88,32 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
 
  private:
   gd::String GenerateFreeFunctionCode(
+      const gd::String& functionName,
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
       const ExpressionMetadata& expressionMetadata);
   gd::String GenerateObjectFunctionCode(
       const gd::String& type,
+      const gd::String& functionName,
       const gd::String& objectName,
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
       const ExpressionMetadata& expressionMetadata);
   gd::String GenerateBehaviorFunctionCode(
       const gd::String& type,
+      const gd::String& functionName,
       const gd::String& objectName,
       const gd::String& behaviorName,
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
       const ExpressionMetadata& expressionMetadata);
-  gd::String GenerateParametersCodes(
+  std::vector<gd::String> GenerateParametersCodesList(
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
       const ExpressionMetadata& expressionMetadata,
       size_t initialParameterIndex);
+  static gd::String JoinParametersCodes(
+      const std::vector<gd::String>& parametersCodes);
   gd::String GenerateDefaultValue(const gd::String& type);
+  bool GenerateConstantCode(const ExpressionNode& node);
+  bool GenerateLoopInvariantCode(FunctionCallNode& node,
+                                 const ExpressionMetadata& metadata);
   static std::vector<gd::Expression> PrintParameters(
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters);
 
@@ -108,6 +123,7 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
   EventsCodeGenerationContext& context;
   const gd::String rootType;
   const gd::String rootObjectName;
+  const ExpressionConstantFolder* constantFolder = nullptr;
 };
 
 }  // namespace gd
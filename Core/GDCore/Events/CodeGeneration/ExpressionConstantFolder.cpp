@@ -0,0 +1,319 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+
+namespace gd {
+
+namespace {
+
+bool ParseNumber(const std::string &str, double &number) {
+  std::istringstream stream(str);
+  stream.imbue(std::locale::classic());
+  stream >> number;
+  return !stream.fail() && stream.peek() == std::char_traits<char>::eof();
+}
+
+/**
+ * Return true if the number can be written as a literal (negative zero, NaN
+ * and infinities are not, or can't be computed the same way in C++ and JS).
+ */
+bool IsFoldable(double number) {
+  return std::isfinite(number) && !(number == 0 && std::signbit(number));
+}
+
+/**
+ * JavaScript Math.round: round half up (towards positive infinity).
+ */
+double RoundLikeJavaScript(double number) {
+  // number - floor(number) is exact, so this is correct even for numbers
+  // just below 0.5 (where floor(number + 0.5) would be wrong).
+  double floored = std::floor(number);
+  double rounded = number - floored >= 0.5 ? floored + 1 : floored;
+  return rounded == 0 && std::signbit(number) ? -0.0 : rounded;
+}
+
+/**
+ * Evaluate a call to a side-effect free function, if it's one for which the
+ * result is known to be the same as the one computed by the game engine.
+ */
+bool EvaluateFunction(const gd::String &functionName,
+                      const std::vector<double> &parameters,
+                      ExpressionConstantFolder::Constant &result) {
+  auto hasParameters = [&](std::size_t count) {
+    return parameters.size() == count;
+  };
+
+  if (functionName == "ToString" && hasParameters(1)) {
+    result.isText = true;
+    result.text = ExpressionConstantFolder::NumberToString(parameters[0]);
+    return true;
+  }
+
+  // Functions computed exactly as defined by IEEE 754, so giving the same
+  // result on any platform:
+  if (functionName == "abs" && hasParameters(1))
+    result.number = std::fabs(parameters[0]);
+  else if (functionName == "min" && hasParameters(2))
+    result.number = std::fmin(parameters[0], parameters[1]);
+  else if (functionName == "max" && hasParameters(2))
+    result.number = std::fmax(parameters[0], parameters[1]);
+  else if (functionName == "floor" && hasParameters(1))
+    result.number = std::floor(parameters[0]);
+  else if (functionName == "ceil" && hasParameters(1))
+    result.number = std::ceil(parameters[0]);
+  else if (functionName == "round" && hasParameters(1))
+    result.number = RoundLikeJavaScript(parameters[0]);
+  else if (functionName == "sqrt" && hasParameters(1))
+    result.number = std::sqrt(parameters[0]);
+  // Transcendental functions can differ by one ulp between math libraries:
+  // only their exact values are used.
+  else if ((functionName == "cos" || functionName == "exp") &&
+           hasParameters(1) && parameters[0] == 0)
+    result.number = 1;
+  else if ((functionName == "sin" || functionName == "tan") &&
+           hasParameters(1) && parameters[0] == 0)
+    result.number = 0;
+  else
+    return false;
+
+  result.isText = false;
+  return IsFoldable(result.number);
+}
+
+}  // namespace
+
+gd::String ExpressionConstantFolder::NumberToString(double number) {
+  if (number == 0) return "0";
+
+  // Find the shortest digits giving back the same number.
+  std::string scientific;
+  for (int precision = 1; precision <= 17; ++precision) {
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream.precision(precision - 1);
+    stream << std::scientific << std::fabs(number);
+    scientific = stream.str();
+
+    double parsedNumber = 0;
+    if (ParseNumber(scientific, parsedNumber) &&
+        parsedNumber == std::fabs(number))
+      break;
+  }
+
+  // Split "d.ddde+xx" into the digits and the decimal exponent.
+  std::size_t exponentPosition = scientific.find('e');
+  std::string digits;
+  for (std::size_t i = 0; i < exponentPosition; ++i) {
+    if (scientific[i] != '.') digits.push_back(scientific[i]);
+  }
+  while (digits.size() > 1 && digits.back() == '0') digits.pop_back();
+  int exponent = std::atoi(scientific.c_str() + exponentPosition + 1);
+
+  // Layout the digits as JavaScript does (see Number::toString in the
+  // ECMAScript specification).
+  int digitsCount = static_cast<int>(digits.size());
+  int pointPosition = exponent + 1;
+  std::string result = number < 0 ? "-" : "";
+  if (digitsCount <= pointPosition && pointPosition <= 21) {
+    result += digits + std::string(pointPosition - digitsCount, '0');
+  } else if (0 < pointPosition && pointPosition <= 21) {
+    result += digits.substr(0, pointPosition) + "." +
+              digits.substr(pointPosition);
+  } else if (-6 < pointPosition && pointPosition <= 0) {
+    result += "0." + std::string(-pointPosition, '0') + digits;
+  } else {
+    result += digits.substr(0, 1);
+    if (digitsCount > 1) result += "." + digits.substr(1);
+    result += exponent > 0 ? "e+" : "e-";
+    result += std::to_string(std::abs(exponent));
+  }
+
+  return gd::String::FromUTF8(result);
+}
+
+void ExpressionConstantFolder::SetNumber(const gd::ExpressionNode &node,
+                                         double number) {
+  if (!IsFoldable(number)) return;
+
+  Constant &constant = constants[&node];
+  constant.isText = false;
+  constant.number = number;
+}
+
+void ExpressionConstantFolder::SetText(const gd::ExpressionNode &node,
+                                       const gd::String &text) {
+  Constant &constant = constants[&node];
+  constant.isText = true;
+  constant.text = text;
+}
+
+void ExpressionConstantFolder::OnVisitSubExpressionNode(
+    SubExpressionNode &node) {
+  node.expression->Visit(*this);
+
+  const Constant *constant = GetConstant(*node.expression);
+  if (constant) constants[&node] = *constant;
+  if (IsInvariant(*node.expression)) invariants.insert(&node);
+}
+
+void ExpressionConstantFolder::OnVisitOperatorNode(OperatorNode &node) {
+  if (node.op == '+' || node.op == '-') {
+    FoldAdditionsChain(node);
+    return;
+  }
+
+  node.leftHandSide->Visit(*this);
+  node.rightHandSide->Visit(*this);
+  if (IsInvariant(*node.leftHandSide) && IsInvariant(*node.rightHandSide))
+    invariants.insert(&node);
+
+  const Constant *leftHandSide = GetConstant(*node.leftHandSide);
+  const Constant *rightHandSide = GetConstant(*node.rightHandSide);
+  if (!leftHandSide || !rightHandSide || leftHandSide->isText ||
+      rightHandSide->isText)
+    return;
+
+  if (node.op == '*')
+    SetNumber(node, leftHandSide->number * rightHandSide->number);
+  else if (node.op == '/')
+    SetNumber(node, leftHandSide->number / rightHandSide->number);
+}
+
+void ExpressionConstantFolder::FoldAdditionsChain(OperatorNode &node) {
+  // The parser builds "a + b - c" as "a + (b - c)", but the generated code
+  // is evaluated from left to right: "(a + b) - c". Only the whole chain is
+  // evaluated (and never a part of it), so that the result is the same.
+  std::vector<const ExpressionNode *> terms;
+  std::vector<gd::String::value_type> operators;
+  ExpressionNode *current = &node;
+  while (true) {
+    auto *operatorNode = dynamic_cast<OperatorNode *>(current);
+    if (!operatorNode || (operatorNode->op != '+' && operatorNode->op != '-'))
+      break;
+
+    operatorNode->leftHandSide->Visit(*this);
+    terms.push_back(operatorNode->leftHandSide.get());
+    operators.push_back(operatorNode->op);
+    current = operatorNode->rightHandSide.get();
+  }
+  current->Visit(*this);
+  terms.push_back(current);
+
+  bool areTermsInvariant = true;
+  for (const ExpressionNode *term : terms) {
+    if (!IsInvariant(*term)) areTermsInvariant = false;
+  }
+  if (areTermsInvariant) invariants.insert(&node);
+
+  const Constant *firstTerm = GetConstant(*terms[0]);
+  if (!firstTerm) return;
+
+  Constant result = *firstTerm;
+  for (std::size_t i = 1; i < terms.size(); ++i) {
+    const Constant *term = GetConstant(*terms[i]);
+    if (!term || term->isText != result.isText) return;
+
+    if (result.isText) {
+      if (operators[i - 1] != '+') return;
+      result.text += term->text;
+    } else if (operators[i - 1] == '+') {
+      result.number += term->number;
+    } else {
+      result.number -= term->number;
+    }
+  }
+
+  if (result.isText)
+    SetText(node, result.text);
+  else
+    SetNumber(node, result.number);
+}
+
+void ExpressionConstantFolder::OnVisitUnaryOperatorNode(
+    UnaryOperatorNode &node) {
+  node.factor->Visit(*this);
+  if (IsInvariant(*node.factor)) invariants.insert(&node);
+
+  const Constant *factor = GetConstant(*node.factor);
+  if (!factor || factor->isText) return;
+
+  if (node.op == '-')
+    SetNumber(node, -factor->number);
+  else if (node.op == '+')
+    SetNumber(node, factor->number);
+}
+
+void ExpressionConstantFolder::OnVisitNumberNode(NumberNode &node) {
+  invariants.insert(&node);
+
+  double number = 0;
+  if (ParseNumber(node.number.ToUTF8(), number)) SetNumber(node, number);
+}
+
+void ExpressionConstantFolder::OnVisitTextNode(TextNode &node) {
+  invariants.insert(&node);
+  SetText(node, node.text);
+}
+
+void ExpressionConstantFolder::OnVisitVariableNode(VariableNode &node) {
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitVariableAccessorNode(
+    VariableAccessorNode &node) {
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitVariableBracketAccessorNode(
+    VariableBracketAccessorNode &node) {
+  node.expression->Visit(*this);
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitFunctionCallNode(FunctionCallNode &node) {
+  std::vector<double> parameters;
+  bool areParametersConstantNumbers = true;
+  bool areParametersInvariant = true;
+  for (auto &parameter : node.parameters) {
+    parameter->Visit(*this);
+    if (!IsInvariant(*parameter)) areParametersInvariant = false;
+
+    const Constant *constant = GetConstant(*parameter);
+    if (!constant || constant->isText)
+      areParametersConstantNumbers = false;
+    else
+      parameters.push_back(constant->number);
+  }
+
+  if (!areParametersInvariant || !node.objectName.empty()) return;
+
+  const gd::ExpressionMetadata &metadata =
+      MetadataProvider::GetFunctionCallMetadata(platform, objectsContainersList,
+                                                node);
+  if (gd::MetadataProvider::IsBadExpressionMetadata(metadata) ||
+      !metadata.IsSideEffectFree())
+    return;
+
+  // Code generated in a custom way could depend on the context.
+  if (!metadata.HasCustomCodeGenerator()) invariants.insert(&node);
+  if (!areParametersConstantNumbers) return;
+
+  Constant result;
+  if (EvaluateFunction(node.functionName, parameters, result))
+    constants[&node] = result;
+}
+
+}  // namespace gd
@@ -0,0 +1,117 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class ObjectsContainersList;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the nodes of an expression having a value that is known before
+ * the game is run, so that the code generator can output this value instead
+ * of computing it each time the expression is evaluated.
+ *
+ * Operations between numbers, concatenations of texts and calls to
+ * side-effect free functions (see gd::ExpressionMetadata::IsSideEffectFree)
+ * with constant parameters are evaluated.
+ *
+ * Evaluation follows the JavaScript semantics. A result that can't be written
+ * as a literal (NaN, infinity or negative zero) is not folded, and only the
+ * functions for which the result is known to be exactly the same as the one
+ * of the game engine are evaluated.
+ *
+ * The nodes having a value that can't be known before the game is run, but
+ * that is the same each time the expression is evaluated, are also found
+ * (see IsInvariant).
+ *
+ * The expression is not modified: the values are stored for each node.
+ *
+ * \see gd::ExpressionCodeGenerator
+ */
+class GD_CORE_API ExpressionConstantFolder
+    : public ExpressionParser2NodeWorker {
+ public:
+  /**
+   * \brief The value of a constant node.
+   */
+  struct Constant {
+    bool isText = false;
+    double number = 0;
+    gd::String text;
+  };
+
+  ExpressionConstantFolder(
+      const gd::Platform &platform_,
+      const gd::ObjectsContainersList &objectsContainersList_)
+      : platform(platform_), objectsContainersList(objectsContainersList_){};
+  virtual ~ExpressionConstantFolder(){};
+
+  /**
+   * \brief Return the value of the node, or nullptr if its value is not
+   * known before the game is run (or if the node was not visited).
+   */
+  const Constant *GetConstant(const gd::ExpressionNode &node) const {
+    auto it = constants.find(&node);
+    return it == constants.end() ? nullptr : &it->second;
+  }
+
+  /**
+   * \brief Return true if the value of the node is the same each time the
+   * expression is evaluated: it's a constant, or it only uses constants and
+   * side-effect free functions (even the ones that can't be evaluated here).
+   *
+   * The code of these nodes can be generated once, before a loop, instead of
+   * at each iteration.
+   */
+  bool IsInvariant(const gd::ExpressionNode &node) const {
+    return invariants.find(&node) != invariants.end();
+  }
+
+  /**
+   * \brief Write the number like JavaScript does when converting a number to
+   * a string: using the shortest representation giving back the same number.
+   *
+   * \note The number must be finite.
+   */
+  static gd::String NumberToString(double number);
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override;
+  void OnVisitOperatorNode(OperatorNode &node) override;
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override;
+  void OnVisitNumberNode(NumberNode &node) override;
+  void OnVisitTextNode(TextNode &node) override;
+  void OnVisitVariableNode(VariableNode &node) override;
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override;
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override;
+  void OnVisitIdentifierNode(IdentifierNode &node) override{};
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override{};
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override;
+  void OnVisitEmptyNode(EmptyNode &node) override{};
+
+ private:
+  void FoldAdditionsChain(OperatorNode &node);
+  void SetNumber(const gd::ExpressionNode &node, double number);
+  void SetText(const gd::ExpressionNode &node, const gd::String &text);
+
+  const gd::Platform &platform;
+  const gd::ObjectsContainersList &objectsContainersList;
+  std::unordered_map<const gd::ExpressionNode *, Constant> constants;
+  std::unordered_set<const gd::ExpressionNode *> invariants;
+};
+
+}  // namespace gd
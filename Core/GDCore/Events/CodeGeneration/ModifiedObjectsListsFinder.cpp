@@ -0,0 +1,112 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ModifiedObjectsListsFinder.h"
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Project/ObjectsContainersList.h"
+
+namespace gd {
+
+bool ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+    const gd::Platform &platform,
+    const gd::ObjectsContainersList &objectsContainersList,
+    const gd::BaseEvent &event,
+    std::set<gd::String> &modifiedObjectsLists) {
+  if (event.IsDisabled() || !event.IsExecutable()) return true;
+
+  // Other events can pick objects without using instructions (like a "For
+  // each object" event), or can run code that is not known.
+  const gd::StandardEvent *standardEvent =
+      dynamic_cast<const gd::StandardEvent *>(&event);
+  if (!standardEvent) return false;
+
+  if (!FindModifiedObjectsListsInInstructions(platform,
+                                              objectsContainersList,
+                                              standardEvent->GetConditions(),
+                                              true,
+                                              modifiedObjectsLists) ||
+      !FindModifiedObjectsListsInInstructions(platform,
+                                              objectsContainersList,
+                                              standardEvent->GetActions(),
+                                              false,
+                                              modifiedObjectsLists))
+    return false;
+
+  // Sub-events are considered as modifying the lists too, as the last one
+  // can use the lists of its parent instead of copies.
+  const gd::EventsList &subEvents = standardEvent->GetSubEvents();
+  for (std::size_t i = 0; i < subEvents.size(); ++i) {
+    if (!FindModifiedObjectsLists(platform,
+                                  objectsContainersList,
+                                  subEvents[i],
+                                  modifiedObjectsLists))
+      return false;
+  }
+
+  return true;
+}
+
+bool ModifiedObjectsListsFinder::FindModifiedObjectsListsInInstructions(
+    const gd::Platform &platform,
+    const gd::ObjectsContainersList &objectsContainersList,
+    const gd::InstructionsList &instructions,
+    bool areConditions,
+    std::set<gd::String> &modifiedObjectsLists) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    const gd::Instruction &instruction = instructions[i];
+    const gd::InstructionMetadata &metadata =
+        areConditions ? gd::MetadataProvider::GetConditionMetadata(
+                            platform, instruction.GetType())
+                      : gd::MetadataProvider::GetActionMetadata(
+                            platform, instruction.GetType());
+    // Asynchronous actions keep the lists to use them once they are done.
+    if (gd::MetadataProvider::IsBadInstructionMetadata(metadata) ||
+        metadata.IsAsync())
+      return false;
+
+    for (std::size_t parameterIndex = 0;
+         parameterIndex < instruction.GetParametersCount() &&
+         parameterIndex < metadata.GetParametersCount();
+         ++parameterIndex) {
+      const gd::String &parameterType =
+          metadata.GetParameter(parameterIndex).GetType();
+      if (!gd::ParameterMetadata::IsObject(parameterType)) continue;
+
+      // Conditions pick the objects. Actions only iterate on them, unless
+      // they are given the whole list (to create objects in it or to pass it
+      // to a function) or unless their code is generated in a custom way.
+      bool isModified = areConditions || metadata.HasCustomCodeGenerator() ||
+                        (parameterType != "object" &&
+                         parameterType != "objectPtr");
+      if (!isModified) continue;
+
+      for (const gd::String &objectName :
+           objectsContainersList.ExpandObjectName(
+               instruction.GetParameter(parameterIndex).GetPlainString())) {
+        modifiedObjectsLists.insert(objectName);
+      }
+    }
+
+    if (!FindModifiedObjectsListsInInstructions(
+            platform,
+            objectsContainersList,
+            instruction.GetSubInstructions(),
+            areConditions,
+            modifiedObjectsLists))
+      return false;
+  }
+
+  return true;
+}
+
+}  // namespace gd
@@ -0,0 +1,59 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <set>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class InstructionsList;
+class ObjectsContainersList;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the objects lists that can be modified when the code generated
+ * for an event (its conditions, actions and sub-events) is run.
+ *
+ * Conditions pick objects, so they modify the lists of the objects they use.
+ * Actions only read the lists of their objects, unless they can add objects
+ * to them (like the actions creating objects) or give them to a function
+ * (which can pick objects).
+ *
+ * This is used by the code generation to let an event use the objects lists
+ * of its parent, instead of copies, when it does not modify them.
+ *
+ * \see gd::EventsCodeGenerationContext::ShareUnmodifiedObjectsListsWithParent
+ */
+class GD_CORE_API ModifiedObjectsListsFinder {
+ public:
+  /**
+   * \brief Find the objects lists that can be modified by the event.
+   *
+   * \return false if the modified lists can't be known (for example, for events
+   * other than standard events or using asynchronous actions): all the lists
+   * must then be considered as modified.
+   */
+  static bool FindModifiedObjectsLists(
+      const gd::Platform &platform,
+      const gd::ObjectsContainersList &objectsContainersList,
+      const gd::BaseEvent &event,
+      std::set<gd::String> &modifiedObjectsLists);
+
+ private:
+  static bool FindModifiedObjectsListsInInstructions(
+      const gd::Platform &platform,
+      const gd::ObjectsContainersList &objectsContainersList,
+      const gd::InstructionsList &instructions,
+      bool areConditions,
+      std::set<gd::String> &modifiedObjectsLists);
+};
+
+}  // namespace gd
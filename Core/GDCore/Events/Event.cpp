@@ -13,6 +13,7 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Tools/UUID/UUID.h"
 
 namespace gd {
 
@@ -26,7 +27,8 @@ BaseEvent::BaseEvent()
     : totalTimeDuringLastSession(0),
       percentDuringLastSession(0),
       disabled(false),
-      folded(false) {}
+      folded(false),
+      persistentUuid(UUID::MakeUuid4()) {}
 
 // Copy operations are user-defined because _memoryTracked must not be copied:
 // it registers the owning instance in MemoryTrackedRegistry.
@@ -37,7 +39,8 @@ BaseEvent::BaseEvent(const BaseEvent& other)
       folded(other.folded),
       disabled(other.disabled),
       type(other.type),
-      aiGeneratedEventId(other.aiGeneratedEventId) {}
+      aiGeneratedEventId(other.aiGeneratedEventId),
+      persistentUuid(other.persistentUuid) {}
 
 BaseEvent& BaseEvent::operator=(const BaseEvent& other) {
   if (this != &other) {
@@ -48,10 +51,22 @@ BaseEvent& BaseEvent::operator=(const BaseEvent& other) {
     disabled = other.disabled;
     type = other.type;
     aiGeneratedEventId = other.aiGeneratedEventId;
+    persistentUuid = other.persistentUuid;
   }
   return *this;
 }
 
+BaseEvent& BaseEvent::ResetPersistentUuid() {
+  persistentUuid = UUID::MakeUuid4();
+  if (CanHaveSubEvents()) {
+    gd::EventsList& subEvents = GetSubEvents();
+    for (std::size_t i = 0; i < subEvents.GetEventsCount(); ++i)
+      subEvents.GetEvent(i).ResetPersistentUuid();
+  }
+
+  return *this;
+}
+
 bool BaseEvent::HasSubEvents() const { return !GetSubEvents().IsEmpty(); }
 
 bool BaseEvent::HasVariables() const { return GetVariables().Count() > 0; }
@@ -67,14 +82,14 @@ gd::String BaseEvent::GenerateEventCode(
     const gd::Platform& platform = codeGenerator.GetPlatform();
 
     // First try to guess the extension used
-    gd::String eventNamespace = type.substr(0, type.find("::"));
+    gd::String eventNamespace = GetType().substr(0, GetType().find("::"));
     std::shared_ptr<gd::PlatformExtension> guessedExtension =
         platform.GetExtension(eventNamespace);
     if (guessedExtension) {
       std::map<gd::String, gd::EventMetadata>& allEvents =
           guessedExtension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].codeGeneration(*this, codeGenerator, context);
+      if (allEvents.find(GetType()) != allEvents.end())
+        return allEvents[GetType()].codeGeneration(*this, codeGenerator, context);
     }
 
     // Else make a search in all the extensions
@@ -86,12 +101,12 @@ gd::String BaseEvent::GenerateEventCode(
 
       std::map<gd::String, gd::EventMetadata>& allEvents =
           extension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].codeGeneration(*this, codeGenerator, context);
+      if (allEvents.find(GetType()) != allEvents.end())
+        return allEvents[GetType()].codeGeneration(*this, codeGenerator, context);
     }
   } catch (...) {
     std::cout << "ERROR: Exception caught during code generation for event \""
-              << type << "\"." << std::endl;
+              << GetType() << "\"." << std::endl;
   }
 
   return "";
@@ -139,14 +154,14 @@ void BaseEvent::Preprocess(gd::EventsCodeGenerator& codeGenerator,
     const gd::Platform& platform = codeGenerator.GetPlatform();
 
     // First try to guess the extension used
-    gd::String eventNamespace = type.substr(0, type.find("::"));
+    gd::String eventNamespace = GetType().substr(0, GetType().find("::"));
     std::shared_ptr<gd::PlatformExtension> guessedExtension =
         platform.GetExtension(eventNamespace);
     if (guessedExtension) {
       std::map<gd::String, gd::EventMetadata>& allEvents =
           guessedExtension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].preprocessing(
+      if (allEvents.find(GetType()) != allEvents.end())
+        return allEvents[GetType()].preprocessing(
             *this, codeGenerator, eventList, indexOfTheEventInThisList);
     }
 
@@ -159,13 +174,13 @@ void BaseEvent::Preprocess(gd::EventsCodeGenerator& codeGenerator,
 
       std::map<gd::String, gd::EventMetadata>& allEvents =
           extension->GetAllEvents();
-      if (allEvents.find(type) != allEvents.end())
-        return allEvents[type].preprocessing(
+      if (allEvents.find(GetType()) != allEvents.end())
+        return allEvents[GetType()].preprocessing(
             *this, codeGenerator, eventList, indexOfTheEventInThisList);
     }
   } catch (...) {
     std::cout << "ERROR: Exception caught during preprocessing of event \""
-              << type << "\"." << std::endl;
+              << GetType() << "\"." << std::endl;
   }
 }
 
@@ -14,6 +14,7 @@
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Project/MemoryTrackedRegistry.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 namespace gd {
 class EventsList;
 class Project;
@@ -282,12 +283,18 @@ class GD_CORE_API BaseEvent {
   /**
    * \brief Return the event type
    */
-  const gd::String& GetType() const { return type; };
+  const gd::String& GetType() const { return type.Get(); };
+
+  /**
+   * \brief Return the event type, as an interned string that can be compared
+   * and hashed in constant time.
+   */
+  const gd::InternedString& GetInternedType() const { return type; };
 
   /**
    * \brief Change the event type
    */
-  void SetType(gd::String type_) { type = type_; };
+  void SetType(const gd::String& type_) { type = type_; };
 
   /**
    * \brief Set if the event if disabled or not
@@ -323,6 +330,28 @@ class GD_CORE_API BaseEvent {
   const gd::String& GetAiGeneratedEventId() const {
     return aiGeneratedEventId;
   }
+
+  /**
+   * \brief Get the persistent UUID used to recognize the same event between
+   * serializations.
+   *
+   * It's created with the event and kept by its copies: duplicated events
+   * must be given a new one with ResetPersistentUuid.
+   */
+  const gd::String& GetPersistentUuid() const { return persistentUuid; }
+
+  /**
+   * \brief Set the persistent UUID of the event (used when unserializing it).
+   */
+  void SetPersistentUuid(const gd::String& persistentUuid_) {
+    persistentUuid = persistentUuid_;
+  }
+
+  /**
+   * \brief Reset the persistent UUID of the event and of its sub-events, so
+   * that a copy (for example pasted events) is not recognized as the original.
+   */
+  BaseEvent& ResetPersistentUuid();
   ///@}
 
   std::weak_ptr<gd::BaseEvent>
@@ -339,9 +368,12 @@ class GD_CORE_API BaseEvent {
  private:
   bool folded;  ///< True if the subevents should be hidden in the events editor
   bool disabled;    ///< True if the event is disabled and must not be executed
-  gd::String type;  ///< Type of the event. Must be assigned at the creation.
+  gd::InternedString type;  ///< Type of the event. Must be assigned at the creation.
                     ///< Used for saving the event for instance.
   gd::String aiGeneratedEventId;  ///< When generated by an AI/external tool.
+  gd::String persistentUuid;  ///< A persistent random version 4 UUID,
+                              ///< useful to recognize the event between
+                              ///< serializations.
 
   static gd::EventsList badSubEvents;
   static gd::VariablesContainer badLocalVariables;
@@ -116,6 +116,13 @@ bool EventsList::MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
   return false;
 }
 
+EventsList& EventsList::ResetPersistentUuid() {
+  for (std::size_t i = 0; i < GetEventsCount(); ++i)
+    events[i]->ResetPersistentUuid();
+
+  return *this;
+}
+
 EventsList::EventsList(const EventsList& other) { Init(other); }
 
 EventsList& EventsList::operator=(const EventsList& other) {
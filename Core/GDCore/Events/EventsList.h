@@ -161,6 +161,14 @@ class GD_CORE_API EventsList {
   bool MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
                                     gd::EventsList& newEventsList,
                                     std::size_t newPosition);
+
+  /**
+   * \brief Give new persistent UUIDs to all the events (and their sub-events),
+   * so that duplicated events are not recognized as the original ones.
+   *
+   * \see gd::BaseEvent::ResetPersistentUuid
+   */
+  EventsList& ResetPersistentUuid();
   ///@}
 
   /** \name std::vector API compatibility
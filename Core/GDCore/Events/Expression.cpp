@@ -11,6 +11,14 @@
 
 namespace gd {
 
+/**
+ * The nodes of an expression that are shared with the copies made after it
+ * was parsed.
+ */
+struct Expression::SharedNode {
+  std::unique_ptr<gd::ExpressionNode> node;
+};
+
 Expression::Expression() : node(nullptr) {};
 
 Expression::Expression(gd::String plainString_)
@@ -20,17 +28,20 @@ Expression::Expression(const char* plainString_)
     : node(nullptr), plainString(plainString_) {};
 
 Expression::Expression(const Expression& copy)
-    : node(nullptr), plainString{copy.plainString} {};
+    : node(nullptr),
+      plainString{copy.plainString},
+      sharedNode(copy.sharedNode) {};
 
 Expression& Expression::operator=(const Expression& expression) {
   plainString = expression.plainString;
   node = nullptr;
+  sharedNode = expression.sharedNode;
   return *this;
 };
 
 Expression::~Expression(){};
 
-ExpressionNode* Expression::GetRootNode() const {
+ExpressionNode* Expression::GetRootNode() {
   if (!node) {
     gd::ExpressionParser2 parser = ExpressionParser2();
     node = std::move(parser.ParseExpression(plainString));
@@ -38,4 +49,13 @@ ExpressionNode* Expression::GetRootNode() const {
   return node.get();
 }
 
+ExpressionNode* Expression::GetSharedRootNode() const {
+  if (!sharedNode) sharedNode = std::make_shared<SharedNode>();
+  if (!sharedNode->node) {
+    gd::ExpressionParser2 parser = ExpressionParser2();
+    sharedNode->node = parser.ParseExpression(plainString);
+  }
+  return sharedNode->node.get();
+}
+
 }  // namespace gd
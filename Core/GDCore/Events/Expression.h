@@ -23,6 +23,11 @@ namespace gd {
  * gd::Instruction. This class is nothing more than a wrapper around a
  * gd::String.
  *
+ * The expression is parsed when its nodes are first requested. The nodes
+ * returned by GetSharedRootNode are shared with the copies made after they
+ * were parsed, so that the expression is not parsed again when it's copied
+ * (for example, when events are copied for code generation).
+ *
  * \see gd::Instruction
  *
  * \ingroup Events
@@ -46,6 +51,9 @@ class GD_CORE_API Expression {
 
   /**
    * \brief Copy construct an expression.
+   *
+   * The nodes returned by GetSharedRootNode, if already parsed, are shared
+   * with the copy.
    */
   Expression(const Expression& copy);
 
@@ -61,9 +69,22 @@ class GD_CORE_API Expression {
 
   /**
    * @brief Get the expression node.
+   *
+   * The nodes are only owned by this expression and can be modified (for
+   * example, before printing them back to a new expression). Use
+   * GetSharedRootNode to only read them.
+   *
    * @return std::unique_ptr<gd::ExpressionNode>
    */
-  gd::ExpressionNode* GetRootNode() const;
+  gd::ExpressionNode* GetRootNode();
+
+  /**
+   * \brief Get the expression node, shared with the copies of this
+   * expression.
+   *
+   * \warning The nodes must not be modified: use GetRootNode for this.
+   */
+  gd::ExpressionNode* GetSharedRootNode() const;
 
   /**
    * \brief Mimics std::string::c_str
@@ -74,7 +95,12 @@ class GD_CORE_API Expression {
 
  private:
   gd::String plainString;  ///< The expression string
-  mutable std::unique_ptr<gd::ExpressionNode> node;
+  std::unique_ptr<gd::ExpressionNode> node;
+
+  struct SharedNode;
+  mutable std::shared_ptr<SharedNode>
+      sharedNode;  ///< The nodes that are never modified, shared with copies.
+                   ///< Only created when the expression is first parsed.
 };
 
 }  // namespace gd
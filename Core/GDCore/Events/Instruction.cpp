@@ -18,45 +18,70 @@ namespace gd {
 
 gd::Expression Instruction::badExpression("");
 
-Instruction::Instruction(gd::String type_) : type(type_), inverted(false) {
-  parameters.reserve(8);
+Instruction::Instruction(gd::String type_)
+    : type(type_),
+      inverted(false),
+      parameters(std::make_shared<std::vector<gd::Expression>>()) {
+  parameters->reserve(8);
 }
 
 Instruction::Instruction(gd::String type_,
                          const std::vector<gd::Expression>& parameters_,
                          bool inverted_)
-    : type(type_), inverted(inverted_), parameters(parameters_) {
-  parameters.reserve(8);
+    : type(type_),
+      inverted(inverted_),
+      parameters(std::make_shared<std::vector<gd::Expression>>(parameters_)) {
+  parameters->reserve(8);
+}
+
+std::vector<gd::Expression>& Instruction::GetParametersToModify() {
+  // Parameters are shared with the copies of the instruction: copy them
+  // before they are modified, so that the copies are not changed.
+  if (parameters.use_count() > 1)
+    parameters = std::make_shared<std::vector<gd::Expression>>(*parameters);
+
+  return *parameters;
 }
 
 const gd::Expression& Instruction::GetParameter(std::size_t index) const {
-  if (index >= parameters.size()) return badExpression;
+  if (index >= parameters->size()) return badExpression;
 
-  return parameters[index];
+  return (*parameters)[index];
 }
 
 gd::Expression& Instruction::GetParameter(std::size_t index) {
-  if (index >= parameters.size()) return badExpression;
+  if (index >= parameters->size()) return badExpression;
 
-  return parameters[index];
+  return GetParametersToModify()[index];
 }
 
 void Instruction::SetParametersCount(std::size_t size) {
-  while (size < parameters.size())
-    parameters.erase(parameters.begin() + parameters.size() - 1);
-  while (size > parameters.size()) parameters.push_back(gd::Expression(""));
+  if (size == parameters->size()) return;
+
+  std::vector<gd::Expression>& parametersToModify = GetParametersToModify();
+  while (size < parametersToModify.size())
+    parametersToModify.erase(parametersToModify.begin() +
+                             parametersToModify.size() - 1);
+  while (size > parametersToModify.size())
+    parametersToModify.push_back(gd::Expression(""));
 }
 
 void Instruction::SetParameter(std::size_t nb, const gd::Expression& val) {
-  if (nb >= parameters.size()) {
+  if (nb >= parameters->size()) {
     std::cout << "Trying to write an out of bound parameter.\n\n" << std::endl;
     return;
   }
-  parameters[nb] = val;
+  GetParametersToModify()[nb] = val;
 }
 
 void Instruction::AddParameter(const gd::Expression& val) {
-  parameters.push_back(val);
+  GetParametersToModify().push_back(val);
+}
+
+void Instruction::SetParameters(const std::vector<gd::Expression>& val) {
+  // Replace the vector rather than its content, as it can be shared with
+  // copies of the instruction.
+  parameters = std::make_shared<std::vector<gd::Expression>>(val);
 }
 
 std::shared_ptr<Instruction> GD_CORE_API
@@ -11,6 +11,7 @@
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 
 namespace gd {
 
@@ -23,6 +24,13 @@ namespace gd {
  * can have sub instructions. This class does nothing particular except storing
  * these data.
  *
+ * The parameters are shared between an instruction and its copies, until one
+ * of them modifies them (copy-on-write): copying events is cheap as long as
+ * their parameters are only read.
+ * \warning Don't keep a reference to a parameter obtained by the non-const
+ * GetParameter across a copy of the instruction, as it would be shared with
+ * the copy.
+ *
  * \see gd::BaseEvent
  *
  * \ingroup Events
@@ -52,7 +60,13 @@ class GD_CORE_API Instruction {
    * \brief Return the type of the instruction.
    * \return The type of the instruction
    */
-  const gd::String& GetType() const { return type; }
+  const gd::String& GetType() const { return type.Get(); }
+
+  /**
+   * \brief Return the type of the instruction, as an interned string that can
+   * be compared and hashed in constant time.
+   */
+  const gd::InternedString& GetInternedType() const { return type; }
 
   /**
    * \brief Change the instruction type
@@ -60,6 +74,12 @@ class GD_CORE_API Instruction {
    */
   void SetType(const gd::String& newType) { type = newType; }
 
+  /**
+   * \brief Change the instruction type
+   * \param val The new type of the instruction
+   */
+  void SetType(const gd::InternedString& newType) { type = newType; }
+
   /**
    * \brief Return true if the condition is inverted
    * \return true if the condition is inverted
@@ -91,7 +111,7 @@ class GD_CORE_API Instruction {
   /**
    * \brief Return the number of parameters of the instruction.
    */
-  std::size_t GetParametersCount() const { return parameters.size(); }
+  std::size_t GetParametersCount() const { return parameters->size(); }
 
   /**
    * \brief Change the number of parameter of the instruction.
@@ -113,6 +133,8 @@ class GD_CORE_API Instruction {
    * \brief Get the value of a parameter.
    *
    * Return an empty expression if the parameter requested does not exists.
+   * \note The parameters are detached from the copies of the instruction, so
+   * that the expression can be modified.
    * \return The current value of the parameter.
    */
   gd::Expression& GetParameter(std::size_t index);
@@ -132,15 +154,13 @@ class GD_CORE_API Instruction {
    * \return A std::vector containing the parameters
    */
   inline const std::vector<gd::Expression>& GetParameters() const {
-    return parameters;
+    return *parameters;
   }
 
   /** \brief Replace all the parameters by new ones.
    * \param val A vector containing the new parameters.
    */
-  inline void SetParameters(const std::vector<gd::Expression>& val) {
-    parameters = val;
-  }
+  void SetParameters(const std::vector<gd::Expression>& val);
 
   /**
    * \brief Return a reference to the vector containing sub instructions
@@ -168,14 +188,21 @@ class GD_CORE_API Instruction {
       std::shared_ptr<Instruction> instruction);
 
  private:
-  gd::String type;  ///< Instruction type
+  /**
+   * \brief Return the parameters, after copying them if they are shared with
+   * copies of this instruction.
+   */
+  std::vector<gd::Expression>& GetParametersToModify();
+
+  gd::InternedString type;  ///< Instruction type
   bool inverted;  ///< True if the instruction if inverted. Only applicable for
                   ///< instruction used as conditions by events
   bool awaitAsync =
       false;  ///< Tells the code generator whether the optionally asynchronous
               ///< instruction should be generated as asynchronous (awaited) or not.
-  mutable std::vector<gd::Expression>
-      parameters;                        ///< Vector containing the parameters
+  std::shared_ptr<std::vector<gd::Expression>>
+      parameters;  ///< Vector containing the parameters, shared with the
+                   ///< copies of the instruction until one is modified.
   gd::InstructionsList subInstructions;  ///< Sub instructions, if applicable.
 
   std::weak_ptr<Instruction>
@@ -10,6 +10,7 @@
 
 #include "ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 namespace gd {
 class Expression;
@@ -94,6 +95,75 @@ private:
   gd::String actualValue;
 };
 
+/**
+ * \brief The results of the analysis of a gd::ExpressionNode, stored in the
+ * node to avoid computing them again.
+ *
+ * The results are only valid for the version of the scope they were computed
+ * in (see gd::ProjectScopedContainers::GetVersion). The type, the metadata and
+ * the validation also depend on the extensions of the platform, so they are
+ * only valid for its generation (see gd::Platform::GetGeneration).
+ */
+struct GD_CORE_API ExpressionNodeCache {
+  /**
+   * \brief What an identifier refers to.
+   *
+   * \see gd::ProjectScopedContainers::MatchIdentifierWithName
+   */
+  enum IdentifierKind {
+    Unresolved,
+    Object,
+    Variable,
+    Property,
+    Parameter,
+    NotFound,
+  };
+
+  ExpressionNodeCache(std::size_t scopeVersion_)
+      : scopeVersion(scopeVersion_),
+        platformGeneration(0),
+        hasType(false),
+        metadata(nullptr),
+        identifierKind(Unresolved),
+        isValidated(false),
+        hasFatalErrors(false),
+        hasErrors(false){};
+
+  /**
+   * \brief Forget the results depending on the extensions of the platform.
+   */
+  void ClearPlatformResults(std::size_t platformGeneration_) {
+    platformGeneration = platformGeneration_;
+    hasType = false;
+    metadata = nullptr;
+    isValidated = false;
+    hasFatalErrors = false;
+    hasErrors = false;
+  }
+
+  std::size_t scopeVersion;
+  std::size_t platformGeneration;
+
+  bool hasType;
+  gd::String typeRootType;
+  gd::String type;  ///< The type of the node (see gd::ExpressionTypeFinder),
+                    ///< for typeRootType.
+
+  const gd::ExpressionMetadata *metadata;  ///< The metadata of a function
+                                           ///< call, if already found.
+
+  gd::String identifierName;
+  IdentifierKind identifierKind;  ///< What identifierName refers to.
+
+  bool isValidated;
+  gd::String validationRootType;
+  gd::String validationExtraInfo;
+  bool hasFatalErrors;  ///< True if gd::ExpressionValidator found fatal
+                        ///< errors in the node and its children, for
+                        ///< validationRootType and validationExtraInfo.
+  bool hasErrors;
+};
+
 /**
  * \brief The base node, from which all nodes in the tree of
  * an expression inherits from.
@@ -103,6 +173,32 @@ struct GD_CORE_API ExpressionNode {
   virtual ~ExpressionNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker){};
 
+  /**
+   * \brief Return the results of the analysis of the node, emptied if they
+   * were computed for another version of the scope.
+   */
+  ExpressionNodeCache &GetCache(std::size_t scopeVersion) const {
+    if (!cache)
+      cache = gd::make_unique<ExpressionNodeCache>(scopeVersion);
+    else if (cache->scopeVersion != scopeVersion)
+      *cache = ExpressionNodeCache(scopeVersion);
+    return *cache;
+  }
+
+  /**
+   * \brief Return the results of the analysis of the node, emptied if they
+   * were computed for another version of the scope, or without the results
+   * depending on the platform if they were computed for another generation of
+   * the platform.
+   */
+  ExpressionNodeCache &GetCache(std::size_t scopeVersion,
+                                std::size_t platformGeneration) const {
+    ExpressionNodeCache &scopeCache = GetCache(scopeVersion);
+    if (scopeCache.platformGeneration != platformGeneration)
+      scopeCache.ClearPlatformResults(platformGeneration);
+    return scopeCache;
+  }
+
   std::unique_ptr<ExpressionParserError> diagnostic;
   ExpressionParserLocation location;  ///< The location of the entire node. Some
                                       /// nodes might have other locations
@@ -111,6 +207,9 @@ struct GD_CORE_API ExpressionNode {
                                       /// object name, the dot, the function
                                       /// name, etc...
   ExpressionNode *parent;
+
+ private:
+  mutable std::unique_ptr<ExpressionNodeCache> cache;
 };
 
 struct GD_CORE_API SubExpressionNode : public ExpressionNode {
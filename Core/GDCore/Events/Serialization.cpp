@@ -223,6 +223,9 @@ void EventsListSerialization::UnserializeEventsFrom(
     event->SetFolded(eventElem.GetBoolAttribute("folded", false));
     event->SetAiGeneratedEventId(
         eventElem.GetStringAttribute("aiGeneratedEventId", ""));
+    // Events saved without a UUID keep the one created with them.
+    if (eventElem.HasAttribute("persistentUuid"))
+      event->SetPersistentUuid(eventElem.GetStringAttribute("persistentUuid"));
 
     list.InsertEvent(event, list.GetEventsCount());
   }
@@ -242,6 +245,8 @@ void EventsListSerialization::SerializeEventsTo(const EventsList& list,
       eventElem.SetAttribute("folded", event.IsFolded());
     if (!event.GetAiGeneratedEventId().empty())
       eventElem.SetAttribute("aiGeneratedEventId", event.GetAiGeneratedEventId());
+    if (!event.GetPersistentUuid().empty())
+      eventElem.SetAttribute("persistentUuid", event.GetPersistentUuid());
     eventElem.AddChild("type").SetValue(event.GetType());
 
     event.SerializeTo(eventElem);
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_COMMONINSTRUCTIONSEXTENSION_H
 #define GDCORE_COMMONINSTRUCTIONSEXTENSION_H
+#include "GDCore/Extensions/ExtensionBindingsRegistry.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 
 namespace gd {
@@ -50,6 +51,14 @@ class GD_CORE_API BuiltinExtensionsImplementer {
   static void ImplementsEffectExtension(gd::PlatformExtension& extension);
   static void ImplementsOpacityExtension(gd::PlatformExtension& extension);
   static void ImplementsTextContainerExtension(gd::PlatformExtension& extension);
+
+  /**
+   * \brief Register the event instances, object creation functions and
+   * behavior instances of the builtin extensions, so that they can be bound
+   * to extensions restored from a gd::PlatformMetadataSnapshot.
+   */
+  static void AddBuiltinExtensionsBindings(
+      gd::ExtensionBindingsRegistry& registry);
 };
 
 }  // namespace gd
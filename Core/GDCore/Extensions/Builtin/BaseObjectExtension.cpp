@@ -96,7 +96,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   obj.AddAction("SetX",
                 _("X position"),
@@ -109,7 +111,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardOperatorParameters("number",
                                      ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsPure();
 
   // Compatibility with GD <= 5.6.251
   obj.AddDuplicatedAction("MettreX", "SetX").SetHidden();
@@ -126,7 +129,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   obj.AddAction("SetY",
                 _("Y position"),
@@ -139,7 +144,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardOperatorParameters("number",
                                      ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsPure();
 
   // Compatibility with GD <= 5.6.251
   obj.AddDuplicatedAction("MettreY", "SetY").SetHidden();
@@ -304,7 +310,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .UseStandardOperatorParameters(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
-              _("Angle (in degrees)")));
+              _("Angle (in degrees)")))
+      .MarkAsPure();
 
   obj.AddAction("Rotate",
                 _("Rotate"),
@@ -318,7 +325,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("expression", _("Angular speed (in degrees per second)"))
       .AddCodeOnlyParameter("currentScene", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsPure();
 
   obj.AddAction(
          "RotateTowardAngle",
@@ -569,7 +577,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
       .SetHelpPath("/all-features/variables/object-variables/")
-      .SetRelevantForLayoutEventsOnly();
+      .SetRelevantForLayoutEventsOnly()
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   obj.AddCondition("StringObjectVariable",
                    _("Object variable value"),
@@ -584,7 +594,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .UseStandardRelationalOperatorParameters(
           "string", ParameterOptions::MakeNewOptions())
       .SetHelpPath("/all-features/variables/object-variables/")
-      .SetRelevantForLayoutEventsOnly();
+      .SetRelevantForLayoutEventsOnly()
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   obj.AddCondition("BooleanObjectVariable",
                    _("Object variable value"),
@@ -601,7 +613,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       // when the editor switch between variable instructions.
       .AddCodeOnlyParameter("yesorno", _("Value"))
       .SetHelpPath("/all-features/variables/object-variables/")
-      .SetRelevantForLayoutEventsOnly();
+      .SetRelevantForLayoutEventsOnly()
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   obj.AddAction("ModVarObjet",
                 _("Change number variable"),
@@ -714,7 +728,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                 "res/actions/visibilite.png")
 
       .AddParameter("object", _("Object"))
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsPure();
 
   // Compatibility with GD <= 5.6.251
   obj.AddDuplicatedAction("Cache", "Hide").SetHidden();
@@ -730,7 +745,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
 
       .AddParameter("object", _("Object"))
       .AddCodeOnlyParameter("inlineCode", "false")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsPure();
 
   // Compatibility with GD <= 5.6.251
   obj.AddDuplicatedAction("Montre", "Show").SetHidden();
@@ -1988,7 +2004,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                     true)
       .SetDefaultValue("no")
       .SetHelpPath("/all-features/collisions/")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .SetEvaluationCost(gd::InstructionMetadata::Expensive)
+      .MarkAsPure();
 
   extension
       .AddCondition("EstTourne",
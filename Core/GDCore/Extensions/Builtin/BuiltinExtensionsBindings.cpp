@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "AllBuiltinExtensions.h"
+#include "GDCore/Events/Builtin/AsyncEvent.h"
+#include "GDCore/Events/Builtin/CommentEvent.h"
+#include "GDCore/Events/Builtin/ElseEvent.h"
+#include "GDCore/Events/Builtin/ForEachChildVariableEvent.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/RepeatEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Builtin/WhileEvent.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/BehaviorsSharedData.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Tools/MakeUnique.h"
+
+namespace gd {
+
+void GD_CORE_API BuiltinExtensionsImplementer::AddBuiltinExtensionsBindings(
+    gd::ExtensionBindingsRegistry& registry) {
+  registry.AddBindings("BuiltinObject", [](gd::PlatformExtension& extension) {
+    extension.SetObjectCreationFunction(
+        "", []() -> std::unique_ptr<gd::ObjectConfiguration> {
+          return gd::make_unique<gd::ObjectConfiguration>();
+        });
+  });
+  registry.AddBindings("Sprite", [](gd::PlatformExtension& extension) {
+    extension.SetObjectCreationFunction(
+        "Sprite", []() -> std::unique_ptr<gd::ObjectConfiguration> {
+          return gd::make_unique<gd::SpriteObject>();
+        });
+  });
+
+  registry.AddBindings("BuiltinAsync", [](gd::PlatformExtension& extension) {
+    extension.SetEventInstance(extension.GetNameSpace() + "Async",
+                               std::make_shared<gd::AsyncEvent>());
+  });
+  registry.AddBindings(
+      "BuiltinCommonInstructions", [](gd::PlatformExtension& extension) {
+        const gd::String& nameSpace = extension.GetNameSpace();
+        extension
+            .SetEventInstance(nameSpace + "Standard",
+                              std::make_shared<gd::StandardEvent>())
+            .SetEventInstance(nameSpace + "Else",
+                              std::make_shared<gd::ElseEvent>())
+            .SetEventInstance(nameSpace + "Link",
+                              std::make_shared<gd::LinkEvent>())
+            .SetEventInstance(nameSpace + "Comment",
+                              std::make_shared<gd::CommentEvent>())
+            .SetEventInstance(nameSpace + "While",
+                              std::make_shared<gd::WhileEvent>())
+            .SetEventInstance(nameSpace + "Repeat",
+                              std::make_shared<gd::RepeatEvent>())
+            .SetEventInstance(nameSpace + "ForEach",
+                              std::make_shared<gd::ForEachEvent>())
+            .SetEventInstance(nameSpace + "ForEachChildVariable",
+                              std::make_shared<gd::ForEachChildVariableEvent>())
+            .SetEventInstance(nameSpace + "Group",
+                              std::make_shared<gd::GroupEvent>());
+      });
+
+  // Capabilities are declared with the base behavior classes.
+  for (const gd::String& capability : {"Resizable",
+                                       "Scalable",
+                                       "Flippable",
+                                       "Animatable",
+                                       "Effect",
+                                       "Opacity",
+                                       "TextContainer"}) {
+    registry.AddBindings(
+        capability + "Capability",
+        [capability](gd::PlatformExtension& extension) {
+          extension.SetBehaviorInstances(
+              extension.GetNameSpace() + capability + "Behavior",
+              std::make_shared<gd::Behavior>(),
+              std::make_shared<gd::BehaviorsSharedData>());
+        });
+  }
+}
+
+}  // namespace gd
@@ -32,7 +32,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
                      _("Convert the text to a number"),
                      "",
                      "res/conditions/toujours24_black.png")
-      .AddParameter("string", _("Text to convert to a number"));
+      .AddParameter("string", _("Text to convert to a number"))
+      .SetSideEffectFree();
 
   extension
       .AddStrExpression("ToString",
@@ -40,7 +41,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
                         _("Convert the result of the expression to text"),
                         "",
                         "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Expression to be converted to text"));
+      .AddParameter("expression", _("Expression to be converted to text"))
+      .SetSideEffectFree();
 
   extension
       .AddStrExpression("LargeNumberToString",
@@ -49,7 +51,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
                           "without using the scientific notation"),
                         "",
                         "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Expression to be converted to text"));
+      .AddParameter("expression", _("Expression to be converted to text"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
@@ -58,7 +61,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
           _("Converts the angle, expressed in degrees, into radians"),
           "",
           "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Angle, in degrees"));
+      .AddParameter("expression", _("Angle, in degrees"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
@@ -67,7 +71,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
           _("Converts the angle, expressed in radians, into degrees"),
           "",
           "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Angle, in radians"));
+      .AddParameter("expression", _("Angle, in radians"))
+      .SetSideEffectFree();
 
   extension
       .AddStrExpression("ToJSON",
@@ -80,7 +80,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("Value"))
       .AddParameter("expression", _("Min"))
-      .AddParameter("expression", _("Max"));
+      .AddParameter("expression", _("Max"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("clamp",
@@ -90,7 +91,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("Value"))
       .AddParameter("expression", _("Min"))
-      .AddParameter("expression", _("Max"));
+      .AddParameter("expression", _("Max"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("AngleDifference",
@@ -99,7 +101,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("First angle, in degrees"))
-      .AddParameter("expression", _("Second angle, in degrees"));
+      .AddParameter("expression", _("Second angle, in degrees"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("AngleBetweenPositions",
@@ -110,7 +113,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
       .AddParameter("expression", _("First point X position"))
       .AddParameter("expression", _("First point Y position"))
       .AddParameter("expression", _("Second point X position"))
-      .AddParameter("expression", _("Second point Y position"));
+      .AddParameter("expression", _("Second point Y position"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("DistanceBetweenPositions",
@@ -121,7 +125,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
       .AddParameter("expression", _("First point X position"))
       .AddParameter("expression", _("First point Y position"))
       .AddParameter("expression", _("Second point X position"))
-      .AddParameter("expression", _("Second point Y position"));
+      .AddParameter("expression", _("Second point Y position"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("mod",
@@ -131,7 +136,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("x (as in x mod y)"))
-      .AddParameter("expression", _("y (as in x mod y)"));
+      .AddParameter("expression", _("y (as in x mod y)"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("min",
@@ -140,7 +146,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("First expression"))
-      .AddParameter("expression", _("Second expression"));
+      .AddParameter("expression", _("Second expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("max",
@@ -149,7 +156,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("First expression"))
-      .AddParameter("expression", _("Second expression"));
+      .AddParameter("expression", _("Second expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("abs",
@@ -158,7 +166,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "The absolute value of -8 is 8."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("acos",
@@ -167,7 +176,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "`ToDeg` allows to convert it to degrees."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("acosh",
@@ -175,7 +185,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic arccosine"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("asin",
@@ -184,12 +195,14 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "`ToDeg` allows to convert it to degrees."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "asinh", _("Arcsine"), _("Arcsine"), "", "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("atan",
@@ -198,7 +211,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "`ToDeg` allows to convert it to degrees."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("atan2",
@@ -207,7 +221,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Y"))
-      .AddParameter("expression", _("X"));
+      .AddParameter("expression", _("X"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("atanh",
@@ -215,12 +230,14 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic arctangent"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "cbrt", _("Cube root"), _("Cube root"), "", "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("ceil",
@@ -228,7 +245,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Round number up to an integer"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("ceilTo",
@@ -237,7 +255,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Expression"))
-      .AddParameter("expression", _("Expression"), "", true);
+      .AddParameter("expression", _("Expression"), "", true)
+      .SetSideEffectFree();
 
   extension
       .AddExpression("floor",
@@ -245,7 +264,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Round number down to an integer"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("floorTo",
@@ -254,7 +274,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Expression"))
-      .AddParameter("expression", _("Expression"), "", true);
+      .AddParameter("expression", _("Expression"), "", true)
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
@@ -264,7 +285,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
             "If you want to use degrees, use`ToRad`: `sin(ToRad(45))`."),
           "",
           "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("cosh",
@@ -272,7 +294,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic cosine"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("cot",
@@ -280,7 +303,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Cotangent of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("csc",
@@ -288,24 +312,28 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Cosecant of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "int", _("Round"), _("Round a number"), "", "res/mathfunction.png")
       .SetHidden()
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "rint", _("Round"), _("Round a number"), "", "res/mathfunction.png")
       .SetHidden()
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "round", _("Round"), _("Round a number"), "", "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("roundTo",
@@ -314,7 +342,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Number to Round"))
-      .AddParameter("expression", _("Decimal Places"), "", true);
+      .AddParameter("expression", _("Decimal Places"), "", true)
+      .SetSideEffectFree();
 
   extension
       .AddExpression("exp",
@@ -322,18 +351,21 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Exponential of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "log", _("Logarithm"), _("Logarithm"), "", "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "ln", _("Logarithm"), _("Logarithm"), "", "res/mathfunction.png")
       .SetHidden()
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("log2",
@@ -341,7 +373,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Base 2 Logarithm"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("log10",
@@ -349,7 +382,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Base-10 logarithm"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("nthroot",
@@ -358,7 +392,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Number"))
-      .AddParameter("expression", _("N"));
+      .AddParameter("expression", _("N"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("pow",
@@ -367,12 +402,14 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Number"))
-      .AddParameter("expression", _("The exponent (n in x^n)"));
+      .AddParameter("expression", _("The exponent (n in x^n)"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
           "sec", _("Secant"), _("Secant"), "", "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("sign",
@@ -380,7 +417,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Return the sign of a number (1,-1 or 0)"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
@@ -390,7 +428,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
             "If you want to use degrees, use`ToRad`: `sin(ToRad(45))`."),
           "",
           "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("sinh",
@@ -398,7 +437,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic sine"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("sqrt",
@@ -406,7 +446,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Square root of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
@@ -416,7 +457,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
             "If you want to use degrees, use`ToRad`: `tan(ToRad(45))`."),
           "",
           "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("tanh",
@@ -424,7 +466,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic tangent"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("trunc",
@@ -432,7 +475,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Truncate a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("lerp",
@@ -442,7 +486,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("a (in a+(b-a)*x)"))
       .AddParameter("expression", _("b (in a+(b-a)*x)"))
-      .AddParameter("expression", _("x (in a+(b-a)*x)"));
+      .AddParameter("expression", _("x (in a+(b-a)*x)"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
@@ -455,7 +500,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
           "",
           "res/mathfunction.png")
       .AddParameter("expression", _("Angle, in degrees"))
-      .AddParameter("expression", _("Distance"));
+      .AddParameter("expression", _("Distance"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression(
@@ -468,7 +514,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
           "",
           "res/mathfunction.png")
       .AddParameter("expression", _("Angle, in degrees"))
-      .AddParameter("expression", _("Distance"));
+      .AddParameter("expression", _("Distance"))
+      .SetSideEffectFree();
 
   extension
       .AddExpression("Pi",
@@ -476,7 +523,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("The number Pi (3.1415...)"),
                      "",
                      "res/mathfunction.png")
-      .SetHelpPath("/all-features/expressions");
+      .SetHelpPath("/all-features/expressions")
+      .SetSideEffectFree();
 
   extension
       .AddExpression("lerpAngle",
@@ -487,7 +535,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("Starting angle, in degrees"))
       .AddParameter("expression", _("Destination angle, in degrees"))
-      .AddParameter("expression", _("Interpolation value between 0 and 1."));
+      .AddParameter("expression", _("Interpolation value between 0 and 1."))
+      .SetSideEffectFree();
 }
 
 }  // namespace gd
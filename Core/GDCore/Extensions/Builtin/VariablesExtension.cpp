@@ -36,7 +36,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("variableOrPropertyOrParameter", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "number", ParameterOptions::MakeNewOptions());
+          "number", ParameterOptions::MakeNewOptions())
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   extension
       .AddCondition("StringVariable",
@@ -48,7 +50,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("variableOrPropertyOrParameter", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "string", ParameterOptions::MakeNewOptions());
+          "string", ParameterOptions::MakeNewOptions())
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   extension
       .AddCondition(
@@ -64,7 +68,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
       .SetDefaultValue("true")
       // This parameter allows to keep the operand expression
       // when the editor switch between variable instructions.
-      .AddCodeOnlyParameter("trueorfalse", "");
+      .AddCodeOnlyParameter("trueorfalse", "")
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
 
   extension
       .AddAction("SetNumberVariable",
@@ -0,0 +1,30 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/ExtensionBindingsRegistry.h"
+
+#include "GDCore/Extensions/PlatformExtension.h"
+
+namespace gd {
+
+ExtensionBindingsRegistry& ExtensionBindingsRegistry::AddBindings(
+    const gd::String& extensionName, Bindings bindings) {
+  bindingsByExtension[extensionName].push_back(bindings);
+  return *this;
+}
+
+bool ExtensionBindingsRegistry::HasBindings(
+    const gd::String& extensionName) const {
+  return bindingsByExtension.find(extensionName) != bindingsByExtension.end();
+}
+
+void ExtensionBindingsRegistry::BindTo(gd::PlatformExtension& extension) const {
+  auto it = bindingsByExtension.find(extension.GetName());
+  if (it == bindingsByExtension.end()) return;
+
+  for (const Bindings& bindings : it->second) bindings(extension);
+}
+
+}  // namespace gd
@@ -0,0 +1,59 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class PlatformExtension;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Registry of the functions binding, by extension name, what can't be
+ * serialized in an extension metadata: code generators, event instances,
+ * object creation functions and behavior instances.
+ *
+ * Extensions restored from a gd::PlatformMetadataSnapshot are bound with it.
+ *
+ * \see gd::PlatformExtension::SerializeTo
+ */
+class GD_CORE_API ExtensionBindingsRegistry {
+ public:
+  typedef std::function<void(gd::PlatformExtension&)> Bindings;
+
+  ExtensionBindingsRegistry(){};
+  virtual ~ExtensionBindingsRegistry(){};
+
+  /**
+   * \brief Register a function binding the extension with the given name.
+   *
+   * Several functions can be registered for the same extension (for instance
+   * the instances from GDCore and the code generators from a platform).
+   */
+  ExtensionBindingsRegistry& AddBindings(const gd::String& extensionName,
+                                         Bindings bindings);
+
+  /**
+   * \brief Check if at least a function is registered for the extension.
+   */
+  bool HasBindings(const gd::String& extensionName) const;
+
+  /**
+   * \brief Call all the functions registered for the extension.
+   */
+  void BindTo(gd::PlatformExtension& extension) const;
+
+ private:
+  std::map<gd::String, std::vector<Bindings>> bindingsByExtension;
+};
+
+}  // namespace gd
@@ -14,6 +14,7 @@
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/BehaviorsSharedData.h"
 #include "GDCore/Project/PropertyDescriptor.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/MakeUnique.h"
 #include "GDCore/Tools/Log.h"
@@ -35,13 +36,20 @@ BehaviorMetadata::BehaviorMetadata(
     std::shared_ptr<gd::BehaviorsSharedData> sharedDatasInstance_)
     : extensionNamespace(extensionNamespace_),
       className(className_),
-      iconFilename(icon24x24),
-      instance(instance_),
-      sharedDatasInstance(sharedDatasInstance_) {
+      iconFilename(icon24x24) {
   SetFullName(gd::String(fullname_));
   SetDescription(gd::String(description_));
   SetDefaultName(gd::String(defaultName_));
   SetGroup(group_);
+  SetInstances(nameWithNamespace, instance_, sharedDatasInstance_);
+}
+
+BehaviorMetadata& BehaviorMetadata::SetInstances(
+    const gd::String& nameWithNamespace,
+    std::shared_ptr<gd::Behavior> instance_,
+    std::shared_ptr<gd::BehaviorsSharedData> sharedDatasInstance_) {
+  instance = instance_;
+  sharedDatasInstance = sharedDatasInstance_;
 
   if (!instance) {
     gd::LogFatalError(
@@ -58,6 +66,74 @@ BehaviorMetadata::BehaviorMetadata(
     sharedDatasInstance->SetTypeName(nameWithNamespace);
     sharedDatasInstance->InitializeContent();
   }
+  return *this;
+}
+
+void BehaviorMetadata::SerializeTo(SerializerElement& element) const {
+  element.SetAttribute("fullName", fullname);
+  element.SetAttribute("defaultName", defaultName);
+  element.SetAttribute("description", description);
+  element.SetAttribute("group", group);
+  element.SetAttribute("iconFilename", iconFilename);
+  element.SetAttribute("helpPath", helpPath);
+  if (!objectType.empty()) element.SetAttribute("objectType", objectType);
+  if (!className.empty()) element.SetAttribute("className", className);
+  if (isPrivate) element.SetAttribute("private", true);
+  if (isHidden) element.SetAttribute("hidden", true);
+  if (!isRelevantForChildObjects)
+    element.SetAttribute("irrelevantForChildObjects", true);
+  if (isActivatedByDefaultInEditor)
+    element.SetAttribute("activatedByDefaultInEditor", true);
+  if (!openFullEditorLabel.empty())
+    element.SetAttribute("openFullEditorLabel", openFullEditorLabel);
+  element.SetAttribute("quickCustomizationVisibility",
+                       static_cast<int>(quickCustomizationVisibility));
+  if (sharedDatasInstance) element.SetAttribute("hasSharedData", true);
+
+  gd::SerializerElement& includeFilesElement = element.AddChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (const gd::String& includeFile : includeFiles)
+    includeFilesElement.AddChild("includeFile").SetStringValue(includeFile);
+  gd::SerializerElement& requiredFilesElement =
+      element.AddChild("requiredFiles");
+  requiredFilesElement.ConsiderAsArrayOf("requiredFile");
+  for (const gd::String& requiredFile : requiredFiles)
+    requiredFilesElement.AddChild("requiredFile").SetStringValue(requiredFile);
+}
+
+void BehaviorMetadata::UnserializeFrom(const gd::String& extensionNamespace_,
+                                       const SerializerElement& element) {
+  *this = BehaviorMetadata();
+  extensionNamespace = extensionNamespace_;
+  fullname = element.GetStringAttribute("fullName");
+  defaultName = element.GetStringAttribute("defaultName");
+  description = element.GetStringAttribute("description");
+  group = element.GetStringAttribute("group");
+  iconFilename = element.GetStringAttribute("iconFilename");
+  helpPath = element.GetStringAttribute("helpPath");
+  objectType = element.GetStringAttribute("objectType");
+  className = element.GetStringAttribute("className");
+  isPrivate = element.GetBoolAttribute("private");
+  isHidden = element.GetBoolAttribute("hidden");
+  isRelevantForChildObjects =
+      !element.GetBoolAttribute("irrelevantForChildObjects");
+  isActivatedByDefaultInEditor =
+      element.GetBoolAttribute("activatedByDefaultInEditor");
+  openFullEditorLabel = element.GetStringAttribute("openFullEditorLabel");
+  quickCustomizationVisibility =
+      static_cast<QuickCustomization::Visibility>(element.GetIntAttribute(
+          "quickCustomizationVisibility", QuickCustomization::Default));
+
+  const gd::SerializerElement& includeFilesElement =
+      element.GetChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (std::size_t i = 0; i < includeFilesElement.GetChildrenCount(); ++i)
+    includeFiles.push_back(includeFilesElement.GetChild(i).GetStringValue());
+  const gd::SerializerElement& requiredFilesElement =
+      element.GetChild("requiredFiles");
+  requiredFilesElement.ConsiderAsArrayOf("requiredFile");
+  for (std::size_t i = 0; i < requiredFilesElement.GetChildrenCount(); ++i)
+    requiredFiles.push_back(requiredFilesElement.GetChild(i).GetStringValue());
 }
 
 gd::InstructionMetadata& BehaviorMetadata::AddCondition(
@@ -70,17 +146,17 @@ gd::InstructionMetadata& BehaviorMetadata::AddCondition(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsBehaviorInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = conditionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
+  return metadata;
 }
 
 gd::InstructionMetadata& BehaviorMetadata::AddAction(
@@ -93,17 +169,17 @@ gd::InstructionMetadata& BehaviorMetadata::AddAction(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsBehaviorInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = actionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
+  return metadata;
 }
 
 gd::InstructionMetadata& BehaviorMetadata::AddScopedCondition(
@@ -116,17 +192,17 @@ gd::InstructionMetadata& BehaviorMetadata::AddScopedCondition(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsBehaviorInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = conditionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
+  return metadata;
 }
 
 gd::InstructionMetadata& BehaviorMetadata::AddScopedAction(
@@ -139,17 +215,17 @@ gd::InstructionMetadata& BehaviorMetadata::AddScopedAction(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsBehaviorInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = actionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
+  return metadata;
 }
 
 gd::ExpressionMetadata& BehaviorMetadata::AddExpression(
@@ -160,15 +236,16 @@ gd::ExpressionMetadata& BehaviorMetadata::AddExpression(
     const gd::String& smallicon) {
   // Be careful, behaviors expression do not have namespace (not necessary as
   // we refer to the behavior name in the expression).
-  expressionsInfos[name] = ExpressionMetadata("number",
-                                              extensionNamespace,
-                                              name,
-                                              fullname,
-                                              description,
-                                              group,
-                                              smallicon)
-                               .SetHelpPath(GetHelpPath());
-  return expressionsInfos[name];
+  gd::ExpressionMetadata& metadata = expressionsInfos[name];
+  metadata = ExpressionMetadata("number",
+                                extensionNamespace,
+                                name,
+                                fullname,
+                                description,
+                                group,
+                                smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::ExpressionMetadata& BehaviorMetadata::AddStrExpression(
@@ -179,15 +256,16 @@ gd::ExpressionMetadata& BehaviorMetadata::AddStrExpression(
     const gd::String& smallicon) {
   // Be careful, behaviors expression do not have namespace (not necessary as
   // we refer to the behavior name in the expression).
-  strExpressionsInfos[name] = ExpressionMetadata("string",
-                                                 extensionNamespace,
-                                                 name,
-                                                 fullname,
-                                                 description,
-                                                 group,
-                                                 smallicon)
-                                  .SetHelpPath(GetHelpPath());
-  return strExpressionsInfos[name];
+  gd::ExpressionMetadata& metadata = strExpressionsInfos[name];
+  metadata = ExpressionMetadata("string",
+                                extensionNamespace,
+                                name,
+                                fullname,
+                                description,
+                                group,
+                                smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::MultipleInstructionMetadata BehaviorMetadata::AddExpressionAndCondition(
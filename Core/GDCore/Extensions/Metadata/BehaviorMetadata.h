@@ -20,6 +20,7 @@ class MultipleInstructionMetadata;
 class InstructionMetadata;
 class ExpressionMetadata;
 class PropertyDescriptor;
+class SerializerElement;
 }  // namespace gd
 
 namespace gd {
@@ -373,6 +374,12 @@ class GD_CORE_API BehaviorMetadata : public InstructionOrExpressionContainerMeta
    */
   gd::BehaviorsSharedData* GetSharedDataInstance() const;
 
+  /**
+   * \brief Check if the behavior instance is set. It's not the case for
+   * unserialized metadata until SetInstances is called.
+   */
+  bool HasInstance() const { return instance != nullptr; }
+
   /**
    * \brief Called when the IDE wants to know about the custom shared properties
    * of the behavior.
@@ -382,6 +389,31 @@ class GD_CORE_API BehaviorMetadata : public InstructionOrExpressionContainerMeta
    */
   std::map<gd::String, gd::PropertyDescriptor> GetSharedProperties() const;
 
+  /**
+   * \brief Set the behavior and the shared data (if any) used as "blueprints"
+   * for the behaviors of this type.
+   */
+  BehaviorMetadata& SetInstances(
+      const gd::String& nameWithNamespace,
+      std::shared_ptr<gd::Behavior> instance,
+      std::shared_ptr<gd::BehaviorsSharedData> sharedDatasInstance);
+
+  /**
+   * \brief Serialize the information about the behavior.
+   *
+   * \note The actions, conditions and expressions of the behavior are
+   * serialized by gd::PlatformExtension::SerializeTo. The behavior and shared
+   * data instances can't be serialized and must be set again after
+   * unserializing the metadata (see SetInstances).
+   */
+  void SerializeTo(gd::SerializerElement& element) const;
+
+  /**
+   * \brief Unserialize the information about the behavior.
+   */
+  void UnserializeFrom(const gd::String& extensionNamespace,
+                       const gd::SerializerElement& element);
+
   /**
    * \brief Return a reference to a map containing the names of the actions
    * (as keys) and the metadata associated with (as values).
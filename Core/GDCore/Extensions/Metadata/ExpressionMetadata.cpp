@@ -6,6 +6,7 @@
 #include "ExpressionMetadata.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 
 namespace gd {
@@ -25,6 +26,7 @@ ExpressionMetadata::ExpressionMetadata(const gd::String& returnType_,
       smallIconFilename(smallicon_),
       extensionNamespace(extensionNamespace_),
       isPrivate(false),
+      isSideEffectFree(false),
       relevantContext("Any") {
 }
 
@@ -33,6 +35,66 @@ ExpressionMetadata& ExpressionMetadata::SetHidden() {
   return *this;
 }
 
+void ExpressionMetadata::SerializeTo(SerializerElement& element) const {
+  element.SetAttribute("returnType", returnType);
+  element.SetAttribute("fullName", fullname);
+  element.SetAttribute("description", description);
+  element.SetAttribute("group", group.Get());
+  element.SetAttribute("smallIconFilename", smallIconFilename.Get());
+  element.SetAttribute("helpPath", helpPath.Get());
+  element.SetAttribute("relevantContext", relevantContext.Get());
+  if (!requiredBaseObjectCapability.empty())
+    element.SetAttribute("requiredBaseObjectCapability",
+                         requiredBaseObjectCapability.Get());
+  if (!deprecationMessage.empty())
+    element.SetAttribute("deprecationMessage", deprecationMessage);
+  if (!shown) element.SetAttribute("hidden", true);
+  if (isPrivate) element.SetAttribute("private", true);
+  if (isSideEffectFree) element.SetAttribute("sideEffectFree", true);
+  parameters.SerializeParametersTo(element.AddChild("parameters"));
+
+  element.SetAttribute("functionName", codeExtraInformation.functionCallName);
+  if (codeExtraInformation.staticFunction)
+    element.SetAttribute("static", true);
+  if (codeExtraInformation.hasCustomCodeGenerator)
+    element.SetAttribute("customCodeGenerator", true);
+  gd::SerializerElement& includeFilesElement = element.AddChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (const gd::String& includeFile : codeExtraInformation.includeFiles)
+    includeFilesElement.AddChild("includeFile").SetStringValue(includeFile);
+}
+
+void ExpressionMetadata::UnserializeFrom(const gd::String& extensionNamespace_,
+                                         const SerializerElement& element) {
+  *this = ExpressionMetadata(element.GetStringAttribute("returnType"),
+                             extensionNamespace_,
+                             "",
+                             element.GetStringAttribute("fullName"),
+                             element.GetStringAttribute("description"),
+                             element.GetStringAttribute("group"),
+                             element.GetStringAttribute("smallIconFilename"));
+  helpPath = element.GetStringAttribute("helpPath");
+  relevantContext = element.GetStringAttribute("relevantContext");
+  requiredBaseObjectCapability =
+      element.GetStringAttribute("requiredBaseObjectCapability");
+  deprecationMessage = element.GetStringAttribute("deprecationMessage");
+  shown = !element.GetBoolAttribute("hidden");
+  isPrivate = element.GetBoolAttribute("private");
+  isSideEffectFree = element.GetBoolAttribute("sideEffectFree");
+  parameters.UnserializeParametersFrom(element.GetChild("parameters"));
+
+  codeExtraInformation.functionCallName =
+      element.GetStringAttribute("functionName");
+  codeExtraInformation.staticFunction = element.GetBoolAttribute("static");
+  // The custom code generator, if any, is bound after unserialization.
+  const gd::SerializerElement& includeFilesElement =
+      element.GetChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (std::size_t i = 0; i < includeFilesElement.GetChildrenCount(); ++i)
+    codeExtraInformation.includeFiles.push_back(
+        includeFilesElement.GetChild(i).GetStringValue());
+}
+
 gd::ExpressionMetadata& ExpressionMetadata::AddParameter(
     const gd::String& type,
     const gd::String& description,
@@ -13,8 +13,10 @@
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 namespace gd {
 class Layout;
+class SerializerElement;
 }
 
 namespace gd {
@@ -63,10 +65,19 @@ class GD_CORE_API ExpressionMetadata : public gd::AbstractFunctionMetadata {
    * to fulfill std::map requirements.
    */
   ExpressionMetadata()
-      : returnType("unknown"), shown(false), isPrivate(false), relevantContext("Any"){};
+      : returnType("unknown"),
+        shown(false),
+        isPrivate(false),
+        isSideEffectFree(false),
+        relevantContext("Any"){};
 
   virtual ~ExpressionMetadata(){};
 
+  ExpressionMetadata(const ExpressionMetadata &) = default;
+  ExpressionMetadata(ExpressionMetadata &&) = default;
+  ExpressionMetadata &operator=(const ExpressionMetadata &) = default;
+  ExpressionMetadata &operator=(ExpressionMetadata &&) = default;
+
   /**
    * \brief Set the expression as not shown in the IDE.
    */
@@ -130,6 +141,24 @@ class GD_CORE_API ExpressionMetadata : public gd::AbstractFunctionMetadata {
     return *this;
   }
 
+  /**
+   * Check if the expression is side-effect free: it only depends on its
+   * parameters, and calling it changes nothing.
+   */
+  bool IsSideEffectFree() const { return isSideEffectFree; }
+
+  /**
+   * Set that the expression is side-effect free: it only depends on its
+   * parameters, and calling it changes nothing. Its calls can then be
+   * evaluated during code generation when the parameters are constants.
+   *
+   * \see gd::ExpressionConstantFolder
+   */
+  ExpressionMetadata& SetSideEffectFree() {
+    isSideEffectFree = true;
+    return *this;
+  }
+
   /**
    * Check if the instruction can be used in layouts or external events.
    */
@@ -377,6 +406,21 @@ class GD_CORE_API ExpressionMetadata : public gd::AbstractFunctionMetadata {
 
   bool HasCustomCodeGenerator() const { return codeExtraInformation.hasCustomCodeGenerator; }
 
+  /**
+   * \brief Serialize the metadata, including the parameters and the
+   * information used for code generation.
+   *
+   * \note Like for instructions, only the fact that a custom code generator
+   * is set is stored.
+   */
+  void SerializeTo(gd::SerializerElement& element) const;
+
+  /**
+   * \brief Unserialize the metadata.
+   */
+  void UnserializeFrom(const gd::String& extensionNamespace,
+                       const gd::SerializerElement& element);
+
   /**
    * \brief Return the structure containing the information about code
    * generation for the expression.
@@ -393,15 +437,16 @@ class GD_CORE_API ExpressionMetadata : public gd::AbstractFunctionMetadata {
   gd::String returnType;
   gd::String fullname;
   gd::String description;
-  gd::String helpPath;
-  gd::String group;
+  gd::InternedString helpPath;
+  gd::InternedString group;
   bool shown;
 
-  gd::String smallIconFilename;
-  gd::String extensionNamespace;
+  gd::InternedString smallIconFilename;
+  gd::InternedString extensionNamespace;
   bool isPrivate;
-  gd::String requiredBaseObjectCapability;
-  gd::String relevantContext;
+  bool isSideEffectFree;
+  gd::InternedString requiredBaseObjectCapability;
+  gd::InternedString relevantContext;
   gd::String deprecationMessage;
 
   gd::ParameterMetadataContainer parameters;
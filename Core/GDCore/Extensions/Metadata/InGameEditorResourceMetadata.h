@@ -39,6 +39,18 @@ class GD_CORE_API InGameEditorResourceMetadata {
   const gd::String& GetFilePath() const { return relativeFilePath; };
   const gd::String& GetKind() const { return kind; };
 
+  void SerializeTo(SerializerElement& element) const {
+    element.SetAttribute("resourceName", resourceName);
+    element.SetAttribute("filePath", relativeFilePath);
+    element.SetAttribute("kind", kind);
+  }
+
+  void UnserializeFrom(const SerializerElement& element) {
+    resourceName = element.GetStringAttribute("resourceName");
+    relativeFilePath = element.GetStringAttribute("filePath");
+    kind = element.GetStringAttribute("kind");
+  }
+
  private:
   gd::String resourceName;
   gd::String relativeFilePath;
@@ -26,7 +26,9 @@ InstructionMetadata::InstructionMetadata()
       usageComplexity(5),
       isPrivate(false),
       isObjectInstruction(false),
-      isBehaviorInstruction(false) {}
+      isBehaviorInstruction(false),
+      evaluationCost(UnknownCost),
+      isPure(false) {}
 
 InstructionMetadata::InstructionMetadata(const gd::String& extensionNamespace_,
                                          const gd::String& name_,
@@ -50,8 +52,110 @@ InstructionMetadata::InstructionMetadata(const gd::String& extensionNamespace_,
       isPrivate(false),
       isObjectInstruction(false),
       isBehaviorInstruction(false),
+      evaluationCost(UnknownCost),
+      isPure(false),
       relevantContext("Any") {}
 
+void InstructionMetadata::SerializeTo(SerializerElement& element) const {
+  element.SetAttribute("fullName", fullname);
+  element.SetAttribute("description", description);
+  element.SetAttribute("sentence", sentence);
+  element.SetAttribute("group", group.Get());
+  element.SetAttribute("iconFilename", iconFilename.Get());
+  element.SetAttribute("smallIconFilename", smallIconFilename.Get());
+  element.SetAttribute("helpPath", helpPath.Get());
+  element.SetAttribute("relevantContext", relevantContext.Get());
+  if (!requiredBaseObjectCapability.empty())
+    element.SetAttribute("requiredBaseObjectCapability",
+                         requiredBaseObjectCapability.Get());
+  if (!deprecationMessage.empty())
+    element.SetAttribute("deprecationMessage", deprecationMessage);
+  if (!hint.empty()) element.SetAttribute("hint", hint);
+  element.SetAttribute("usageComplexity", usageComplexity);
+  if (canHaveSubInstructions)
+    element.SetAttribute("canHaveSubInstructions", true);
+  if (hidden) element.SetAttribute("hidden", true);
+  if (isPrivate) element.SetAttribute("private", true);
+  if (isObjectInstruction) element.SetAttribute("objectInstruction", true);
+  if (isBehaviorInstruction) element.SetAttribute("behaviorInstruction", true);
+  if (evaluationCost != UnknownCost)
+    element.SetAttribute("evaluationCost", static_cast<int>(evaluationCost));
+  if (isPure) element.SetAttribute("pure", true);
+  parameters.SerializeParametersTo(element.AddChild("parameters"));
+
+  element.SetAttribute("functionName", codeExtraInformation.functionCallName);
+  if (!codeExtraInformation.asyncFunctionCallName.empty())
+    element.SetAttribute("asyncFunctionName",
+                         codeExtraInformation.asyncFunctionCallName);
+  if (!codeExtraInformation.type.empty())
+    element.SetAttribute("manipulatedType", codeExtraInformation.type);
+  element.SetAttribute("accessType",
+                       static_cast<int>(codeExtraInformation.accessType));
+  if (!codeExtraInformation.optionalAssociatedInstruction.empty())
+    element.SetAttribute("getter",
+                         codeExtraInformation.optionalAssociatedInstruction);
+  if (!codeExtraInformation.optionalMutators.empty()) {
+    gd::SerializerElement& mutatorsElement = element.AddChild("mutators");
+    for (const auto& it : codeExtraInformation.optionalMutators)
+      mutatorsElement.SetAttribute(it.first, it.second);
+  }
+  if (codeExtraInformation.hasCustomCodeGenerator)
+    element.SetAttribute("customCodeGenerator", true);
+  gd::SerializerElement& includeFilesElement = element.AddChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (const gd::String& includeFile : codeExtraInformation.includeFiles)
+    includeFilesElement.AddChild("includeFile").SetStringValue(includeFile);
+}
+
+void InstructionMetadata::UnserializeFrom(
+    const gd::String& extensionNamespace_, const SerializerElement& element) {
+  *this = InstructionMetadata(extensionNamespace_,
+                              "",
+                              element.GetStringAttribute("fullName"),
+                              element.GetStringAttribute("description"),
+                              element.GetStringAttribute("sentence"),
+                              element.GetStringAttribute("group"),
+                              element.GetStringAttribute("iconFilename"),
+                              element.GetStringAttribute("smallIconFilename"));
+  helpPath = element.GetStringAttribute("helpPath");
+  relevantContext = element.GetStringAttribute("relevantContext");
+  requiredBaseObjectCapability =
+      element.GetStringAttribute("requiredBaseObjectCapability");
+  deprecationMessage = element.GetStringAttribute("deprecationMessage");
+  hint = element.GetStringAttribute("hint");
+  usageComplexity = element.GetIntAttribute("usageComplexity", 5);
+  canHaveSubInstructions = element.GetBoolAttribute("canHaveSubInstructions");
+  hidden = element.GetBoolAttribute("hidden");
+  isPrivate = element.GetBoolAttribute("private");
+  isObjectInstruction = element.GetBoolAttribute("objectInstruction");
+  isBehaviorInstruction = element.GetBoolAttribute("behaviorInstruction");
+  evaluationCost = static_cast<EvaluationCost>(
+      element.GetIntAttribute("evaluationCost", UnknownCost));
+  isPure = element.GetBoolAttribute("pure");
+  parameters.UnserializeParametersFrom(element.GetChild("parameters"));
+
+  codeExtraInformation.functionCallName =
+      element.GetStringAttribute("functionName");
+  codeExtraInformation.asyncFunctionCallName =
+      element.GetStringAttribute("asyncFunctionName");
+  codeExtraInformation.type = element.GetStringAttribute("manipulatedType");
+  codeExtraInformation.accessType = static_cast<ExtraInformation::AccessType>(
+      element.GetIntAttribute("accessType", ExtraInformation::Reference));
+  codeExtraInformation.optionalAssociatedInstruction =
+      element.GetStringAttribute("getter");
+  if (element.HasChild("mutators")) {
+    for (const auto& it : element.GetChild("mutators").GetAllAttributes())
+      codeExtraInformation.optionalMutators[it.first] = it.second.GetString();
+  }
+  // The custom code generator, if any, is bound after unserialization.
+  const gd::SerializerElement& includeFilesElement =
+      element.GetChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (std::size_t i = 0; i < includeFilesElement.GetChildrenCount(); ++i)
+    codeExtraInformation.includeFiles.push_back(
+        includeFilesElement.GetChild(i).GetStringValue());
+}
+
 InstructionMetadata& InstructionMetadata::AddParameter(
     const gd::String& type,
     const gd::String& description,
@@ -16,6 +16,7 @@
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Project/ParameterMetadataContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 #include "ParameterMetadata.h"
 #include "ParameterOptions.h"
 
@@ -58,6 +59,11 @@ class GD_CORE_API InstructionMetadata : public gd::AbstractFunctionMetadata {
 
   virtual ~InstructionMetadata(){};
 
+  InstructionMetadata(const InstructionMetadata &) = default;
+  InstructionMetadata(InstructionMetadata &&) = default;
+  InstructionMetadata &operator=(const InstructionMetadata &) = default;
+  InstructionMetadata &operator=(InstructionMetadata &&) = default;
+
   const gd::String &GetFullName() const { return fullname; }
   const gd::String &GetDescription() const { return description; }
   const gd::String &GetSentence() const { return sentence; }
@@ -432,6 +438,55 @@ class GD_CORE_API InstructionMetadata : public gd::AbstractFunctionMetadata {
    */
   int GetUsageComplexity() const { return usageComplexity; }
 
+  /**
+   * \brief The estimated cost of evaluating a condition.
+   */
+  enum EvaluationCost { UnknownCost, Cheap, Medium, Expensive };
+
+  /**
+   * \brief Set the estimated cost of evaluating the condition.
+   *
+   * \see MarkAsPure
+   */
+  InstructionMetadata &SetEvaluationCost(EvaluationCost evaluationCost_) {
+    evaluationCost = evaluationCost_;
+    return *this;
+  }
+
+  /**
+   * \brief Return the estimated cost of evaluating the condition.
+   */
+  EvaluationCost GetEvaluationCost() const { return evaluationCost; }
+
+  /**
+   * \brief Declare that the condition has no side effect, apart from picking
+   * the instances of its objects that verify it. For a condition with a single
+   * object, each instance must be checked independently of the others. A
+   * condition with several objects (like a collision) can pick the instances of
+   * each object depending on the instances of the other ones.
+   *
+   * For an action, declare that it only changes the instance it's run on, and
+   * does not read the other instances.
+   *
+   * Adjacent pure conditions can be evaluated by the generated code in another
+   * order than the one of the events, the cheapest ones first. Adjacent pure
+   * instructions run on the same object can be run in a single loop over its
+   * instances.
+   *
+   * \see SetEvaluationCost
+   */
+  InstructionMetadata &MarkAsPure() {
+    isPure = true;
+    return *this;
+  }
+
+  /**
+   * \brief Return true if the condition has no side effect, apart from picking
+   * the instances of its object (or if the action only changes the instance
+   * it's run on).
+   */
+  bool IsPure() const { return isPure; }
+
   /**
    * \brief Defines information about how generate the code for an instruction
    */
@@ -603,6 +658,22 @@ class GD_CORE_API InstructionMetadata : public gd::AbstractFunctionMetadata {
 
   bool HasCustomCodeGenerator() const { return codeExtraInformation.hasCustomCodeGenerator; }
 
+  /**
+   * \brief Serialize the metadata, including the parameters and the
+   * information used for code generation.
+   *
+   * \note The custom code generator is a function and can't be serialized:
+   * only the fact that one is set is stored. It must be set again after
+   * unserializing the metadata (see gd::ExtensionBindingsRegistry).
+   */
+  void SerializeTo(gd::SerializerElement &element) const;
+
+  /**
+   * \brief Unserialize the metadata.
+   */
+  void UnserializeFrom(const gd::String &extensionNamespace,
+                       const gd::SerializerElement &element);
+
   /**
    * \brief Return the structure containing the information about code
    * generation for the instruction.
@@ -616,21 +687,23 @@ class GD_CORE_API InstructionMetadata : public gd::AbstractFunctionMetadata {
  private:
   gd::String fullname;
   gd::String description;
-  gd::String helpPath;
+  gd::InternedString helpPath;
   gd::String sentence;
-  gd::String group;
-  gd::String iconFilename;
-  gd::String smallIconFilename;
+  gd::InternedString group;
+  gd::InternedString iconFilename;
+  gd::InternedString smallIconFilename;
   bool canHaveSubInstructions;
-  gd::String extensionNamespace;
+  gd::InternedString extensionNamespace;
   bool hidden;
   int usageComplexity;  ///< Evaluate the instruction from 0 (simple&easy to
                         ///< use) to 10 (complex to understand)
   bool isPrivate;
   bool isObjectInstruction;
   bool isBehaviorInstruction;
-  gd::String requiredBaseObjectCapability;
-  gd::String relevantContext;
+  EvaluationCost evaluationCost;
+  bool isPure;
+  gd::InternedString requiredBaseObjectCapability;
+  gd::InternedString relevantContext;
   gd::String deprecationMessage;
   gd::String hint;
 };
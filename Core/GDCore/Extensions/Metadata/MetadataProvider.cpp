@@ -15,11 +15,52 @@
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"  // For GetTypeOfObject and GetTypeOfBehavior
 #include "GDCore/Project/ObjectsContainersList.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/String.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 
 using namespace std;
 
+namespace {
+int GetParameterIndex(const gd::FunctionCallNode& functionCall,
+                      const gd::ExpressionNode& parameter) {
+  for (int i = 0; i < functionCall.parameters.size(); i++) {
+    if (functionCall.parameters.at(i).get() == &parameter) return i;
+  }
+  return -1;
+}
+
+const gd::ParameterMetadata* GetVisibleParameterMetadata(
+    const gd::ExpressionMetadata& metadata,
+    const gd::FunctionCallNode& functionCall,
+    int parameterIndex) {
+  // Search the parameter metadata index skipping invisible ones.
+  size_t visibleParameterIndex = 0;
+  size_t metadataParameterIndex =
+      gd::ExpressionParser2::WrittenParametersFirstIndex(
+          functionCall.objectName, functionCall.behaviorName);
+
+  // TODO use a badMetadata instead of a nullptr?
+  const gd::ParameterMetadata* parameterMetadata = nullptr;
+  while (metadataParameterIndex <
+         metadata.GetParameters().GetParametersCount()) {
+    if (!metadata.GetParameters().GetParameter(metadataParameterIndex)
+             .IsCodeOnly()) {
+      if (visibleParameterIndex == parameterIndex) {
+        parameterMetadata =
+            &metadata.GetParameters().GetParameter(metadataParameterIndex);
+      }
+      visibleParameterIndex++;
+    }
+    metadataParameterIndex++;
+  }
+  // It can be null if there are too many parameters in the expression, this
+  // text node is not actually linked to a parameter expected by the function
+  // call.
+  return parameterMetadata;
+}
+}  // namespace
+
 namespace gd {
 
 gd::BehaviorMetadata MetadataProvider::badBehaviorMetadata;
@@ -92,26 +133,25 @@ MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
   auto& extensions = platform.GetAllPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allActions = extension->GetAllActions();
-    if (allActions.find(actionType) != allActions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allActions.find(actionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsActions =
-          extension->GetAllActionsForObject(extObjectType);
-      if (allObjectsActions.find(actionType) != allObjectsActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsActions.find(actionType)->second);
+    auto it = allActions.find(actionType);
+    if (it != allActions.end())
+      return ExtensionAndMetadata<InstructionMetadata>(*extension, it->second);
+
+    for (const auto& objectMetadata : extension->GetAllObjectsMetadata()) {
+      const auto& allObjectsActions = objectMetadata.second.actionsInfos;
+      auto objectIt = allObjectsActions.find(actionType);
+      if (objectIt != allObjectsActions.end())
+        return ExtensionAndMetadata<InstructionMetadata>(*extension,
+                                                         objectIt->second);
     }
 
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosActions =
-          extension->GetAllActionsForBehavior(autos[j]);
-      if (allAutosActions.find(actionType) != allAutosActions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosActions.find(actionType)->second);
+    for (const auto& behaviorMetadata :
+         extension->GetAllBehaviorsMetadata()) {
+      const auto& allBehaviorsActions = behaviorMetadata.second.actionsInfos;
+      auto behaviorIt = allBehaviorsActions.find(actionType);
+      if (behaviorIt != allBehaviorsActions.end())
+        return ExtensionAndMetadata<InstructionMetadata>(*extension,
+                                                         behaviorIt->second);
     }
   }
 
@@ -130,26 +170,26 @@ MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
   auto& extensions = platform.GetAllPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allConditions = extension->GetAllConditions();
-    if (allConditions.find(conditionType) != allConditions.end())
-      return ExtensionAndMetadata<InstructionMetadata>(
-          *extension, allConditions.find(conditionType)->second);
-
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    for (const gd::String& extObjectType : objects) {
-      const auto& allObjectsConditions =
-          extension->GetAllConditionsForObject(extObjectType);
-      if (allObjectsConditions.find(conditionType) != allObjectsConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allObjectsConditions.find(conditionType)->second);
+    auto it = allConditions.find(conditionType);
+    if (it != allConditions.end())
+      return ExtensionAndMetadata<InstructionMetadata>(*extension, it->second);
+
+    for (const auto& objectMetadata : extension->GetAllObjectsMetadata()) {
+      const auto& allObjectsConditions = objectMetadata.second.conditionsInfos;
+      auto objectIt = allObjectsConditions.find(conditionType);
+      if (objectIt != allObjectsConditions.end())
+        return ExtensionAndMetadata<InstructionMetadata>(*extension,
+                                                         objectIt->second);
     }
 
-    const auto& autos = extension->GetBehaviorsTypes();
-    for (std::size_t j = 0; j < autos.size(); ++j) {
-      const auto& allAutosConditions =
-          extension->GetAllConditionsForBehavior(autos[j]);
-      if (allAutosConditions.find(conditionType) != allAutosConditions.end())
-        return ExtensionAndMetadata<InstructionMetadata>(
-            *extension, allAutosConditions.find(conditionType)->second);
+    for (const auto& behaviorMetadata :
+         extension->GetAllBehaviorsMetadata()) {
+      const auto& allBehaviorsConditions =
+          behaviorMetadata.second.conditionsInfos;
+      auto behaviorIt = allBehaviorsConditions.find(conditionType);
+      if (behaviorIt != allBehaviorsConditions.end())
+        return ExtensionAndMetadata<InstructionMetadata>(*extension,
+                                                         behaviorIt->second);
     }
   }
 
@@ -168,8 +208,7 @@ MetadataProvider::GetExtensionAndObjectExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
   auto& extensions = platform.GetAllPlatformExtensions();
   for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
+    if (extension->HasObject(objectType)) {
       const auto& allObjectExpressions =
           extension->GetAllExpressionsForObject(objectType);
       if (allObjectExpressions.find(exprType) != allObjectExpressions.end())
@@ -255,8 +294,7 @@ MetadataProvider::GetExtensionAndObjectStrExpressionMetadata(
     const gd::Platform& platform, gd::String objectType, gd::String exprType) {
   auto& extensions = platform.GetAllPlatformExtensions();
   for (auto& extension : extensions) {
-    const auto& objects = extension->GetExtensionObjectsTypes();
-    if (find(objects.begin(), objects.end(), objectType) != objects.end()) {
+    if (extension->HasObject(objectType)) {
       const auto& allObjectStrExpressions =
           extension->GetAllStrExpressionsForObject(objectType);
       if (allObjectStrExpressions.find(exprType) !=
@@ -394,7 +432,7 @@ MetadataProvider::GetBehaviorAnyExpressionMetadata(const gd::Platform& platform,
 const gd::ExpressionMetadata& MetadataProvider::GetFunctionCallMetadata(
     const gd::Platform& platform,
     const gd::ObjectsContainersList &objectsContainersList,
-    FunctionCallNode& node) {
+    const FunctionCallNode& node) {
 
   if (!node.behaviorName.empty()) {
     gd::String behaviorType =
@@ -417,13 +455,7 @@ const gd::ParameterMetadata* MetadataProvider::GetFunctionCallParameterMetadata(
     const gd::ObjectsContainersList &objectsContainersList,
     FunctionCallNode& functionCall,
     ExpressionNode& parameter) {
-      int parameterIndex = -1;
-      for (int i = 0; i < functionCall.parameters.size(); i++) {
-        if (functionCall.parameters.at(i).get() == &parameter) {
-          parameterIndex = i;
-          break;
-        }
-      }
+      int parameterIndex = GetParameterIndex(functionCall, parameter);
       if (parameterIndex < 0) {
         return nullptr;
       }
@@ -439,11 +471,6 @@ const gd::ParameterMetadata* MetadataProvider::GetFunctionCallParameterMetadata(
     const gd::ObjectsContainersList &objectsContainersList,
     FunctionCallNode& functionCall,
     int parameterIndex) {
-      // Search the parameter metadata index skipping invisible ones.
-      size_t visibleParameterIndex = 0;
-      size_t metadataParameterIndex =
-          ExpressionParser2::WrittenParametersFirstIndex(
-              functionCall.objectName, functionCall.behaviorName);
       const gd::ExpressionMetadata &metadata = MetadataProvider::GetFunctionCallMetadata(
           platform, objectsContainersList, functionCall);
 
@@ -451,24 +478,40 @@ const gd::ParameterMetadata* MetadataProvider::GetFunctionCallParameterMetadata(
         return nullptr;
       }
 
-      // TODO use a badMetadata instead of a nullptr?
-      const gd::ParameterMetadata* parameterMetadata = nullptr;
-      while (metadataParameterIndex <
-             metadata.GetParameters().GetParametersCount()) {
-        if (!metadata.GetParameters().GetParameter(metadataParameterIndex)
-                 .IsCodeOnly()) {
-          if (visibleParameterIndex == parameterIndex) {
-            parameterMetadata =
-                &metadata.GetParameters().GetParameter(metadataParameterIndex);
-          }
-          visibleParameterIndex++;
-        }
-        metadataParameterIndex++;
-      }
-      const int visibleParameterCount = visibleParameterIndex;
-      // It can be null if there are too many parameters in the expression, this text node is
-      // not actually linked to a parameter expected by the function call.
-      return parameterMetadata;
+      return GetVisibleParameterMetadata(metadata, functionCall, parameterIndex);
+}
+
+const gd::ExpressionMetadata& MetadataProvider::GetFunctionCallMetadata(
+    const gd::Platform& platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const FunctionCallNode& node) {
+  gd::ExpressionNodeCache& cache = node.GetCache(
+      projectScopedContainers.GetVersion(), platform.GetGeneration());
+  if (!cache.metadata) {
+    cache.metadata = &MetadataProvider::GetFunctionCallMetadata(
+        platform, projectScopedContainers.GetObjectsContainersList(), node);
+  }
+
+  return *cache.metadata;
+}
+
+const gd::ParameterMetadata* MetadataProvider::GetFunctionCallParameterMetadata(
+    const gd::Platform& platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const FunctionCallNode& functionCall,
+    const ExpressionNode& parameter) {
+  int parameterIndex = GetParameterIndex(functionCall, parameter);
+  if (parameterIndex < 0) {
+    return nullptr;
+  }
+
+  const gd::ExpressionMetadata &metadata = MetadataProvider::GetFunctionCallMetadata(
+      platform, projectScopedContainers, functionCall);
+  if (IsBadExpressionMetadata(metadata)) {
+    return nullptr;
+  }
+
+  return GetVisibleParameterMetadata(metadata, functionCall, parameterIndex);
 }
 
 MetadataProvider::~MetadataProvider() {}
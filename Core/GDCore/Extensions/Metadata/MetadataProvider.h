@@ -16,6 +16,7 @@ class ExpressionMetadata;
 class Platform;
 class PlatformExtension;
 class ObjectsContainersList;
+class ProjectScopedContainers;
 struct FunctionCallNode;
 struct ExpressionNode;
 }  // namespace gd
@@ -240,7 +241,7 @@ class GD_CORE_API MetadataProvider {
   static const gd::ExpressionMetadata& GetFunctionCallMetadata(
     const gd::Platform& platform,
     const gd::ObjectsContainersList &objectsContainersList,
-    FunctionCallNode& node);
+    const FunctionCallNode& node);
 
   static const gd::ParameterMetadata* GetFunctionCallParameterMetadata(
     const gd::Platform& platform,
@@ -254,6 +255,22 @@ class GD_CORE_API MetadataProvider {
     FunctionCallNode& functionCall,
     int parameterIndex);
 
+  /**
+   * Get information about the expression called by a function call node.
+   * The metadata is only searched the first time for a node, as long as the
+   * scope is unchanged.
+   */
+  static const gd::ExpressionMetadata& GetFunctionCallMetadata(
+    const gd::Platform& platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const FunctionCallNode& node);
+
+  static const gd::ParameterMetadata* GetFunctionCallParameterMetadata(
+    const gd::Platform& platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const FunctionCallNode& functionCall,
+    const ExpressionNode& parameter);
+
   /**
    * Get information about an expression from its type.
    * Works for behavior expressions.
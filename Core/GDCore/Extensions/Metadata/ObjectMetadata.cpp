@@ -13,6 +13,7 @@
 #include "GDCore/Extensions/Metadata/MultipleInstructionMetadata.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 
@@ -78,17 +79,17 @@ gd::InstructionMetadata& ObjectMetadata::AddCondition(
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsObjectInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = conditionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
+  return metadata;
 #endif
 }
 
@@ -103,17 +104,17 @@ gd::InstructionMetadata& ObjectMetadata::AddAction(
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsObjectInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = actionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
+  return metadata;
 #endif
 }
 
@@ -131,17 +132,17 @@ gd::InstructionMetadata& ObjectMetadata::AddScopedCondition(
           ? name // Don't insert a namespace separator for the base object.
           : GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
 
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsObjectInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = conditionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
+  return metadata;
 #endif
 }
 
@@ -159,17 +160,17 @@ gd::InstructionMetadata& ObjectMetadata::AddScopedAction(
           ? name // Don't insert a namespace separator for the base object.
           : GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
 
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsObjectInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = actionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(extensionNamespace,
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
+  return metadata;
 #endif
 }
 
@@ -182,16 +183,16 @@ gd::ExpressionMetadata& ObjectMetadata::AddExpression(
 #if defined(GD_IDE_ONLY)
   // Be careful, objects expression do not have namespace (not necessary as
   // objects inherits from only one derived object).
-  expressionsInfos[name] = ExpressionMetadata("number",
-                                              extensionNamespace,
-                                              name,
-                                              fullname,
-                                              description,
-                                              group,
-                                              smallicon)
-                               .SetHelpPath(GetHelpPath());
-
-  return expressionsInfos[name];
+  gd::ExpressionMetadata& metadata = expressionsInfos[name];
+  metadata = ExpressionMetadata("number",
+                                extensionNamespace,
+                                name,
+                                fullname,
+                                description,
+                                group,
+                                smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 #endif
 }
 
@@ -204,16 +205,16 @@ gd::ExpressionMetadata& ObjectMetadata::AddStrExpression(
 #if defined(GD_IDE_ONLY)
   // Be careful, objects expression do not have namespace (not necessary as
   // objects inherits from only one derived object).
-  strExpressionsInfos[name] = ExpressionMetadata("string",
-                                                 extensionNamespace,
-                                                 name,
-                                                 fullname,
-                                                 description,
-                                                 group,
-                                                 smallicon)
-                                  .SetHelpPath(GetHelpPath());
-
-  return strExpressionsInfos[name];
+  gd::ExpressionMetadata& metadata = strExpressionsInfos[name];
+  metadata = ExpressionMetadata("string",
+                                extensionNamespace,
+                                name,
+                                fullname,
+                                description,
+                                group,
+                                smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 #endif
 }
 
@@ -373,6 +374,75 @@ ObjectMetadata& ObjectMetadata::SetDescription(const gd::String& description_) {
   return *this;
 }
 
+void ObjectMetadata::SerializeTo(SerializerElement& element) const {
+  element.SetAttribute("fullName", fullname);
+  element.SetAttribute("description", description);
+  element.SetAttribute("iconFilename", iconFilename);
+  element.SetAttribute("helpPath", helpPath);
+  if (!helpUrl.empty()) element.SetAttribute("helpUrl", helpUrl);
+  element.SetAttribute("category", category);
+  if (!assetStoreTag.empty())
+    element.SetAttribute("assetStoreTag", assetStoreTag);
+  if (!className.empty()) element.SetAttribute("className", className);
+  if (isPrivate) element.SetAttribute("private", true);
+  if (hidden) element.SetAttribute("hidden", true);
+  if (isRenderedIn3D) element.SetAttribute("renderedIn3D", true);
+  if (!openFullEditorLabel.empty())
+    element.SetAttribute("openFullEditorLabel", openFullEditorLabel);
+
+  gd::SerializerElement& defaultBehaviorsElement =
+      element.AddChild("defaultBehaviors");
+  defaultBehaviorsElement.ConsiderAsArrayOf("behaviorType");
+  for (const gd::String& behaviorType : defaultBehaviorTypes)
+    defaultBehaviorsElement.AddChild("behaviorType")
+        .SetStringValue(behaviorType);
+  gd::SerializerElement& includeFilesElement = element.AddChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (const gd::String& includeFile : includeFiles)
+    includeFilesElement.AddChild("includeFile").SetStringValue(includeFile);
+  gd::SerializerElement& resourcesElement =
+      element.AddChild("inGameEditorResources");
+  resourcesElement.ConsiderAsArrayOf("resource");
+  for (const auto& resource : inGameEditorResources)
+    resource.SerializeTo(resourcesElement.AddChild("resource"));
+}
+
+void ObjectMetadata::UnserializeFrom(const gd::String& extensionNamespace_,
+                                     const gd::String& name_,
+                                     const SerializerElement& element) {
+  *this = ObjectMetadata(extensionNamespace_,
+                         name_,
+                         element.GetStringAttribute("fullName"),
+                         element.GetStringAttribute("description"),
+                         element.GetStringAttribute("iconFilename"));
+  helpPath = element.GetStringAttribute("helpPath");
+  helpUrl = element.GetStringAttribute("helpUrl");
+  category = element.GetStringAttribute("category");
+  assetStoreTag = element.GetStringAttribute("assetStoreTag");
+  className = element.GetStringAttribute("className");
+  isPrivate = element.GetBoolAttribute("private");
+  hidden = element.GetBoolAttribute("hidden");
+  isRenderedIn3D = element.GetBoolAttribute("renderedIn3D");
+  openFullEditorLabel = element.GetStringAttribute("openFullEditorLabel");
+
+  const gd::SerializerElement& defaultBehaviorsElement =
+      element.GetChild("defaultBehaviors");
+  defaultBehaviorsElement.ConsiderAsArrayOf("behaviorType");
+  for (std::size_t i = 0; i < defaultBehaviorsElement.GetChildrenCount(); ++i)
+    defaultBehaviorTypes.insert(
+        defaultBehaviorsElement.GetChild(i).GetStringValue());
+  const gd::SerializerElement& includeFilesElement =
+      element.GetChild("includeFiles");
+  includeFilesElement.ConsiderAsArrayOf("includeFile");
+  for (std::size_t i = 0; i < includeFilesElement.GetChildrenCount(); ++i)
+    includeFiles.push_back(includeFilesElement.GetChild(i).GetStringValue());
+  const gd::SerializerElement& resourcesElement =
+      element.GetChild("inGameEditorResources");
+  resourcesElement.ConsiderAsArrayOf("resource");
+  for (std::size_t i = 0; i < resourcesElement.GetChildrenCount(); ++i)
+    AddInGameEditorResource().UnserializeFrom(resourcesElement.GetChild(i));
+}
+
 ObjectMetadata& ObjectMetadata::SetIncludeFile(const gd::String& includeFile) {
 #if defined(GD_IDE_ONLY)
   includeFiles.clear();
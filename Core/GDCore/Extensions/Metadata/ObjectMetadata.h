@@ -22,6 +22,7 @@ namespace gd {
 class InstructionMetadata;
 class MultipleInstructionMetadata;
 class ExpressionMetadata;
+class SerializerElement;
 }  // namespace gd
 
 typedef std::function<std::unique_ptr<gd::ObjectConfiguration>()>
@@ -386,6 +387,23 @@ class GD_CORE_API ObjectMetadata : public InstructionOrExpressionContainerMetada
     return inGameEditorResources;
   }
 
+  /**
+   * \brief Serialize the information about the object.
+   *
+   * \note The actions, conditions and expressions of the object are serialized
+   * by gd::PlatformExtension::SerializeTo. The function creating the object
+   * can't be serialized and must be set again after unserializing the
+   * metadata (see gd::PlatformExtension::SetObjectCreationFunction).
+   */
+  void SerializeTo(gd::SerializerElement& element) const;
+
+  /**
+   * \brief Unserialize the information about the object.
+   */
+  void UnserializeFrom(const gd::String& extensionNamespace,
+                       const gd::String& name,
+                       const gd::SerializerElement& element);
+
   std::map<gd::String, gd::InstructionMetadata> conditionsInfos;
   std::map<gd::String, gd::InstructionMetadata> actionsInfos;
   std::map<gd::String, gd::ExpressionMetadata> expressionsInfos;
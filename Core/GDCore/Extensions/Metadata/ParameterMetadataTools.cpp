@@ -208,14 +208,18 @@ void ParameterMetadataTools::IterateOverParametersWithIndex(
                        size_t parameterIndex,
                        const gd::String& lastObjectName,
                        size_t lastObjectIndex)> fn) {
+  static const gd::Expression emptyExpression;
+
   gd::String lastObjectName = "";
   size_t lastObjectIndex = 0;
   for (std::size_t pNb = 0; pNb < parametersMetadata.GetParametersCount();
        ++pNb) {
     const gd::ParameterMetadata &parameterMetadata =
         parametersMetadata.GetParameter(pNb);
+    // Refer to the parameter itself (rather than to a copy) so that its parsed
+    // node is reused.
     const gd::Expression &parameterValue =
-        pNb < parameters.size() ? parameters[pNb].GetPlainString() : "";
+        pNb < parameters.size() ? parameters[pNb] : emptyExpression;
     const gd::Expression& parameterValueOrDefault =
         parameterValue.GetPlainString().empty() && parameterMetadata.IsOptional()
             ? Expression(parameterMetadata.GetDefaultValue())
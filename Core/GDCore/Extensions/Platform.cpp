@@ -5,6 +5,8 @@
  */
 #include "Platform.h"
 
+#include <atomic>
+
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectConfiguration.h"
@@ -20,7 +22,14 @@ namespace gd {
 InstructionOrExpressionGroupMetadata
     Platform::badInstructionOrExpressionGroupMetadata;
 
-Platform::Platform() : enableExtensionLoadingLogs(false) {}
+namespace {
+std::atomic<std::size_t> lastGeneration(0);
+}  // namespace
+
+std::size_t Platform::MakeNewGeneration() { return ++lastGeneration; }
+
+Platform::Platform()
+    : enableExtensionLoadingLogs(false), generation(MakeNewGeneration()) {}
 
 Platform::~Platform() {}
 
@@ -37,6 +46,7 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+  generation = MakeNewGeneration();
 
   // Load all creation functions for objects provided by the
   // extension.
@@ -78,6 +88,7 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+  generation = MakeNewGeneration();
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
@@ -124,6 +124,15 @@ class GD_CORE_API Platform {
    */
   virtual void RemoveExtension(const gd::String& name);
 
+  /**
+   * \brief Return a number identifying the platform with its current
+   * extensions: it's different for each platform and changes each time an
+   * extension is added or removed.
+   *
+   * \see gd::ExpressionNode::GetCache
+   */
+  std::size_t GetGeneration() const { return generation; }
+
   /**
    * \brief Get the metadata (icon, etc...) of a group used for instructions or
    * expressions.
@@ -174,6 +183,9 @@ class GD_CORE_API Platform {
       instructionOrExpressionGroupMetadata;
   static InstructionOrExpressionGroupMetadata badInstructionOrExpressionGroupMetadata;
   bool enableExtensionLoadingLogs;
+  std::size_t generation;
+
+  static std::size_t MakeNewGeneration();
 };
 
 }  // namespace gd
@@ -20,7 +20,9 @@
 #include "GDCore/Project/Behavior.h"
 #include "GDCore/Project/BehaviorsSharedData.h"
 #include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Localization.h"
+#include "GDCore/Tools/Log.h"
 
 namespace gd {
 
@@ -31,6 +33,62 @@ std::map<gd::String, gd::InstructionMetadata>
 std::map<gd::String, gd::ExpressionMetadata>
     PlatformExtension::badExpressionsMetadata;
 
+namespace {
+
+template <class T>
+void SerializeMetadataTo(const std::map<gd::String, T>& metadata,
+                         gd::SerializerElement& element) {
+  element.ConsiderAsArrayOf("metadata");
+  for (const auto& it : metadata) {
+    gd::SerializerElement& metadataElement = element.AddChild("metadata");
+    metadataElement.SetAttribute("type", it.first);
+    it.second.SerializeTo(metadataElement);
+  }
+}
+
+template <class T>
+void UnserializeMetadataFrom(const gd::String& extensionNamespace,
+                             const gd::SerializerElement& element,
+                             std::map<gd::String, T>& metadata) {
+  element.ConsiderAsArrayOf("metadata");
+  for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& metadataElement = element.GetChild(i);
+    metadata[metadataElement.GetStringAttribute("type")].UnserializeFrom(
+        extensionNamespace, metadataElement);
+  }
+}
+
+void SerializeInstructionsAndExpressionsTo(
+    const std::map<gd::String, gd::InstructionMetadata>& conditions,
+    const std::map<gd::String, gd::InstructionMetadata>& actions,
+    const std::map<gd::String, gd::ExpressionMetadata>& expressions,
+    const std::map<gd::String, gd::ExpressionMetadata>& strExpressions,
+    gd::SerializerElement& element) {
+  SerializeMetadataTo(conditions, element.AddChild("conditions"));
+  SerializeMetadataTo(actions, element.AddChild("actions"));
+  SerializeMetadataTo(expressions, element.AddChild("expressions"));
+  SerializeMetadataTo(strExpressions, element.AddChild("strExpressions"));
+}
+
+void UnserializeInstructionsAndExpressionsFrom(
+    const gd::String& extensionNamespace,
+    const gd::SerializerElement& element,
+    std::map<gd::String, gd::InstructionMetadata>& conditions,
+    std::map<gd::String, gd::InstructionMetadata>& actions,
+    std::map<gd::String, gd::ExpressionMetadata>& expressions,
+    std::map<gd::String, gd::ExpressionMetadata>& strExpressions) {
+  UnserializeMetadataFrom(
+      extensionNamespace, element.GetChild("conditions"), conditions);
+  UnserializeMetadataFrom(
+      extensionNamespace, element.GetChild("actions"), actions);
+  UnserializeMetadataFrom(
+      extensionNamespace, element.GetChild("expressions"), expressions);
+  UnserializeMetadataFrom(
+      extensionNamespace, element.GetChild("strExpressions"), strExpressions);
+}
+
+}  // namespace
+
 gd::InstructionMetadata& PlatformExtension::AddCondition(
     const gd::String& name,
     const gd::String& fullname,
@@ -40,16 +98,17 @@ gd::InstructionMetadata& PlatformExtension::AddCondition(
     const gd::String& icon,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(GetNameSpace(),
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath());
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = conditionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(GetNameSpace(),
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::InstructionMetadata& PlatformExtension::AddAction(
@@ -61,16 +120,17 @@ gd::InstructionMetadata& PlatformExtension::AddAction(
     const gd::String& icon,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(GetNameSpace(),
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath());
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& metadata = actionsInfos[nameWithNamespace];
+  metadata = InstructionMetadata(GetNameSpace(),
+                                 nameWithNamespace,
+                                 fullname,
+                                 description,
+                                 sentence,
+                                 group,
+                                 icon,
+                                 smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::ExpressionMetadata& PlatformExtension::AddExpression(
@@ -80,15 +140,16 @@ gd::ExpressionMetadata& PlatformExtension::AddExpression(
     const gd::String& group,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  expressionsInfos[nameWithNamespace] = ExpressionMetadata("number",
-                                                           GetNameSpace(),
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           group,
-                                                           smallicon)
-                                            .SetHelpPath(GetHelpPath());
-  return expressionsInfos[nameWithNamespace];
+  gd::ExpressionMetadata& metadata = expressionsInfos[nameWithNamespace];
+  metadata = ExpressionMetadata("number",
+                                GetNameSpace(),
+                                nameWithNamespace,
+                                fullname,
+                                description,
+                                group,
+                                smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::ExpressionMetadata& PlatformExtension::AddStrExpression(
@@ -98,15 +159,16 @@ gd::ExpressionMetadata& PlatformExtension::AddStrExpression(
     const gd::String& group,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  strExpressionsInfos[nameWithNamespace] = ExpressionMetadata("string",
-                                                              GetNameSpace(),
-                                                              nameWithNamespace,
-                                                              fullname,
-                                                              description,
-                                                              group,
-                                                              smallicon)
-                                               .SetHelpPath(GetHelpPath());
-  return strExpressionsInfos[nameWithNamespace];
+  gd::ExpressionMetadata& metadata = strExpressionsInfos[nameWithNamespace];
+  metadata = ExpressionMetadata("string",
+                                GetNameSpace(),
+                                nameWithNamespace,
+                                fullname,
+                                description,
+                                group,
+                                smallicon);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::MultipleInstructionMetadata PlatformExtension::AddExpressionAndCondition(
@@ -227,15 +289,15 @@ gd::ObjectMetadata& PlatformExtension::AddObject(
     const gd::String& icon24x24,
     std::shared_ptr<gd::ObjectConfiguration> instance) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  objectsInfos[nameWithNamespace] = ObjectMetadata(GetNameSpace(),
-                                                   nameWithNamespace,
-                                                   fullname,
-                                                   description,
-                                                   icon24x24,
-                                                   instance)
-                                        .SetHelpPath(GetHelpPath());
-
-  return objectsInfos[nameWithNamespace];
+  gd::ObjectMetadata& metadata = objectsInfos[nameWithNamespace];
+  metadata = ObjectMetadata(GetNameSpace(),
+                            nameWithNamespace,
+                            fullname,
+                            description,
+                            icon24x24,
+                            instance);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::ObjectMetadata& PlatformExtension::AddEventsBasedObject(
@@ -244,11 +306,11 @@ gd::ObjectMetadata& PlatformExtension::AddEventsBasedObject(
     const gd::String& description,
     const gd::String& icon24x24) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  objectsInfos[nameWithNamespace] =
-      ObjectMetadata(
-          GetNameSpace(), nameWithNamespace, fullname, description, icon24x24)
-          .SetHelpPath(GetHelpPath());
-  return objectsInfos[nameWithNamespace];
+  gd::ObjectMetadata& metadata = objectsInfos[nameWithNamespace];
+  metadata = ObjectMetadata(
+      GetNameSpace(), nameWithNamespace, fullname, description, icon24x24);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::BehaviorMetadata& PlatformExtension::AddBehavior(
@@ -262,24 +324,26 @@ gd::BehaviorMetadata& PlatformExtension::AddBehavior(
     std::shared_ptr<gd::Behavior> instance,
     std::shared_ptr<gd::BehaviorsSharedData> sharedDatasInstance) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  behaviorsInfo[nameWithNamespace] = BehaviorMetadata(GetNameSpace(),
-                                                      nameWithNamespace,
-                                                      fullname,
-                                                      defaultName,
-                                                      description,
-                                                      group,
-                                                      icon24x24,
-                                                      className,
-                                                      instance,
-                                                      sharedDatasInstance)
-                                         .SetHelpPath(GetHelpPath());
-  return behaviorsInfo[nameWithNamespace];
+  gd::BehaviorMetadata& metadata = behaviorsInfo[nameWithNamespace];
+  metadata = BehaviorMetadata(GetNameSpace(),
+                              nameWithNamespace,
+                              fullname,
+                              defaultName,
+                              description,
+                              group,
+                              icon24x24,
+                              className,
+                              instance,
+                              sharedDatasInstance);
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 gd::EffectMetadata& PlatformExtension::AddEffect(const gd::String& name) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  effectsMetadata[nameWithNamespace] = EffectMetadata(nameWithNamespace);
-  return effectsMetadata[nameWithNamespace];
+  gd::EffectMetadata& metadata = effectsMetadata[nameWithNamespace];
+  metadata = EffectMetadata(nameWithNamespace);
+  return metadata;
 }
 
 gd::EventMetadata& PlatformExtension::AddEvent(
@@ -290,13 +354,14 @@ gd::EventMetadata& PlatformExtension::AddEvent(
     const gd::String& smallicon_,
     std::shared_ptr<gd::BaseEvent> instance_) {
   gd::String nameWithNamespace = GetNameSpace() + name_;
-  eventsInfos[nameWithNamespace] = gd::EventMetadata(nameWithNamespace,
-                                                     fullname_,
-                                                     description_,
-                                                     group_,
-                                                     smallicon_,
-                                                     instance_);
-  return eventsInfos[nameWithNamespace];
+  gd::EventMetadata& metadata = eventsInfos[nameWithNamespace];
+  metadata = gd::EventMetadata(nameWithNamespace,
+                               fullname_,
+                               description_,
+                               group_,
+                               smallicon_,
+                               instance_);
+  return metadata;
 }
 
 PlatformExtension& PlatformExtension::SetExtensionInformation(
@@ -355,6 +420,18 @@ bool PlatformExtension::HasBehavior(const gd::String& behaviorType) const {
   return behaviorsInfo.find(behaviorType) != behaviorsInfo.end();
 }
 
+bool PlatformExtension::HasObject(const gd::String& objectType) const {
+  return objectsInfos.find(objectType) != objectsInfos.end();
+}
+
+void PlatformExtension::RemoveBehavior(const gd::String& behaviorType) {
+  behaviorsInfo.erase(behaviorType);
+}
+
+void PlatformExtension::RemoveObject(const gd::String& objectType) {
+  objectsInfos.erase(objectType);
+}
+
 gd::EffectMetadata& PlatformExtension::GetEffectMetadata(
     const gd::String& effectName) {
   if (effectsMetadata.find(effectName) != effectsMetadata.end())
@@ -380,15 +457,16 @@ gd::InstructionMetadata& PlatformExtension::AddDuplicatedAction(
   gd::String newNameWithNamespace = GetNameSpace() + newActionName;
   gd::String copiedNameWithNamespace = GetNameSpace() + copiedActionName;
 
+  gd::InstructionMetadata& metadata = actionsInfos[newNameWithNamespace];
   auto copiedAction = actionsInfos.find(copiedNameWithNamespace);
   if (copiedAction == actionsInfos.end()) {
     gd::LogError("Could not find an action with name " +
                  copiedNameWithNamespace + " to copy.");
   } else {
-    actionsInfos[newNameWithNamespace] = copiedAction->second;
+    metadata = copiedAction->second;
   }
 
-  return actionsInfos[newNameWithNamespace];
+  return metadata;
 }
 
 gd::InstructionMetadata& PlatformExtension::AddDuplicatedCondition(
@@ -400,15 +478,16 @@ gd::InstructionMetadata& PlatformExtension::AddDuplicatedCondition(
   gd::String copiedNameWithNamespace =
       (options.unscoped ? "" : GetNameSpace()) + copiedConditionName;
 
+  gd::InstructionMetadata& metadata = conditionsInfos[newNameWithNamespace];
   auto copiedCondition = conditionsInfos.find(copiedNameWithNamespace);
   if (copiedCondition == conditionsInfos.end()) {
     gd::LogError("Could not find a condition with name " +
                  copiedNameWithNamespace + " to copy.");
   } else {
-    conditionsInfos[newNameWithNamespace] = copiedCondition->second;
+    metadata = copiedCondition->second;
   }
 
-  return conditionsInfos[newNameWithNamespace];
+  return metadata;
 }
 
 gd::ExpressionMetadata& PlatformExtension::AddDuplicatedExpression(
@@ -417,15 +496,16 @@ gd::ExpressionMetadata& PlatformExtension::AddDuplicatedExpression(
   gd::String newNameWithNamespace = GetNameSpace() + newExpressionName;
   gd::String copiedNameWithNamespace = GetNameSpace() + copiedExpressionName;
 
+  gd::ExpressionMetadata& metadata = expressionsInfos[newNameWithNamespace];
   auto copiedExpression = expressionsInfos.find(copiedNameWithNamespace);
   if (copiedExpression == expressionsInfos.end()) {
     gd::LogError("Could not find an expression with name " +
                  copiedNameWithNamespace + " to copy.");
   } else {
-    expressionsInfos[newNameWithNamespace] = copiedExpression->second;
+    metadata = copiedExpression->second;
   }
 
-  return expressionsInfos[newNameWithNamespace];
+  return metadata;
 }
 
 gd::ExpressionMetadata& PlatformExtension::AddDuplicatedStrExpression(
@@ -434,15 +514,16 @@ gd::ExpressionMetadata& PlatformExtension::AddDuplicatedStrExpression(
   gd::String newNameWithNamespace = GetNameSpace() + newExpressionName;
   gd::String copiedNameWithNamespace = GetNameSpace() + copiedExpressionName;
 
+  gd::ExpressionMetadata& metadata = strExpressionsInfos[newNameWithNamespace];
   auto copiedExpression = strExpressionsInfos.find(copiedNameWithNamespace);
   if (copiedExpression == strExpressionsInfos.end()) {
     gd::LogError("Could not find a string expression with name " +
                  copiedNameWithNamespace + " to copy.");
   } else {
-    strExpressionsInfos[newNameWithNamespace] = copiedExpression->second;
+    metadata = copiedExpression->second;
   }
 
-  return strExpressionsInfos[newNameWithNamespace];
+  return metadata;
 }
 
 std::map<gd::String, gd::InstructionMetadata>&
@@ -487,65 +568,65 @@ std::map<gd::String, gd::EventMetadata>& PlatformExtension::GetAllEvents() {
   return eventsInfos;
 }
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllActionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.actionsInfos;
+PlatformExtension::GetAllActionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.actionsInfos;
 
   return badActionsMetadata;
 }
 
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllConditionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.conditionsInfos;
+PlatformExtension::GetAllConditionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.conditionsInfos;
 
   return badConditionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllExpressionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.expressionsInfos;
+PlatformExtension::GetAllExpressionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.expressionsInfos;
 
   return badExpressionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllStrExpressionsForObject(gd::String objectType) {
-  if (objectsInfos.find(objectType) != objectsInfos.end())
-    return objectsInfos.find(objectType)->second.strExpressionsInfos;
+PlatformExtension::GetAllStrExpressionsForObject(const gd::String& objectType) {
+  auto it = objectsInfos.find(objectType);
+  if (it != objectsInfos.end()) return it->second.strExpressionsInfos;
 
   return badExpressionsMetadata;
 }
 
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllActionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.actionsInfos;
+PlatformExtension::GetAllActionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.actionsInfos;
 
   return badActionsMetadata;
 }
 
 std::map<gd::String, gd::InstructionMetadata>&
-PlatformExtension::GetAllConditionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.conditionsInfos;
+PlatformExtension::GetAllConditionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.conditionsInfos;
 
   return badConditionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllExpressionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.expressionsInfos;
+PlatformExtension::GetAllExpressionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.expressionsInfos;
 
   return badExpressionsMetadata;
 }
 
 std::map<gd::String, gd::ExpressionMetadata>&
-PlatformExtension::GetAllStrExpressionsForBehavior(gd::String autoType) {
-  if (behaviorsInfo.find(autoType) != behaviorsInfo.end())
-    return behaviorsInfo.find(autoType)->second.strExpressionsInfos;
+PlatformExtension::GetAllStrExpressionsForBehavior(const gd::String& autoType) {
+  auto it = behaviorsInfo.find(autoType);
+  if (it != behaviorsInfo.end()) return it->second.strExpressionsInfos;
 
   return badExpressionsMetadata;
 }
@@ -759,6 +840,332 @@ void PlatformExtension::StripUnimplementedInstructionsAndExpressions() {
   }
 }
 
+void PlatformExtension::SerializeTo(SerializerElement& element) const {
+  element.SetAttribute("name", name);
+  element.SetAttribute("fullName", fullname);
+  element.SetAttribute("description", informations);
+  element.SetAttribute("shortDescription", shortDescription);
+  element.SetAttribute("dimension", dimension);
+  element.SetAttribute("category", category);
+  element.SetAttribute("author", author);
+  element.SetAttribute("license", license);
+  element.SetAttribute("helpPath", helpPath);
+  element.SetAttribute("iconUrl", iconUrl);
+  if (deprecated)
+    element.SetAttribute("deprecationGDVersion", deprecationGDVersion);
+  gd::SerializerElement& tagsElement = element.AddChild("tags");
+  tagsElement.ConsiderAsArrayOf("tag");
+  for (const gd::String& tag : tags)
+    tagsElement.AddChild("tag").SetStringValue(tag);
+
+  SerializeInstructionsAndExpressionsTo(conditionsInfos,
+                                        actionsInfos,
+                                        expressionsInfos,
+                                        strExpressionsInfos,
+                                        element);
+
+  gd::SerializerElement& objectsElement = element.AddChild("objects");
+  objectsElement.ConsiderAsArrayOf("object");
+  for (const auto& it : objectsInfos) {
+    gd::SerializerElement& objectElement = objectsElement.AddChild("object");
+    objectElement.SetAttribute("type", it.first);
+    it.second.SerializeTo(objectElement);
+    if (it.second.createFunPtr)
+      objectElement.SetAttribute("hasCreationFunction", true);
+    SerializeInstructionsAndExpressionsTo(it.second.conditionsInfos,
+                                          it.second.actionsInfos,
+                                          it.second.expressionsInfos,
+                                          it.second.strExpressionsInfos,
+                                          objectElement);
+  }
+
+  gd::SerializerElement& behaviorsElement = element.AddChild("behaviors");
+  behaviorsElement.ConsiderAsArrayOf("behavior");
+  for (const auto& it : behaviorsInfo) {
+    gd::SerializerElement& behaviorElement =
+        behaviorsElement.AddChild("behavior");
+    behaviorElement.SetAttribute("type", it.first);
+    it.second.SerializeTo(behaviorElement);
+    SerializeInstructionsAndExpressionsTo(it.second.conditionsInfos,
+                                          it.second.actionsInfos,
+                                          it.second.expressionsInfos,
+                                          it.second.strExpressionsInfos,
+                                          behaviorElement);
+  }
+
+  gd::SerializerElement& eventsElement = element.AddChild("events");
+  eventsElement.ConsiderAsArrayOf("event");
+  for (const auto& it : eventsInfos) {
+    gd::SerializerElement& eventElement = eventsElement.AddChild("event");
+    eventElement.SetAttribute("type", it.first);
+    eventElement.SetAttribute("fullName", it.second.GetFullName());
+    eventElement.SetAttribute("description", it.second.GetDescription());
+    eventElement.SetAttribute("group", it.second.GetGroup());
+    if (it.second.HasCustomCodeGenerator())
+      eventElement.SetAttribute("customCodeGenerator", true);
+    if (it.second.instance) eventElement.SetAttribute("hasInstance", true);
+  }
+
+  gd::SerializerElement& effectsElement = element.AddChild("effects");
+  effectsElement.ConsiderAsArrayOf("effect");
+  for (const auto& it : effectsMetadata) {
+    const gd::EffectMetadata& effect = it.second;
+    gd::SerializerElement& effectElement = effectsElement.AddChild("effect");
+    effectElement.SetAttribute("type", it.first);
+    effectElement.SetAttribute("fullName", effect.GetFullName());
+    effectElement.SetAttribute("description", effect.GetDescription());
+    effectElement.SetAttribute("helpPath", effect.GetHelpPath());
+    if (effect.IsMarkedAsNotWorkingForObjects())
+      effectElement.SetAttribute("notWorkingForObjects", true);
+    if (effect.IsMarkedAsOnlyWorkingFor2D())
+      effectElement.SetAttribute("onlyWorkingFor2D", true);
+    if (effect.IsMarkedAsOnlyWorkingFor3D())
+      effectElement.SetAttribute("onlyWorkingFor3D", true);
+    if (effect.IsMarkedAsUnique()) effectElement.SetAttribute("unique", true);
+    gd::SerializerElement& includeFilesElement =
+        effectElement.AddChild("includeFiles");
+    includeFilesElement.ConsiderAsArrayOf("includeFile");
+    for (const gd::String& includeFile : effect.GetIncludeFiles())
+      includeFilesElement.AddChild("includeFile").SetStringValue(includeFile);
+    gd::SerializerElement& propertiesElement =
+        effectElement.AddChild("properties");
+    for (const auto& property : effect.GetProperties())
+      property.second.SerializeTo(propertiesElement.AddChild(property.first));
+  }
+
+  gd::SerializerElement& dependenciesElement =
+      element.AddChild("dependencies");
+  dependenciesElement.ConsiderAsArrayOf("dependency");
+  for (const auto& dependency : extensionDependenciesMetadata) {
+    gd::SerializerElement& dependencyElement =
+        dependenciesElement.AddChild("dependency");
+    dependencyElement.SetAttribute("name", dependency.GetName());
+    dependencyElement.SetAttribute("exportName", dependency.GetExportName());
+    dependencyElement.SetAttribute("version", dependency.GetVersion());
+    dependencyElement.SetAttribute("dependencyType",
+                                   dependency.GetDependencyType());
+    if (dependency.IsOnlyIfSomeExtraSettingsNonEmpty())
+      dependencyElement.SetAttribute("onlyIfSomeExtraSettingsNonEmpty", true);
+    dependencyElement.SetAttribute(
+        "onlyIfOtherDependencyIsExported",
+        dependency.GetOtherDependencyThatMustBeExported());
+    gd::SerializerElement& extraSettingsElement =
+        dependencyElement.AddChild("extraSettings");
+    for (const auto& setting : dependency.GetAllExtraSettings())
+      setting.second.SerializeTo(extraSettingsElement.AddChild(setting.first));
+  }
+
+  gd::SerializerElement& sourceFilesElement = element.AddChild("sourceFiles");
+  sourceFilesElement.ConsiderAsArrayOf("sourceFile");
+  for (const auto& sourceFile : extensionSourceFilesMetadata)
+    sourceFile.SerializeTo(sourceFilesElement.AddChild("sourceFile"));
+
+  gd::SerializerElement& propertiesElement = element.AddChild("properties");
+  for (const auto& it : extensionPropertiesMetadata)
+    it.second.SerializeTo(propertiesElement.AddChild(it.first));
+
+  gd::SerializerElement& groupsElement = element.AddChild("groups");
+  groupsElement.ConsiderAsArrayOf("group");
+  for (const auto& it : instructionOrExpressionGroupMetadata) {
+    gd::SerializerElement& groupElement = groupsElement.AddChild("group");
+    groupElement.SetAttribute("name", it.first);
+    groupElement.SetAttribute("icon", it.second.GetIcon());
+  }
+
+  gd::SerializerElement& resourcesElement =
+      element.AddChild("inGameEditorResources");
+  resourcesElement.ConsiderAsArrayOf("resource");
+  for (const auto& resource : inGameEditorResources)
+    resource.SerializeTo(resourcesElement.AddChild("resource"));
+}
+
+void PlatformExtension::UnserializeFrom(const SerializerElement& element) {
+  SetExtensionInformation(element.GetStringAttribute("name"),
+                          element.GetStringAttribute("fullName"),
+                          element.GetStringAttribute("description"),
+                          element.GetStringAttribute("author"),
+                          element.GetStringAttribute("license"));
+  shortDescription = element.GetStringAttribute("shortDescription");
+  dimension = element.GetStringAttribute("dimension");
+  category = element.GetStringAttribute("category");
+  helpPath = element.GetStringAttribute("helpPath");
+  iconUrl = element.GetStringAttribute("iconUrl");
+  deprecated = element.HasAttribute("deprecationGDVersion");
+  deprecationGDVersion = element.GetStringAttribute("deprecationGDVersion");
+  const gd::SerializerElement& tagsElement = element.GetChild("tags");
+  tagsElement.ConsiderAsArrayOf("tag");
+  for (std::size_t i = 0; i < tagsElement.GetChildrenCount(); ++i)
+    tags.push_back(tagsElement.GetChild(i).GetStringValue());
+
+  UnserializeInstructionsAndExpressionsFrom(nameSpace,
+                                            element,
+                                            conditionsInfos,
+                                            actionsInfos,
+                                            expressionsInfos,
+                                            strExpressionsInfos);
+
+  const gd::SerializerElement& objectsElement = element.GetChild("objects");
+  objectsElement.ConsiderAsArrayOf("object");
+  for (std::size_t i = 0; i < objectsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& objectElement = objectsElement.GetChild(i);
+    const gd::String& type = objectElement.GetStringAttribute("type");
+    gd::ObjectMetadata& metadata = objectsInfos[type];
+    metadata.UnserializeFrom(nameSpace, type, objectElement);
+    UnserializeInstructionsAndExpressionsFrom(nameSpace,
+                                              objectElement,
+                                              metadata.conditionsInfos,
+                                              metadata.actionsInfos,
+                                              metadata.expressionsInfos,
+                                              metadata.strExpressionsInfos);
+  }
+
+  const gd::SerializerElement& behaviorsElement =
+      element.GetChild("behaviors");
+  behaviorsElement.ConsiderAsArrayOf("behavior");
+  for (std::size_t i = 0; i < behaviorsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& behaviorElement = behaviorsElement.GetChild(i);
+    gd::BehaviorMetadata& metadata =
+        behaviorsInfo[behaviorElement.GetStringAttribute("type")];
+    metadata.UnserializeFrom(nameSpace, behaviorElement);
+    UnserializeInstructionsAndExpressionsFrom(nameSpace,
+                                              behaviorElement,
+                                              metadata.conditionsInfos,
+                                              metadata.actionsInfos,
+                                              metadata.expressionsInfos,
+                                              metadata.strExpressionsInfos);
+  }
+
+  const gd::SerializerElement& eventsElement = element.GetChild("events");
+  eventsElement.ConsiderAsArrayOf("event");
+  for (std::size_t i = 0; i < eventsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& eventElement = eventsElement.GetChild(i);
+    gd::EventMetadata& metadata =
+        eventsInfos[eventElement.GetStringAttribute("type")];
+    metadata.fullname = eventElement.GetStringAttribute("fullName");
+    metadata.description = eventElement.GetStringAttribute("description");
+    metadata.group = eventElement.GetStringAttribute("group");
+    metadata.ClearCodeGenerationAndPreprocessing();
+  }
+
+  const gd::SerializerElement& effectsElement = element.GetChild("effects");
+  effectsElement.ConsiderAsArrayOf("effect");
+  for (std::size_t i = 0; i < effectsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& effectElement = effectsElement.GetChild(i);
+    const gd::String& type = effectElement.GetStringAttribute("type");
+    gd::EffectMetadata& effect = effectsMetadata[type];
+    effect = gd::EffectMetadata(type);
+    effect.SetFullName(effectElement.GetStringAttribute("fullName"))
+        .SetDescription(effectElement.GetStringAttribute("description"))
+        .SetHelpPath(effectElement.GetStringAttribute("helpPath"));
+    if (effectElement.GetBoolAttribute("notWorkingForObjects"))
+      effect.MarkAsNotWorkingForObjects();
+    if (effectElement.GetBoolAttribute("onlyWorkingFor2D"))
+      effect.MarkAsOnlyWorkingFor2D();
+    if (effectElement.GetBoolAttribute("onlyWorkingFor3D"))
+      effect.MarkAsOnlyWorkingFor3D();
+    if (effectElement.GetBoolAttribute("unique")) effect.MarkAsUnique();
+    const gd::SerializerElement& includeFilesElement =
+        effectElement.GetChild("includeFiles");
+    includeFilesElement.ConsiderAsArrayOf("includeFile");
+    for (std::size_t j = 0; j < includeFilesElement.GetChildrenCount(); ++j)
+      effect.AddIncludeFile(includeFilesElement.GetChild(j).GetStringValue());
+    for (const auto& property :
+         effectElement.GetChild("properties").GetAllChildren())
+      effect.GetProperties()[property.first].UnserializeFrom(*property.second);
+  }
+
+  const gd::SerializerElement& dependenciesElement =
+      element.GetChild("dependencies");
+  dependenciesElement.ConsiderAsArrayOf("dependency");
+  for (std::size_t i = 0; i < dependenciesElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& dependencyElement =
+        dependenciesElement.GetChild(i);
+    gd::DependencyMetadata& dependency = AddDependency();
+    dependency.SetName(dependencyElement.GetStringAttribute("name"))
+        .SetExportName(dependencyElement.GetStringAttribute("exportName"))
+        .SetVersion(dependencyElement.GetStringAttribute("version"));
+    if (!dependencyElement.GetStringAttribute("dependencyType").empty())
+      dependency.SetDependencyType(
+          dependencyElement.GetStringAttribute("dependencyType"));
+    if (dependencyElement.GetBoolAttribute("onlyIfSomeExtraSettingsNonEmpty"))
+      dependency.OnlyIfSomeExtraSettingsNonEmpty();
+    dependency.OnlyIfOtherDependencyIsExported(
+        dependencyElement.GetStringAttribute("onlyIfOtherDependencyIsExported"));
+    for (const auto& setting :
+         dependencyElement.GetChild("extraSettings").GetAllChildren()) {
+      gd::PropertyDescriptor settingValue;
+      settingValue.UnserializeFrom(*setting.second);
+      dependency.SetExtraSetting(setting.first, settingValue);
+    }
+  }
+
+  const gd::SerializerElement& sourceFilesElement =
+      element.GetChild("sourceFiles");
+  sourceFilesElement.ConsiderAsArrayOf("sourceFile");
+  for (std::size_t i = 0; i < sourceFilesElement.GetChildrenCount(); ++i)
+    AddSourceFile().UnserializeFrom(sourceFilesElement.GetChild(i));
+
+  for (const auto& it : element.GetChild("properties").GetAllChildren())
+    extensionPropertiesMetadata[it.first].UnserializeFrom(*it.second);
+
+  const gd::SerializerElement& groupsElement = element.GetChild("groups");
+  groupsElement.ConsiderAsArrayOf("group");
+  for (std::size_t i = 0; i < groupsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& groupElement = groupsElement.GetChild(i);
+    AddInstructionOrExpressionGroupMetadata(
+        groupElement.GetStringAttribute("name"))
+        .SetIcon(groupElement.GetStringAttribute("icon"));
+  }
+
+  const gd::SerializerElement& resourcesElement =
+      element.GetChild("inGameEditorResources");
+  resourcesElement.ConsiderAsArrayOf("resource");
+  for (std::size_t i = 0; i < resourcesElement.GetChildrenCount(); ++i)
+    AddInGameEditorResource().UnserializeFrom(resourcesElement.GetChild(i));
+}
+
+PlatformExtension& PlatformExtension::SetEventInstance(
+    const gd::String& eventType, std::shared_ptr<gd::BaseEvent> instance) {
+  auto it = eventsInfos.find(eventType);
+  if (it == eventsInfos.end()) {
+    gd::LogError("Could not find an event with type " + eventType +
+                 " to set its instance.");
+    return *this;
+  }
+
+  it->second.instance = instance;
+  if (instance) instance->SetType(eventType);
+  return *this;
+}
+
+PlatformExtension& PlatformExtension::SetObjectCreationFunction(
+    const gd::String& objectType, CreateFunPtr createFunPtr) {
+  auto it = objectsInfos.find(objectType);
+  if (it == objectsInfos.end()) {
+    gd::LogError("Could not find an object with type " + objectType +
+                 " to set its creation function.");
+    return *this;
+  }
+
+  it->second.createFunPtr = createFunPtr;
+  return *this;
+}
+
+PlatformExtension& PlatformExtension::SetBehaviorInstances(
+    const gd::String& behaviorType,
+    std::shared_ptr<gd::Behavior> instance,
+    std::shared_ptr<gd::BehaviorsSharedData> sharedDatasInstance) {
+  auto it = behaviorsInfo.find(behaviorType);
+  if (it == behaviorsInfo.end()) {
+    gd::LogError("Could not find a behavior with type " + behaviorType +
+                 " to set its instances.");
+    return *this;
+  }
+
+  it->second.SetInstances(behaviorType, instance, sharedDatasInstance);
+  return *this;
+}
+
 gd::String PlatformExtension::GetEventsFunctionFullType(
     const gd::String& extensionName, const gd::String& functionName) {
   const auto& separator = GetNamespaceSeparator();
@@ -39,6 +39,7 @@ class BehaviorsSharedData;
 class Behavior;
 class Object;
 class ObjectConfiguration;
+class SerializerElement;
 }  // namespace gd
 
 typedef std::function<std::unique_ptr<gd::ObjectConfiguration>()> CreateFunPtr;
@@ -558,6 +559,41 @@ class GD_CORE_API PlatformExtension {
    */
   bool HasBehavior(const gd::String& behaviorType) const;
 
+  /**
+   * \brief Return true if the extension contains an object associated to \a
+   * objectType
+   */
+  bool HasObject(const gd::String& objectType) const;
+
+  /**
+   * \brief Remove the behavior associated to \a behaviorType, with all the
+   * instructions and expressions it provides.
+   */
+  void RemoveBehavior(const gd::String& behaviorType);
+
+  /**
+   * \brief Remove the object associated to \a objectType, with all the
+   * instructions and expressions it provides.
+   */
+  void RemoveObject(const gd::String& objectType);
+
+  /**
+   * \brief Return a map containing the metadata of all the objects provided by
+   * the extension, with the object types as keys.
+   */
+  const std::map<gd::String, gd::ObjectMetadata>& GetAllObjectsMetadata() const {
+    return objectsInfos;
+  }
+
+  /**
+   * \brief Return a map containing the metadata of all the behaviors provided
+   * by the extension, with the behavior types as keys.
+   */
+  const std::map<gd::String, gd::BehaviorMetadata>& GetAllBehaviorsMetadata()
+      const {
+    return behaviorsInfo;
+  }
+
   /**
    * \brief Return the metadata for the effect with the given name.
    */
@@ -618,49 +654,49 @@ class GD_CORE_API PlatformExtension {
    * related to the object type, and the metadata associated with.
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllActionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllConditionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllExpressionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllStrExpressionsForObject(
-      gd::String objectType);
+      const gd::String& objectType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllActionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::InstructionMetadata>& GetAllConditionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllExpressionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \see gd::PlatformExtension::GetAllActionsForObject
    */
   std::map<gd::String, gd::ExpressionMetadata>& GetAllStrExpressionsForBehavior(
-      gd::String autoType);
+      const gd::String& autoType);
 
   /**
    * \brief Get all the properties of the extension. Properties
@@ -685,6 +721,52 @@ class GD_CORE_API PlatformExtension {
   }
   ///@}
 
+  /** \name Serialization
+   * Snapshot of the declared metadata, allowing to restore an extension
+   * without running its declarations.
+   */
+  ///@{
+
+  /**
+   * \brief Serialize all the metadata declared by the extension.
+   *
+   * Code generators, event instances, object creation functions and behavior
+   * instances can't be serialized: only their presence is recorded.
+   *
+   * \see gd::PlatformMetadataSnapshot
+   */
+  void SerializeTo(SerializerElement& element) const;
+
+  /**
+   * \brief Restore the metadata of an empty extension from a snapshot.
+   *
+   * The code generators and instances must be bound again, usually with
+   * gd::ExtensionBindingsRegistry.
+   */
+  void UnserializeFrom(const SerializerElement& element);
+
+  /**
+   * \brief Set the instance of the event with the given type.
+   */
+  PlatformExtension& SetEventInstance(const gd::String& eventType,
+                                      std::shared_ptr<gd::BaseEvent> instance);
+
+  /**
+   * \brief Set the function creating the configuration of the object with the
+   * given type.
+   */
+  PlatformExtension& SetObjectCreationFunction(const gd::String& objectType,
+                                               CreateFunPtr createFunPtr);
+
+  /**
+   * \brief Set the instances of the behavior with the given type.
+   */
+  PlatformExtension& SetBehaviorInstances(
+      const gd::String& behaviorType,
+      std::shared_ptr<gd::Behavior> instance,
+      std::shared_ptr<gd::BehaviorsSharedData> sharedDatasInstance);
+  ///@}
+
   /**
    * \brief Get the string used to separate the name of the
    * instruction/expression and the extension.
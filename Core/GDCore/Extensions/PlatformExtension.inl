@@ -21,18 +21,17 @@ gd::ObjectMetadata& PlatformExtension::AddObject(const gd::String& name,
                                                  const gd::String& icon24x24) {
   gd::String nameWithNamespace =
       GetNameSpace().empty() ? name : GetNameSpace() + name;
-  objectsInfos[nameWithNamespace] =
-      ObjectMetadata(GetNameSpace(),
-                     nameWithNamespace,
-                     fullname,
-                     description,
-                     icon24x24,
-                     []() -> std::unique_ptr<gd::ObjectConfiguration> {
-                       return gd::make_unique<T>();
-                     })
-          .SetHelpPath(GetHelpPath());
-
-  return objectsInfos[nameWithNamespace];
+  gd::ObjectMetadata& metadata = objectsInfos[nameWithNamespace];
+  metadata = ObjectMetadata(GetNameSpace(),
+                            nameWithNamespace,
+                            fullname,
+                            description,
+                            icon24x24,
+                            []() -> std::unique_ptr<gd::ObjectConfiguration> {
+                              return gd::make_unique<T>();
+                            });
+  metadata.SetHelpPath(GetHelpPath());
+  return metadata;
 }
 
 }  // namespace gd
@@ -0,0 +1,72 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "ContainersSignatureTools.h"
+
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace gd {
+
+void ContainersSignatureTools::AddVariableSignature(
+    const gd::Variable &variable, gd::String &signature) {
+  signature += gd::String::From(static_cast<int>(variable.GetType()));
+  if (variable.GetType() == gd::Variable::Structure) {
+    signature += "{";
+    for (const auto &child : variable.GetAllChildren()) {
+      signature += child.first + ":";
+      AddVariableSignature(*child.second, signature);
+      signature += ",";
+    }
+    signature += "}";
+  } else if (variable.GetType() == gd::Variable::Array) {
+    signature += "[";
+    for (const auto &child : variable.GetAllChildrenArray()) {
+      AddVariableSignature(*child, signature);
+      signature += ",";
+    }
+    signature += "]";
+  }
+}
+
+void ContainersSignatureTools::AddVariablesSignature(
+    const gd::VariablesContainer &variables, gd::String &signature) {
+  for (std::size_t i = 0; i < variables.Count(); ++i) {
+    signature += variables.GetNameAt(i) + ":";
+    AddVariableSignature(variables.Get(i), signature);
+    signature += ";";
+  }
+  signature += "\n";
+}
+
+void ContainersSignatureTools::AddObjectsSignature(
+    const gd::ObjectsContainer &objects, gd::String &signature) {
+  for (std::size_t i = 0; i < objects.GetObjectsCount(); ++i) {
+    const gd::Object &object = objects.GetObject(i);
+    signature += object.GetName() + ":" + object.GetType() + "(";
+    for (const gd::String &behaviorName : object.GetAllBehaviorNames()) {
+      signature += behaviorName + ":" +
+                   object.GetBehavior(behaviorName).GetTypeName() + ",";
+    }
+    signature += ")";
+    AddVariablesSignature(object.GetVariables(), signature);
+  }
+
+  const gd::ObjectGroupsContainer &groups = objects.GetObjectGroups();
+  for (std::size_t i = 0; i < groups.size(); ++i) {
+    const gd::ObjectGroup &group = groups.Get(i);
+    signature += group.GetName() + "(";
+    for (const gd::String &objectName : group.GetAllObjectsNames())
+      signature += objectName + ",";
+    signature += ")\n";
+  }
+}
+
+}  // namespace gd
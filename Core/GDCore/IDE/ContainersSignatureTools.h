@@ -0,0 +1,52 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include "GDCore/String.h"
+
+namespace gd {
+class ObjectsContainer;
+class Variable;
+class VariablesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Build strings identifying the content of containers, so that results
+ * depending on them (like generated code or diagnostics) can be reused as long
+ * as the signature is the same.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ContainersSignatureTools {
+ public:
+  /**
+   * \brief Add the type of a variable, and the names and types of its
+   * children, to the signature. Values are not part of the signature.
+   */
+  static void AddVariableSignature(const gd::Variable &variable,
+                                   gd::String &signature);
+
+  /**
+   * \brief Add the names and types of the variables of a container to the
+   * signature.
+   *
+   * Variables are accessed by their position in the container when it's
+   * known, so their order is part of the signature.
+   */
+  static void AddVariablesSignature(const gd::VariablesContainer &variables,
+                                    gd::String &signature);
+
+  /**
+   * \brief Add the names, types, behaviors and variables of the objects of a
+   * container, and its groups, to the signature.
+   */
+  static void AddObjectsSignature(const gd::ObjectsContainer &objects,
+                                  gd::String &signature);
+};
+
+}  // namespace gd
@@ -122,7 +122,8 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
             }
           }
         } else {
-          auto node = parameterValue.GetRootNode();
+          gd::Expression expression(parameterValue.GetPlainString());
+          auto node = expression.GetRootNode();
           if (node) {
             ExpressionBehaviorRenamer renamer(objectName,
                                               oldBehaviorName,
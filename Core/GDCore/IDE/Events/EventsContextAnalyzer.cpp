@@ -176,12 +176,12 @@ void EventsContextAnalyzer::AnalyzeParameter(
   if (ParameterMetadata::IsObject(type)) {
     context.AddObjectName(projectScopedContainers, value);
   } else if (ParameterMetadata::IsExpression("number", type)) {
-    auto node = parameter.GetRootNode();
+    auto node = parameter.GetSharedRootNode();
 
     ExpressionObjectsAnalyzer analyzer(platform, projectScopedContainers, "number", context);
     node->Visit(analyzer);
   } else if (ParameterMetadata::IsExpression("string", type)) {
-    auto node = parameter.GetRootNode();
+    auto node = parameter.GetSharedRootNode();
 
     ExpressionObjectsAnalyzer analyzer(platform, projectScopedContainers, "string", context);
     node->Visit(analyzer);
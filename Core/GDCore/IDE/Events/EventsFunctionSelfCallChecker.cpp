@@ -78,7 +78,7 @@ public:
                 "number", instrInfos.parameters.GetParameter(pNb).GetType()) ||
             ParameterMetadata::IsExpression(
                 "string", instrInfos.parameters.GetParameter(pNb).GetType())) {
-          auto node = instruction.GetParameter(pNb).GetRootNode();
+          auto node = instruction.GetParameter(pNb).GetSharedRootNode();
           node->Visit(*this);
         }
       }
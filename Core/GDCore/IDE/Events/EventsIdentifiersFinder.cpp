@@ -160,7 +160,7 @@ class GD_CORE_API IdentifierFinderEventWorker
                     "number", instrInfos.parameters.GetParameter(pNb).GetType()) ||
                 ParameterMetadata::IsExpression(
                     "string", instrInfos.parameters.GetParameter(pNb).GetType())) {
-          auto node = instruction.GetParameter(pNb).GetRootNode();
+          auto node = instruction.GetParameter(pNb).GetSharedRootNode();
 
           IdentifierFinderExpressionNodeWorker searcher(
               results,
@@ -191,7 +191,8 @@ bool EventsParameterReplacer::DoVisitInstruction(gd::Instruction& instruction,
           parameterMetadata.GetValueTypeMetadata())) {
           return;
         }
-        auto node = parameterValue.GetRootNode();
+        gd::Expression expression(parameterValue.GetPlainString());
+        auto node = expression.GetRootNode();
         if (node) {
           ExpressionParameterReplacer renamer(
               platform, GetProjectScopedContainers(),
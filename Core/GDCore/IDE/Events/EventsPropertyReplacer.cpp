@@ -225,7 +225,8 @@ bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
           parameterMetadata.GetValueTypeMetadata())) {
           return;
         }
-        auto node = parameterValue.GetRootNode();
+        gd::Expression expression(parameterValue.GetPlainString());
+        auto node = expression.GetRootNode();
         if (node) {
           ExpressionPropertyReplacer renamer(
               platform, GetProjectScopedContainers(), targetPropertiesContainer,
@@ -340,7 +340,8 @@ private:
                   parameterMetadata.GetValueTypeMetadata())) {
             return;
           }
-          auto node = parameterValue.GetRootNode();
+          gd::Expression expression(parameterValue.GetPlainString());
+          auto node = expression.GetRootNode();
           if (node) {
             ExpressionObjectRenamer renamer(
                 platform, GetProjectScopedContainers(),
@@ -428,7 +429,7 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
       // Find object's name in expressions
       else if (ParameterMetadata::IsExpression(
                    "number", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
+        auto node = actions[aId].GetParameter(pNb).GetSharedRootNode();
 
         if (ExpressionObjectFinder::CheckIfHasObject(platform, projectScopedContainers, "number", *node, name)) {
           deleteMe = true;
@@ -438,7 +439,7 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
       // Find object's name in text expressions
       else if (ParameterMetadata::IsExpression(
                    "string", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
+        auto node = actions[aId].GetParameter(pNb).GetSharedRootNode();
 
         if (ExpressionObjectFinder::CheckIfHasObject(platform, projectScopedContainers, "string", *node, name)) {
           deleteMe = true;
@@ -486,7 +487,7 @@ bool EventsRefactorer::RemoveObjectInConditions(
       // Find object's name in expressions
       else if (ParameterMetadata::IsExpression(
                    "number", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
+        auto node = conditions[cId].GetParameter(pNb).GetSharedRootNode();
 
         if (ExpressionObjectFinder::CheckIfHasObject(platform, projectScopedContainers, "number", *node, name)) {
           deleteMe = true;
@@ -496,7 +497,7 @@ bool EventsRefactorer::RemoveObjectInConditions(
       // Find object's name in text expressions
       else if (ParameterMetadata::IsExpression(
                    "string", instrInfos.parameters.GetParameter(pNb).GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
+        auto node = conditions[cId].GetParameter(pNb).GetSharedRootNode();
 
         if (ExpressionObjectFinder::CheckIfHasObject(platform, projectScopedContainers, "string", *node, name)) {
           deleteMe = true;
@@ -55,7 +55,7 @@ bool EventsVariableInstructionTypeSwitcher::DoVisitInstruction(gd::Instruction&
         }
         const auto variableName =
             gd::ExpressionVariableNameFinder::GetVariableName(
-                *parameterValue.GetRootNode());
+                *parameterValue.GetSharedRootNode());
 
         const gd::VariablesContainer *variablesContainer = nullptr;
         if (type == "objectvar") {
@@ -459,7 +459,8 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain variables.
 
-        auto node = parameterValue.GetRootNode();
+        gd::Expression expression(parameterValue.GetPlainString());
+        auto node = expression.GetRootNode();
         if (node) {
           ExpressionVariableReplacer renamer(platform,
                                              GetProjectScopedContainers(),
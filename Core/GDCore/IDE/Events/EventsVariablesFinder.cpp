@@ -164,7 +164,7 @@ class GD_CORE_API VariableFinderEventWorker
                     "number", instrInfos.parameters.GetParameter(pNb).GetType()) ||
                 ParameterMetadata::IsExpression(
                     "string", instrInfos.parameters.GetParameter(pNb).GetType())) {
-          auto node = instruction.GetParameter(pNb).GetRootNode();
+          auto node = instruction.GetParameter(pNb).GetSharedRootNode();
 
           VariableFinderExpressionNodeWorker searcher(
               results,
@@ -94,11 +94,11 @@ bool ExampleExtensionUsagesFinder::DoVisitInstruction(
 
         if (gd::ParameterMetadata::IsExpression("string", parameterType)) {
           rootType = "string";
-          parameterValue.GetRootNode()->Visit(*this);
+          parameterValue.GetSharedRootNode()->Visit(*this);
         } else if (gd::ParameterMetadata::IsExpression("number",
                                                        parameterType)) {
           rootType = "number";
-          parameterValue.GetRootNode()->Visit(*this);
+          parameterValue.GetSharedRootNode()->Visit(*this);
         } else if (gd::ParameterMetadata::IsExpression("variable",
                                                        parameterType))
           AddUsedBuiltinExtension("BuiltinVariables");
@@ -15,6 +15,7 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/ProjectScopedContainers.h"
 #include "GDCore/Tools/Localization.h"
 
@@ -48,15 +49,26 @@ class GD_CORE_API ExpressionTypeFinder : public ExpressionParser2NodeWorker {
   /**
    * \brief Helper function to find the type of the expression or
    * sub-expression that a given node represents.
+   *
+   * The type is stored in the node, and only searched again when the scope
+   * or the root type change.
    */
   static const gd::String GetType(const gd::Platform &platform,
                       const gd::ProjectScopedContainers &projectScopedContainers,
                       const gd::String &rootType,
                       gd::ExpressionNode& node) {
+    gd::ExpressionNodeCache &cache = node.GetCache(
+        projectScopedContainers.GetVersion(), platform.GetGeneration());
+    if (cache.hasType && cache.typeRootType == rootType) return cache.type;
+
     gd::ExpressionTypeFinder typeFinder(
         platform, projectScopedContainers, rootType);
     node.Visit(typeFinder);
-    return typeFinder.GetType();
+
+    cache.hasType = true;
+    cache.typeRootType = rootType;
+    cache.type = typeFinder.GetType();
+    return cache.type;
   }
 
   virtual ~ExpressionTypeFinder(){};
@@ -129,7 +141,7 @@ class GD_CORE_API ExpressionTypeFinder : public ExpressionParser2NodeWorker {
   void OnVisitFunctionCallNode(FunctionCallNode& node) override {
     if (child == nullptr) {
       const gd::ExpressionMetadata &metadata = MetadataProvider::GetFunctionCallMetadata(
-          platform, projectScopedContainers.GetObjectsContainersList(), node);
+          platform, projectScopedContainers, node);
       if (gd::MetadataProvider::IsBadExpressionMetadata(metadata)) {
         VisitParent(node);
       }
@@ -141,7 +153,7 @@ class GD_CORE_API ExpressionTypeFinder : public ExpressionParser2NodeWorker {
       const gd::ParameterMetadata* parameterMetadata =
           gd::MetadataProvider::GetFunctionCallParameterMetadata(
               platform,
-              projectScopedContainers.GetObjectsContainersList(),
+              projectScopedContainers,
               node,
               *child);
       if (parameterMetadata == nullptr || parameterMetadata->GetType().empty()) {
@@ -66,12 +66,37 @@ size_t GetMaximumParametersNumber(
 
 }  // namespace
 
+const gd::ExpressionNodeCache &ExpressionValidator::Validate(
+    const gd::Platform &platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const gd::String &rootType,
+    const gd::String &extraInfo,
+    gd::ExpressionNode &node) {
+  gd::ExpressionNodeCache &cache = node.GetCache(
+      projectScopedContainers.GetVersion(), platform.GetGeneration());
+  if (cache.isValidated && cache.validationRootType == rootType &&
+      cache.validationExtraInfo == extraInfo)
+    return cache;
+
+  gd::ExpressionValidator validator(
+      platform, projectScopedContainers, rootType, extraInfo);
+  node.Visit(validator);
+
+  cache.isValidated = true;
+  cache.validationRootType = rootType;
+  cache.validationExtraInfo = extraInfo;
+  cache.hasFatalErrors = !validator.GetFatalErrors().empty();
+  cache.hasErrors = !validator.GetAllErrors().empty();
+  return cache;
+}
+
 bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
     const gd::IdentifierNode& identifier) {
-  return ValidateObjectVariableOrVariableOrProperty(identifier.identifierName, identifier.identifierNameLocation, identifier.childIdentifierName, identifier.childIdentifierNameLocation);
+  return ValidateObjectVariableOrVariableOrProperty(identifier, identifier.identifierName, identifier.identifierNameLocation, identifier.childIdentifierName, identifier.childIdentifierNameLocation);
 }
 
 bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
+    const gd::ExpressionNode &node,
     const gd::String &identifierName,
     const gd::ExpressionParserLocation identifierNameLocation,
     const gd::String &childIdentifierName,
@@ -103,7 +128,7 @@ bool ExpressionValidator::ValidateObjectVariableOrVariableOrProperty(
   // we consider this node will be of the type required by the parent.
   childType = parentType;
 
-  return projectScopedContainers.MatchIdentifierWithName<bool>(identifierName,
+  return projectScopedContainers.MatchIdentifierWithName<bool>(node, identifierName,
     [&]() {
       // This represents an object.
       if (childIdentifierName.empty()) {
@@ -238,19 +263,9 @@ ExpressionValidator::Type ExpressionValidator::ValidateFunction(
           ? ""
           : objectsContainersList.GetTypeOfObject(function.objectName);
 
-  gd::String behaviorType = function.behaviorName.empty()
-                                ? ""
-                                : objectsContainersList.GetTypeOfBehavior(function.behaviorName);
-
   const gd::ExpressionMetadata& metadata =
-      function.behaviorName.empty()
-          ? function.objectName.empty()
-                ? MetadataProvider::GetAnyExpressionMetadata(
-                      platform, function.functionName)
-                : MetadataProvider::GetObjectAnyExpressionMetadata(
-                      platform, objectType, function.functionName)
-          : MetadataProvider::GetBehaviorAnyExpressionMetadata(
-                platform, behaviorType, function.functionName);
+      MetadataProvider::GetFunctionCallMetadata(
+          platform, projectScopedContainers, function);
 
   Type returnType = StringToType(metadata.GetReturnType());
 
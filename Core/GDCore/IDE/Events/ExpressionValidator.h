@@ -54,14 +54,33 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
   /**
    * \brief Helper function to check if a given node does not contain
    * any error including non-fatal ones.
+   *
+   * The result is stored in the node, and the node is only validated again
+   * when the scope or the root type change.
    */
   static bool HasNoErrors(const gd::Platform &platform,
                       const gd::ProjectScopedContainers & projectScopedContainers,
                       const gd::String &rootType,
                       gd::ExpressionNode& node) {
-    gd::ExpressionValidator validator(platform, projectScopedContainers, rootType);
-    node.Visit(validator);
-    return validator.GetAllErrors().empty();
+    return !Validate(platform, projectScopedContainers, rootType,
+                     emptyParameterExtraInfo, node)
+                .hasErrors;
+  }
+
+  /**
+   * \brief Helper function to check if a given node does not contain any
+   * fatal error, meaning that code can be generated for it.
+   *
+   * \see HasNoErrors
+   */
+  static bool HasNoFatalErrors(const gd::Platform &platform,
+                      const gd::ProjectScopedContainers & projectScopedContainers,
+                      const gd::String &rootType,
+                      const gd::String &extraInfo,
+                      gd::ExpressionNode& node) {
+    return !Validate(platform, projectScopedContainers, rootType, extraInfo,
+                     node)
+                .hasFatalErrors;
   }
 
   /**
@@ -236,7 +255,7 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
       const auto& propertiesContainerList = projectScopedContainers.GetPropertiesContainersList();
 
       forbidsUsageOfBracketsBecauseParentIsObject = false;
-      projectScopedContainers.MatchIdentifierWithName<void>(node.name,
+      projectScopedContainers.MatchIdentifierWithName<void>(node, node.name,
         [&]() {
           // This represents an object.
           variableObjectName = node.name;
@@ -281,7 +300,8 @@ class GD_CORE_API ExpressionValidator : public ExpressionParser2NodeWorker {
     ReportAnyError(node);
     // TODO Also check child-variables existence on a path with only VariableAccessor to raise non-fatal errors.
     if (!variableObjectName.empty()) {
-      ValidateObjectVariableOrVariableOrProperty(variableObjectName,
+      ValidateObjectVariableOrVariableOrProperty(node,
+                                                 variableObjectName,
                                                  variableObjectNameLocation,
                                                  node.name, node.nameLocation);
       variableObjectName = "";
@@ -402,8 +422,16 @@ private:
     VariableOrPropertyOrParameter
   };
   Type ValidateFunction(const gd::FunctionCallNode& function);
+  static const gd::ExpressionNodeCache &Validate(
+      const gd::Platform &platform,
+      const gd::ProjectScopedContainers &projectScopedContainers,
+      const gd::String &rootType,
+      const gd::String &extraInfo,
+      gd::ExpressionNode &node);
+
   bool ValidateObjectVariableOrVariableOrProperty(const gd::IdentifierNode& identifier);
   bool ValidateObjectVariableOrVariableOrProperty(
+      const gd::ExpressionNode &node,
       const gd::String &identifierName,
       const gd::ExpressionParserLocation identifierNameLocation,
       const gd::String &childIdentifierName,
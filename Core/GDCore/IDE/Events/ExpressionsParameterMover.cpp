@@ -148,7 +148,7 @@ bool ExpressionsParameterMover::DoVisitInstruction(gd::Instruction& instruction,
                             pNb < instruction.GetParametersCount();
        ++pNb) {
     const gd::String& type = metadata.parameters.GetParameter(pNb).GetType();
-    const gd::Expression& expression = instruction.GetParameter(pNb);
+    gd::Expression& expression = instruction.GetParameter(pNb);
 
     auto node = expression.GetRootNode();
     if (node) {
@@ -154,7 +154,7 @@ bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
   for (std::size_t pNb = 0; pNb < metadata.parameters.GetParametersCount() &&
                             pNb < instruction.GetParametersCount();
        ++pNb) {
-    const gd::Expression& expression = instruction.GetParameter(pNb);
+    gd::Expression& expression = instruction.GetParameter(pNb);
 
     auto node = expression.GetRootNode();
     if (node) {
@@ -171,7 +171,8 @@ bool ProjectElementRenamer::DoVisitInstruction(gd::Instruction &instruction,
                                      gd::Expression("\"" + newName + "\""));
           }
         }
-        auto node = parameterValue.GetRootNode();
+        gd::Expression expression(parameterValue.GetPlainString());
+        auto node = expression.GetRootNode();
         if (node) {
           ExpressionIdentifierStringFinder finder(
               platform, GetProjectScopedContainers(),
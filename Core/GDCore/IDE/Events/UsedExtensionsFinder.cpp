@@ -87,6 +87,8 @@ const std::vector<gd::String> UsedExtensionsFinder::FindExtensionsDependentOn(
 // Objects scanner
 
 void UsedExtensionsFinder::DoVisitObject(gd::Object &object) {
+  if (!scannedObjectTypes.insert(object.GetInternedType()).second) return;
+
   auto metadata = gd::MetadataProvider::GetExtensionAndObjectMetadata(
       project.GetCurrentPlatform(), object.GetType());
   if (metadata.GetMetadata().IsRenderedIn3D()) {
@@ -104,6 +106,9 @@ void UsedExtensionsFinder::DoVisitObject(gd::Object &object) {
 // Behaviors scanner
 
 void UsedExtensionsFinder::DoVisitBehavior(gd::Behavior &behavior) {
+  if (!scannedBehaviorTypes.insert(behavior.GetInternedTypeName()).second)
+    return;
+
   auto metadata = gd::MetadataProvider::GetExtensionAndBehaviorMetadata(
       project.GetCurrentPlatform(), behavior.GetTypeName());
   result.AddUsedExtension(metadata.GetExtension());
@@ -119,19 +124,32 @@ void UsedExtensionsFinder::DoVisitBehavior(gd::Behavior &behavior) {
 
 bool UsedExtensionsFinder::DoVisitInstruction(gd::Instruction& instruction,
                                               bool isCondition) {
-  auto metadata =
-      isCondition ? gd::MetadataProvider::GetExtensionAndConditionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType())
-                  : gd::MetadataProvider::GetExtensionAndActionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType());
-  result.AddUsedExtension(metadata.GetExtension());
-  for (auto&& includeFile : metadata.GetMetadata().GetIncludeFiles()) {
-    result.AddUsedIncludeFiles(includeFile);
+  auto &scannedInstructionTypes =
+      isCondition ? scannedConditionTypes : scannedActionTypes;
+  auto scannedInstructionIt =
+      scannedInstructionTypes.find(instruction.GetInternedType());
+  const gd::InstructionMetadata *instructionMetadata = nullptr;
+  if (scannedInstructionIt != scannedInstructionTypes.end()) {
+    instructionMetadata = scannedInstructionIt->second;
+  } else {
+    auto metadata =
+        isCondition ? gd::MetadataProvider::GetExtensionAndConditionMetadata(
+                          project.GetCurrentPlatform(), instruction.GetType())
+                    : gd::MetadataProvider::GetExtensionAndActionMetadata(
+                          project.GetCurrentPlatform(), instruction.GetType());
+    result.AddUsedExtension(metadata.GetExtension());
+    for (auto&& includeFile : metadata.GetMetadata().GetIncludeFiles()) {
+      result.AddUsedIncludeFiles(includeFile);
+    }
+
+    instructionMetadata = &metadata.GetMetadata();
+    scannedInstructionTypes[instruction.GetInternedType()] =
+        instructionMetadata;
   }
 
   gd::ParameterMetadataTools::IterateOverParameters(
       instruction.GetParameters(),
-      metadata.GetMetadata().GetParameters(),
+      instructionMetadata->GetParameters(),
       [this](const gd::ParameterMetadata& parameterMetadata,
           const gd::Expression& parameterValue,
           const gd::String& lastObjectName) {
@@ -139,10 +157,10 @@ bool UsedExtensionsFinder::DoVisitInstruction(gd::Instruction& instruction,
 
     if (gd::ParameterMetadata::IsExpression("string", parameterType)) {
       rootType = "string";
-      parameterValue.GetRootNode()->Visit(*this);
+      parameterValue.GetSharedRootNode()->Visit(*this);
     } else if (gd::ParameterMetadata::IsExpression("number", parameterType)) {
       rootType = "number";
-      parameterValue.GetRootNode()->Visit(*this);
+      parameterValue.GetSharedRootNode()->Visit(*this);
     } else if (gd::ParameterMetadata::IsExpression("variable", parameterType))
       result.AddUsedBuiltinExtension(project, "BuiltinVariables");
   });
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
@@ -16,11 +18,13 @@
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 
 namespace gd {
 class Project;
 class Object;
 class Behavior;
+class InstructionMetadata;
 }  // namespace gd
 
 namespace gd {
@@ -103,6 +107,15 @@ private:
   gd::String rootType;
   UsedExtensionsResult result;
 
+  // Types already scanned: objects, behaviors and instructions of the same
+  // type are only looked up once in the platform metadata.
+  std::unordered_set<gd::InternedString> scannedObjectTypes;
+  std::unordered_set<gd::InternedString> scannedBehaviorTypes;
+  std::unordered_map<gd::InternedString, const gd::InstructionMetadata*>
+      scannedActionTypes;
+  std::unordered_map<gd::InternedString, const gd::InstructionMetadata*>
+      scannedConditionTypes;
+
   // Object Visitor
   void DoVisitObject(gd::Object& object) override;
 
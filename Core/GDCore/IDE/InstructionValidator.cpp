@@ -27,7 +27,7 @@ namespace gd {
 
 ParameterValidationResult InstructionValidator::ValidateParameter(
     const gd::Platform &platform,
-    const gd::ProjectScopedContainers projectScopedContainers,
+    const gd::ProjectScopedContainers &projectScopedContainers,
     const gd::Instruction &instruction, const InstructionMetadata &metadata,
     std::size_t parameterIndex) {
   ParameterValidationResult result;
@@ -66,7 +66,7 @@ ParameterValidationResult InstructionValidator::ValidateParameter(
       gd::ParameterMetadata::IsExpression("string", parameterType) ||
       gd::ParameterMetadata::IsExpression("variable", parameterType)) {
     auto &expressionNode =
-        *instruction.GetParameter(parameterIndex).GetRootNode();
+        *instruction.GetParameter(parameterIndex).GetSharedRootNode();
     ExpressionValidator expressionValidator(platform, projectScopedContainers,
                                             parameterType,
                                             parameterMetadata.GetExtraInfo());
@@ -123,7 +123,7 @@ ParameterValidationResult InstructionValidator::ValidateParameter(
 
 bool InstructionValidator::IsParameterValid(
     const gd::Platform &platform,
-    const gd::ProjectScopedContainers projectScopedContainers,
+    const gd::ProjectScopedContainers &projectScopedContainers,
     const gd::Instruction &instruction, const InstructionMetadata &metadata,
     std::size_t parameterIndex) {
   return ValidateParameter(platform, projectScopedContainers, instruction,
@@ -45,7 +45,7 @@ public:
    */
   static ParameterValidationResult ValidateParameter(
       const gd::Platform &platform,
-      const gd::ProjectScopedContainers projectScopedContainers,
+      const gd::ProjectScopedContainers &projectScopedContainers,
       const gd::Instruction &instruction, const InstructionMetadata &metadata,
       std::size_t parameterIndex);
 
@@ -56,7 +56,7 @@ public:
    */
   static bool
   IsParameterValid(const gd::Platform &platform,
-                   const gd::ProjectScopedContainers projectScopedContainers,
+                   const gd::ProjectScopedContainers &projectScopedContainers,
                    const gd::Instruction &instruction,
                    const InstructionMetadata &metadata,
                    std::size_t parameterIndex);
@@ -0,0 +1,370 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/PlatformMetadataSnapshot.h"
+
+#include <map>
+#include <typeinfo>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Extensions/ExtensionBindingsRegistry.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/BehaviorsSharedData.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/VersionWrapper.h"
+
+namespace gd {
+
+namespace {
+
+template <class T>
+void FindUnboundCodeGenerators(const gd::String& prefix,
+                               const gd::SerializerElement& element,
+                               const std::map<gd::String, T>& metadata,
+                               std::vector<gd::String>& problems) {
+  element.ConsiderAsArrayOf("metadata");
+  for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& metadataElement = element.GetChild(i);
+    if (!metadataElement.GetBoolAttribute("customCodeGenerator")) continue;
+
+    const gd::String& type = metadataElement.GetStringAttribute("type");
+    auto it = metadata.find(type);
+    if (it == metadata.end() || !it->second.HasCustomCodeGenerator())
+      problems.push_back(prefix + "\"" + type + "\" has no code generator.");
+  }
+}
+
+template <class T>
+void FindUnboundInstructionsAndExpressions(
+    const gd::String& prefix,
+    const gd::SerializerElement& element,
+    const T& metadata,
+    std::vector<gd::String>& problems) {
+  FindUnboundCodeGenerators(prefix + "condition ",
+                            element.GetChild("conditions"),
+                            metadata.conditionsInfos,
+                            problems);
+  FindUnboundCodeGenerators(prefix + "action ",
+                            element.GetChild("actions"),
+                            metadata.actionsInfos,
+                            problems);
+  FindUnboundCodeGenerators(prefix + "expression ",
+                            element.GetChild("expressions"),
+                            metadata.expressionsInfos,
+                            problems);
+  FindUnboundCodeGenerators(prefix + "string expression ",
+                            element.GetChild("strExpressions"),
+                            metadata.strExpressionsInfos,
+                            problems);
+}
+
+/**
+ * Adapter giving to FindUnboundInstructionsAndExpressions the same
+ * members as the object and behavior metadata.
+ */
+struct ExtensionInstructionsAndExpressions {
+  ExtensionInstructionsAndExpressions(gd::PlatformExtension& extension)
+      : conditionsInfos(extension.GetAllConditions()),
+        actionsInfos(extension.GetAllActions()),
+        expressionsInfos(extension.GetAllExpressions()),
+        strExpressionsInfos(extension.GetAllStrExpressions()){};
+
+  const std::map<gd::String, gd::InstructionMetadata>& conditionsInfos;
+  const std::map<gd::String, gd::InstructionMetadata>& actionsInfos;
+  const std::map<gd::String, gd::ExpressionMetadata>& expressionsInfos;
+  const std::map<gd::String, gd::ExpressionMetadata>& strExpressionsInfos;
+};
+
+/**
+ * Check that everything recorded in the snapshot of an extension, but that
+ * can't be serialized, was bound.
+ */
+void FindUnboundEntries(gd::PlatformExtension& extension,
+                        const gd::SerializerElement& element,
+                        std::vector<gd::String>& problems) {
+  const gd::String prefix = extension.GetName() + ": ";
+  FindUnboundInstructionsAndExpressions(
+      prefix, element, ExtensionInstructionsAndExpressions(extension), problems);
+
+  const gd::SerializerElement& objectsElement = element.GetChild("objects");
+  objectsElement.ConsiderAsArrayOf("object");
+  for (std::size_t i = 0; i < objectsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& objectElement = objectsElement.GetChild(i);
+    const gd::String& type = objectElement.GetStringAttribute("type");
+    const gd::ObjectMetadata& metadata =
+        extension.GetAllObjectsMetadata().find(type)->second;
+    if (objectElement.GetBoolAttribute("hasCreationFunction") &&
+        !metadata.createFunPtr)
+      problems.push_back(prefix + "object \"" + type +
+                         "\" has no creation function.");
+    FindUnboundInstructionsAndExpressions(
+        prefix + "object \"" + type + "\" ", objectElement, metadata, problems);
+  }
+
+  const gd::SerializerElement& behaviorsElement =
+      element.GetChild("behaviors");
+  behaviorsElement.ConsiderAsArrayOf("behavior");
+  for (std::size_t i = 0; i < behaviorsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& behaviorElement = behaviorsElement.GetChild(i);
+    const gd::String& type = behaviorElement.GetStringAttribute("type");
+    const gd::BehaviorMetadata& metadata =
+        extension.GetAllBehaviorsMetadata().find(type)->second;
+    if (!metadata.HasInstance()) {
+      // Nothing else can be checked safely without the behavior instance.
+      problems.push_back(prefix + "behavior \"" + type +
+                         "\" has no instance.");
+      continue;
+    }
+    if (behaviorElement.GetBoolAttribute("hasSharedData") &&
+        !metadata.GetSharedDataInstance())
+      problems.push_back(prefix + "behavior \"" + type +
+                         "\" has no shared data instance.");
+    FindUnboundInstructionsAndExpressions(prefix + "behavior \"" + type + "\" ",
+                                          behaviorElement,
+                                          metadata,
+                                          problems);
+  }
+
+  const gd::SerializerElement& eventsElement = element.GetChild("events");
+  eventsElement.ConsiderAsArrayOf("event");
+  for (std::size_t i = 0; i < eventsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& eventElement = eventsElement.GetChild(i);
+    const gd::String& type = eventElement.GetStringAttribute("type");
+    const gd::EventMetadata& metadata = extension.GetAllEvents()[type];
+    if (eventElement.GetBoolAttribute("customCodeGenerator") &&
+        !metadata.HasCustomCodeGenerator())
+      problems.push_back(prefix + "event \"" + type +
+                         "\" has no code generator.");
+    if (eventElement.GetBoolAttribute("hasInstance") && !metadata.instance)
+      problems.push_back(prefix + "event \"" + type + "\" has no instance.");
+  }
+}
+
+/**
+ * Compare two serialized extensions, reporting the differing entries (for the
+ * children which are arrays of typed metadata) or the differing children.
+ */
+void FindSerializedDifferences(const gd::String& extensionName,
+                               const gd::SerializerElement& declared,
+                               const gd::SerializerElement& snapshot,
+                               std::vector<gd::String>& differences) {
+  for (const auto& attribute : declared.GetAllAttributes()) {
+    if (attribute.second.GetString() !=
+        snapshot.GetStringAttribute(attribute.first))
+      differences.push_back(extensionName + ": \"" + attribute.first +
+                            "\" differs from the snapshot.");
+  }
+
+  for (const auto& child : declared.GetAllChildren()) {
+    const gd::String& childName = child.first;
+    const gd::SerializerElement& declaredChild = *child.second;
+    const gd::SerializerElement& snapshotChild = snapshot.GetChild(childName);
+    if (gd::Serializer::ToJSON(declaredChild) ==
+        gd::Serializer::ToJSON(snapshotChild))
+      continue;
+
+    // Arrays of metadata (one of them can be empty) are compared entry by
+    // entry, to tell which ones changed.
+    bool hasTypedEntries = false;
+    for (const auto& entry : declaredChild.GetAllChildren())
+      hasTypedEntries |= entry.second->HasAttribute("type");
+
+    std::map<gd::String, gd::String> snapshotEntries;
+    for (const auto& entry : snapshotChild.GetAllChildren()) {
+      if (entry.second->HasAttribute("type")) {
+        hasTypedEntries = true;
+        snapshotEntries[entry.second->GetStringAttribute("type")] =
+            gd::Serializer::ToJSON(*entry.second);
+      }
+    }
+    if (!hasTypedEntries) {
+      differences.push_back(extensionName + ": " + childName +
+                            " differ from the snapshot.");
+      continue;
+    }
+
+    for (const auto& entry : declaredChild.GetAllChildren()) {
+      const gd::String& type = entry.second->GetStringAttribute("type");
+      auto snapshotEntry = snapshotEntries.find(type);
+      if (snapshotEntry == snapshotEntries.end()) {
+        differences.push_back(extensionName + ": " + childName + " \"" + type +
+                              "\" is missing from the snapshot.");
+        continue;
+      }
+      if (snapshotEntry->second != gd::Serializer::ToJSON(*entry.second))
+        differences.push_back(extensionName + ": " + childName + " \"" + type +
+                              "\" differs from the snapshot.");
+      snapshotEntries.erase(snapshotEntry);
+    }
+    for (const auto& snapshotEntry : snapshotEntries)
+      differences.push_back(extensionName + ": " + childName + " \"" +
+                            snapshotEntry.first +
+                            "\" is only in the snapshot.");
+  }
+}
+
+/**
+ * Check that the instances bound to a restored extension are of the same
+ * classes as the ones of the declared extension.
+ */
+void FindInstancesDifferences(gd::PlatformExtension& declared,
+                              gd::PlatformExtension& restored,
+                              std::vector<gd::String>& differences) {
+  const gd::String prefix = declared.GetName() + ": ";
+  for (const auto& it : declared.GetAllEvents()) {
+    if (!it.second.instance) continue;
+    const std::shared_ptr<gd::BaseEvent>& instance =
+        restored.GetAllEvents()[it.first].instance;
+    if (!instance || typeid(*instance) != typeid(*it.second.instance))
+      differences.push_back(prefix + "event \"" + it.first +
+                            "\" is not bound to the declared class.");
+  }
+
+  for (const auto& it : declared.GetAllObjectsMetadata()) {
+    if (!it.second.createFunPtr) continue;
+    auto restoredObject = restored.GetAllObjectsMetadata().find(it.first);
+    if (restoredObject == restored.GetAllObjectsMetadata().end() ||
+        !restoredObject->second.createFunPtr)
+      continue;  // Already reported when restoring.
+
+    std::unique_ptr<gd::ObjectConfiguration> declaredConfiguration =
+        it.second.createFunPtr();
+    std::unique_ptr<gd::ObjectConfiguration> restoredConfiguration =
+        restoredObject->second.createFunPtr();
+    if (typeid(*declaredConfiguration) != typeid(*restoredConfiguration))
+      differences.push_back(prefix + "object \"" + it.first +
+                            "\" is not created with the declared class.");
+  }
+
+  for (const auto& it : declared.GetAllBehaviorsMetadata()) {
+    auto restoredBehavior = restored.GetAllBehaviorsMetadata().find(it.first);
+    if (restoredBehavior == restored.GetAllBehaviorsMetadata().end() ||
+        !restoredBehavior->second.HasInstance())
+      continue;  // Already reported when restoring.
+
+    gd::BehaviorsSharedData* declaredSharedData =
+        it.second.GetSharedDataInstance();
+    gd::BehaviorsSharedData* restoredSharedData =
+        restoredBehavior->second.GetSharedDataInstance();
+    if (typeid(it.second.Get()) != typeid(restoredBehavior->second.Get()) ||
+        (declaredSharedData && restoredSharedData &&
+         typeid(*declaredSharedData) != typeid(*restoredSharedData)))
+      differences.push_back(prefix + "behavior \"" + it.first +
+                            "\" is not bound to the declared classes.");
+  }
+}
+
+}  // namespace
+
+void PlatformMetadataSnapshot::SerializeTo(
+    const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions,
+    gd::SerializerElement& snapshot) {
+  snapshot.SetAttribute("gdVersion", gd::VersionWrapper::FullString());
+  gd::SerializerElement& extensionsElement = snapshot.AddChild("extensions");
+  extensionsElement.ConsiderAsArrayOf("extension");
+  for (const auto& extension : extensions)
+    extension->SerializeTo(extensionsElement.AddChild("extension"));
+}
+
+std::vector<gd::String> PlatformMetadataSnapshot::Restore(
+    const gd::SerializerElement& snapshot,
+    const gd::ExtensionBindingsRegistry& registry,
+    std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions) {
+  std::vector<gd::String> problems;
+  if (snapshot.GetStringAttribute("gdVersion") !=
+      gd::VersionWrapper::FullString()) {
+    problems.push_back("The snapshot was made by GDevelop " +
+                       snapshot.GetStringAttribute("gdVersion") + ".");
+    return problems;
+  }
+
+  const gd::SerializerElement& extensionsElement =
+      snapshot.GetChild("extensions");
+  extensionsElement.ConsiderAsArrayOf("extension");
+  for (std::size_t i = 0; i < extensionsElement.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& extensionElement =
+        extensionsElement.GetChild(i);
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    extension->UnserializeFrom(extensionElement);
+    registry.BindTo(*extension);
+    FindUnboundEntries(*extension, extensionElement, problems);
+    extensions.push_back(extension);
+  }
+
+  return problems;
+}
+
+bool PlatformMetadataSnapshot::UnserializeFrom(
+    const gd::SerializerElement& snapshot,
+    const gd::ExtensionBindingsRegistry& registry,
+    std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions) {
+  std::vector<std::shared_ptr<gd::PlatformExtension>> restoredExtensions;
+  std::vector<gd::String> problems =
+      Restore(snapshot, registry, restoredExtensions);
+  if (!problems.empty()) {
+    for (const gd::String& problem : problems)
+      gd::LogError("Unable to restore the platform metadata snapshot - " +
+                   problem);
+    return false;
+  }
+
+  extensions.insert(
+      extensions.end(), restoredExtensions.begin(), restoredExtensions.end());
+  return true;
+}
+
+std::vector<gd::String> PlatformMetadataSnapshot::FindDifferences(
+    const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions,
+    const gd::SerializerElement& snapshot,
+    const gd::ExtensionBindingsRegistry& registry) {
+  std::vector<std::shared_ptr<gd::PlatformExtension>> restoredExtensions;
+  std::vector<gd::String> differences =
+      Restore(snapshot, registry, restoredExtensions);
+
+  const gd::SerializerElement& extensionsElement =
+      snapshot.GetChild("extensions");
+  extensionsElement.ConsiderAsArrayOf("extension");
+  std::map<gd::String, std::size_t> snapshotIndices;
+  for (std::size_t i = 0; i < extensionsElement.GetChildrenCount(); ++i)
+    snapshotIndices[extensionsElement.GetChild(i).GetStringAttribute("name")] =
+        i;
+
+  for (const auto& extension : extensions) {
+    auto snapshotIndex = snapshotIndices.find(extension->GetName());
+    if (snapshotIndex == snapshotIndices.end()) {
+      differences.push_back(extension->GetName() +
+                            ": the extension is missing from the snapshot.");
+      continue;
+    }
+
+    gd::SerializerElement declaredElement;
+    extension->SerializeTo(declaredElement);
+    FindSerializedDifferences(extension->GetName(),
+                              declaredElement,
+                              extensionsElement.GetChild(snapshotIndex->second),
+                              differences);
+    if (snapshotIndex->second < restoredExtensions.size())
+      FindInstancesDifferences(*extension,
+                               *restoredExtensions[snapshotIndex->second],
+                               differences);
+    snapshotIndices.erase(snapshotIndex);
+  }
+  for (const auto& snapshotIndex : snapshotIndices)
+    differences.push_back(snapshotIndex.first +
+                          ": the extension is only in the snapshot.");
+
+  return differences;
+}
+
+}  // namespace gd
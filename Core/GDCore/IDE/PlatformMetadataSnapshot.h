@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class ExtensionBindingsRegistry;
+class PlatformExtension;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Tool class to store the metadata declared by the extensions of a
+ * platform into a snapshot, and to restore the extensions from it without
+ * running their declarations.
+ *
+ * What can't be serialized (code generators, event instances, object creation
+ * functions and behavior instances) is bound again by name using a
+ * gd::ExtensionBindingsRegistry. The snapshot is only valid for the version of
+ * GDevelop that created it.
+ *
+ * \see gd::PlatformExtension::SerializeTo
+ */
+class GD_CORE_API PlatformMetadataSnapshot {
+ public:
+  /**
+   * \brief Serialize the metadata of the extensions.
+   */
+  static void SerializeTo(
+      const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions,
+      gd::SerializerElement& snapshot);
+
+  /**
+   * \brief Restore the extensions from a snapshot and bind them using the
+   * registry.
+   *
+   * \return false (and no extensions) if the snapshot was made by another
+   * version of GDevelop or if a code generator or an instance recorded in the
+   * snapshot was not bound.
+   */
+  static bool UnserializeFrom(
+      const gd::SerializerElement& snapshot,
+      const gd::ExtensionBindingsRegistry& registry,
+      std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions);
+
+  /**
+   * \brief Check that a snapshot matches the declarations of the extensions.
+   *
+   * The declared metadata is compared to the snapshot, then the extensions
+   * restored from the snapshot are checked to be bound to code generators and
+   * to instances of the same classes as the declared ones.
+   *
+   * \return A description of each difference (empty if the snapshot is
+   * consistent with the extensions).
+   */
+  static std::vector<gd::String> FindDifferences(
+      const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions,
+      const gd::SerializerElement& snapshot,
+      const gd::ExtensionBindingsRegistry& registry);
+
+ private:
+  static std::vector<gd::String> Restore(
+      const gd::SerializerElement& snapshot,
+      const gd::ExtensionBindingsRegistry& registry,
+      std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions);
+
+  PlatformMetadataSnapshot(){};
+  virtual ~PlatformMetadataSnapshot(){};
+};
+
+}  // namespace gd
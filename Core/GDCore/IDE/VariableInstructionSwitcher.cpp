@@ -213,7 +213,7 @@ VariableInstructionSwitcher::GetVariableTypeFromParameters(
 
   const std::size_t variableParameterIndex = isObjectVariable ? 1 : 0;
   auto &variableExpressionNode =
-      *instruction.GetParameter(variableParameterIndex).GetRootNode();
+      *instruction.GetParameter(variableParameterIndex).GetSharedRootNode();
 
   auto variableType = gd::ExpressionVariablePathFinder::GetVariableType(
       platform, projectScopedContainers, variableExpressionNode, objectName);
@@ -0,0 +1,675 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "WholeProjectDiagnosticsChecker.h"
+
+#include <set>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/ContainersSignatureTools.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/InstructionValidator.h"
+#include "GDCore/IDE/VariableInstructionSwitcher.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsContainer.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/NamedPropertyDescriptor.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/ObjectsContainersList.h"
+#include "GDCore/Project/ParameterMetadataContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "GDCore/Project/PropertiesContainer.h"
+#include "GDCore/Project/ResourcesContainer.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Project/VariablesContainersList.h"
+#include "GDCore/Tools/Localization.h"
+
+namespace {
+/**
+ * \brief Combine the hash of a value with another hash, like the hash of the
+ * scope of this value.
+ */
+std::size_t CombineHashes(std::size_t hash, std::size_t otherHash) {
+  return hash ^ (otherHash + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+}
+
+void AddParametersSignature(const gd::ParameterMetadataContainer &parameters,
+                            gd::String &signature) {
+  for (std::size_t i = 0; i < parameters.GetParametersCount(); ++i) {
+    const gd::ParameterMetadata &parameter = parameters.GetParameter(i);
+    signature += parameter.GetName() + ":" + parameter.GetType() + ":" +
+                 parameter.GetExtraInfo() + ",";
+  }
+  signature += "\n";
+}
+
+void AddPropertiesSignature(const gd::PropertiesContainer &properties,
+                            gd::String &signature) {
+  for (const auto &property : properties.GetInternalVector()) {
+    signature += property->GetName() + ":" + property->GetType() + ",";
+  }
+  signature += "\n";
+}
+
+/**
+ * \brief Return a string identifying everything in the scope that can change
+ * the issues of events: objects, groups, variables, properties and parameters.
+ */
+gd::String GetScopeSignature(
+    const gd::ProjectScopedContainers &projectScopedContainers) {
+  gd::String signature;
+
+  const auto &objectsContainersList =
+      projectScopedContainers.GetObjectsContainersList();
+  for (std::size_t i = 0; i < objectsContainersList.GetObjectsContainersCount();
+       ++i) {
+    gd::ContainersSignatureTools::AddObjectsSignature(
+        objectsContainersList.GetObjectsContainer(i), signature);
+    signature += "\n";
+  }
+
+  const auto &variablesContainersList =
+      projectScopedContainers.GetVariablesContainersList();
+  for (std::size_t i = 0;
+       i < variablesContainersList.GetVariablesContainersCount();
+       ++i) {
+    signature += gd::String::From(static_cast<int>(
+        variablesContainersList.GetVariablesContainer(i).GetSourceType()));
+    gd::ContainersSignatureTools::AddVariablesSignature(
+        variablesContainersList.GetVariablesContainer(i), signature);
+  }
+
+  projectScopedContainers.GetPropertiesContainersList()
+      .ForEachPropertyMatchingSearch(
+          "", [&signature](const gd::NamedPropertyDescriptor &property) {
+            signature += property.GetName() + ":" + property.GetType() + ",";
+          });
+  signature += "\n";
+
+  for (const auto *parameters :
+       projectScopedContainers.GetParametersVectorsList()) {
+    AddParametersSignature(*parameters, signature);
+  }
+
+  return signature;
+}
+
+void AddInstructionsSignature(const gd::InstructionsList &instructions,
+                              gd::String &signature) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    const gd::Instruction &instruction = instructions[i];
+    signature += instruction.GetType();
+    if (instruction.IsInverted()) signature += "!";
+    if (instruction.IsAwaited()) signature += "&";
+    signature += "(";
+    for (std::size_t p = 0; p < instruction.GetParametersCount(); ++p) {
+      signature += instruction.GetParameter(p).GetPlainString() + "\n";
+    }
+    signature += ")";
+    if (!instruction.GetSubInstructions().empty()) {
+      signature += "{";
+      AddInstructionsSignature(instruction.GetSubInstructions(), signature);
+      signature += "}";
+    }
+    signature += ";";
+  }
+  signature += "\n";
+}
+
+/**
+ * \brief Return a string identifying the content of an event, without its
+ * sub-events.
+ */
+gd::String GetEventSignature(const gd::BaseEvent &event) {
+  gd::String signature = event.GetType() + "\n";
+  for (const auto *conditions : event.GetAllConditionsVectors())
+    AddInstructionsSignature(*conditions, signature);
+  signature += "\n";
+  for (const auto *actions : event.GetAllActionsVectors())
+    AddInstructionsSignature(*actions, signature);
+  signature += "\n";
+  for (const auto &expressionAndMetadata :
+       event.GetAllExpressionsWithMetadata())
+    signature += expressionAndMetadata.first->GetPlainString() + "\n";
+
+  return signature;
+}
+
+void AddEventsFunctionsSignature(
+    const gd::EventsFunctionsContainer &eventsFunctions,
+    gd::String &signature) {
+  for (const auto &eventsFunction : eventsFunctions.GetInternalVector()) {
+    signature +=
+        eventsFunction->GetName() + ":" +
+        gd::String::From(static_cast<int>(eventsFunction->GetFunctionType())) +
+        ":" + eventsFunction->GetExpressionType().GetName() + ":" +
+        eventsFunction->GetExpressionType().GetExtraInfo() + "(";
+    AddParametersSignature(eventsFunction->GetParameters(), signature);
+    signature += ")";
+  }
+  signature += "\n";
+}
+
+/**
+ * \brief Return a string identifying the functions, behaviors and objects
+ * declared by the extensions of the project, that can be used by any event.
+ */
+gd::String GetFunctionsSignature(const gd::Project &project) {
+  gd::String signature;
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(e);
+    signature += eventsFunctionsExtension.GetName() + "\n";
+    AddEventsFunctionsSignature(eventsFunctionsExtension.GetEventsFunctions(),
+                                signature);
+    for (const auto &eventsBasedBehavior :
+         eventsFunctionsExtension.GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      signature += eventsBasedBehavior->GetName() + "\n";
+      AddEventsFunctionsSignature(eventsBasedBehavior->GetEventsFunctions(),
+                                  signature);
+      AddPropertiesSignature(eventsBasedBehavior->GetPropertyDescriptors(),
+                             signature);
+      AddPropertiesSignature(
+          eventsBasedBehavior->GetSharedPropertyDescriptors(), signature);
+    }
+    for (const auto &eventsBasedObject :
+         eventsFunctionsExtension.GetEventsBasedObjects()
+             .GetInternalVector()) {
+      signature += eventsBasedObject->GetName() + "\n";
+      AddEventsFunctionsSignature(eventsBasedObject->GetEventsFunctions(),
+                                  signature);
+      AddPropertiesSignature(eventsBasedObject->GetPropertyDescriptors(),
+                             signature);
+    }
+  }
+  return signature;
+}
+}  // namespace
+
+namespace gd {
+
+void WholeProjectDiagnosticsChecker::Check(
+    const gd::Project &project,
+    gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport) {
+  wholeProjectDiagnosticReport.Clear();
+  checkedEventsCount = 0;
+  reusedEventsCount = 0;
+
+  // Functions of extensions can be used by any event, so all the events are
+  // checked again when one of them is changed.
+  std::size_t newFunctionsHash =
+      std::hash<gd::String>()(GetFunctionsSignature(project));
+  if (newFunctionsHash != functionsHash) {
+    eventsListsResults.clear();
+    functionsHash = newFunctionsHash;
+  }
+
+  const gd::Platform &platform = project.GetCurrentPlatform();
+  std::set<gd::String> checkedKeys;
+  auto checkEventsList =
+      [&](const gd::ProjectScopedContainers &projectScopedContainers,
+          const gd::String &key,
+          const gd::String &reportName,
+          const gd::EventsList &events,
+          bool alwaysReport) {
+        checkedKeys.insert(key);
+        CheckEventsList(platform,
+                        projectScopedContainers,
+                        key,
+                        reportName,
+                        events,
+                        alwaysReport,
+                        wholeProjectDiagnosticReport);
+      };
+
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    const gd::Layout &layout = project.GetLayout(i);
+    auto projectScopedContainers = gd::ProjectScopedContainers::
+        MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+    checkEventsList(projectScopedContainers,
+                    "Scene:" + layout.GetName(),
+                    layout.GetName(),
+                    layout.GetEvents(),
+                    true);
+  }
+
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    const gd::ExternalEvents &externalEvents = project.GetExternalEvents(i);
+    const gd::String &associatedLayout = externalEvents.GetAssociatedLayout();
+    auto projectScopedContainers =
+        project.HasLayoutNamed(associatedLayout)
+            ? gd::ProjectScopedContainers::
+                  MakeNewProjectScopedContainersForProjectAndLayout(
+                      project, project.GetLayout(associatedLayout))
+            : gd::ProjectScopedContainers::
+                  MakeNewProjectScopedContainersForProject(project);
+    checkEventsList(projectScopedContainers,
+                    "ExternalEvents:" + externalEvents.GetName(),
+                    externalEvents.GetName(),
+                    externalEvents.GetEvents(),
+                    true);
+  }
+
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(e);
+    const gd::String &extensionName = eventsFunctionsExtension.GetName();
+
+    for (const auto &eventsFunction :
+         eventsFunctionsExtension.GetEventsFunctions().GetInternalVector()) {
+      gd::ObjectsContainer parameterObjectsContainer(
+          gd::ObjectsContainer::SourceType::Function);
+      gd::VariablesContainer parameterVariablesContainer(
+          gd::VariablesContainer::SourceType::Parameters);
+      gd::ResourcesContainer parameterResourcesContainer(
+          gd::ResourcesContainer::SourceType::Parameters);
+      auto projectScopedContainers = gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForFreeEventsFunction(
+              project,
+              eventsFunctionsExtension,
+              *eventsFunction,
+              parameterObjectsContainer,
+              parameterVariablesContainer,
+              parameterResourcesContainer);
+      gd::String name = extensionName + "::" + eventsFunction->GetName();
+      checkEventsList(projectScopedContainers,
+                      "Function:" + name,
+                      name,
+                      eventsFunction->GetEvents(),
+                      false);
+    }
+
+    for (const auto &eventsBasedBehavior :
+         eventsFunctionsExtension.GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      for (const auto &eventsFunction :
+           eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+        gd::ObjectsContainer parameterObjectsContainer(
+            gd::ObjectsContainer::SourceType::Function);
+        gd::VariablesContainer parameterVariablesContainer(
+            gd::VariablesContainer::SourceType::Parameters);
+        gd::VariablesContainer propertyVariablesContainer(
+            gd::VariablesContainer::SourceType::Properties);
+        gd::ResourcesContainer parameterResourcesContainer(
+            gd::ResourcesContainer::SourceType::Parameters);
+        gd::ResourcesContainer propertyResourcesContainer(
+            gd::ResourcesContainer::SourceType::Properties);
+        auto projectScopedContainers = gd::ProjectScopedContainers::
+            MakeNewProjectScopedContainersForBehaviorEventsFunction(
+                project,
+                eventsFunctionsExtension,
+                *eventsBasedBehavior,
+                *eventsFunction,
+                parameterObjectsContainer,
+                parameterVariablesContainer,
+                propertyVariablesContainer,
+                parameterResourcesContainer,
+                propertyResourcesContainer);
+        gd::String name = extensionName + "::" +
+                          eventsBasedBehavior->GetName() +
+                          "::" + eventsFunction->GetName();
+        checkEventsList(projectScopedContainers,
+                        "BehaviorFunction:" + name,
+                        name,
+                        eventsFunction->GetEvents(),
+                        false);
+      }
+    }
+
+    for (const auto &eventsBasedObject :
+         eventsFunctionsExtension.GetEventsBasedObjects()
+             .GetInternalVector()) {
+      for (const auto &eventsFunction :
+           eventsBasedObject->GetEventsFunctions().GetInternalVector()) {
+        gd::ObjectsContainer parameterObjectsContainer(
+            gd::ObjectsContainer::SourceType::Function);
+        gd::VariablesContainer parameterVariablesContainer(
+            gd::VariablesContainer::SourceType::Parameters);
+        gd::VariablesContainer propertyVariablesContainer(
+            gd::VariablesContainer::SourceType::Properties);
+        gd::ResourcesContainer parameterResourcesContainer(
+            gd::ResourcesContainer::SourceType::Parameters);
+        gd::ResourcesContainer propertyResourcesContainer(
+            gd::ResourcesContainer::SourceType::Properties);
+        auto projectScopedContainers = gd::ProjectScopedContainers::
+            MakeNewProjectScopedContainersForObjectEventsFunction(
+                project,
+                eventsFunctionsExtension,
+                *eventsBasedObject,
+                *eventsFunction,
+                parameterObjectsContainer,
+                parameterVariablesContainer,
+                propertyVariablesContainer,
+                parameterResourcesContainer,
+                propertyResourcesContainer);
+        gd::String name = extensionName + "::" + eventsBasedObject->GetName() +
+                          "::" + eventsFunction->GetName();
+        checkEventsList(projectScopedContainers,
+                        "ObjectFunction:" + name,
+                        name,
+                        eventsFunction->GetEvents(),
+                        false);
+      }
+    }
+  }
+
+  // Forget the results of the removed scenes, external events and functions.
+  for (auto it = eventsListsResults.begin(); it != eventsListsResults.end();) {
+    if (checkedKeys.find(it->first) == checkedKeys.end())
+      it = eventsListsResults.erase(it);
+    else
+      ++it;
+  }
+}
+
+void WholeProjectDiagnosticsChecker::CheckEventsList(
+    const gd::Platform &platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const gd::String &key,
+    const gd::String &reportName,
+    const gd::EventsList &events,
+    bool alwaysReport,
+    gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport) {
+  std::size_t scopeHash =
+      std::hash<gd::String>()(GetScopeSignature(projectScopedContainers));
+  EventsListResults &eventsListResults = eventsListsResults[key];
+  if (eventsListResults.scopeHash != scopeHash) {
+    eventsListResults.scopeHash = scopeHash;
+    eventsListResults.eventsResults.clear();
+  }
+
+  // Results of events that are not found anymore are dropped.
+  std::unordered_map<const gd::BaseEvent *, EventResults> eventsResults;
+  std::vector<gd::ProjectDiagnostic> diagnostics;
+  CheckEvents(platform,
+              projectScopedContainers,
+              events,
+              0,
+              eventsListResults.eventsResults,
+              eventsResults,
+              diagnostics);
+  eventsListResults.eventsResults = std::move(eventsResults);
+
+  if (diagnostics.empty() && !alwaysReport) return;
+
+  gd::DiagnosticReport &diagnosticReport =
+      wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(reportName);
+  for (const auto &diagnostic : diagnostics) diagnosticReport.Add(diagnostic);
+}
+
+void WholeProjectDiagnosticsChecker::CheckEvents(
+    const gd::Platform &platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const gd::EventsList &events,
+    std::size_t localVariablesHash,
+    std::unordered_map<const gd::BaseEvent *, EventResults>
+        &previousEventsResults,
+    std::unordered_map<const gd::BaseEvent *, EventResults> &eventsResults,
+    std::vector<gd::ProjectDiagnostic> &diagnostics) {
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent &event = events.GetEvent(i);
+    // Like for code generation, disabled events are ignored.
+    if (event.IsDisabled()) continue;
+
+    if (!event.HasVariables()) {
+      CheckEvent(platform,
+                 projectScopedContainers,
+                 event,
+                 localVariablesHash,
+                 previousEventsResults,
+                 eventsResults,
+                 diagnostics);
+      continue;
+    }
+
+    auto eventProjectScopedContainers = gd::ProjectScopedContainers::
+        MakeNewProjectScopedContainersWithLocalVariables(
+            projectScopedContainers, event);
+    gd::String eventVariablesSignature;
+    gd::ContainersSignatureTools::AddVariablesSignature(
+        event.GetVariables(), eventVariablesSignature);
+    CheckEvent(platform,
+               eventProjectScopedContainers,
+               event,
+               CombineHashes(std::hash<gd::String>()(eventVariablesSignature),
+                             localVariablesHash),
+               previousEventsResults,
+               eventsResults,
+               diagnostics);
+  }
+}
+
+void WholeProjectDiagnosticsChecker::CheckEvent(
+    const gd::Platform &platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const gd::BaseEvent &event,
+    std::size_t localVariablesHash,
+    std::unordered_map<const gd::BaseEvent *, EventResults>
+        &previousEventsResults,
+    std::unordered_map<const gd::BaseEvent *, EventResults> &eventsResults,
+    std::vector<gd::ProjectDiagnostic> &diagnostics) {
+  std::size_t hash = CombineHashes(
+      std::hash<gd::String>()(GetEventSignature(event)), localVariablesHash);
+
+  EventResults &eventResults = eventsResults[&event];
+  auto previousEventResults = previousEventsResults.find(&event);
+  if (previousEventResults != previousEventsResults.end() &&
+      previousEventResults->second.hash == hash) {
+    eventResults = std::move(previousEventResults->second);
+    reusedEventsCount++;
+  } else {
+    eventResults.hash = hash;
+    for (const auto *conditions : event.GetAllConditionsVectors())
+      CheckInstructions(platform,
+                        projectScopedContainers,
+                        *conditions,
+                        true,
+                        eventResults.diagnostics);
+    for (const auto *actions : event.GetAllActionsVectors())
+      CheckInstructions(platform,
+                        projectScopedContainers,
+                        *actions,
+                        false,
+                        eventResults.diagnostics);
+    for (const auto &expressionAndMetadata :
+         event.GetAllExpressionsWithMetadata())
+      CheckExpression(platform,
+                      projectScopedContainers,
+                      *expressionAndMetadata.first,
+                      expressionAndMetadata.second,
+                      eventResults.diagnostics);
+    checkedEventsCount++;
+  }
+  diagnostics.insert(diagnostics.end(),
+                     eventResults.diagnostics.begin(),
+                     eventResults.diagnostics.end());
+
+  if (event.CanHaveSubEvents())
+    CheckEvents(platform,
+                projectScopedContainers,
+                event.GetSubEvents(),
+                localVariablesHash,
+                previousEventsResults,
+                eventsResults,
+                diagnostics);
+}
+
+void WholeProjectDiagnosticsChecker::CheckInstructions(
+    const gd::Platform &platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const gd::InstructionsList &instructions,
+    bool areConditions,
+    std::vector<gd::ProjectDiagnostic> &diagnostics) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    CheckInstruction(platform,
+                     projectScopedContainers,
+                     instructions[i],
+                     areConditions,
+                     diagnostics);
+    if (!instructions[i].GetSubInstructions().empty())
+      CheckInstructions(platform,
+                        projectScopedContainers,
+                        instructions[i].GetSubInstructions(),
+                        areConditions,
+                        diagnostics);
+  }
+}
+
+void WholeProjectDiagnosticsChecker::CheckInstruction(
+    const gd::Platform &platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const gd::Instruction &instruction,
+    bool isCondition,
+    std::vector<gd::ProjectDiagnostic> &diagnostics) {
+  const gd::InstructionMetadata &metadata =
+      isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                        platform, instruction.GetType())
+                  : gd::MetadataProvider::GetActionMetadata(
+                        platform, instruction.GetType());
+  if (gd::MetadataProvider::IsBadInstructionMetadata(metadata)) return;
+
+  const auto &objectsContainersList =
+      projectScopedContainers.GetObjectsContainersList();
+  for (std::size_t i = 0; i < metadata.GetParametersCount() &&
+                          i < instruction.GetParametersCount();
+       ++i) {
+    const gd::ParameterMetadata &parameterMetadata = metadata.GetParameter(i);
+    if (parameterMetadata.IsCodeOnly()) continue;
+
+    // Most parameters are valid: only look for the details of the issues
+    // of the invalid ones.
+    if (gd::InstructionValidator::ValidateParameter(
+            platform, projectScopedContainers, instruction, metadata, i)
+            .IsValid())
+      continue;
+
+    const gd::String &parameterType = parameterMetadata.GetType();
+    const gd::String &value = instruction.GetParameter(i).GetPlainString();
+    if (gd::ParameterMetadata::IsObject(parameterType)) {
+      const gd::String &expectedObjectType = parameterMetadata.GetExtraInfo();
+      if (!objectsContainersList.HasObjectOrGroupNamed(value)) {
+        diagnostics.push_back(gd::ProjectDiagnostic(
+            gd::ProjectDiagnostic::ErrorType::UnknownObject, "", value, ""));
+        continue;
+      }
+      const gd::String &actualObjectType =
+          objectsContainersList.GetTypeOfObject(value);
+      if (!expectedObjectType.empty() &&
+          actualObjectType != expectedObjectType) {
+        diagnostics.push_back(gd::ProjectDiagnostic(
+            gd::ProjectDiagnostic::ErrorType::MismatchedObjectType,
+            "",
+            actualObjectType,
+            expectedObjectType,
+            value));
+        continue;
+      }
+
+      // The behaviors required by the instruction are given after the object.
+      for (std::size_t j = i + 1; j < metadata.GetParametersCount() &&
+                                  j < instruction.GetParametersCount();
+           ++j) {
+        const auto &behaviorParameter = metadata.GetParameter(j);
+        const auto &behaviorParameterType =
+            behaviorParameter.GetValueTypeMetadata();
+        if (behaviorParameterType.IsObject()) break;
+        if (!behaviorParameterType.IsBehavior()) continue;
+
+        const gd::String &expectedBehaviorType =
+            behaviorParameter.GetExtraInfo();
+        if (expectedBehaviorType.empty()) continue;
+        const gd::String &actualBehaviorType =
+            objectsContainersList.GetTypeOfBehaviorInObjectOrGroup(
+                value,
+                instruction.GetParameter(j).GetPlainString(),
+                /** searchInGroups = */ true);
+        if (actualBehaviorType != expectedBehaviorType) {
+          diagnostics.push_back(gd::ProjectDiagnostic(
+              gd::ProjectDiagnostic::ErrorType::MissingBehavior,
+              "",
+              actualBehaviorType,
+              expectedBehaviorType,
+              value));
+        }
+      }
+    } else if (gd::ParameterMetadata::IsExpression("variable",
+                                                   parameterType) ||
+               gd::ParameterMetadata::IsExpression("number", parameterType) ||
+               gd::ParameterMetadata::IsExpression("string", parameterType)) {
+      std::size_t diagnosticsCount = diagnostics.size();
+      CheckExpression(platform,
+                      projectScopedContainers,
+                      instruction.GetParameter(i),
+                      parameterMetadata,
+                      diagnostics);
+
+      // Variables of objects are also required to be declared by the new
+      // variable instructions, which the expression can't know about.
+      if (diagnostics.size() == diagnosticsCount &&
+          parameterType == "objectvar" &&
+          gd::VariableInstructionSwitcher::IsSwitchableVariableInstruction(
+              instruction.GetType())) {
+        diagnostics.push_back(gd::ProjectDiagnostic(
+            gd::ProjectDiagnostic::ErrorType::UndeclaredVariable,
+            _("This variable does not exist on this object or group."),
+            gd::InstructionValidator::GetRootVariableName(value),
+            "",
+            instruction.GetParameter(0).GetPlainString()));
+      }
+    }
+  }
+}
+
+void WholeProjectDiagnosticsChecker::CheckExpression(
+    const gd::Platform &platform,
+    const gd::ProjectScopedContainers &projectScopedContainers,
+    const gd::Expression &expression,
+    const gd::ParameterMetadata &parameterMetadata,
+    std::vector<gd::ProjectDiagnostic> &diagnostics) {
+  // TODO Remove the ternary when all parameter declarations use
+  // "number" instead of "expression".
+  const gd::String &parameterType = parameterMetadata.GetType() == "expression"
+                                        ? "number"
+                                        : parameterMetadata.GetType();
+  gd::ExpressionValidator validator(platform,
+                                    projectScopedContainers,
+                                    parameterType,
+                                    parameterMetadata.GetExtraInfo());
+  expression.GetSharedRootNode()->Visit(validator);
+
+  // Only the errors also reported by the code generation are kept.
+  for (auto *error : validator.GetFatalErrors()) {
+    if ((error->GetType() ==
+             gd::ExpressionParserError::ErrorType::UndeclaredVariable ||
+         error->GetType() ==
+             gd::ExpressionParserError::ErrorType::UnknownIdentifier) &&
+        !error->GetActualValue().empty()) {
+      diagnostics.push_back(gd::ProjectDiagnostic(
+          gd::ProjectDiagnostic::ErrorType::UndeclaredVariable,
+          error->GetMessage(),
+          error->GetActualValue(),
+          "",
+          error->GetObjectName()));
+    }
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,162 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class BaseEvent;
+class EventsList;
+class Expression;
+class Instruction;
+class InstructionsList;
+class ParameterMetadata;
+class Platform;
+class Project;
+class ProjectScopedContainers;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Check the events of a whole project (scenes, external events and
+ * functions of extensions) for the issues reported when generating their code
+ * (unknown objects, mismatched object types, missing behaviors and undeclared
+ * variables), without generating any code.
+ *
+ * The results of each event are kept between checks: an event is only checked
+ * again if its instructions changed, or if something it can depend on changed
+ * (the objects, groups, variables, properties and parameters in its scope, or
+ * the functions of the extensions of the project).
+ *
+ * \see gd::InstructionValidator
+ * \see gd::ExpressionValidator
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API WholeProjectDiagnosticsChecker {
+ public:
+  WholeProjectDiagnosticsChecker()
+      : functionsHash(0), checkedEventsCount(0), reusedEventsCount(0){};
+  virtual ~WholeProjectDiagnosticsChecker(){};
+
+  /**
+   * \brief Check the events of the project and replace the content of the
+   * report by the issues found.
+   *
+   * A report is added for each scene and each external events, and for each
+   * function of an extension having issues.
+   */
+  void Check(const gd::Project &project,
+             gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport);
+
+  /**
+   * \brief Forget the results of the previous checks, so that all the events
+   * are checked again.
+   */
+  void ClearCache() {
+    functionsHash = 0;
+    eventsListsResults.clear();
+  }
+
+  /**
+   * \brief Return the number of events checked by the last call to Check.
+   */
+  std::size_t GetCheckedEventsCount() const { return checkedEventsCount; }
+
+  /**
+   * \brief Return the number of events for which the results of a previous
+   * check were reused by the last call to Check.
+   */
+  std::size_t GetReusedEventsCount() const { return reusedEventsCount; }
+
+ private:
+  struct EventResults {
+    std::size_t hash = 0;  ///< The hash of the content of the event and of
+                           ///< the local variables of its parents.
+    std::vector<gd::ProjectDiagnostic> diagnostics;
+  };
+
+  struct EventsListResults {
+    std::size_t scopeHash = 0;  ///< The hash of the objects, groups,
+                                ///< variables, properties and parameters
+                                ///< in the scope of the events.
+    std::unordered_map<const gd::BaseEvent *, EventResults> eventsResults;
+  };
+
+  /**
+   * \brief Check the events of a scene, external events or function and add
+   * their issues to the report.
+   *
+   * \param key The key of the results of the events, unique in the project.
+   * \param reportName The name given to the report of the events.
+   * \param alwaysReport Add a report even if there are no issues.
+   */
+  void CheckEventsList(
+      const gd::Platform &platform,
+      const gd::ProjectScopedContainers &projectScopedContainers,
+      const gd::String &key,
+      const gd::String &reportName,
+      const gd::EventsList &events,
+      bool alwaysReport,
+      gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport);
+
+  void CheckEvents(
+      const gd::Platform &platform,
+      const gd::ProjectScopedContainers &projectScopedContainers,
+      const gd::EventsList &events,
+      std::size_t localVariablesHash,
+      std::unordered_map<const gd::BaseEvent *, EventResults>
+          &previousEventsResults,
+      std::unordered_map<const gd::BaseEvent *, EventResults> &eventsResults,
+      std::vector<gd::ProjectDiagnostic> &diagnostics);
+
+  void CheckEvent(
+      const gd::Platform &platform,
+      const gd::ProjectScopedContainers &projectScopedContainers,
+      const gd::BaseEvent &event,
+      std::size_t localVariablesHash,
+      std::unordered_map<const gd::BaseEvent *, EventResults>
+          &previousEventsResults,
+      std::unordered_map<const gd::BaseEvent *, EventResults> &eventsResults,
+      std::vector<gd::ProjectDiagnostic> &diagnostics);
+
+  static void CheckInstructions(
+      const gd::Platform &platform,
+      const gd::ProjectScopedContainers &projectScopedContainers,
+      const gd::InstructionsList &instructions,
+      bool areConditions,
+      std::vector<gd::ProjectDiagnostic> &diagnostics);
+
+  static void CheckInstruction(
+      const gd::Platform &platform,
+      const gd::ProjectScopedContainers &projectScopedContainers,
+      const gd::Instruction &instruction,
+      bool isCondition,
+      std::vector<gd::ProjectDiagnostic> &diagnostics);
+
+  static void CheckExpression(
+      const gd::Platform &platform,
+      const gd::ProjectScopedContainers &projectScopedContainers,
+      const gd::Expression &expression,
+      const gd::ParameterMetadata &parameterMetadata,
+      std::vector<gd::ProjectDiagnostic> &diagnostics);
+
+  std::size_t functionsHash;  ///< The hash of the functions of the extensions
+                             ///< of the project when it was last checked.
+  std::map<gd::String, EventsListResults>
+      eventsListsResults;  ///< The results of the events of each scene,
+                           ///< external events and function, by name.
+  std::size_t checkedEventsCount;
+  std::size_t reusedEventsCount;
+};
+
+}  // namespace gd
@@ -12,6 +12,7 @@
 #include "GDCore/Project/QuickCustomizationVisibilitiesContainer.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 
 namespace gd {
 class PropertyDescriptor;
@@ -60,7 +61,13 @@ class GD_CORE_API BehaviorConfigurationContainer {
   /**
    * \brief Return the type of the behavior
    */
-  const gd::String& GetTypeName() const { return type; }
+  const gd::String& GetTypeName() const { return type.Get(); }
+
+  /**
+   * \brief Return the type of the behavior, as an interned string that can be
+   * compared and hashed in constant time.
+   */
+  const gd::InternedString& GetInternedTypeName() const { return type; }
 
   /**
    * \brief Set the type of the behavior.
@@ -267,8 +274,9 @@ class GD_CORE_API BehaviorConfigurationContainer {
 
  private:
   gd::String name;  ///< Name of the behavior
-  gd::String type;  ///< The type of the behavior that is represented. Usually
-                    ///< in the form "ExtensionName::BehaviorTypeName"
+  gd::InternedString type;  ///< The type of the behavior that is represented.
+                            ///< Usually in the form
+                            ///< "ExtensionName::BehaviorTypeName"
 
   gd::SerializerElement content;  // Storage for the behavior properties
   bool folded;
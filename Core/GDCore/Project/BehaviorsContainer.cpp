@@ -5,6 +5,8 @@
  */
 #include "GDCore/Project/BehaviorsContainer.h"
 
+#include <atomic>
+
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
@@ -19,12 +21,23 @@
 
 namespace gd {
 
+namespace {
+std::atomic<std::size_t> allContainersChangesCount(0);
+}  // namespace
+
+std::size_t BehaviorsContainer::GetAllContainersChangesCount() {
+  return allContainersChangesCount;
+}
+
+void BehaviorsContainer::AddChange() { allContainersChangesCount++; }
+
 BehaviorsContainer::~BehaviorsContainer() {}
 
 BehaviorsContainer::BehaviorsContainer(bool isOverriding_)
     : isOverriding(isOverriding_) {}
 
 void BehaviorsContainer::Init(const gd::BehaviorsContainer &behaviorsContainer) {
+  AddChange();
   isOverriding = behaviorsContainer.isOverriding;
   behaviors = gd::Clone(behaviorsContainer.behaviors);
 }
@@ -39,6 +52,7 @@ std::vector<gd::String> BehaviorsContainer::GetAllBehaviorNames() const {
 }
 
 void BehaviorsContainer::RemoveBehavior(const gd::String &name) {
+  AddChange();
   behaviors.erase(name);
 }
 
@@ -48,6 +62,7 @@ bool BehaviorsContainer::RenameBehavior(const gd::String &name,
       behaviors.find(newName) != behaviors.end())
     return false;
 
+  AddChange();
   std::unique_ptr<Behavior> aut = std::move(behaviors.find(name)->second);
   behaviors.erase(name);
   behaviors[newName] = std::move(aut);
@@ -57,6 +72,7 @@ bool BehaviorsContainer::RenameBehavior(const gd::String &name,
 }
 
 gd::Behavior &BehaviorsContainer::GetBehavior(const gd::String &name) {
+  AddChange();
   return *behaviors.find(name)->second;
 }
 
@@ -72,6 +88,7 @@ bool BehaviorsContainer::HasBehaviorNamed(const gd::String &name) const {
 gd::Behavior *BehaviorsContainer::AddNewBehavior(const gd::Project &project,
                                                  const gd::String &type,
                                                  const gd::String &name) {
+  AddChange();
   auto initializeAndAdd = [this,
                            &name](std::unique_ptr<gd::Behavior> behavior) {
     if (isOverriding) {
@@ -109,6 +126,7 @@ gd::Behavior *BehaviorsContainer::AddNewBehavior(const gd::Project &project,
 
 gd::Behavior *BehaviorsContainer::AddBehavior(const gd::Behavior &behavior,
                                               const gd::String &name) {
+  AddChange();
   behaviors[name] = std::move(behavior.Clone());
   return behaviors[name].get();
 }
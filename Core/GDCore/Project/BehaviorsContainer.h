@@ -123,6 +123,19 @@ public:
   GetAllBehaviorContents() const {
     return behaviors;
   };
+
+  /**
+   * \brief Return a number changing each time the behaviors of any container
+   * can have been modified (including when a non-const reference to one of
+   * them is returned).
+   *
+   * Behaviors are changed through the objects owning them, which can be kept
+   * without their objects container knowing it, so the count is shared by all
+   * the containers.
+   *
+   * \see gd::ProjectScopedContainers::GetVersion
+   */
+  static std::size_t GetAllContainersChangesCount();
   ///@}
 
   /** \name Serialization
@@ -157,6 +170,12 @@ protected:
    */
   void Init(const gd::BehaviorsContainer &behaviorsContainer);
 
+  /**
+   * \brief Count a change of the behaviors.
+   * \see GetAllContainersChangesCount
+   */
+  static void AddChange();
+
 private:
   gd::MemoryTracked _memoryTracked{this, "BehaviorsContainer"};
 };
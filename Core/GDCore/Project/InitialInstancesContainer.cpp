@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <iostream>
 #include <map>
+#include <unordered_map>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/InitialInstance.h"
@@ -208,6 +209,143 @@ void InitialInstancesContainer::SerializeTo(SerializerElement& element) const {
 
 void InitialInstancesContainer::Clear() { initialInstances.clear(); }
 
+namespace {
+std::unordered_map<gd::String, int32_t> GetIndicesByName(
+    const std::vector<gd::String>& names) {
+  std::unordered_map<gd::String, int32_t> indicesByName;
+  indicesByName.reserve(names.size());
+  for (std::size_t i = 0; i < names.size(); ++i)
+    indicesByName.emplace(names[i], static_cast<int32_t>(i));
+
+  return indicesByName;
+}
+
+int32_t GetIndexOf(const std::unordered_map<gd::String, int32_t>& indicesByName,
+                   const gd::String& name) {
+  auto it = indicesByName.find(name);
+  return it != indicesByName.end() ? it->second : -1;
+}
+}  // namespace
+
+std::size_t InitialInstancesContainer::GetInstancesFields(
+    double* fields,
+    int32_t* indices,
+    std::size_t maxInstancesCount,
+    const std::vector<gd::String>& layerNames,
+    const std::vector<gd::String>& objectNames) const {
+  return GetInstancesFieldsIf(
+      [](const gd::InitialInstance&) { return true; },
+      fields,
+      indices,
+      maxInstancesCount,
+      layerNames,
+      objectNames);
+}
+
+std::size_t InitialInstancesContainer::GetLayerInstancesFields(
+    const gd::String& layerName,
+    double* fields,
+    int32_t* indices,
+    std::size_t maxInstancesCount,
+    const std::vector<gd::String>& layerNames,
+    const std::vector<gd::String>& objectNames) const {
+  return GetInstancesFieldsIf(
+      [&layerName](const gd::InitialInstance& instance) {
+        return instance.GetLayer() == layerName;
+      },
+      fields,
+      indices,
+      maxInstancesCount,
+      layerNames,
+      objectNames);
+}
+
+std::size_t InitialInstancesContainer::GetInstancesFieldsIf(
+    std::function<bool(const gd::InitialInstance&)> predicate,
+    double* fields,
+    int32_t* indices,
+    std::size_t maxInstancesCount,
+    const std::vector<gd::String>& layerNames,
+    const std::vector<gd::String>& objectNames) const {
+  auto layerIndices = GetIndicesByName(layerNames);
+  auto objectIndices = GetIndicesByName(objectNames);
+
+  std::size_t count = 0;
+  for (const gd::InitialInstance& instance : initialInstances) {
+    if (count >= maxInstancesCount) break;
+    if (!predicate(instance)) continue;
+
+    double* instanceFields = fields + count * fieldsPerInstance;
+    instanceFields[0] = instance.GetX();
+    instanceFields[1] = instance.GetY();
+    instanceFields[2] = instance.GetZ();
+    instanceFields[3] = instance.GetAngle();
+    instanceFields[4] = instance.HasCustomSize() ? instance.GetCustomWidth()
+                                                 : instance.GetDefaultWidth();
+    instanceFields[5] = instance.HasCustomSize() ? instance.GetCustomHeight()
+                                                 : instance.GetDefaultHeight();
+    instanceFields[6] = instance.GetZOrder();
+
+    int32_t* instanceIndices = indices + count * indicesPerInstance;
+    instanceIndices[0] = GetIndexOf(layerIndices, instance.GetLayer());
+    instanceIndices[1] = GetIndexOf(objectIndices, instance.GetObjectName());
+
+    count++;
+  }
+
+  return count;
+}
+
+std::size_t InitialInstancesContainer::SetInstancesFields(
+    const double* fields, std::size_t instancesCount) {
+  return SetInstancesFieldsIf(
+      [](const gd::InitialInstance&) { return true; }, fields, instancesCount);
+}
+
+std::size_t InitialInstancesContainer::SetLayerInstancesFields(
+    const gd::String& layerName,
+    const double* fields,
+    std::size_t instancesCount) {
+  return SetInstancesFieldsIf(
+      [&layerName](const gd::InitialInstance& instance) {
+        return instance.GetLayer() == layerName;
+      },
+      fields,
+      instancesCount);
+}
+
+std::size_t InitialInstancesContainer::SetInstancesFieldsIf(
+    std::function<bool(const gd::InitialInstance&)> predicate,
+    const double* fields,
+    std::size_t instancesCount) {
+  std::size_t count = 0;
+  for (gd::InitialInstance& instance : initialInstances) {
+    if (count >= instancesCount) break;
+    if (!predicate(instance)) continue;
+
+    const double* instanceFields = fields + count * fieldsPerInstance;
+    instance.SetX(instanceFields[0]);
+    instance.SetY(instanceFields[1]);
+    instance.SetZ(instanceFields[2]);
+    instance.SetAngle(instanceFields[3]);
+
+    double width = instance.HasCustomSize() ? instance.GetCustomWidth()
+                                            : instance.GetDefaultWidth();
+    double height = instance.HasCustomSize() ? instance.GetCustomHeight()
+                                             : instance.GetDefaultHeight();
+    if (instanceFields[4] != width || instanceFields[5] != height) {
+      instance.SetHasCustomSize(true);
+      instance.SetCustomWidth(instanceFields[4]);
+      instance.SetCustomHeight(instanceFields[5]);
+    }
+    instance.SetZOrder(static_cast<int>(instanceFields[6]));
+
+    count++;
+  }
+
+  return count;
+}
+
 InitialInstanceFunctor::~InitialInstanceFunctor(){};
 
 void HighestZOrderFinder::operator()(gd::InitialInstance& instance) {
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
+#include <vector>
 #include "GDCore/Project/InitialInstance.h"
 #include "GDCore/Project/MemoryTrackedRegistry.h"
 #include "GDCore/String.h"
@@ -183,6 +185,90 @@ class GD_CORE_API InitialInstancesContainer {
 
   ///@}
 
+  /** \name Bulk access
+   * Members functions reading or changing the main fields of many instances
+   * in a single call, instead of iterating over them. From JavaScript, the
+   * buffers are views (`Float64Array` and `Int32Array`) of the memory of
+   * GDevelop.js.
+   */
+  ///@{
+
+  /**
+   * \brief The number of values stored for each instance in the fields
+   * buffer: X, Y, Z, angle, width, height and Z order (in this order).
+   *
+   * The width and height are the custom size of the instance, or its default
+   * size if it has no custom size.
+   */
+  static constexpr std::size_t fieldsPerInstance = 7;
+
+  /**
+   * \brief The number of values stored for each instance in the indices
+   * buffer: the index of its layer and the index of its object in the names
+   * given by the caller (-1 if not found).
+   */
+  static constexpr std::size_t indicesPerInstance = 2;
+
+  /**
+   * \brief Write the fields and the indices of the instances, in the order of
+   * IterateOverInstances, into the buffers.
+   *
+   * \param fields A buffer of at least \a maxInstancesCount *
+   * fieldsPerInstance values.
+   * \param indices A buffer of at least \a maxInstancesCount *
+   * indicesPerInstance values.
+   * \param maxInstancesCount The number of instances the buffers can hold.
+   * \param layerNames The layers, giving the indices of the layers.
+   * \param objectNames The objects, giving the indices of the objects.
+   * \return The number of instances written.
+   */
+  std::size_t GetInstancesFields(
+      double *fields,
+      int32_t *indices,
+      std::size_t maxInstancesCount,
+      const std::vector<gd::String> &layerNames,
+      const std::vector<gd::String> &objectNames) const;
+
+  /**
+   * \brief Write the fields and the indices of the instances on the layer
+   * named \a layerName into the buffers.
+   *
+   * \see GetInstancesFields
+   */
+  std::size_t GetLayerInstancesFields(
+      const gd::String &layerName,
+      double *fields,
+      int32_t *indices,
+      std::size_t maxInstancesCount,
+      const std::vector<gd::String> &layerNames,
+      const std::vector<gd::String> &objectNames) const;
+
+  /**
+   * \brief Change the fields of the instances, in the order of
+   * IterateOverInstances, to the ones read from the buffer.
+   *
+   * An instance gets a custom size only if its width or height is changed.
+   *
+   * \param fields A buffer of \a instancesCount * fieldsPerInstance values,
+   * as filled by GetInstancesFields.
+   * \param instancesCount The number of instances in the buffer.
+   * \return The number of instances changed.
+   */
+  std::size_t SetInstancesFields(const double *fields,
+                                 std::size_t instancesCount);
+
+  /**
+   * \brief Change the fields of the instances on the layer named \a
+   * layerName to the ones read from the buffer.
+   *
+   * \see SetInstancesFields
+   */
+  std::size_t SetLayerInstancesFields(const gd::String &layerName,
+                                      const double *fields,
+                                      std::size_t instancesCount);
+
+  ///@}
+
   /** \name Saving and loading
    * Members functions related to saving and loading the object.
    */
@@ -201,6 +287,19 @@ class GD_CORE_API InitialInstancesContainer {
   ///@}
 
 private:
+  std::size_t GetInstancesFieldsIf(
+      std::function<bool(const gd::InitialInstance &)> predicate,
+      double *fields,
+      int32_t *indices,
+      std::size_t maxInstancesCount,
+      const std::vector<gd::String> &layerNames,
+      const std::vector<gd::String> &objectNames) const;
+
+  std::size_t SetInstancesFieldsIf(
+      std::function<bool(const gd::InitialInstance &)> predicate,
+      const double *fields,
+      std::size_t instancesCount);
+
   void RemoveInstanceIf(
       std::function<bool(const gd::InitialInstance &)> predicate);
 
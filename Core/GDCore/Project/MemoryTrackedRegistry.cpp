@@ -0,0 +1,307 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/MemoryTrackedRegistry.h"
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "GDCore/Tools/Log.h"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#else
+#include <chrono>
+#endif
+
+namespace gd {
+
+namespace {
+
+constexpr std::size_t kMaxClasses = 256;
+
+// Class names are found with an open addressing table of class ids, indexed
+// by a hash of the name (never more than half full).
+constexpr std::size_t kClassIndexSize = kMaxClasses * 2;
+
+// The dead table is made of buckets of a few entries, indexed by a hash of
+// the address of the destroyed object.
+constexpr std::size_t kBucketCountLog2 = 14;
+constexpr std::size_t kBucketCount = std::size_t(1) << kBucketCountLog2;
+
+struct ClassInfo {
+  std::string name;
+  std::atomic<long> aliveCount{0};
+  std::atomic<long> deadCount{0};
+};
+
+// Heap-allocated (intentionally leaked) to avoid static destruction order
+// issues: tracked objects can be destroyed after the registry would be.
+struct RegistryState {
+  std::array<ClassInfo, kMaxClasses> classes;
+  std::size_t classesCount = 1;  // Id 0 is kUntrackedClassId.
+  std::array<MemoryTrackedRegistry::ClassId, kClassIndexSize> classIndex{};
+  bool reportedFullTable = false;
+};
+
+RegistryState& GetState() {
+  static auto* state = new RegistryState();
+  return *state;
+}
+
+int& CurrentCallContextId() {
+  static int id = 0;
+  return id;
+}
+
+/** High-resolution milliseconds for timestamping destructions.
+ *  Under Emscripten, uses emscripten_get_now() (equivalent to
+ *  performance.now() in JS). Otherwise falls back to std::chrono. */
+double NowMs() {
+#ifdef __EMSCRIPTEN__
+  return emscripten_get_now();
+#else
+  return static_cast<double>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+// Timestamps are read once per JS call (identified by its context id) rather
+// than once per destroyed object: destroying a project destroys thousands of
+// objects in a single call. Without a JS context (native code), every
+// destruction reads the clock.
+bool& IsCurrentContextTimestampValid() {
+  static bool valid = false;
+  return valid;
+}
+
+double GetCurrentContextTimestampMs() {
+  static double timestampMs = 0;
+  if (CurrentCallContextId() == 0) return NowMs();
+
+  if (!IsCurrentContextTimestampValid()) {
+    timestampMs = NowMs();
+    IsCurrentContextTimestampValid() = true;
+  }
+  return timestampMs;
+}
+
+std::size_t HashClassName(const char* className) {
+  // FNV-1a hash.
+  std::uint32_t hash = 2166136261u;
+  for (const char* c = className; *c; ++c) {
+    hash ^= static_cast<unsigned char>(*c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * \brief Return the slot of the class index holding the class with the given
+ * name, or the empty slot where it must be added.
+ */
+MemoryTrackedRegistry::ClassId& FindClassIndexSlot(const char* className) {
+  RegistryState& state = GetState();
+  std::size_t slot = HashClassName(className) & (kClassIndexSize - 1);
+  while (true) {
+    MemoryTrackedRegistry::ClassId& classId = state.classIndex[slot];
+    if (classId == MemoryTrackedRegistry::kUntrackedClassId ||
+        state.classes[classId].name == className)
+      return classId;
+
+    slot = (slot + 1) & (kClassIndexSize - 1);
+  }
+}
+
+std::size_t GetBucketIndex(const void* ptr) {
+  // Fibonacci hashing of the address (the lowest bits are always 0 because
+  // of the alignment).
+  std::uint64_t address =
+      static_cast<std::uint64_t>(reinterpret_cast<uintptr_t>(ptr)) >> 3;
+  return static_cast<std::size_t>((address * 11400714819323198485ull) >>
+                                  (64 - kBucketCountLog2));
+}
+
+}  // namespace
+
+constexpr MemoryTrackedRegistry::ClassId
+    MemoryTrackedRegistry::kUntrackedClassId;
+constexpr std::size_t MemoryTrackedRegistry::kDeadBucketSize;
+
+std::vector<MemoryTrackedRegistry::DeadEntry>&
+MemoryTrackedRegistry::getDeadTable() {
+  // Allocated on the first destruction, so that programs not destroying
+  // tracked objects don't pay for it.
+  static auto* table =
+      new std::vector<DeadEntry>(kBucketCount * kDeadBucketSize);
+  return *table;
+}
+
+MemoryTrackedRegistry::ClassId MemoryTrackedRegistry::getOrCreateClassId(
+    const char* className) {
+  if (!className) return kUntrackedClassId;
+
+  ClassId& classIdSlot = FindClassIndexSlot(className);
+  if (classIdSlot != kUntrackedClassId) return classIdSlot;
+
+  RegistryState& state = GetState();
+  if (state.classesCount >= kMaxClasses) {
+    if (!state.reportedFullTable) {
+      state.reportedFullTable = true;
+      gd::LogError("Too many classes tracked by MemoryTrackedRegistry: "
+                   "objects of class \"" +
+                   gd::String(className) +
+                   "\" and of any new class won't be tracked.");
+    }
+    return kUntrackedClassId;
+  }
+
+  ClassId classId = static_cast<ClassId>(state.classesCount++);
+  state.classes[classId].name = className;
+  classIdSlot = classId;
+  return classId;
+}
+
+bool MemoryTrackedRegistry::findClassId(const char* className,
+                                        ClassId& classId) {
+  classId = FindClassIndexSlot(className);
+  return classId != kUntrackedClassId;
+}
+
+void MemoryTrackedRegistry::add(const void* ptr, ClassId classId) {
+  if (classId == kUntrackedClassId) return;
+  GetState().classes[classId].aliveCount.fetch_add(1,
+                                                   std::memory_order_relaxed);
+
+  // A new object can be allocated at the address of a destroyed one.
+  const DeadEntry* deadEntry = findDeadEntry(ptr, classId);
+  if (deadEntry) {
+    const_cast<DeadEntry*>(deadEntry)->used = false;
+    GetState().classes[classId].deadCount.fetch_sub(1,
+                                                    std::memory_order_relaxed);
+  }
+}
+
+void MemoryTrackedRegistry::remove(const void* ptr, ClassId classId) {
+  if (classId == kUntrackedClassId) return;
+  RegistryState& state = GetState();
+  state.classes[classId].aliveCount.fetch_sub(1, std::memory_order_relaxed);
+
+  std::size_t bucketIndex = GetBucketIndex(ptr);
+  DeadEntry* bucket = &getDeadTable()[bucketIndex * kDeadBucketSize];
+  DeadEntry* entry = nullptr;
+  for (std::size_t i = 0; i < kDeadBucketSize; ++i) {
+    DeadEntry& candidate = bucket[i];
+    if (candidate.used && candidate.ptr == ptr &&
+        candidate.classId == classId) {
+      entry = &candidate;
+      break;
+    }
+    if (!entry && !candidate.used) entry = &candidate;
+  }
+  if (!entry) {
+    // The bucket is full: forget the oldest destruction of the bucket.
+    static auto* nextVictims = new std::vector<unsigned char>(kBucketCount, 0);
+    unsigned char& nextVictim = (*nextVictims)[bucketIndex];
+    entry = &bucket[nextVictim];
+    nextVictim = (nextVictim + 1) % kDeadBucketSize;
+  }
+
+  if (entry->used) {
+    state.classes[entry->classId].deadCount.fetch_sub(
+        1, std::memory_order_relaxed);
+  }
+  entry->ptr = ptr;
+  entry->classId = classId;
+  entry->callContextId = CurrentCallContextId();
+  entry->timestampMs = GetCurrentContextTimestampMs();
+  entry->used = true;
+  state.classes[classId].deadCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+const MemoryTrackedRegistry::DeadEntry* MemoryTrackedRegistry::findDeadEntry(
+    const void* ptr, ClassId classId) {
+  if (classId == kUntrackedClassId || GetState().classes[classId].deadCount == 0)
+    return nullptr;
+
+  const DeadEntry* bucket =
+      &getDeadTable()[GetBucketIndex(ptr) * kDeadBucketSize];
+  for (std::size_t i = 0; i < kDeadBucketSize; ++i) {
+    const DeadEntry& entry = bucket[i];
+    if (entry.used && entry.ptr == ptr && entry.classId == classId)
+      return &entry;
+  }
+  return nullptr;
+}
+
+long MemoryTrackedRegistry::getDeadCount() {
+  RegistryState& state = GetState();
+  long total = 0;
+  for (std::size_t i = 1; i < state.classesCount; ++i)
+    total += state.classes[i].deadCount.load(std::memory_order_relaxed);
+  return total;
+}
+
+void MemoryTrackedRegistry::pruneDead(long maxSize) {
+  if (getDeadCount() <= maxSize) return;
+
+  for (DeadEntry& entry : getDeadTable()) entry.used = false;
+  RegistryState& state = GetState();
+  for (std::size_t i = 1; i < state.classesCount; ++i)
+    state.classes[i].deadCount.store(0, std::memory_order_relaxed);
+}
+
+long MemoryTrackedRegistry::getAliveCount() {
+  RegistryState& state = GetState();
+  long total = 0;
+  for (std::size_t i = 1; i < state.classesCount; ++i)
+    total += state.classes[i].aliveCount.load(std::memory_order_relaxed);
+  return total;
+}
+
+long MemoryTrackedRegistry::getAliveCountForClass(
+    const gd::String& className) {
+  ClassId classId;
+  if (!findClassId(className.c_str(), classId)) return 0;
+  return GetState().classes[classId].aliveCount.load(
+      std::memory_order_relaxed);
+}
+
+long MemoryTrackedRegistry::getDeadCountForClass(const gd::String& className) {
+  ClassId classId;
+  if (!findClassId(className.c_str(), classId)) return 0;
+  return GetState().classes[classId].deadCount.load(std::memory_order_relaxed);
+}
+
+void MemoryTrackedRegistry::setCurrentCallContextId(long id) {
+  CurrentCallContextId() = static_cast<int>(id);
+  IsCurrentContextTimestampValid() = false;
+}
+
+long MemoryTrackedRegistry::getDeadContextId(long ptr,
+                                             const gd::String& className) {
+  ClassId classId;
+  if (!findClassId(className.c_str(), classId)) return -1;
+
+  const DeadEntry* entry = findDeadEntry(
+      reinterpret_cast<const void*>(static_cast<uintptr_t>(ptr)), classId);
+  return entry ? static_cast<long>(entry->callContextId) : -1;
+}
+
+double MemoryTrackedRegistry::getDeadContextTimeMs(
+    long ptr, const gd::String& className) {
+  ClassId classId;
+  if (!findClassId(className.c_str(), classId)) return 0.0;
+
+  const DeadEntry* entry = findDeadEntry(
+      reinterpret_cast<const void*>(static_cast<uintptr_t>(ptr)), classId);
+  return entry ? entry->timestampMs : 0.0;
+}
+
+}  // namespace gd
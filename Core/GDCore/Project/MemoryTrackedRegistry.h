@@ -5,19 +5,9 @@
  */
 #pragma once
 
-#include <algorithm>
-#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <cstring>
-#include <string>
-#include <unordered_map>
-#include <unordered_set>
-
-#ifdef __EMSCRIPTEN__
-#include <emscripten.h>
-#else
-#include <chrono>
-#endif
+#include <vector>
 
 #include "GDCore/String.h"
 
@@ -27,38 +17,56 @@ namespace gd {
  * \brief A static registry tracking the lifetime of C++ objects exposed to
  * JavaScript via Emscripten/WebIDL bindings.
  *
- * Uses two maps keyed by className, each mapping to a set of pointers:
- * - alive: objects currently alive
- * - dead: objects that were alive and are now destroyed
+ * Each tracked class name is interned once into a small class identifier.
+ * For each class, the registry keeps:
+ * - a counter of the objects currently alive,
+ * - a counter of the destroyed objects that are remembered as dead.
  *
- * Additionally stores a bounded ring buffer of destruction contexts per class,
- * capturing which JS call triggered each destruction and when it happened.
+ * Destroyed objects are remembered in a fixed-size table indexed by their
+ * address, together with the context of their destruction (which JS call
+ * triggered it and when it happened). When the table is full, the oldest
+ * entries of a bucket are forgotten: isDead() can then miss a very old
+ * destruction, but never reports an alive object as dead.
  *
  * This allows JavaScript wrappers to detect use-after-free by calling isDead(),
  * and enables per-class statistics for debugging.
  */
-class MemoryTrackedRegistry {
+class GD_CORE_API MemoryTrackedRegistry {
  public:
+  using ClassId = std::uint16_t;
+
+  /** Identifier used for a null class name: such objects are not tracked. */
+  static constexpr ClassId kUntrackedClassId = 0;
+
   // Internal C++ API (used by MemoryTracked).
   static void add(const void* ptr, const char* className) {
     if (!className) return;
-    dead()[className].erase(ptr);
-    alive()[className].insert(ptr);
+    add(ptr, getOrCreateClassId(className));
   }
 
   static void remove(const void* ptr, const char* className) {
     if (!className) return;
-    alive()[className].erase(ptr);
-    dead()[className].insert(ptr);
-    deadContexts()[className].push(ptr, currentCallContextId_(), nowMs());
+    remove(ptr, getOrCreateClassId(className));
   }
 
   static bool isDead(const void* ptr, const char* className) {
-    if (!className) return false;
-    auto it = dead().find(className);
-    return it != dead().end() && it->second.count(ptr) > 0;
+    ClassId classId;
+    if (!className || !findClassId(className, classId)) return false;
+    return findDeadEntry(ptr, classId) != nullptr;
   }
 
+  static void add(const void* ptr, ClassId classId);
+  static void remove(const void* ptr, ClassId classId);
+
+  /**
+   * \brief Return the identifier of the class, registering it if needed.
+   *
+   * Classes are found by the content of their name, through a hash table:
+   * the name can be a temporary string. If too many classes are registered,
+   * an error is logged and objects of the new classes are not tracked.
+   */
+  static ClassId getOrCreateClassId(const char* className);
+
   // WebIDL-facing API (called from JS via the binder).
   static void add(long ptr, const gd::String& className) {
     add(reinterpret_cast<const void*>(static_cast<uintptr_t>(ptr)),
@@ -76,146 +84,50 @@ class MemoryTrackedRegistry {
         className.c_str());
   }
 
-  static long getDeadCount() {
-    long total = 0;
-    for (auto& kv : dead()) total += static_cast<long>(kv.second.size());
-    return total;
-  }
+  static long getDeadCount();
 
-  static void pruneDead(long maxSize) {
-    if (getDeadCount() > maxSize) {
-      dead().clear();
-      deadContexts().clear();
-    }
-  }
+  static void pruneDead(long maxSize);
 
-  static long getAliveCount() {
-    long total = 0;
-    for (auto& kv : alive()) total += static_cast<long>(kv.second.size());
-    return total;
-  }
+  static long getAliveCount();
 
-  static long getAliveCountForClass(const gd::String& className) {
-    auto it = alive().find(className.c_str());
-    return it != alive().end() ? static_cast<long>(it->second.size()) : 0;
-  }
+  static long getAliveCountForClass(const gd::String& className);
 
-  static long getDeadCountForClass(const gd::String& className) {
-    auto it = dead().find(className.c_str());
-    return it != dead().end() ? static_cast<long>(it->second.size()) : 0;
-  }
+  static long getDeadCountForClass(const gd::String& className);
 
   // --- Destruction context API ---
 
   /** Set by JS before each wrapped method call (integer ID, ~50-100ns). */
-  static void setCurrentCallContextId(long id) {
-    currentCallContextId_() = static_cast<int>(id);
-  }
+  static void setCurrentCallContextId(long id);
 
   /**
    * Returns the call-context ID that was active when the object was destroyed,
-   * or -1 if the context has been evicted from the ring buffer.
+   * or -1 if the destruction is not remembered anymore.
    */
-  static long getDeadContextId(long ptr, const gd::String& className) {
-    auto* ctx = findDeadContext(
-        reinterpret_cast<const void*>(static_cast<uintptr_t>(ptr)),
-        className.c_str());
-    return ctx ? static_cast<long>(ctx->callContextId) : -1;
-  }
+  static long getDeadContextId(long ptr, const gd::String& className);
 
   /**
-   * Returns the wall-clock timestamp (ms since Unix epoch) when the object
-   * was destroyed, or 0 if the context is not available.
+   * Returns the wall-clock timestamp (ms since Unix epoch, or
+   * performance.now() under Emscripten) of the JS call that destroyed the
+   * object, or 0 if the destruction is not remembered anymore.
    */
-  static double getDeadContextTimeMs(long ptr, const gd::String& className) {
-    auto* ctx = findDeadContext(
-        reinterpret_cast<const void*>(static_cast<uintptr_t>(ptr)),
-        className.c_str());
-    return ctx ? ctx->timestampMs : 0.0;
-  }
+  static double getDeadContextTimeMs(long ptr, const gd::String& className);
 
  private:
-  using PtrSet = std::unordered_set<const void*>;
-  using ClassMap = std::unordered_map<std::string, PtrSet>;
-
-  // --- Destruction context ring buffer ---
-
-  struct DestructionContext {
+  struct DeadEntry {
     const void* ptr = nullptr;
-    int callContextId = -1;
     double timestampMs = 0.0;
+    int callContextId = -1;
+    ClassId classId = 0;
+    bool used = false;
   };
 
-  static constexpr size_t kRingCapacity = 64;
-
-  struct ClassRing {
-    std::array<DestructionContext, kRingCapacity> entries{};
-    size_t count = 0;  // total pushes; head = count % kRingCapacity
-
-    void push(const void* p, int contextId, double timestamp) {
-      DestructionContext& entry = entries[count % kRingCapacity];
-      entry.ptr = p;
-      entry.callContextId = contextId;
-      entry.timestampMs = timestamp;
-      count++;
-    }
-
-    // Search newest-first so the most recent destruction of a ptr wins.
-    const DestructionContext* find(const void* p) const {
-      size_t n = std::min(count, kRingCapacity);
-      for (size_t i = 0; i < n; i++) {
-        size_t idx = (count - 1 - i) % kRingCapacity;
-        if (entries[idx].ptr == p) return &entries[idx];
-      }
-      return nullptr;
-    }
-  };
-
-  using RingMap = std::unordered_map<std::string, ClassRing>;
+  static constexpr std::size_t kDeadBucketSize = 4;
 
-  // Heap-allocated maps (intentionally leaked) to avoid static destruction
-  // order issues.
-  static ClassMap& alive() {
-    static auto* m = new ClassMap();
-    return *m;
-  }
+  static bool findClassId(const char* className, ClassId& classId);
+  static const DeadEntry* findDeadEntry(const void* ptr, ClassId classId);
 
-  static ClassMap& dead() {
-    static auto* m = new ClassMap();
-    return *m;
-  }
-
-  static RingMap& deadContexts() {
-    static auto* m = new RingMap();
-    return *m;
-  }
-
-  static int& currentCallContextId_() {
-    static int id = 0;
-    return id;
-  }
-
-  /** High-resolution milliseconds for timestamping destructions.
-   *  Under Emscripten, uses emscripten_get_now() (equivalent to
-   *  performance.now() in JS). Otherwise falls back to std::chrono. */
-  static double nowMs() {
-#ifdef __EMSCRIPTEN__
-    return emscripten_get_now();
-#else
-    return static_cast<double>(
-        std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch())
-            .count());
-#endif
-  }
-
-  static const DestructionContext* findDeadContext(const void* ptr,
-                                                   const char* className) {
-    if (!className) return nullptr;
-    auto it = deadContexts().find(className);
-    if (it == deadContexts().end()) return nullptr;
-    return it->second.find(ptr);
-  }
+  /** The remembered destructions, by buckets of kDeadBucketSize entries. */
+  static std::vector<DeadEntry>& getDeadTable();
 };
 
 /**
@@ -238,11 +150,12 @@ class MemoryTrackedRegistry {
 class MemoryTracked {
  public:
   MemoryTracked(const void* owner, const char* className)
-      : owner_(owner), className_(className) {
-    if (className_) MemoryTrackedRegistry::add(owner_, className_);
+      : owner_(owner),
+        classId_(MemoryTrackedRegistry::getOrCreateClassId(className)) {
+    MemoryTrackedRegistry::add(owner_, classId_);
   }
 
-  ~MemoryTracked() { if (className_) MemoryTrackedRegistry::remove(owner_, className_); }
+  ~MemoryTracked() { MemoryTrackedRegistry::remove(owner_, classId_); }
 
   // Non-copyable, non-movable.
   MemoryTracked(const MemoryTracked&) = delete;
@@ -252,7 +165,7 @@ class MemoryTracked {
 
  private:
   const void* owner_;
-  const char* className_;
+  MemoryTrackedRegistry::ClassId classId_;
 };
 
 }  // namespace gd
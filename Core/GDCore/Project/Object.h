@@ -124,6 +124,13 @@ class GD_CORE_API Object {
    */
   const gd::String& GetType() const { return configuration->GetType(); }
 
+  /** \brief Return the type of the object, as an interned string that can be
+   * compared and hashed in constant time.
+   */
+  const gd::InternedString& GetInternedType() const {
+    return configuration->GetInternedType();
+  }
+
   /**
    * Set when the object resources must be preloaded: `with-scene`(default),
    * `manually`.
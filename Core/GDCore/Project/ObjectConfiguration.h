@@ -15,6 +15,7 @@
 #include "GDCore/Project/ResourcesContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/InternedString.h"
 #include "GDCore/Tools/MakeUnique.h"
 namespace gd {
 class PropertyDescriptor;
@@ -67,7 +68,12 @@ class GD_CORE_API ObjectConfiguration {
 
   /** \brief Return the type of the object.
    */
-  const gd::String& GetType() const { return type; }
+  const gd::String& GetType() const { return type.Get(); }
+
+  /** \brief Return the type of the object, as an interned string that can be
+   * compared and hashed in constant time.
+   */
+  const gd::InternedString& GetInternedType() const { return type; }
 
   /** \name Object properties
    * Reading and updating object configuration properties
@@ -206,8 +212,8 @@ class GD_CORE_API ObjectConfiguration {
   ///@}
 
 protected:
-  gd::String type; ///< Which type of object is represented by this
-                   ///< configuration.
+  gd::InternedString type; ///< Which type of object is represented by this
+                           ///< configuration.
 
   /**
    * \brief Derived object configuration can redefine this method to load
@@ -29,7 +29,10 @@ ObjectsContainer::ObjectsContainer(const ObjectsContainer& other) {
 }
 
 ObjectsContainer& ObjectsContainer::operator=(const ObjectsContainer& other) {
-  if (this != &other) Init(other);
+  if (this != &other) {
+    Init(other);
+    changesCount++;
+  }
 
   return *this;
 }
@@ -69,6 +72,7 @@ void ObjectsContainer::AddMissingObjectsInRootFolder() {
 void ObjectsContainer::UnserializeObjectsFrom(
     gd::Project& project, const SerializerElement& element) {
   Clear();
+  changesCount++;
   element.ConsiderAsArrayOf("object", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     const SerializerElement& objectElement = element.GetChild(i);
@@ -94,6 +98,7 @@ bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
                   }) != initialObjects.end());
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
+  changesCount++;
   return *(*find_if(initialObjects.begin(),
                     initialObjects.end(),
                     [&](const std::unique_ptr<gd::Object>& object) {
@@ -108,6 +113,7 @@ const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
                     }));
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
+  changesCount++;
   return *initialObjects[index];
 }
 const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
@@ -126,6 +132,7 @@ gd::Object& ObjectsContainer::InsertNewObject(const gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
+  changesCount++;
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
@@ -142,6 +149,7 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
     const gd::String& name,
     gd::ObjectFolderOrObject& objectFolderOrObject,
     std::size_t position) {
+  changesCount++;
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       initialObjects.end(), project.CreateObject(objectType, name))));
 
@@ -152,6 +160,7 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
+  changesCount++;
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       position < initialObjects.size() ? initialObjects.begin() + position
                                        : initialObjects.end(),
@@ -163,6 +172,7 @@ gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
 void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   if (oldIndex >= initialObjects.size() || newIndex >= initialObjects.size())
     return;
+  changesCount++;
 
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
@@ -177,6 +187,7 @@ void ObjectsContainer::RemoveObject(const gd::String& name) {
                 return object->GetName() == name;
               });
   if (objectIt == initialObjects.end()) return;
+  changesCount++;
 
   rootFolder->RemoveRecursivelyObjectNamed(name);
 
@@ -184,6 +195,7 @@ void ObjectsContainer::RemoveObject(const gd::String& name) {
 }
 
 void ObjectsContainer::Clear() {
+  changesCount++;
   rootFolder->Clear();
   initialObjects.clear();
 }
@@ -202,6 +214,8 @@ void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
         return object->GetName() == objectFolderOrObject.GetObject().GetName();
       });
   if (objectIt == initialObjects.end()) return;
+  changesCount++;
+  newContainer.changesCount++;
 
   std::unique_ptr<gd::Object> object = std::move(*objectIt);
   initialObjects.erase(objectIt);
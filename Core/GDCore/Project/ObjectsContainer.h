@@ -56,6 +56,15 @@ class GD_CORE_API ObjectsContainer {
 
   SourceType GetSourceType() const { return sourceType; }
 
+  /**
+   * \brief Return a number changing each time the objects or the groups of the
+   * container can have been modified (including when a non-const reference to
+   * one of them is returned).
+   *
+   * \see gd::ProjectScopedContainers::GetVersion
+   */
+  std::size_t GetChangesCount() const { return changesCount; }
+
   /** \name Objects management
    * Members functions related to objects management.
    */
@@ -176,6 +185,7 @@ class GD_CORE_API ObjectsContainer {
    * Provide a raw access to the vector containing the objects
    */
   std::vector<std::unique_ptr<gd::Object> >& GetObjects() {
+    changesCount++;
     return initialObjects;
   }
 
@@ -236,7 +246,10 @@ class GD_CORE_API ObjectsContainer {
   /**
    * \brief Return a reference to the project's objects groups.
    */
-  ObjectGroupsContainer& GetObjectGroups() { return objectGroups; }
+  ObjectGroupsContainer& GetObjectGroups() {
+    changesCount++;
+    return objectGroups;
+  }
 
   /**
    * \brief Return a const reference to the project's objects groups.
@@ -253,6 +266,7 @@ class GD_CORE_API ObjectsContainer {
  private:
   SourceType sourceType = Unknown;
   std::unique_ptr<gd::ObjectFolderOrObject> rootFolder;
+  std::size_t changesCount = 0;
   gd::MemoryTracked _memoryTracked{this, "ObjectsContainer"};
 
   /**
@@ -26,6 +26,23 @@ class GD_CORE_API ParameterMetadataContainer
     : private SerializableWithNameList<gd::ParameterMetadata> {
 public:
   ParameterMetadataContainer() {}
+  ParameterMetadataContainer(const ParameterMetadataContainer &other)
+      : SerializableWithNameList<gd::ParameterMetadata>(other) {}
+  ParameterMetadataContainer &operator=(
+      const ParameterMetadataContainer &other) {
+    SerializableWithNameList<gd::ParameterMetadata>::operator=(other);
+    changesCount++;
+    return *this;
+  }
+
+  /**
+   * \brief Return a number changing each time the parameters can have been
+   * modified (including when a non-const reference to one of them is
+   * returned).
+   *
+   * \see gd::ProjectScopedContainers::GetVersion
+   */
+  std::size_t GetChangesCount() const { return changesCount; }
 
   /** \name Events Functions management
    */
@@ -42,6 +59,7 @@ public:
    * undefined behavior.
    */
   gd::ParameterMetadata &GetParameter(const gd::String &name) {
+    changesCount++;
     return Get(name);
   }
 
@@ -61,7 +79,10 @@ public:
    * \warning Trying to access to a not existing function will result in
    * undefined behavior.
    */
-  gd::ParameterMetadata &GetParameter(std::size_t index) { return Get(index); }
+  gd::ParameterMetadata &GetParameter(std::size_t index) {
+    changesCount++;
+    return Get(index);
+  }
 
   /**
    * \brief Get the function at the specified index in the list.
@@ -80,21 +101,32 @@ public:
 
   gd::ParameterMetadata &InsertNewParameter(const gd::String &name,
                                             std::size_t position) {
+    changesCount++;
     return InsertNew(name, position);
   }
   gd::ParameterMetadata &InsertParameter(const gd::ParameterMetadata &object,
                                          std::size_t position) {
+    changesCount++;
     return Insert(object, position);
   }
   gd::ParameterMetadata &AddNewParameter(const gd::String &name) {
+    changesCount++;
     return InsertNew(name, GetCount());
   }
   gd::ParameterMetadata &AddParameter(const gd::ParameterMetadata &object) {
+    changesCount++;
     return Insert(object, GetCount());
   }
-  void RemoveParameter(const gd::String &name) { return Remove(name); }
-  void ClearParameters() { return Clear(); }
+  void RemoveParameter(const gd::String &name) {
+    changesCount++;
+    return Remove(name);
+  }
+  void ClearParameters() {
+    changesCount++;
+    return Clear();
+  }
   void MoveParameter(std::size_t oldIndex, std::size_t newIndex) {
+    changesCount++;
     return Move(oldIndex, newIndex);
   };
   std::size_t
@@ -114,6 +146,7 @@ public:
    * \brief Provide a raw access to the vector containing the functions.
    */
   std::vector<std::unique_ptr<gd::ParameterMetadata>> &GetInternalVector() {
+    changesCount++;
     return elements;
   };
   ///@}
@@ -132,6 +165,7 @@ public:
    * \brief Unserialize the events functions.
    */
   void UnserializeParametersFrom(const SerializerElement &element) {
+    changesCount++;
     return UnserializeElementsFrom("parameters", element);
   };
   ///@}
@@ -143,6 +177,9 @@ protected:
   void Init(const gd::ParameterMetadataContainer &other) {
     return SerializableWithNameList<gd::ParameterMetadata>::Init(other);
   };
+
+private:
+  std::size_t changesCount = 0;
 };
 
 } // namespace gd
@@ -1,6 +1,9 @@
 #include "ProjectScopedContainers.h"
 
+#include <atomic>
+
 #include "GDCore/IDE/EventsFunctionTools.h"
+#include "GDCore/Project/BehaviorsContainer.h"
 #include "GDCore/Project/EventsFunctionsExtension.h"
 #include "GDCore/Project/EventsBasedBehavior.h"
 #include "GDCore/Project/EventsBasedObject.h"
@@ -12,6 +15,33 @@
 
 namespace gd {
 
+namespace {
+std::atomic<std::size_t> lastVersion(0);
+}  // namespace
+
+std::size_t ProjectScopedContainers::MakeNewVersion() { return ++lastVersion; }
+
+std::size_t ProjectScopedContainers::GetContainersChangesCount() const {
+  std::size_t changesCount = 0;
+  for (std::size_t i = 0;
+       i < objectsContainersList.GetObjectsContainersCount();
+       ++i) {
+    changesCount +=
+        objectsContainersList.GetObjectsContainer(i).GetChangesCount();
+  }
+  for (std::size_t i = 0;
+       i < variablesContainersList.GetVariablesContainersCount();
+       ++i) {
+    changesCount +=
+        variablesContainersList.GetVariablesContainer(i).GetChangesCount();
+  }
+  for (const ParameterMetadataContainer *parameters : parametersVectorsList) {
+    changesCount += parameters->GetChangesCount();
+  }
+  changesCount += gd::BehaviorsContainer::GetAllContainersChangesCount();
+  return changesCount;
+}
+
 ProjectScopedContainers
 ProjectScopedContainers::MakeNewProjectScopedContainersForProjectAndLayout(
     const gd::Project &project, const gd::Layout &layout) {
@@ -244,6 +274,7 @@ ProjectScopedContainers::MakeNewProjectScopedContainersWithLocalVariables(
       VariablesContainersList::MakeNewVariablesContainersListPushing(
           projectScopedContainers.GetVariablesContainersList(),
           event.GetVariables());
+  newProjectScopedContainers.MarkAsChanged();
   return newProjectScopedContainers;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <set>
 
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/String.h"
 #include "ObjectsContainersList.h"
@@ -32,6 +33,11 @@ namespace gd {
  *
  * For example, in an expression, when an identifier is written, this class is
  * used to know what this identifier refers too.
+ *
+ * Each change of the scope, or of the objects, variables or parameters of its
+ * containers, gives it a new version, so that the results of the analysis of
+ * expressions can be stored in their nodes and reused while the version is
+ * unchanged (see gd::ExpressionNodeCache).
  */
 class ProjectScopedContainers {
  public:
@@ -47,7 +53,9 @@ class ProjectScopedContainers {
         legacyGlobalVariables(legacyGlobalVariables_),
         legacySceneVariables(legacySceneVariables_),
         propertiesContainersList(propertiesContainersList_),
-        resourcesContainersList(resourcesContainersList_){};
+        resourcesContainersList(resourcesContainersList_),
+        version(MakeNewVersion()),
+        containersChangesCount(0){};
   virtual ~ProjectScopedContainers(){};
 
   static ProjectScopedContainers
@@ -110,6 +118,7 @@ class ProjectScopedContainers {
   ProjectScopedContainers &AddPropertiesContainer(
       const gd::PropertiesContainer &container) {
     propertiesContainersList.Add(container);
+    MarkAsChanged();
 
     return *this;
   }
@@ -117,10 +126,35 @@ class ProjectScopedContainers {
   ProjectScopedContainers &AddParameters(
       const ParameterMetadataContainer &parameters) {
     parametersVectorsList.push_back(&parameters);
+    MarkAsChanged();
 
     return *this;
   }
 
+  /**
+   * \brief Return the version of the scope, which changes each time
+   * something in the scope is changed.
+   *
+   * Changes of the objects, variables and parameters of the containers are
+   * detected using their changes count, as well as changes of the behaviors
+   * of any object.
+   */
+  std::size_t GetVersion() const {
+    std::size_t changesCount = GetContainersChangesCount();
+    if (changesCount != containersChangesCount) {
+      containersChangesCount = changesCount;
+      version = MakeNewVersion();
+    }
+    return version;
+  };
+
+  /**
+   * \brief Give a new version to the scope, to be called when something
+   * that is not detected by GetVersion is changed (like properties, or a
+   * variable modified through a reference kept from before).
+   */
+  void MarkAsChanged() { version = MakeNewVersion(); };
+
   template <class ReturnType>
   ReturnType MatchIdentifierWithName(
       const gd::String &name,
@@ -129,24 +163,40 @@ class ProjectScopedContainers {
       std::function<ReturnType()> propertyCallback,
       std::function<ReturnType()> parameterCallback,
       std::function<ReturnType()> notFoundCallback) const {
-    if (objectsContainersList.HasObjectOrGroupNamed(name))
-      return objectCallback();
-    else if (variablesContainersList.Has(name)) {
-      const auto &variablesContainer =
-          variablesContainersList.GetVariablesContainerFromVariableOrPropertyOrParameterName(name);
-      const auto sourceType = variablesContainer.GetSourceType();
-      if (sourceType == gd::VariablesContainer::SourceType::Properties) {
-        return propertyCallback();
-      } else if (sourceType == gd::VariablesContainer::SourceType::Parameters) {
-        return parameterCallback();
-      }
-      return variableCallback();
-    } else if (ParameterMetadataTools::Has(parametersVectorsList, name))
-      return parameterCallback();
-    else if (propertiesContainersList.Has(name))
-      return propertyCallback();
+    return CallIdentifierKindCallback(GetIdentifierKind(name),
+                                      objectCallback,
+                                      variableCallback,
+                                      propertyCallback,
+                                      parameterCallback,
+                                      notFoundCallback);
+  };
 
-    return notFoundCallback();
+  /**
+   * \brief Same as MatchIdentifierWithName, but the identifier is only
+   * searched the first time for a node, as long as the scope is unchanged.
+   */
+  template <class ReturnType>
+  ReturnType MatchIdentifierWithName(
+      const gd::ExpressionNode &node,
+      const gd::String &name,
+      std::function<ReturnType()> objectCallback,
+      std::function<ReturnType()> variableCallback,
+      std::function<ReturnType()> propertyCallback,
+      std::function<ReturnType()> parameterCallback,
+      std::function<ReturnType()> notFoundCallback) const {
+    gd::ExpressionNodeCache &cache = node.GetCache(GetVersion());
+    if (cache.identifierKind == gd::ExpressionNodeCache::Unresolved ||
+        cache.identifierName != name) {
+      cache.identifierName = name;
+      cache.identifierKind = GetIdentifierKind(name);
+    }
+
+    return CallIdentifierKindCallback(cache.identifierKind,
+                                      objectCallback,
+                                      variableCallback,
+                                      propertyCallback,
+                                      parameterCallback,
+                                      notFoundCallback);
   };
 
   void ForEachIdentifierMatchingSearch(
@@ -205,11 +255,21 @@ class ProjectScopedContainers {
   };
 
   /**
-   * @brief Allow modification of the variables containers list. This is used
-   * by code generation which does push and pop of local variable containers.
+   * @brief Push a variables container to the variables containers list. This
+   * is used by code generation for local variables.
    */
-  gd::VariablesContainersList &GetVariablesContainersList() {
-    return variablesContainersList;
+  void PushVariablesContainer(const gd::VariablesContainer &variablesContainer) {
+    variablesContainersList.Push(variablesContainer);
+    MarkAsChanged();
+  };
+
+  /**
+   * @brief Pop the last variables container pushed to the variables
+   * containers list.
+   */
+  void PopVariablesContainer() {
+    variablesContainersList.Pop();
+    MarkAsChanged();
   };
 
   /**
@@ -303,9 +363,64 @@ class ProjectScopedContainers {
   /** Do not use - should be private but accessible to let Emscripten create a
    * temporary. */
   ProjectScopedContainers()
-      : legacyGlobalVariables(nullptr), legacySceneVariables(nullptr){};
+      : legacyGlobalVariables(nullptr),
+        legacySceneVariables(nullptr),
+        version(MakeNewVersion()),
+        containersChangesCount(0){};
 
 private:
+  gd::ExpressionNodeCache::IdentifierKind GetIdentifierKind(
+      const gd::String &name) const {
+    if (objectsContainersList.HasObjectOrGroupNamed(name))
+      return gd::ExpressionNodeCache::Object;
+    else if (variablesContainersList.Has(name)) {
+      const auto &variablesContainer =
+          variablesContainersList.GetVariablesContainerFromVariableOrPropertyOrParameterName(name);
+      const auto sourceType = variablesContainer.GetSourceType();
+      if (sourceType == gd::VariablesContainer::SourceType::Properties) {
+        return gd::ExpressionNodeCache::Property;
+      } else if (sourceType == gd::VariablesContainer::SourceType::Parameters) {
+        return gd::ExpressionNodeCache::Parameter;
+      }
+      return gd::ExpressionNodeCache::Variable;
+    } else if (ParameterMetadataTools::Has(parametersVectorsList, name))
+      return gd::ExpressionNodeCache::Parameter;
+    else if (propertiesContainersList.Has(name))
+      return gd::ExpressionNodeCache::Property;
+
+    return gd::ExpressionNodeCache::NotFound;
+  };
+
+  template <class ReturnType>
+  static ReturnType CallIdentifierKindCallback(
+      gd::ExpressionNodeCache::IdentifierKind identifierKind,
+      std::function<ReturnType()> &objectCallback,
+      std::function<ReturnType()> &variableCallback,
+      std::function<ReturnType()> &propertyCallback,
+      std::function<ReturnType()> &parameterCallback,
+      std::function<ReturnType()> &notFoundCallback) {
+    switch (identifierKind) {
+      case gd::ExpressionNodeCache::Object:
+        return objectCallback();
+      case gd::ExpressionNodeCache::Variable:
+        return variableCallback();
+      case gd::ExpressionNodeCache::Property:
+        return propertyCallback();
+      case gd::ExpressionNodeCache::Parameter:
+        return parameterCallback();
+      default:
+        return notFoundCallback();
+    }
+  };
+
+  /**
+   * \brief Return the sum of the changes counts of the containers of objects,
+   * variables and parameters in the scope.
+   */
+  std::size_t GetContainersChangesCount() const;
+
+  static std::size_t MakeNewVersion();
+
   gd::ObjectsContainersList objectsContainersList;
   gd::VariablesContainersList variablesContainersList;
   const gd::VariablesContainer *legacyGlobalVariables;
@@ -320,6 +435,11 @@ private:
   gd::String scopeFunctionName;
   gd::String scopeBehaviorName;
   gd::String scopeObjectName;
+
+  mutable std::size_t version;
+  mutable std::size_t containersChangesCount;  ///< The changes count of the
+                                               ///< containers when the
+                                               ///< version was last given.
 };
 
 }  // namespace gd
\ No newline at end of file
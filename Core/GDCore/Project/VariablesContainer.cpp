@@ -49,6 +49,7 @@ bool VariablesContainer::Has(const gd::String& name) const {
 }
 
 Variable& VariablesContainer::Get(const gd::String& name) {
+  changesCount++;
   auto i =
       std::find_if(variables.begin(), variables.end(), VariableHasName(name));
   if (i != variables.end()) return *i->second;
@@ -65,6 +66,7 @@ const Variable& VariablesContainer::Get(const gd::String& name) const {
 }
 
 Variable& VariablesContainer::Get(std::size_t index) {
+  changesCount++;
   if (index < variables.size()) return *variables[index].second;
 
   return badVariable;
@@ -85,6 +87,7 @@ const gd::String& VariablesContainer::GetNameAt(std::size_t index) const {
 Variable& VariablesContainer::Insert(const gd::String& name,
                                      const gd::Variable& variable,
                                      std::size_t position) {
+  changesCount++;
   auto newVariable = std::make_shared<gd::Variable>(variable);
   // The "mixed values" marker is an editor-only, display state used by the
   // temporary containers merging the variables of several objects (see
@@ -104,6 +107,7 @@ Variable& VariablesContainer::Insert(const gd::String& name,
 }
 
 void VariablesContainer::Remove(const gd::String& varName) {
+  changesCount++;
   variables.erase(
       std::remove_if(
           variables.begin(), variables.end(), VariableHasName(varName)),
@@ -112,6 +116,7 @@ void VariablesContainer::Remove(const gd::String& varName) {
 
 void VariablesContainer::RemoveRecursively(
     const gd::Variable& variableToRemove) {
+  changesCount++;
   variables.erase(
       std::remove_if(
           variables.begin(),
@@ -145,6 +150,7 @@ Variable& VariablesContainer::InsertNew(const gd::String& name,
 bool VariablesContainer::Rename(const gd::String& oldName,
                                 const gd::String& newName) {
   if (Has(newName)) return false;
+  changesCount++;
 
   auto i = std::find_if(
       variables.begin(), variables.end(), VariableHasName(oldName));
@@ -158,6 +164,7 @@ void VariablesContainer::Swap(std::size_t firstVariableIndex,
   if (firstVariableIndex >= variables.size() ||
       secondVariableIndex >= variables.size())
     return;
+  changesCount++;
 
   auto temp = variables[firstVariableIndex];
   variables[firstVariableIndex] = variables[secondVariableIndex];
@@ -168,6 +175,7 @@ void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   if (oldIndex >= variables.size() || newIndex >= variables.size() ||
       oldIndex == newIndex)
     return;
+  changesCount++;
 
   auto nameAndVariable = variables[oldIndex];
   variables.erase(variables.begin() + oldIndex);
@@ -254,7 +262,10 @@ VariablesContainer::VariablesContainer(const VariablesContainer& other) {
 
 VariablesContainer& VariablesContainer::operator=(
     const VariablesContainer& other) {
-  if (this != &other) Init(other);
+  if (this != &other) {
+    Init(other);
+    changesCount++;
+  }
 
   return *this;
 }
@@ -49,6 +49,15 @@ class GD_CORE_API VariablesContainer {
 
   SourceType GetSourceType() const { return sourceType; }
 
+  /**
+   * \brief Return a number changing each time the variables of the container
+   * can have been modified (including when a non-const reference to one of
+   * them is returned).
+   *
+   * \see gd::ProjectScopedContainers::GetVersion
+   */
+  std::size_t GetChangesCount() const { return changesCount; }
+
   /** \name Variables management
    * Members functions related to variables management.
    */
@@ -148,7 +157,10 @@ class GD_CORE_API VariablesContainer {
   /**
    * \brief Clear all variables of the container.
    */
-  inline void Clear() { variables.clear(); }
+  inline void Clear() {
+    changesCount++;
+    variables.clear();
+  }
 
   /**
    * \brief Call the callback for each variable with a name matching the specified search.
@@ -211,6 +223,7 @@ class GD_CORE_API VariablesContainer {
  private:
   SourceType sourceType = Unknown;
   std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>> variables;
+  std::size_t changesCount = 0;
   mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
                                       ///< useful for computing changesets.
   static gd::Variable badVariable;
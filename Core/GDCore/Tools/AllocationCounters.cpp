@@ -0,0 +1,240 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/AllocationCounters.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <vector>
+
+namespace {
+
+// The counters only ever increase: counts are computed from their values at
+// the start of a phase (or at the last reset).
+std::atomic<std::size_t> allocationsCount(0);
+std::atomic<std::size_t> allocatedBytes(0);
+std::atomic<std::size_t> liveBytes(0);
+std::atomic<std::size_t> peakLiveBytes(0);
+
+#if defined(GD_ALLOCATION_COUNTING)
+// The size of each allocation is stored before it, in a header keeping the
+// alignment of the allocated memory.
+const std::size_t headerSize = alignof(std::max_align_t);
+
+void* CountedAllocate(std::size_t size) {
+  void* memory = std::malloc(size + headerSize);
+  if (!memory) return nullptr;
+
+  *static_cast<std::size_t*>(memory) = size;
+  allocationsCount++;
+  allocatedBytes += size;
+  std::size_t newLiveBytes = liveBytes += size;
+  std::size_t peak = peakLiveBytes.load();
+  while (newLiveBytes > peak &&
+         !peakLiveBytes.compare_exchange_weak(peak, newLiveBytes)) {
+  }
+
+  return static_cast<char*>(memory) + headerSize;
+}
+
+void CountedFree(void* pointer) {
+  if (!pointer) return;
+
+  void* memory = static_cast<char*>(pointer) - headerSize;
+  liveBytes -= *static_cast<std::size_t*>(memory);
+  std::free(memory);
+}
+#endif
+
+struct CountersState {
+  std::size_t allocationsCount;
+  std::size_t allocatedBytes;
+  std::size_t liveBytes;
+  std::size_t peakLiveBytes;  ///< The peak before the state was taken.
+
+  static CountersState Now() {
+    CountersState state;
+    state.allocationsCount = ::allocationsCount;
+    state.allocatedBytes = ::allocatedBytes;
+    state.liveBytes = ::liveBytes;
+    state.peakLiveBytes = ::peakLiveBytes;
+    return state;
+  }
+
+  /**
+   * \brief Move the state forward to ignore the allocations done between
+   * \a before and \a after.
+   */
+  void Ignore(const CountersState& before, const CountersState& after) {
+    allocationsCount += after.allocationsCount - before.allocationsCount;
+    allocatedBytes += after.allocatedBytes - before.allocatedBytes;
+    liveBytes += after.liveBytes - before.liveBytes;
+  }
+
+  /**
+   * \brief Return the counts since this state was taken, the peak being
+   * measured from when it was restarted at the live bytes of this state.
+   */
+  gd::AllocationCounts GetCountsSince(std::size_t currentPeakLiveBytes) const {
+    gd::AllocationCounts counts;
+    counts.allocationsCount = ::allocationsCount - allocationsCount;
+    counts.allocatedBytes = ::allocatedBytes - allocatedBytes;
+    counts.peakBytes = currentPeakLiveBytes > liveBytes
+                           ? currentPeakLiveBytes - liveBytes
+                           : 0;
+    return counts;
+  }
+};
+
+struct Phase {
+  std::size_t index;  ///< In GetPhasesState().phaseNames.
+  CountersState start;
+};
+
+struct PhasesState {
+  CountersState reset = CountersState::Now();
+  std::vector<Phase> phasesInProgress;
+  std::vector<gd::String> phaseNames;
+  std::map<gd::String, gd::AllocationCounts> phasesCounts;
+};
+
+PhasesState& GetPhasesState() {
+  static PhasesState phasesState;
+  return phasesState;
+}
+
+/**
+ * \brief Return the peak of the live bytes since the last reset, as the
+ * phases in progress restarted it.
+ */
+std::size_t GetPeakLiveBytesSinceReset() {
+  std::size_t peak = peakLiveBytes;
+  for (const auto& phase : GetPhasesState().phasesInProgress)
+    peak = std::max(peak, phase.start.peakLiveBytes);
+
+  return peak;
+}
+
+}  // namespace
+
+#if defined(GD_ALLOCATION_COUNTING)
+void* operator new(std::size_t size) {
+  void* pointer = CountedAllocate(size);
+  if (!pointer) throw std::bad_alloc();
+  return pointer;
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return CountedAllocate(size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return CountedAllocate(size);
+}
+void operator delete(void* pointer) noexcept { CountedFree(pointer); }
+void operator delete[](void* pointer) noexcept { CountedFree(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept {
+  CountedFree(pointer);
+}
+void operator delete[](void* pointer, std::size_t) noexcept {
+  CountedFree(pointer);
+}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  CountedFree(pointer);
+}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  CountedFree(pointer);
+}
+#endif
+
+namespace gd {
+
+bool AllocationCounters::IsEnabled() {
+#if defined(GD_ALLOCATION_COUNTING)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void AllocationCounters::Reset() {
+  auto& phasesState = GetPhasesState();
+  phasesState.phasesInProgress.clear();
+  phasesState.phaseNames.clear();
+  phasesState.phasesCounts.clear();
+
+  peakLiveBytes = liveBytes.load();
+  phasesState.reset = CountersState::Now();
+}
+
+AllocationCounts AllocationCounters::GetCounts() {
+  return GetPhasesState().reset.GetCountsSince(GetPeakLiveBytesSinceReset());
+}
+
+void AllocationCounters::BeginPhase(const gd::String& name) {
+  // Allocations done to remember the phase are not counted, neither in the
+  // total nor in the phases in progress.
+  CountersState beforeBookkeeping = CountersState::Now();
+  auto& phasesState = GetPhasesState();
+  if (phasesState.phasesCounts.find(name) == phasesState.phasesCounts.end()) {
+    phasesState.phaseNames.push_back(name);
+    phasesState.phasesCounts[name] = AllocationCounts();
+  }
+  auto nameIt = std::find(
+      phasesState.phaseNames.begin(), phasesState.phaseNames.end(), name);
+  phasesState.phasesInProgress.push_back(Phase());
+
+  CountersState afterBookkeeping = CountersState::Now();
+  phasesState.reset.Ignore(beforeBookkeeping, afterBookkeeping);
+  for (std::size_t i = 0; i + 1 < phasesState.phasesInProgress.size(); ++i)
+    phasesState.phasesInProgress[i].start.Ignore(beforeBookkeeping,
+                                                 afterBookkeeping);
+  peakLiveBytes = beforeBookkeeping.peakLiveBytes +
+                  (afterBookkeeping.liveBytes - beforeBookkeeping.liveBytes);
+
+  Phase& phase = phasesState.phasesInProgress.back();
+  phase.index = nameIt - phasesState.phaseNames.begin();
+  phase.start = CountersState::Now();
+  peakLiveBytes = phase.start.liveBytes;
+}
+
+void AllocationCounters::EndPhase() {
+  auto& phasesState = GetPhasesState();
+  if (phasesState.phasesInProgress.empty()) return;
+
+  const Phase& phase = phasesState.phasesInProgress.back();
+  std::size_t currentPeakLiveBytes = peakLiveBytes;
+  AllocationCounts counts = phase.start.GetCountsSince(currentPeakLiveBytes);
+
+  // Let the enclosing phases see the peak of this one.
+  peakLiveBytes = std::max(currentPeakLiveBytes, phase.start.peakLiveBytes);
+
+  auto& phaseCounts =
+      phasesState.phasesCounts[phasesState.phaseNames[phase.index]];
+  phaseCounts.allocationsCount += counts.allocationsCount;
+  phaseCounts.allocatedBytes += counts.allocatedBytes;
+  phaseCounts.peakBytes = std::max(phaseCounts.peakBytes, counts.peakBytes);
+  phasesState.phasesInProgress.pop_back();
+}
+
+bool AllocationCounters::HasPhase(const gd::String& name) {
+  const auto& phasesCounts = GetPhasesState().phasesCounts;
+  return phasesCounts.find(name) != phasesCounts.end();
+}
+
+AllocationCounts AllocationCounters::GetPhaseCounts(const gd::String& name) {
+  const auto& phasesCounts = GetPhasesState().phasesCounts;
+  auto it = phasesCounts.find(name);
+  return it != phasesCounts.end() ? it->second : AllocationCounts();
+}
+
+std::vector<gd::String> AllocationCounters::GetPhaseNames() {
+  return GetPhasesState().phaseNames;
+}
+
+}  // namespace gd
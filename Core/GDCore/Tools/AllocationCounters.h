@@ -0,0 +1,125 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief The number and the size of the heap allocations done during a
+ * period of time.
+ */
+class GD_CORE_API AllocationCounts {
+ public:
+  AllocationCounts() : allocationsCount(0), allocatedBytes(0), peakBytes(0){};
+
+  /**
+   * \brief Return the number of allocations.
+   */
+  std::size_t GetAllocationsCount() const { return allocationsCount; }
+
+  /**
+   * \brief Return the total size, in bytes, of the allocations.
+   */
+  std::size_t GetAllocatedBytes() const { return allocatedBytes; }
+
+  /**
+   * \brief Return the highest size, in bytes, of the memory allocated at the
+   * same time, not counting the memory that was already allocated at the
+   * start.
+   */
+  std::size_t GetPeakBytes() const { return peakBytes; }
+
+  std::size_t allocationsCount;
+  std::size_t allocatedBytes;
+  std::size_t peakBytes;
+};
+
+/**
+ * \brief Count the heap allocations done by GDevelop, in total and for named
+ * phases (like "UnserializeFrom" or "ExportScenesEventsCode").
+ *
+ * The counting is only done when GDevelop is built with the
+ * `GD_ALLOCATION_COUNTING` CMake option: the global operator new and delete
+ * are then replaced by versions updating the counters. Otherwise, all the
+ * counts stay at zero: see IsEnabled.
+ *
+ * Phases can be nested: the allocations of a phase are also counted in the
+ * phases containing it. A phase done several times sums its allocations, and
+ * keeps the highest peak.
+ *
+ * \note Counts are made for all the threads, without distinguishing them.
+ */
+class GD_CORE_API AllocationCounters {
+ public:
+  /**
+   * \brief Return true if GDevelop was built with the allocation counting.
+   */
+  static bool IsEnabled();
+
+  /**
+   * \brief Set the counts to zero and forget all the phases.
+   *
+   * Must not be called while a phase is in progress.
+   */
+  static void Reset();
+
+  /**
+   * \brief Return the counts since the last reset.
+   */
+  static AllocationCounts GetCounts();
+
+  /**
+   * \brief Start counting the allocations of a phase, until the matching call
+   * to EndPhase.
+   */
+  static void BeginPhase(const gd::String& name);
+
+  /**
+   * \brief End the phase started by the last call to BeginPhase.
+   */
+  static void EndPhase();
+
+  /**
+   * \brief Return true if the phase was done since the last reset.
+   */
+  static bool HasPhase(const gd::String& name);
+
+  /**
+   * \brief Return the counts of all the times the phase was done since the
+   * last reset (zero if it was not done).
+   */
+  static AllocationCounts GetPhaseCounts(const gd::String& name);
+
+  /**
+   * \brief Return the names of the phases done since the last reset, in the
+   * order they were first started.
+   */
+  static std::vector<gd::String> GetPhaseNames();
+};
+
+/**
+ * \brief Count the allocations of a phase for the lifetime of this object.
+ *
+ * \see gd::AllocationCounters
+ */
+class GD_CORE_API AllocationCountingPhase {
+ public:
+  AllocationCountingPhase(const gd::String& name) {
+    AllocationCounters::BeginPhase(name);
+  };
+  ~AllocationCountingPhase() { AllocationCounters::EndPhase(); };
+
+ private:
+  AllocationCountingPhase(const AllocationCountingPhase&) = delete;
+  AllocationCountingPhase& operator=(const AllocationCountingPhase&) = delete;
+};
+
+}  // namespace gd
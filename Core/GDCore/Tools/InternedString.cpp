@@ -0,0 +1,54 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/InternedString.h"
+
+#include <unordered_map>
+
+namespace gd {
+
+namespace {
+// The pool is a function-local static so that it can be used by static
+// metadata constructed before main (like the "bad" metadata returned for
+// unknown instructions). Nodes of an unordered_map are never moved, so the
+// addresses handed out stay valid when the map is rehashed.
+std::unordered_map<gd::String, std::size_t>& GetPool() {
+  static std::unordered_map<gd::String, std::size_t> pool;
+  return pool;
+}
+}  // namespace
+
+InternedString::PooledString& InternedString::Intern(const gd::String& str) {
+  if (str.empty()) {
+    PooledString& emptyString = GetEmptyString();
+    Acquire(&emptyString);
+    return emptyString;
+  }
+
+  auto& pool = GetPool();
+  auto it = pool.find(str);
+  if (it == pool.end()) it = pool.emplace(str, 0).first;
+
+  Acquire(&*it);
+  return *it;
+}
+
+InternedString::PooledString& InternedString::GetEmptyString() {
+  // The empty string is used by every default-constructed InternedString:
+  // it keeps an extra reference so that it's never removed from the pool.
+  static PooledString& emptyString = *GetPool().emplace("", 1).first;
+  return emptyString;
+}
+
+void InternedString::Release(PooledString* pooledString) {
+  if (--pooledString->second != 0) return;
+
+  auto& pool = GetPool();
+  pool.erase(pool.find(pooledString->first));
+}
+
+std::size_t InternedString::GetPoolSize() { return GetPool().size(); }
+
+}  // namespace gd
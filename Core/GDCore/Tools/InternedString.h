@@ -0,0 +1,113 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An immutable string stored once in a process-wide pool.
+ *
+ * Two InternedString built from equal strings point to the same pooled
+ * gd::String: copying is a pointer copy, and comparing two InternedString is a
+ * pointer comparison. This is used for strings that are repeated a lot in
+ * the metadata of extensions (groups, icons, help paths, namespaces...) and
+ * for the types of instructions, events, objects and behaviors.
+ *
+ * \note Pooled strings are reference counted: a string is removed from the
+ * pool when the last InternedString using it is destroyed, so that strings
+ * coming from projects (like the types of events-based objects or behaviors)
+ * don't stay in memory. The pool is not thread-safe.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API InternedString {
+ public:
+  InternedString() : value(&GetEmptyString()) { Acquire(value); }
+  explicit InternedString(const gd::String& str) : value(&Intern(str)) {}
+  explicit InternedString(const char* str) : value(&Intern(str)) {}
+  InternedString(const InternedString& other) : value(other.value) {
+    Acquire(value);
+  }
+  ~InternedString() { Release(value); }
+
+  InternedString& operator=(const InternedString& other) {
+    Acquire(other.value);
+    Release(value);
+    value = other.value;
+    return *this;
+  }
+
+  InternedString& operator=(const gd::String& str) {
+    PooledString* newValue = &Intern(str);
+    Release(value);
+    value = newValue;
+    return *this;
+  }
+
+  InternedString& operator=(const char* str) {
+    return *this = gd::String(str);
+  }
+
+  /**
+   * \brief Return the pooled string.
+   */
+  const gd::String& Get() const { return value->first; }
+
+  operator const gd::String&() const { return value->first; }
+
+  bool empty() const { return value->first.empty(); }
+
+  bool operator==(const InternedString& other) const {
+    return value == other.value;
+  }
+  bool operator!=(const InternedString& other) const {
+    return value != other.value;
+  }
+
+  /**
+   * \brief Return an identifier unique to the string content, usable
+   * for hashing (as long as the string is used).
+   */
+  std::size_t GetId() const { return reinterpret_cast<std::size_t>(value); }
+
+  /**
+   * \brief Return the number of distinct strings stored in the pool.
+   */
+  static std::size_t GetPoolSize();
+
+ private:
+  /**
+   * A string of the pool, with the number of InternedString using it.
+   */
+  typedef std::pair<const gd::String, std::size_t> PooledString;
+
+  /**
+   * Return the pooled string equal to \a str, with a new reference to it.
+   */
+  static PooledString& Intern(const gd::String& str);
+  static PooledString& GetEmptyString();
+  static void Acquire(PooledString* pooledString) { ++pooledString->second; }
+  static void Release(PooledString* pooledString);
+
+  PooledString* value;  ///< Never null, owned by the pool.
+};
+
+}  // namespace gd
+
+namespace std {
+template <>
+struct hash<gd::InternedString> {
+  size_t operator()(const gd::InternedString& str) const {
+    return hash<size_t>()(str.GetId());
+  }
+};
+}  // namespace std
@@ -0,0 +1,87 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the counting of allocations (only done when built with
+ * the GD_ALLOCATION_COUNTING option).
+ */
+#include "GDCore/Tools/AllocationCounters.h"
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+// Allocations stored here can't be removed by the compiler optimizations.
+void* volatile allocationsSink = nullptr;
+}  // namespace
+
+TEST_CASE("AllocationCounters", "[common]") {
+  SECTION("Phases") {
+    gd::AllocationCounters::Reset();
+    REQUIRE(gd::AllocationCounters::GetPhaseNames().empty());
+
+    std::unique_ptr<std::vector<int>> kept;
+    {
+      gd::AllocationCountingPhase phase("Outer");
+      std::unique_ptr<char[]> freed(new char[1000]);
+      allocationsSink = freed.get();
+      freed.reset();
+      {
+        gd::AllocationCountingPhase phase("Inner");
+        kept.reset(new std::vector<int>(100));
+        allocationsSink = kept->data();
+      }
+    }
+    {
+      gd::AllocationCountingPhase phase("Inner");
+      std::unique_ptr<char[]> freed(new char[10]);
+      allocationsSink = freed.get();
+    }
+
+    REQUIRE(gd::AllocationCounters::HasPhase("Outer"));
+    REQUIRE(gd::AllocationCounters::HasPhase("Inner"));
+    REQUIRE_FALSE(gd::AllocationCounters::HasPhase("Unknown"));
+    auto phaseNames = gd::AllocationCounters::GetPhaseNames();
+    REQUIRE(phaseNames.size() == 2);
+    REQUIRE(phaseNames[0] == "Outer");
+    REQUIRE(phaseNames[1] == "Inner");
+
+    auto outerCounts = gd::AllocationCounters::GetPhaseCounts("Outer");
+    auto innerCounts = gd::AllocationCounters::GetPhaseCounts("Inner");
+    auto totalCounts = gd::AllocationCounters::GetCounts();
+    auto unknownCounts = gd::AllocationCounters::GetPhaseCounts("Unknown");
+    REQUIRE(unknownCounts.GetAllocationsCount() == 0);
+
+    if (!gd::AllocationCounters::IsEnabled()) {
+      REQUIRE(outerCounts.GetAllocationsCount() == 0);
+      REQUIRE(totalCounts.GetAllocatedBytes() == 0);
+      return;
+    }
+
+    // The vector and its buffer, then the array.
+    REQUIRE(innerCounts.GetAllocationsCount() == 3);
+    REQUIRE(innerCounts.GetAllocatedBytes() ==
+            sizeof(std::vector<int>) + 100 * sizeof(int) + 10);
+    REQUIRE(innerCounts.GetPeakBytes() ==
+            sizeof(std::vector<int>) + 100 * sizeof(int));
+
+    // The array freed before the inner phase, then the inner phase.
+    REQUIRE(outerCounts.GetAllocationsCount() == 3);
+    REQUIRE(outerCounts.GetAllocatedBytes() ==
+            1000 + sizeof(std::vector<int>) + 100 * sizeof(int));
+    REQUIRE(outerCounts.GetPeakBytes() == 1000);
+
+    REQUIRE(totalCounts.GetAllocationsCount() >= 4);
+    REQUIRE(totalCounts.GetPeakBytes() >= 1000);
+
+    gd::AllocationCounters::Reset();
+    auto countsAfterReset = gd::AllocationCounters::GetCounts();
+    REQUIRE_FALSE(gd::AllocationCounters::HasPhase("Outer"));
+    REQUIRE(countsAfterReset.GetAllocationsCount() == 0);
+  }
+}
@@ -408,7 +408,24 @@ void SetupProjectWithDummyPlatform(gd::Project& project,
                       "",
                       "")
       .AddParameter("number", "")
-      .SetFunctionName("toString");
+      .SetFunctionName("toString")
+      .SetSideEffectFree();
+
+  extension->AddExpression("abs", "", "", "", "")
+      .AddParameter("expression", "")
+      .SetFunctionName("Math.abs")
+      .SetSideEffectFree();
+
+  extension->AddExpression("min", "", "", "", "")
+      .AddParameter("expression", "")
+      .AddParameter("expression", "")
+      .SetFunctionName("Math.min")
+      .SetSideEffectFree();
+
+  extension->AddExpression("cos", "", "", "", "")
+      .AddParameter("expression", "")
+      .SetFunctionName("Math.cos")
+      .SetSideEffectFree();
 
   platform.AddExtension(extension);
 }
@@ -14,6 +14,7 @@
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
@@ -22,6 +23,35 @@
 #include "catch.hpp"
 
 TEST_CASE("Events", "[common][events]") {
+  SECTION("Expression") {
+    gd::Expression expression("MyVariable + 2");
+    gd::Expression copyBeforeParsing = expression;
+
+    // Copies made after the expression is parsed share its nodes.
+    gd::ExpressionNode *node = expression.GetSharedRootNode();
+    REQUIRE(node != nullptr);
+    gd::Expression copy = expression;
+    gd::Expression otherCopy;
+    otherCopy = copy;
+    REQUIRE(copy.GetSharedRootNode() == node);
+    REQUIRE(otherCopy.GetSharedRootNode() == node);
+    REQUIRE(gd::Expression(expression).GetSharedRootNode() == node);
+
+    // Copies made before are parsed on their own.
+    REQUIRE(copyBeforeParsing.GetSharedRootNode() != nullptr);
+    REQUIRE(copyBeforeParsing.GetSharedRootNode() != node);
+    REQUIRE(expression.GetSharedRootNode() == node);
+
+    // Nodes that can be modified are only owned by one expression.
+    REQUIRE(expression.GetRootNode() != nullptr);
+    REQUIRE(expression.GetRootNode() != node);
+    REQUIRE(expression.GetRootNode() != copy.GetRootNode());
+
+    otherCopy = gd::Expression("3");
+    REQUIRE(otherCopy.GetSharedRootNode() != node);
+    REQUIRE(expression.GetSharedRootNode() == node);
+  }
+
   SECTION("InstructionsList") {
     gd::InstructionsList list;
     gd::Instruction instr("InstructionType");
@@ -45,6 +75,33 @@ TEST_CASE("Events", "[common][events]") {
     REQUIRE(list[1].GetType() == "ChangedInstructionType");
   }
 
+  SECTION("Instruction parameters") {
+    gd::Instruction instruction("InstructionType");
+    instruction.AddParameter(gd::Expression("MyObject"));
+    instruction.AddParameter(gd::Expression("1 + 2"));
+
+    // Copies share the parameters until they are modified.
+    gd::Instruction copy = instruction;
+    const gd::Instruction &constCopy = copy;
+    REQUIRE(&constCopy.GetParameters() == &instruction.GetParameters());
+
+    copy.SetParameter(1, gd::Expression("3"));
+    REQUIRE(&constCopy.GetParameters() != &instruction.GetParameters());
+    REQUIRE(copy.GetParameter(1).GetPlainString() == "3");
+    REQUIRE(instruction.GetParameter(1).GetPlainString() == "1 + 2");
+
+    gd::Instruction otherCopy = instruction;
+    otherCopy.GetParameter(0).GetRootNode();
+    otherCopy.AddParameter(gd::Expression("Extra"));
+    REQUIRE(otherCopy.GetParametersCount() == 3);
+    REQUIRE(instruction.GetParametersCount() == 2);
+
+    otherCopy = instruction;
+    otherCopy.SetParametersCount(1);
+    REQUIRE(otherCopy.GetParametersCount() == 1);
+    REQUIRE(instruction.GetParametersCount() == 2);
+  }
+
   SECTION("StandardEvent") {
     gd::Instruction instr("InstructionType");
     gd::StandardEvent event;
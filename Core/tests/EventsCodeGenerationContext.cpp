@@ -183,6 +183,54 @@ TEST_CASE("EventsCodeGenerationContext", "[common][events]") {
     REQUIRE(c7.IsSameObjectsList("c5.empty1", c5) == false);
   }
 
+  SECTION("Share unmodified objects lists with parent") {
+    /**
+     * Generate a tree of contexts with declared objects as below:
+     *                  ...
+     *                   \
+     *                   c5 -> c5.object1, c1.object2
+     *                  /
+     *                c6 (modifying c5.object1) -> c5.object1, c1.object2,
+     *               /  \                          c6.object3
+     *              /    \
+     *   (reuse c6) c7   c8 -> c1.object2
+     */
+    gd::EventsCodeGenerationContext c6;
+    c6.InheritsFrom(c5);
+    c6.ShareUnmodifiedObjectsListsWithParent({"c5.object1"});
+    c6.ObjectsListNeeded("c5.object1");
+    c6.ObjectsListNeeded("c1.object2");
+    c6.ObjectsListNeeded("c6.object3");
+
+    gd::EventsCodeGenerationContext c7;
+    c7.Reuse(c6);
+    c7.ObjectsListNeeded("c1.object2");
+
+    gd::EventsCodeGenerationContext c8;
+    c8.InheritsFrom(c6);
+    c8.ObjectsListNeeded("c1.object2");
+
+    // Only lists already declared and not modified are shared:
+    REQUIRE(c6.IsObjectsListSharedWithParent("c1.object2") == true);
+    REQUIRE(c6.IsObjectsListSharedWithParent("c5.object1") == false);
+    REQUIRE(c6.IsObjectsListSharedWithParent("c6.object3") == false);
+    REQUIRE(c6.GetObjectsListsToBeDeclared() ==
+            std::set<gd::String>({"c5.object1", "c1.object2", "c6.object3"}));
+
+    REQUIRE(c6.IsSameObjectsList("c1.object2", c5) == true);
+    REQUIRE(c6.IsSameObjectsList("c5.object1", c5) == false);
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c6.object3") == 3);
+
+    // A context reusing c6 uses the same lists:
+    REQUIRE(c7.IsObjectsListSharedWithParent("c1.object2") == true);
+    REQUIRE(c7.IsSameObjectsList("c1.object2", c6) == true);
+    REQUIRE(c7.IsSameObjectsList("c1.object2", c5) == true);
+
+    // Children of c6 still have their own lists:
+    REQUIRE(c8.IsObjectsListSharedWithParent("c1.object2") == false);
+    REQUIRE(c8.IsSameObjectsList("c1.object2", c6) == false);
+  }
+
   SECTION("Async") {
     gd::EventsCodeGenerationContext c1;
     c1.ObjectsListNeeded("c1.object1");
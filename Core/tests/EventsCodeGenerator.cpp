@@ -8,13 +8,91 @@
  */
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include <memory>
+#include "DummyPlatform.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/CommentEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
+namespace {
+
+void DeclareConditionsCostExtension(gd::Platform& platform) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "MyCostExtension", "My testing extension for conditions cost", "", "", "");
+  extension->AddCondition("Cheap", "Cheap condition", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .AddParameter("expression", "Value")
+      .SetEvaluationCost(gd::InstructionMetadata::Cheap)
+      .MarkAsPure();
+  extension
+      ->AddCondition("Expensive", "Expensive condition", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .SetEvaluationCost(gd::InstructionMetadata::Expensive)
+      .MarkAsPure();
+  extension
+      ->AddCondition("ExpensivePair", "Expensive condition", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .AddParameter("object", "Object")
+      .SetEvaluationCost(gd::InstructionMetadata::Expensive)
+      .MarkAsPure();
+  extension->AddCondition("Impure", "Impure condition", "", "", "", "", "")
+      .SetEvaluationCost(gd::InstructionMetadata::Expensive);
+  platform.AddExtension(extension);
+}
+
+void DeclarePerInstanceExtension(gd::Platform& platform) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "MyPerInstanceExtension", "My testing extension for loops", "", "", "");
+  auto& object = extension->AddObject<gd::ObjectConfiguration>(
+      "Box", "Box", "Box object", "");
+  object.AddAction("SetValue", "Set value", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .AddParameter("expression", "Value")
+      .MarkAsPure();
+  object.AddAction("SetValueFrom", "Set value from", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .AddParameter("object", "Other object")
+      .MarkAsPure();
+  object.AddAction("Impure", "Impure action", "", "", "", "", "")
+      .AddParameter("object", "Object");
+  object.AddCondition("HasValue", "Has value", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .AddParameter("expression", "Value")
+      .MarkAsPure();
+  object.AddExpression("Value", "Value", "", "", "")
+      .AddParameter("object", "Object");
+  extension->AddExpression("Count", "Count", "", "", "")
+      .AddParameter("objectList", "Object");
+  platform.AddExtension(extension);
+}
+
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+  return instruction;
+}
+
+}  // namespace
+
 TEST_CASE("EventsCodeGenerator", "[common][events]") {
   SECTION("Basics") {
     gd::Project project;
@@ -31,4 +109,291 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
     REQUIRE(codeGenerator.ConvertToString("{\"hello\":\r\n\"world \\\" \"}") ==
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
+
+  SECTION("Profiled events identifiers") {
+    gd::Project project;
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    gd::Platform platform;
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+
+    gd::EventsList events;
+    gd::StandardEvent event;
+    gd::StandardEvent subEvent;
+    gd::StandardEvent disabledSubEvent;
+    disabledSubEvent.SetDisabled(true);
+    event.GetSubEvents().InsertEvent(disabledSubEvent);
+    event.GetSubEvents().InsertEvent(subEvent);
+    events.InsertEvent(gd::CommentEvent());
+    events.InsertEvent(event);
+    events.InsertEvent(event);
+    events.InsertEvent(event).ResetPersistentUuid();
+
+    codeGenerator.IdentifyProfiledEvents(events);
+    const auto& eventsIds = codeGenerator.GetProfiledEventsIds();
+    // The second copy of the event has the same UUIDs as the first one, so it's
+    // counted in its parent. The duplicated event and its sub-event have new
+    // UUIDs.
+    REQUIRE(eventsIds.size() == 4);
+    REQUIRE(eventsIds[0] == event.GetPersistentUuid());
+    REQUIRE(eventsIds[1] == subEvent.GetPersistentUuid());
+    REQUIRE(eventsIds[2] == events.GetEvent(3).GetPersistentUuid());
+    REQUIRE(eventsIds[3] ==
+            events.GetEvent(3).GetSubEvents().GetEvent(1).GetPersistentUuid());
+    REQUIRE(eventsIds[2] != eventsIds[0]);
+    REQUIRE(eventsIds[3] != eventsIds[1]);
+  }
+
+  SECTION("Profiled events identifiers are stable") {
+    gd::Project project;
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    gd::Platform platform;
+
+    gd::EventsList events;
+    events.InsertEvent(gd::StandardEvent());
+    events.InsertEvent(gd::StandardEvent());
+    gd::String firstEventId;
+    gd::String secondEventId;
+    {
+      gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+      codeGenerator.IdentifyProfiledEvents(events);
+      firstEventId = codeGenerator.GetProfiledEventsIds()[0];
+      secondEventId = codeGenerator.GetProfiledEventsIds()[1];
+    }
+
+    // Inserting an event before doesn't change the identifiers of the others,
+    // and copies keep their identifiers.
+    events.InsertEvent(gd::StandardEvent(), 0);
+    gd::EventsList copiedEvents = events;
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    codeGenerator.IdentifyProfiledEvents(events);
+    REQUIRE(codeGenerator.GetProfiledEventsIds().size() == 3);
+    REQUIRE(codeGenerator.GetProfiledEventsIds()[1] == firstEventId);
+    REQUIRE(codeGenerator.GetProfiledEventsIds()[2] == secondEventId);
+    REQUIRE(copiedEvents.GetEvent(1).GetPersistentUuid() == firstEventId);
+
+    // Duplicated events are given new identifiers.
+    copiedEvents.ResetPersistentUuid();
+    REQUIRE(copiedEvents.GetEvent(1).GetPersistentUuid() != firstEventId);
+    REQUIRE(copiedEvents.GetEvent(2).GetPersistentUuid() != secondEventId);
+  }
+
+  SECTION("Profiled events identifiers are saved") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::EventsList events;
+    events.InsertEvent(gd::StandardEvent());
+    const gd::String eventId = events.GetEvent(0).GetPersistentUuid();
+    REQUIRE(!eventId.empty());
+
+    gd::SerializerElement element;
+    events.SerializeTo(element);
+    gd::EventsList unserializedEvents;
+    unserializedEvents.UnserializeFrom(project, element);
+    REQUIRE(unserializedEvents.GetEvent(0).GetPersistentUuid() == eventId);
+
+    // Events saved without an identifier are given one when loaded.
+    element.GetChild(0).RemoveAttribute("persistentUuid");
+    gd::EventsList oldEvents;
+    oldEvents.UnserializeFrom(project, element);
+    REQUIRE(!oldEvents.GetEvent(0).GetPersistentUuid().empty());
+    REQUIRE(oldEvents.GetEvent(0).GetPersistentUuid() != eventId);
+  }
+
+  SECTION("Conditions evaluation order") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    DeclareConditionsCostExtension(platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MySprite", 0);
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyOtherSprite", 1);
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyThirdSprite", 2);
+    auto& group =
+        layout.GetObjects().GetObjectGroups().InsertNew("MySpriteGroup");
+    group.AddObject("MySprite");
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    gd::DiagnosticReport diagnosticReport;
+    codeGenerator.SetDiagnosticReport(&diagnosticReport);
+
+    gd::InstructionsList conditions;
+    conditions.Insert(
+        MakeInstruction("MyCostExtension::Expensive", {"MySprite"}));
+    conditions.Insert(
+        MakeInstruction("MyCostExtension::Cheap", {"MyOtherSprite", "1"}));
+    conditions.Insert(MakeInstruction("MyCostExtension::Impure", {}));
+    conditions.Insert(
+        MakeInstruction("MyCostExtension::Expensive", {"MySprite"}));
+    conditions.Insert(MakeInstruction("MyCostExtension::Cheap",
+                                      {"MySprite", "MyOtherSprite.X()"}));
+    conditions.Insert(MakeInstruction("MyCostExtension::ExpensivePair",
+                                      {"MySprite", "MyOtherSprite"}));
+    conditions.Insert(
+        MakeInstruction("MyCostExtension::Cheap", {"MySprite", "2"}));
+
+    // Only the first two conditions can be evaluated in another order: the
+    // other ones have side effects, depend on the picking of other objects or
+    // pick an object of a condition picking several objects.
+    REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+            std::vector<std::size_t>({1, 0, 2, 3, 4, 5, 6}));
+    REQUIRE(diagnosticReport.GetReorderedConditionsCount() == 1);
+    REQUIRE(diagnosticReport.GetReorderedConditions(0) ==
+            "MyCostExtension::Cheap, MyCostExtension::Expensive, "
+            "MyCostExtension::Impure, MyCostExtension::Expensive, "
+            "MyCostExtension::Cheap, MyCostExtension::ExpensivePair, "
+            "MyCostExtension::Cheap");
+
+    gd::InstructionsList sortedConditions;
+    sortedConditions.Insert(
+        MakeInstruction("MyCostExtension::Cheap", {"MySprite", "1"}));
+    sortedConditions.Insert(
+        MakeInstruction("MyCostExtension::Expensive", {"MyOtherSprite"}));
+    REQUIRE(codeGenerator.GetConditionsEvaluationOrder(sortedConditions) ==
+            std::vector<std::size_t>({0, 1}));
+    REQUIRE(diagnosticReport.GetReorderedConditionsCount() == 1);
+
+    // Conditions picking several objects are only kept after the conditions
+    // using one of their objects, including through a group.
+    gd::InstructionsList pairConditions;
+    pairConditions.Insert(MakeInstruction("MyCostExtension::ExpensivePair",
+                                          {"MySprite", "MyOtherSprite"}));
+    pairConditions.Insert(
+        MakeInstruction("MyCostExtension::Cheap", {"MyThirdSprite", "1"}));
+    pairConditions.Insert(
+        MakeInstruction("MyCostExtension::Cheap", {"MySpriteGroup", "1"}));
+    pairConditions.Insert(
+        MakeInstruction("MyCostExtension::Expensive", {"MyThirdSprite"}));
+    REQUIRE(codeGenerator.GetConditionsEvaluationOrder(pairConditions) ==
+            std::vector<std::size_t>({1, 0, 2, 3}));
+  }
+
+  SECTION("Conditions evaluation order (builtin conditions)") {
+    gd::Project project;
+    gd::Platform platform;
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+    gd::BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
+        *(extension.get()));
+    platform.AddExtension(extension);
+    std::shared_ptr<gd::PlatformExtension> variablesExtension =
+        std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+    gd::BuiltinExtensionsImplementer::ImplementsVariablesExtension(
+        *(variablesExtension.get()));
+    platform.AddExtension(variablesExtension);
+    project.AddPlatform(platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    layout.GetVariables().InsertNew("Score", 0);
+    layout.GetObjects().InsertNewObject(project, "", "Player", 0);
+    layout.GetObjects().InsertNewObject(project, "", "Enemy", 1);
+    layout.GetObjects().InsertNewObject(project, "", "Wall", 2);
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+
+    gd::InstructionsList conditions;
+    conditions.Insert(
+        MakeInstruction("CollisionNP", {"Player", "Wall", "", "", "no"}));
+    conditions.Insert(MakeInstruction("PosX", {"Enemy", ">", "100"}));
+    conditions.Insert(MakeInstruction("NumberVariable", {"Score", ">", "0"}));
+    conditions.Insert(
+        MakeInstruction("CollisionNP", {"Player", "Enemy", "", "", "no"}));
+    conditions.Insert(MakeInstruction("PosX", {"Player", ">", "100"}));
+
+    // The comparisons are evaluated before the collisions, unless they use
+    // an object picked by a collision before them.
+    REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+            std::vector<std::size_t>({1, 2, 0, 3, 4}));
+  }
+
+  SECTION("Instructions run on each instance") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    DeclarePerInstanceExtension(platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    layout.GetObjects().InsertNewObject(
+        project, "MyPerInstanceExtension::Box", "MyBox", 0);
+    layout.GetObjects().InsertNewObject(
+        project, "MyPerInstanceExtension::Box", "MyOtherBox", 1);
+    auto& group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+    group.AddObject("MyBox");
+    group.AddObject("MyOtherBox");
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    gd::EventsCodeGenerationContext context;
+
+    REQUIRE(codeGenerator.GetPerInstanceInstructionObjectName(
+                MakeInstruction("MyPerInstanceExtension::SetValue",
+                                {"MyBox", "MyBox.Value() + MyBox.MyVariable"}),
+                false,
+                context) == "MyBox");
+    REQUIRE(codeGenerator.GetPerInstanceInstructionObjectName(
+                MakeInstruction("MyPerInstanceExtension::HasValue",
+                                {"MyOtherBox", "1"}),
+                true,
+                context) == "MyOtherBox");
+
+    // Other objects, or the whole objects list, can't be used.
+    REQUIRE(codeGenerator.GetPerInstanceInstructionObjectName(
+                MakeInstruction("MyPerInstanceExtension::SetValue",
+                                {"MyBox", "MyOtherBox.Value()"}),
+                false,
+                context) == "");
+    REQUIRE(codeGenerator.GetPerInstanceInstructionObjectName(
+                MakeInstruction("MyPerInstanceExtension::SetValue",
+                                {"MyBox", "Count(MyBox)"}),
+                false,
+                context) == "");
+    REQUIRE(codeGenerator.GetPerInstanceInstructionObjectName(
+                MakeInstruction("MyPerInstanceExtension::SetValueFrom",
+                                {"MyBox", "MyOtherBox"}),
+                false,
+                context) == "");
+
+    // Groups are run in a loop for each of their objects.
+    REQUIRE(codeGenerator.GetPerInstanceInstructionObjectName(
+                MakeInstruction("MyPerInstanceExtension::SetValue",
+                                {"MyGroup", "1"}),
+                false,
+                context) == "");
+
+    REQUIRE(codeGenerator.GetPerInstanceInstructionObjectName(
+                MakeInstruction("MyPerInstanceExtension::Impure", {"MyBox"}),
+                false,
+                context) == "");
+  }
+
+  SECTION("Parameters stay shared during code generation") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    layout.GetVariables().InsertNew("MyVariable", 0);
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MySprite", 0);
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    gd::EventsCodeGenerationContext context;
+
+    gd::Instruction action =
+        MakeInstruction("MyExtension::DoSomething", {"1 + 2"});
+    gd::Instruction actionCopy = action;
+    codeGenerator.GenerateActionCode(actionCopy, context);
+    REQUIRE(&actionCopy.GetParameters() == &action.GetParameters());
+
+    // Missing parameters are not added to the instruction.
+    gd::Instruction objectsAction =
+        MakeInstruction("MyExtension::DoSomethingWithObjects", {"MySprite"});
+    gd::Instruction objectsActionCopy = objectsAction;
+    codeGenerator.GenerateActionCode(objectsActionCopy, context);
+    REQUIRE(&objectsActionCopy.GetParameters() ==
+            &objectsAction.GetParameters());
+    REQUIRE(objectsActionCopy.GetParametersCount() == 1);
+
+    gd::Instruction condition =
+        MakeInstruction("NumberVariable", {"MyVariable"});
+    gd::Instruction conditionCopy = condition;
+    codeGenerator.GenerateConditionCode(conditionCopy, "result", context);
+    REQUIRE(&conditionCopy.GetParameters() == &condition.GetParameters());
+    REQUIRE(conditionCopy.GetParametersCount() == 1);
+  }
 }
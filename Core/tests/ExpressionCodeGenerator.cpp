@@ -9,12 +9,63 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ParameterMetadataContainer.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
+namespace {
+
+/**
+ * \brief A code generator inlining some functions, to check the arguments
+ * given to GenerateInlinedEventsFunctionCall.
+ */
+class InliningEventsCodeGenerator : public gd::EventsCodeGenerator {
+ public:
+  InliningEventsCodeGenerator(gd::Project &project,
+                              gd::Layout &layout,
+                              gd::Platform &platform)
+      : gd::EventsCodeGenerator(project, layout, platform){};
+
+  gd::String GenerateInlinedEventsFunctionCall(
+      const gd::String &functionType,
+      const gd::ParameterMetadataContainer &parameters,
+      const std::vector<gd::String> &argumentsCode,
+      const gd::String &objectName,
+      const gd::String &behaviorName,
+      gd::EventsCodeGenerationContext &context) override {
+    if (functionType != "MyExtension::GetNumberWith2Params" &&
+        functionType != "MyExtension::Sprite::GetObjectNumber" &&
+        functionType != "MyExtension::MyBehavior::GetBehaviorNumberWith1Param")
+      return "";
+    if (argumentsCode.size() != parameters.GetParametersCount())
+      return "/* Arguments don't match the parameters */";
+
+    gd::String code = "inlined";
+    if (!objectName.empty()) code += "[" + objectName + "]";
+    if (!behaviorName.empty()) code += "[" + behaviorName + "]";
+    code += "(";
+    bool isFirstArgument = true;
+    for (std::size_t i = 0; i < argumentsCode.size(); ++i) {
+      // The object and the behavior are given by their names.
+      const auto &parameterType = parameters.GetParameter(i).GetType();
+      if (gd::ParameterMetadata::IsObject(parameterType) ||
+          gd::ParameterMetadata::IsBehavior(parameterType))
+        continue;
+
+      if (!isFirstArgument) code += " | ";
+      code += argumentsCode[i];
+      isFirstArgument = false;
+    }
+    return code + ")";
+  };
+};
+
+}  // namespace
+
 TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
   gd::Project project;
   gd::Platform platform;
@@ -317,6 +368,44 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
               "MySpriteObject.getObjectStringWith1Param(getNumber()) ?? \"\"");
     }
   }
+  SECTION("Inlined function calls") {
+    InliningEventsCodeGenerator inliningCodeGenerator(
+        project, layout1, platform);
+    auto generate = [&](const gd::String &type, const gd::String &expression) {
+      return gd::ExpressionCodeGenerator::GenerateExpressionCode(
+          inliningCodeGenerator, context, type, expression);
+    };
+
+    // Each argument is given separately and in order, so that the inlined
+    // code can evaluate them in the same order as the function call.
+    REQUIRE(generate("number",
+                     "MyExtension::GetNumberWith2Params(MySceneVariable, "
+                     "\"hello world\") + 1") ==
+            "inlined(getAnyVariable(MySceneVariable).getAsNumber() | "
+            "\"hello world\") + 1");
+    REQUIRE(generate("number",
+                     "MyExtension::GetNumberWith2Params("
+                     "MyExtension::GetNumberWith2Params(1, \"a\"), \"b\")") ==
+            "inlined(inlined(1 | \"a\") | \"b\")");
+
+    // Functions that are not inlined are still called.
+    REQUIRE(generate("number",
+                     "MyExtension::GetNumberWith3Params(1, \"\")") ==
+            "getNumberWith3Params(1, \"\", 0)");
+
+    // Functions of objects and behaviors are given the object they are called
+    // on, unless it's a group.
+    mySpriteObject.AddNewBehavior(
+        project, "MyExtension::MyBehavior", "MyBehavior");
+    REQUIRE(generate("number", "MySpriteObject.GetObjectNumber() + 1") ==
+            "inlined[MySpriteObject]() + 1");
+    REQUIRE(generate("number",
+                     "MySpriteObject.MyBehavior::GetBehaviorNumberWith1Param("
+                     "MyExtension::GetNumberWith2Params(2, \"c\"))") ==
+            "inlined[MySpriteObject][MyBehavior](inlined(2 | \"c\"))");
+    REQUIRE(generate("number", "AllObjects.GetObjectNumber()") !=
+            "inlined[AllObjects]()");
+  }
   SECTION("Valid function calls with optional arguments") {
     SECTION("with optional parameter set") {
       auto node = parser.ParseExpression("MyExtension::MouseX(\"layer1\",2+2)");
@@ -1180,7 +1269,7 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
                   codeGenerator, context, "variable", "MySceneVariable[ \"hello\" + "
             "\"world\" ]", "")
-              == "getAnyVariable(MySceneVariable).getChild(\"hello\" + \"world\")");
+              == "getAnyVariable(MySceneVariable).getChild(\"helloworld\")");
     }
     SECTION("bracket access (using a string object variable inside)") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
@@ -1692,4 +1781,92 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
             "toString(+(-(getNumberWith3Params(12, \"hello world\", "
             "0))))).getChild(\"grandChild\")");
   }
+  SECTION("Constant folding") {
+    auto generate = [&](const gd::String &type, const gd::String &expression) {
+      return gd::ExpressionCodeGenerator::GenerateExpressionCode(
+          codeGenerator, context, type, expression);
+    };
+
+    // Operations between numbers and concatenations of texts are evaluated.
+    REQUIRE(generate("number", "1 + 2 * 3") == "7");
+    REQUIRE(generate("number", "(1 + 2) * 3") == "9");
+    REQUIRE(generate("number", "2 - 5") == "(-3)");
+    REQUIRE(generate("number", "-(2 + 3)") == "(-5)");
+    REQUIRE(generate("number", "1 / 4") == "0.25");
+    REQUIRE(generate("number", "0.1 + 0.2") == "0.30000000000000004");
+    REQUIRE(generate("string", "\"Hello \" + \"world\"") ==
+            "\"Hello world\"");
+
+    // Only the constant parts of the expressions are evaluated.
+    REQUIRE(generate("number", "MySceneVariable + 2 * 3") ==
+            "getAnyVariable(MySceneVariable).getAsNumber() + 6");
+    REQUIRE(generate("number", "MySceneVariable * (2 - 3)") ==
+            "getAnyVariable(MySceneVariable).getAsNumber() * (-1)");
+    REQUIRE(generate("number", "(1 + 2) + MySceneVariable") ==
+            "3 + getAnyVariable(MySceneVariable).getAsNumber()");
+
+    // Chains of additions and subtractions are evaluated from left to right,
+    // so they are only folded when all their terms are constants.
+    REQUIRE(generate("number", "10 - 2 - 3 + 1") == "6");
+    REQUIRE(generate("number", "MySceneVariable - 1 - 2") ==
+            "getAnyVariable(MySceneVariable).getAsNumber() - 1 - 2");
+    REQUIRE(generate("number", "1 - 2 * 3 - MySceneVariable") ==
+            "1 - 6 - getAnyVariable(MySceneVariable).getAsNumber()");
+    REQUIRE(generate("number",
+                     "MySceneNumberArrayVariable[1 + 1] + "
+                     "MyExtension::GetNumberWith3Params(2 * 2, \"a\" + \"b\")") ==
+            "getAnyVariable(MySceneNumberArrayVariable).getChild(2)"
+            ".getAsNumber() + getNumberWith3Params(4, \"ab\", 0)");
+
+    // Side-effect free functions are evaluated when their parameters are
+    // constants.
+    REQUIRE(generate("number", "abs(-3) + min(4, 2 * 3)") == "7");
+    REQUIRE(generate("number", "abs(MySceneVariable)") ==
+            "Math.abs(getAnyVariable(MySceneVariable).getAsNumber())");
+    REQUIRE(generate("string", "ToString(1 / 8)") == "\"0.125\"");
+    REQUIRE(generate("string", "ToString(1000000 * 1000000 * 1000000 * 1000)") ==
+            "\"1e+21\"");
+
+    // Other functions are never evaluated.
+    REQUIRE(generate("number", "MyExtension::GetNumberWith3Params(1, \"\")") ==
+            "getNumberWith3Params(1, \"\", 0)");
+
+    // Results that are not literals are not folded.
+    REQUIRE(generate("number", "1 / 0") == "1 / 0");
+    REQUIRE(generate("number", "0 * -1") == "0 * -1");
+  }
+  SECTION("Loop invariants") {
+    gd::EventsCodeGenerationContext loopContext;
+    loopContext.InheritsFrom(context);
+    loopContext.HoistLoopInvariants();
+    auto generate = [&](const gd::String &type, const gd::String &expression) {
+      return gd::ExpressionCodeGenerator::GenerateExpressionCode(
+          codeGenerator, loopContext, type, expression);
+    };
+
+    // Calls to side-effect free functions with invariant parameters are
+    // computed before the loop, once.
+    REQUIRE(generate("number", "MySceneVariable * cos(2)") ==
+            "getAnyVariable(MySceneVariable).getAsNumber() * loopInvariant1_0");
+    REQUIRE(generate("number", "cos(2) + cos(cos(3) + 1)") ==
+            "loopInvariant1_0 + loopInvariant1_2");
+    REQUIRE(loopContext.GetLoopInvariants().size() == 3);
+    REQUIRE(loopContext.GetLoopInvariants()[0].first == "loopInvariant1_0");
+    REQUIRE(loopContext.GetLoopInvariants()[0].second == "Math.cos(2)");
+    REQUIRE(loopContext.GetLoopInvariants()[1].second == "Math.cos(3)");
+    REQUIRE(loopContext.GetLoopInvariants()[2].second ==
+            "Math.cos(loopInvariant1_1 + 1)");
+
+    // Constants are still folded, and other calls are computed in the loop.
+    REQUIRE(generate("number", "cos(0) + abs(-2)") == "3");
+    REQUIRE(generate("number", "cos(MySceneVariable)") ==
+            "Math.cos(getAnyVariable(MySceneVariable).getAsNumber())");
+    REQUIRE(generate("number", "MyExtension::GetNumberWith3Params(1, \"\")") ==
+            "getNumberWith3Params(1, \"\", 0)");
+    REQUIRE(loopContext.GetLoopInvariants().size() == 3);
+
+    // Nothing is hoisted outside of loops.
+    REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                codeGenerator, context, "number", "cos(2)") == "Math.cos(2)");
+  }
 }
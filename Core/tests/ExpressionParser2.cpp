@@ -6,6 +6,7 @@
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 
 #include "DummyPlatform.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
@@ -5191,4 +5192,70 @@ TEST_CASE("ExpressionParser2", "[common][events]") {
       }
     }
   }
+
+  SECTION("Results stored in nodes") {
+    auto node = parser.ParseExpression("MyNewVariable + MyExtension::GetNumberWith2Params(1, \"2\")");
+    REQUIRE(node != nullptr);
+    auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*node);
+    auto &functionNode =
+        dynamic_cast<gd::FunctionCallNode &>(*operatorNode.rightHandSide);
+
+    REQUIRE(gd::ExpressionTypeFinder::GetType(
+                platform, projectScopedContainers, "number",
+                *functionNode.parameters[1]) == "string");
+    REQUIRE(&gd::MetadataProvider::GetFunctionCallMetadata(
+                platform, projectScopedContainers, functionNode) ==
+            &gd::MetadataProvider::GetFunctionCallMetadata(
+                platform, objectsContainersList, functionNode));
+    REQUIRE(gd::ExpressionValidator::HasNoErrors(
+                platform, projectScopedContainers, "number", *node) == false);
+
+    // Results are reused until the scope is changed, including when a
+    // variable is added to one of its containers.
+    std::size_t version = projectScopedContainers.GetVersion();
+    REQUIRE(projectScopedContainers.GetVersion() == version);
+    layout1.GetVariables().InsertNew("MyNewVariable").SetValue(1);
+    REQUIRE(projectScopedContainers.GetVersion() != version);
+    REQUIRE(gd::ExpressionValidator::HasNoErrors(
+                platform, projectScopedContainers, "number", *node) == true);
+    REQUIRE(gd::ExpressionTypeFinder::GetType(
+                platform, projectScopedContainers, "number",
+                *functionNode.parameters[1]) == "string");
+
+    // Objects and groups are also tracked.
+    version = projectScopedContainers.GetVersion();
+    layout1.GetObjects().GetObjectGroups().InsertNew("MyNewGroup");
+    REQUIRE(projectScopedContainers.GetVersion() != version);
+    version = projectScopedContainers.GetVersion();
+    layout1.GetObjects().RemoveObject("MyNewObjectNotExisting");
+    REQUIRE(projectScopedContainers.GetVersion() == version);
+
+    // Other changes must be notified.
+    version = projectScopedContainers.GetVersion();
+    projectScopedContainers.MarkAsChanged();
+    REQUIRE(projectScopedContainers.GetVersion() != version);
+
+    // Pushing local variables changes the scope.
+    version = projectScopedContainers.GetVersion();
+    gd::VariablesContainer localVariables;
+    projectScopedContainers.PushVariablesContainer(localVariables);
+    REQUIRE(projectScopedContainers.GetVersion() != version);
+    projectScopedContainers.PopVariablesContainer();
+
+    // Behaviors are tracked even when added through an object reference.
+    version = projectScopedContainers.GetVersion();
+    mySpriteObject.AddNewBehavior(project, "MyExtension::MyBehavior",
+                                  "MyNewBehavior");
+    REQUIRE(projectScopedContainers.GetVersion() != version);
+
+    // Results depending on the extensions are cleared when the platform
+    // changes.
+    REQUIRE(gd::ExpressionValidator::HasNoErrors(
+                platform, projectScopedContainers, "number", *node) == true);
+    std::size_t generation = platform.GetGeneration();
+    platform.RemoveExtension("MyExtension");
+    REQUIRE(platform.GetGeneration() != generation);
+    REQUIRE(gd::ExpressionValidator::HasNoErrors(
+                platform, projectScopedContainers, "number", *node) == false);
+  }
 }
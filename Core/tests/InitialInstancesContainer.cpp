@@ -225,4 +225,97 @@ TEST_CASE("InitialInstancesContainer", "[common][instances]") {
     REQUIRE(container.SomeInstancesAreOnLayer("layer3") == false);
     REQUIRE(container.SomeInstancesAreOnLayer("layer5") == false);
   }
+
+  SECTION("GetInstancesFields") {
+    std::vector<double> fields(
+        7 * gd::InitialInstancesContainer::fieldsPerInstance, -1);
+    std::vector<int32_t> indices(
+        7 * gd::InitialInstancesContainer::indicesPerInstance, -2);
+    std::vector<gd::String> layerNames = {"layer2", "layer1"};
+    std::vector<gd::String> objectNames = {"object1", "object2"};
+
+    REQUIRE(container.GetInstancesFields(fields.data(),
+                                         indices.data(),
+                                         7,
+                                         layerNames,
+                                         objectNames) == 7);
+    REQUIRE(fields[0] == 0);
+    REQUIRE(fields[6] == 10);
+    REQUIRE(fields[2 * 7 + 6] == 14);
+    REQUIRE(indices[0] == 1);
+    REQUIRE(indices[1] == 0);
+    REQUIRE(indices[2] == 0);
+    REQUIRE(indices[6 * 2] == 0);
+    REQUIRE(indices[6 * 2 + 1] == -1);
+
+    // Only the instances fitting in the buffers are written.
+    std::fill(fields.begin(), fields.end(), -1);
+    REQUIRE(container.GetInstancesFields(fields.data(),
+                                         indices.data(),
+                                         2,
+                                         layerNames,
+                                         objectNames) == 2);
+    REQUIRE(fields[2 * 7] == -1);
+
+    REQUIRE(container.GetLayerInstancesFields("layer2",
+                                              fields.data(),
+                                              indices.data(),
+                                              7,
+                                              layerNames,
+                                              objectNames) == 3);
+    REQUIRE(fields[6] == 10);
+    REQUIRE(fields[7 + 6] == 11);
+    REQUIRE(fields[2 * 7 + 6] == 9);
+    REQUIRE(indices[2 * 2 + 1] == -1);
+  }
+
+  SECTION("SetInstancesFields") {
+    auto &instance = container.InsertNewInitialInstance();
+    instance.SetLayer("layer3");
+    instance.SetDefaultWidth(32);
+    instance.SetDefaultHeight(16);
+    auto &resizedInstance = container.InsertNewInitialInstance();
+    resizedInstance.SetLayer("layer3");
+    resizedInstance.SetDefaultWidth(32);
+    resizedInstance.SetDefaultHeight(16);
+
+    std::vector<double> fields(
+        2 * gd::InitialInstancesContainer::fieldsPerInstance);
+    std::vector<int32_t> indices(
+        2 * gd::InitialInstancesContainer::indicesPerInstance);
+    REQUIRE(container.GetLayerInstancesFields(
+                "layer3", fields.data(), indices.data(), 2, {}, {}) == 2);
+    REQUIRE(fields[4] == 32);
+    REQUIRE(fields[5] == 16);
+
+    fields[0] = 100;
+    fields[1] = 200;
+    fields[3] = 45;
+    fields[6] = 3;
+    fields[7 + 4] = 64;
+    REQUIRE(container.SetLayerInstancesFields("layer3", fields.data(), 2) ==
+            2);
+
+    REQUIRE(instance.GetX() == 100);
+    REQUIRE(instance.GetY() == 200);
+    REQUIRE(instance.GetAngle() == 45);
+    REQUIRE(instance.GetZOrder() == 3);
+    REQUIRE(instance.HasCustomSize() == false);
+    REQUIRE(resizedInstance.HasCustomSize() == true);
+    REQUIRE(resizedInstance.GetCustomWidth() == 64);
+    REQUIRE(resizedInstance.GetCustomHeight() == 16);
+
+    // Other layers are not changed.
+    AllInstancesFunctor func;
+    container.IterateOverInstances(func);
+    REQUIRE(func.Compare({MakeInstance("object1", "layer1", 10),
+                          MakeInstance("object1", "layer2", 10),
+                          MakeInstance("object1", "layer1", 14),
+                          MakeInstance("object2", "layer1", 12),
+                          MakeInstance("object2", "layer1", 10),
+                          MakeInstance("object3", "layer2", 11),
+                          MakeInstance("object3", "layer2", 9),
+                          MakeInstance("", "layer3", 3),
+                          MakeInstance("", "layer3", 0)}) == true);
+  }
 }
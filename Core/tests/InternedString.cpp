@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the interned strings used by metadata.
+ */
+#include "GDCore/Tools/InternedString.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("InternedString", "[common]") {
+  SECTION("Equal strings share the same storage") {
+    gd::InternedString a("res/conditions/var24.png");
+    gd::InternedString b(gd::String("res/conditions/") + "var24.png");
+    gd::InternedString c("res/conditions/var.png");
+
+    REQUIRE(a == b);
+    REQUIRE(&a.Get() == &b.Get());
+    REQUIRE(a != c);
+    REQUIRE(a.Get() == "res/conditions/var24.png");
+    REQUIRE(static_cast<const gd::String&>(c) == "res/conditions/var.png");
+  }
+
+  SECTION("Empty and assigned strings") {
+    gd::InternedString empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty == gd::InternedString(""));
+
+    gd::InternedString group;
+    group = "Variables";
+    REQUIRE(group == gd::InternedString("Variables"));
+    REQUIRE(group.Get() == "Variables");
+  }
+
+  SECTION("Strings are removed from the pool when not used anymore") {
+    const std::size_t poolSize = gd::InternedString::GetPoolSize();
+    {
+      gd::InternedString type("MyProjectExtension::MyCustomObject");
+      gd::InternedString copiedType(type);
+      REQUIRE(gd::InternedString::GetPoolSize() == poolSize + 1);
+
+      type = "MyProjectExtension::MyOtherCustomObject";
+      REQUIRE(gd::InternedString::GetPoolSize() == poolSize + 2);
+
+      copiedType = type;
+      REQUIRE(gd::InternedString::GetPoolSize() == poolSize + 1);
+      REQUIRE(copiedType.Get() == "MyProjectExtension::MyOtherCustomObject");
+    }
+    REQUIRE(gd::InternedString::GetPoolSize() == poolSize);
+
+    {
+      gd::Instruction instruction("MyProjectExtension::MyCustomAction");
+      REQUIRE(gd::InternedString::GetPoolSize() == poolSize + 1);
+    }
+    REQUIRE(gd::InternedString::GetPoolSize() == poolSize);
+  }
+
+  SECTION("Instruction metadata strings are interned") {
+    gd::InstructionMetadata first("MyExtension::", "First", "First", "",
+                                  "Do first", "My group", "icon.png",
+                                  "small_icon.png");
+    gd::InstructionMetadata second("MyExtension::", "Second", "Second", "",
+                                   "Do second", "My group", "icon.png",
+                                   "small_icon.png");
+
+    REQUIRE(&first.GetGroup() == &second.GetGroup());
+    REQUIRE(&first.GetIconFilename() == &second.GetIconFilename());
+    REQUIRE(&first.GetSmallIconFilename() == &second.GetSmallIconFilename());
+    REQUIRE(first.GetGroup() == "My group");
+    REQUIRE(first.IsRelevantForLayoutEvents());
+  }
+
+  SECTION("Metadata lookups in objects and behaviors") {
+    gd::Project project;
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, "MyExtension::SetAnimationName")));
+    REQUIRE(!gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, "MyExtension::BehaviorDoSomething")));
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "MyExtension::Unknown")));
+  }
+
+  SECTION("Instruction and event types are interned") {
+    gd::Instruction first("MyExtension::DoSomething");
+    gd::Instruction second;
+    second.SetType(gd::String("MyExtension::DoSomething"));
+    REQUIRE(first.GetInternedType() == second.GetInternedType());
+    REQUIRE(&first.GetType() == &second.GetType());
+    REQUIRE(second.GetType() == "MyExtension::DoSomething");
+
+    second.SetType(gd::InternedString("MyExtension::DoSomethingElse"));
+    REQUIRE(first.GetInternedType() != second.GetInternedType());
+    REQUIRE(second.GetType() == "MyExtension::DoSomethingElse");
+
+    gd::StandardEvent firstEvent;
+    firstEvent.SetType("BuiltinCommonInstructions::Standard");
+    gd::StandardEvent secondEvent;
+    secondEvent.SetType("BuiltinCommonInstructions::Standard");
+    REQUIRE(firstEvent.GetInternedType() == secondEvent.GetInternedType());
+    REQUIRE(firstEvent.GetType() == "BuiltinCommonInstructions::Standard");
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the tracking of the lifetime of objects.
+ */
+#include "GDCore/Project/MemoryTrackedRegistry.h"
+
+#include <memory>
+#include <string>
+
+#include "GDCore/Project/Layout.h"
+#include "catch.hpp"
+
+namespace {
+struct TestTrackedObject {
+  gd::MemoryTracked _memoryTracked{this, "TestTrackedObject"};
+};
+}  // namespace
+
+TEST_CASE("MemoryTrackedRegistry", "[common]") {
+  SECTION("Alive and dead objects are counted per class") {
+    long aliveCount =
+        gd::MemoryTrackedRegistry::getAliveCountForClass("TestTrackedObject");
+    long deadCount =
+        gd::MemoryTrackedRegistry::getDeadCountForClass("TestTrackedObject");
+
+    std::unique_ptr<TestTrackedObject> object(new TestTrackedObject);
+    const void* address = object.get();
+    REQUIRE(gd::MemoryTrackedRegistry::getAliveCountForClass(
+                "TestTrackedObject") == aliveCount + 1);
+    REQUIRE(!gd::MemoryTrackedRegistry::isDead(address, "TestTrackedObject"));
+
+    object.reset();
+    REQUIRE(gd::MemoryTrackedRegistry::getAliveCountForClass(
+                "TestTrackedObject") == aliveCount);
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadCountForClass(
+                "TestTrackedObject") == deadCount + 1);
+    REQUIRE(gd::MemoryTrackedRegistry::isDead(address, "TestTrackedObject"));
+    REQUIRE(!gd::MemoryTrackedRegistry::isDead(address, "Layout"));
+  }
+
+  SECTION("An object allocated at the address of a dead one is alive") {
+    const void* address = reinterpret_cast<const void*>(0x1000);
+    gd::MemoryTrackedRegistry::add(address, "TestTrackedObject");
+    gd::MemoryTrackedRegistry::remove(address, "TestTrackedObject");
+    REQUIRE(gd::MemoryTrackedRegistry::isDead(address, "TestTrackedObject"));
+
+    gd::MemoryTrackedRegistry::add(address, "TestTrackedObject");
+    REQUIRE(!gd::MemoryTrackedRegistry::isDead(address, "TestTrackedObject"));
+    gd::MemoryTrackedRegistry::remove(address, "TestTrackedObject");
+  }
+
+  SECTION("Destruction context is remembered") {
+    gd::MemoryTrackedRegistry::setCurrentCallContextId(42);
+    std::unique_ptr<gd::Layout> layout(new gd::Layout);
+    long address = static_cast<long>(reinterpret_cast<uintptr_t>(layout.get()));
+    layout.reset();
+    gd::MemoryTrackedRegistry::setCurrentCallContextId(0);
+
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadContextId(address, "Layout") ==
+            42);
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadContextTimeMs(address,
+                                                            "Layout") > 0);
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadContextId(address,
+                                                        "UnknownClass") == -1);
+  }
+
+  SECTION("Dead objects can be pruned") {
+    TestTrackedObject* object = new TestTrackedObject;
+    delete object;
+    long deadCount = gd::MemoryTrackedRegistry::getDeadCount();
+    REQUIRE(deadCount > 0);
+
+    gd::MemoryTrackedRegistry::pruneDead(deadCount + 1000);
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadCount() == deadCount);
+
+    gd::MemoryTrackedRegistry::pruneDead(0);
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadCount() == 0);
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadCountForClass(
+                "TestTrackedObject") == 0);
+  }
+
+  SECTION("Classes are found by the content of their name") {
+    std::string temporaryName = "TestTrackedObject";
+    gd::MemoryTrackedRegistry::ClassId classId =
+        gd::MemoryTrackedRegistry::getOrCreateClassId(temporaryName.c_str());
+    temporaryName = "OtherTestTrackedObject";
+    REQUIRE(gd::MemoryTrackedRegistry::getOrCreateClassId(
+                "TestTrackedObject") == classId);
+    REQUIRE(gd::MemoryTrackedRegistry::getOrCreateClassId(
+                temporaryName.c_str()) != classId);
+    REQUIRE(gd::MemoryTrackedRegistry::getAliveCountForClass(
+                "OtherTestTrackedObject") == 0);
+  }
+
+  SECTION("Unknown classes are not counted") {
+    REQUIRE(gd::MemoryTrackedRegistry::getAliveCountForClass(
+                "UnknownClass") == 0);
+    REQUIRE(gd::MemoryTrackedRegistry::getDeadCountForClass("UnknownClass") ==
+            0);
+  }
+}
@@ -0,0 +1,149 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the search of the objects lists modified by events.
+ */
+#include "GDCore/Events/CodeGeneration/ModifiedObjectsListsFinder.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainersList.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+void DeclarePickingExtension(gd::Platform &platform) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "MyPickingExtension", "My testing extension for picking", "", "", "");
+  extension
+      ->AddCondition("PickObjects", "Pick objects", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .SetFunctionName("pickObjects");
+  extension
+      ->AddAction("GiveObjects", "Give objects", "", "", "", "", "")
+      .AddParameter("objectList", "Object")
+      .SetFunctionName("giveObjects");
+  extension
+      ->AddAction("WaitForObjects", "Wait for objects", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .SetAsyncFunctionName("waitForObjects");
+  platform.AddExtension(extension);
+}
+
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const std::vector<gd::String> &parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+  return instruction;
+}
+
+}  // namespace
+
+TEST_CASE("ModifiedObjectsListsFinder", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  DeclarePickingExtension(platform);
+  auto &layout = project.InsertNewLayout("Layout1", 0);
+  layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MySprite", 0);
+  layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyOtherSprite", 1);
+  layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MyThirdSprite", 2);
+  auto &group = layout.GetObjects().GetObjectGroups().InsertNew("MyGroup", 0);
+  group.AddObject("MySprite");
+  group.AddObject("MyOtherSprite");
+
+  auto objectsContainersList =
+      gd::ObjectsContainersList::MakeNewObjectsContainersListForProjectAndLayout(
+          project, layout);
+
+  SECTION("Conditions modify the lists of their objects") {
+    gd::StandardEvent event;
+    event.GetConditions().Insert(
+        MakeInstruction("MyPickingExtension::PickObjects", {"MyGroup"}));
+    event.GetActions().Insert(MakeInstruction(
+        "MyExtension::DoSomethingWithObjects", {"MyThirdSprite", "MySprite"}));
+
+    std::set<gd::String> modifiedObjectsLists;
+    REQUIRE(gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+                platform, objectsContainersList, event, modifiedObjectsLists) ==
+            true);
+    REQUIRE(modifiedObjectsLists ==
+            std::set<gd::String>({"MySprite", "MyOtherSprite"}));
+  }
+
+  SECTION("Actions modify the lists given to them") {
+    gd::StandardEvent event;
+    event.GetActions().Insert(MakeInstruction(
+        "MyExtension::DoSomethingWithObjects", {"MySprite", "MyOtherSprite"}));
+    event.GetActions().Insert(
+        MakeInstruction("MyPickingExtension::GiveObjects", {"MyThirdSprite"}));
+
+    std::set<gd::String> modifiedObjectsLists;
+    REQUIRE(gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+                platform, objectsContainersList, event, modifiedObjectsLists) ==
+            true);
+    REQUIRE(modifiedObjectsLists == std::set<gd::String>({"MyThirdSprite"}));
+  }
+
+  SECTION("Sub-events are searched") {
+    gd::StandardEvent event;
+    gd::StandardEvent subEvent;
+    subEvent.GetConditions().Insert(
+        MakeInstruction("MyPickingExtension::PickObjects", {"MyOtherSprite"}));
+    event.GetSubEvents().InsertEvent(subEvent);
+
+    std::set<gd::String> modifiedObjectsLists;
+    REQUIRE(gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+                platform, objectsContainersList, event, modifiedObjectsLists) ==
+            true);
+    REQUIRE(modifiedObjectsLists == std::set<gd::String>({"MyOtherSprite"}));
+  }
+
+  SECTION("Modified lists can't be known for other events") {
+    gd::StandardEvent event;
+    gd::ForEachEvent subEvent;
+    event.GetSubEvents().InsertEvent(subEvent);
+
+    std::set<gd::String> modifiedObjectsLists;
+    REQUIRE(gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+                platform, objectsContainersList, event, modifiedObjectsLists) ==
+            false);
+  }
+
+  SECTION("Modified lists can't be known for unknown or async instructions") {
+    gd::StandardEvent event;
+    event.GetActions().Insert(
+        MakeInstruction("MyPickingExtension::WaitForObjects", {"MySprite"}));
+
+    std::set<gd::String> modifiedObjectsLists;
+    REQUIRE(gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+                platform, objectsContainersList, event, modifiedObjectsLists) ==
+            false);
+
+    gd::StandardEvent otherEvent;
+    otherEvent.GetActions().Insert(
+        MakeInstruction("MyPickingExtension::UnknownAction", {"MySprite"}));
+    REQUIRE(gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+                platform,
+                objectsContainersList,
+                otherEvent,
+                modifiedObjectsLists) == false);
+  }
+}
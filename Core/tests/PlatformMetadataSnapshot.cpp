@@ -0,0 +1,219 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the snapshot of the metadata of the extensions.
+ */
+#include "GDCore/IDE/PlatformMetadataSnapshot.h"
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
+#include "GDCore/Extensions/ExtensionBindingsRegistry.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Serialization/BinarySerializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+
+void BindMyExtension(gd::PlatformExtension &extension) {
+  extension.GetAllActions()["MyExtension::DoSomething"].SetCustomCodeGenerator(
+      [](gd::Instruction &instruction,
+         gd::EventsCodeGenerator &codeGenerator,
+         gd::EventsCodeGenerationContext &context) {
+        return "doSomething();";
+      });
+}
+
+std::vector<std::shared_ptr<gd::PlatformExtension>> CreateExtensions() {
+  std::vector<std::shared_ptr<gd::PlatformExtension>> extensions;
+  for (auto implements : {
+           &gd::BuiltinExtensionsImplementer::ImplementsBaseObjectExtension,
+           &gd::BuiltinExtensionsImplementer::ImplementsSpriteExtension,
+           &gd::BuiltinExtensionsImplementer::
+               ImplementsCommonInstructionsExtension,
+           &gd::BuiltinExtensionsImplementer::ImplementsAsyncExtension,
+           &gd::BuiltinExtensionsImplementer::ImplementsVariablesExtension,
+           &gd::BuiltinExtensionsImplementer::ImplementsScalableExtension,
+       }) {
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    implements(*extension);
+    extensions.push_back(extension);
+  }
+
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(
+      "MyExtension", "My extension", "An extension for tests", "", "MIT");
+  extension
+      ->AddAction("DoSomething",
+                  "Do something",
+                  "Do something for tests.",
+                  "Do something with _PARAM0_",
+                  "",
+                  "res/icon.png",
+                  "res/icon.png")
+      .AddParameter("expression", "Value");
+  extension->AddEffect("MyEffect").SetFullName("My effect").MarkAsUnique();
+  extension->AddDependency()
+      .SetName("My dependency")
+      .SetExportName("my-dependency")
+      .SetDependencyType("npm");
+  BindMyExtension(*extension);
+  extensions.push_back(extension);
+
+  return extensions;
+}
+
+gd::ExtensionBindingsRegistry CreateRegistry() {
+  gd::ExtensionBindingsRegistry registry;
+  gd::BuiltinExtensionsImplementer::AddBuiltinExtensionsBindings(registry);
+  registry.AddBindings("MyExtension", BindMyExtension);
+  return registry;
+}
+
+gd::SerializerElement CreateSnapshot(
+    const std::vector<std::shared_ptr<gd::PlatformExtension>> &extensions) {
+  gd::SerializerElement snapshot;
+  gd::PlatformMetadataSnapshot::SerializeTo(extensions, snapshot);
+
+  std::vector<uint8_t> buffer;
+  gd::BinarySerializer::SerializeToBinaryBuffer(snapshot, buffer);
+  gd::SerializerElement restoredSnapshot;
+  REQUIRE(gd::BinarySerializer::DeserializeFromBinaryBuffer(
+      buffer.data(), buffer.size(), restoredSnapshot));
+  return restoredSnapshot;
+}
+
+std::shared_ptr<gd::PlatformExtension> FindExtension(
+    const std::vector<std::shared_ptr<gd::PlatformExtension>> &extensions,
+    const gd::String &name) {
+  for (const auto &extension : extensions) {
+    if (extension->GetName() == name) return extension;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST_CASE("PlatformMetadataSnapshot", "[common]") {
+  SECTION("Extensions are restored and bound from a binary snapshot") {
+    auto extensions = CreateExtensions();
+    gd::SerializerElement snapshot = CreateSnapshot(extensions);
+
+    std::vector<std::shared_ptr<gd::PlatformExtension>> restoredExtensions;
+    REQUIRE(gd::PlatformMetadataSnapshot::UnserializeFrom(
+        snapshot, CreateRegistry(), restoredExtensions));
+    REQUIRE(restoredExtensions.size() == extensions.size());
+    REQUIRE(gd::PlatformMetadataSnapshot::FindDifferences(
+                extensions, snapshot, CreateRegistry())
+                .empty());
+
+    auto variablesExtension =
+        FindExtension(restoredExtensions, "BuiltinVariables");
+    REQUIRE(variablesExtension != nullptr);
+    const gd::InstructionMetadata &setNumberVariable =
+        variablesExtension->GetAllActions()["SetNumberVariable"];
+    const gd::InstructionMetadata &declaredSetNumberVariable =
+        FindExtension(extensions, "BuiltinVariables")
+            ->GetAllActions()["SetNumberVariable"];
+    REQUIRE(setNumberVariable.GetSentence() ==
+            declaredSetNumberVariable.GetSentence());
+    REQUIRE(setNumberVariable.GetParametersCount() ==
+            declaredSetNumberVariable.GetParametersCount());
+    REQUIRE(setNumberVariable.GetParameter(0).GetType() ==
+            declaredSetNumberVariable.GetParameter(0).GetType());
+
+    auto commonInstructionsExtension =
+        FindExtension(restoredExtensions, "BuiltinCommonInstructions");
+    const gd::EventMetadata &standardEvent =
+        commonInstructionsExtension
+            ->GetAllEvents()["BuiltinCommonInstructions::Standard"];
+    REQUIRE(std::dynamic_pointer_cast<gd::StandardEvent>(
+                standardEvent.instance) != nullptr);
+    REQUIRE(standardEvent.instance->GetType() ==
+            "BuiltinCommonInstructions::Standard");
+
+    auto spriteExtension = FindExtension(restoredExtensions, "Sprite");
+    REQUIRE(spriteExtension->GetObjectCreationFunctionPtr("Sprite")() !=
+            nullptr);
+
+    auto scalableExtension =
+        FindExtension(restoredExtensions, "ScalableCapability");
+    REQUIRE(scalableExtension
+                ->GetBehaviorMetadata("ScalableCapability::ScalableBehavior")
+                .GetName() == "ScalableCapability::ScalableBehavior");
+
+    auto myExtension = FindExtension(restoredExtensions, "MyExtension");
+    REQUIRE(myExtension->GetAllActions()["MyExtension::DoSomething"]
+                .HasCustomCodeGenerator());
+    REQUIRE(myExtension->GetEffectMetadata("MyExtension::MyEffect")
+                .IsMarkedAsUnique());
+    REQUIRE(myExtension->GetAllDependencies().size() == 1);
+    REQUIRE(myExtension->GetAllDependencies()[0].GetExportName() ==
+            "my-dependency");
+  }
+
+  SECTION("Extensions without their bindings are not restored") {
+    auto extensions = CreateExtensions();
+    gd::SerializerElement snapshot = CreateSnapshot(extensions);
+
+    gd::ExtensionBindingsRegistry registry;
+    gd::BuiltinExtensionsImplementer::AddBuiltinExtensionsBindings(registry);
+    std::vector<std::shared_ptr<gd::PlatformExtension>> restoredExtensions;
+    REQUIRE_FALSE(gd::PlatformMetadataSnapshot::UnserializeFrom(
+        snapshot, registry, restoredExtensions));
+    REQUIRE(restoredExtensions.empty());
+
+    auto differences = gd::PlatformMetadataSnapshot::FindDifferences(
+        extensions, snapshot, registry);
+    REQUIRE(differences.size() == 1);
+    REQUIRE(differences[0] ==
+            "MyExtension: action \"MyExtension::DoSomething\" has no code "
+            "generator.");
+  }
+
+  SECTION("Snapshots of other versions are not restored") {
+    auto extensions = CreateExtensions();
+    gd::SerializerElement snapshot = CreateSnapshot(extensions);
+    snapshot.SetAttribute("gdVersion", "1.0.0");
+
+    std::vector<std::shared_ptr<gd::PlatformExtension>> restoredExtensions;
+    REQUIRE_FALSE(gd::PlatformMetadataSnapshot::UnserializeFrom(
+        snapshot, CreateRegistry(), restoredExtensions));
+    REQUIRE(restoredExtensions.empty());
+  }
+
+  SECTION("Changes in the declarations are found") {
+    auto extensions = CreateExtensions();
+    gd::SerializerElement snapshot = CreateSnapshot(extensions);
+
+    auto myExtension = FindExtension(extensions, "MyExtension");
+    myExtension->GetAllActions()["MyExtension::DoSomething"].SetFunctionName(
+        "doSomethingElse");
+    myExtension->AddCondition("IsSomething",
+                              "Is something",
+                              "Check something for tests.",
+                              "Is something",
+                              "",
+                              "res/icon.png",
+                              "res/icon.png");
+
+    auto differences = gd::PlatformMetadataSnapshot::FindDifferences(
+        extensions, snapshot, CreateRegistry());
+    REQUIRE(differences.size() == 2);
+    REQUIRE(differences[0] ==
+            "MyExtension: conditions \"MyExtension::IsSomething\" is missing "
+            "from the snapshot.");
+    REQUIRE(differences[1] ==
+            "MyExtension: actions \"MyExtension::DoSomething\" differs from "
+            "the snapshot.");
+  }
+}
@@ -0,0 +1,142 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the checks of the events of a whole project.
+ */
+#include "GDCore/IDE/WholeProjectDiagnosticsChecker.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+
+gd::StandardEvent MakeEventWithAction(const gd::String &type,
+                                      const std::vector<gd::String> &parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  gd::StandardEvent event;
+  event.GetActions().Insert(instruction);
+  return event;
+}
+
+}  // namespace
+
+TEST_CASE("WholeProjectDiagnosticsChecker", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  layout.GetObjects().InsertNewObject(
+      project, "MyExtension::Sprite", "MySprite", 0);
+  layout.GetVariables().InsertNew("MySceneVariable", 0);
+  layout.GetEvents().InsertEvent(MakeEventWithAction(
+      "MyExtension::DoSomethingWithObjects", {"MySprite", "MyOtherSprite"}));
+  layout.GetEvents().InsertEvent(MakeEventWithAction(
+      "MyExtension::DoSomethingWithAnyVariable", {"MyVariable"}));
+  layout.GetEvents().InsertEvent(MakeEventWithAction(
+      "MyExtension::DoSomethingWithObjects", {"MySprite", "MySprite"}));
+
+  auto &externalEvents = project.InsertNewExternalEvents("External", 0);
+  externalEvents.SetAssociatedLayout("Scene");
+  externalEvents.GetEvents().InsertEvent(MakeEventWithAction(
+      "MyExtension::DoSomethingWithObjects", {"MySprite", "MySprite"}));
+
+  gd::WholeProjectDiagnosticsChecker checker;
+  gd::WholeProjectDiagnosticReport report;
+
+  SECTION("It reports the issues of the events") {
+    checker.Check(project, report);
+
+    REQUIRE(checker.GetCheckedEventsCount() == 4);
+    REQUIRE(checker.GetReusedEventsCount() == 0);
+    REQUIRE(report.Count() == 2);
+    REQUIRE(report.HasAnyIssue());
+
+    const auto &sceneReport = report.Get(0);
+    REQUIRE(sceneReport.GetSceneName() == "Scene");
+    REQUIRE(sceneReport.Count() == 2);
+    REQUIRE(sceneReport.Get(0).GetType() ==
+            gd::ProjectDiagnostic::ErrorType::UnknownObject);
+    REQUIRE(sceneReport.Get(0).GetActualValue() == "MyOtherSprite");
+    REQUIRE(sceneReport.Get(1).GetType() ==
+            gd::ProjectDiagnostic::ErrorType::UndeclaredVariable);
+    REQUIRE(sceneReport.Get(1).GetActualValue() == "MyVariable");
+
+    REQUIRE(report.Get(1).GetSceneName() == "External");
+    REQUIRE(report.Get(1).Count() == 0);
+  }
+
+  SECTION("It reuses the results of the events that did not change") {
+    checker.Check(project, report);
+    checker.Check(project, report);
+
+    REQUIRE(checker.GetCheckedEventsCount() == 0);
+    REQUIRE(checker.GetReusedEventsCount() == 4);
+    REQUIRE(report.Count() == 2);
+    REQUIRE(report.Get(0).Count() == 2);
+    REQUIRE(report.Get(0).Get(0).GetActualValue() == "MyOtherSprite");
+    REQUIRE(report.Get(0).Get(1).GetActualValue() == "MyVariable");
+  }
+
+  SECTION("It checks again the events that changed") {
+    checker.Check(project, report);
+
+    layout.GetEvents().GetEvent(1).GetAllActionsVectors()[0]->Get(0)
+        .SetParameter(0, gd::Expression("MySceneVariable"));
+    checker.Check(project, report);
+
+    REQUIRE(checker.GetCheckedEventsCount() == 1);
+    REQUIRE(checker.GetReusedEventsCount() == 3);
+    REQUIRE(report.Get(0).Count() == 1);
+    REQUIRE(report.Get(0).Get(0).GetActualValue() == "MyOtherSprite");
+  }
+
+  SECTION("It checks again the events of a scene having new objects") {
+    checker.Check(project, report);
+
+    layout.GetObjects().InsertNewObject(
+        project, "MyExtension::Sprite", "MyOtherSprite", 1);
+    checker.Check(project, report);
+
+    // The external events are associated to the scene.
+    REQUIRE(checker.GetCheckedEventsCount() == 4);
+    REQUIRE(checker.GetReusedEventsCount() == 0);
+    REQUIRE(report.Get(0).Count() == 1);
+    REQUIRE(report.Get(0).Get(0).GetActualValue() == "MyVariable");
+  }
+
+  SECTION("It checks again the events having new local variables") {
+    checker.Check(project, report);
+
+    layout.GetEvents().GetEvent(1).GetVariables().InsertNew("MyVariable", 0);
+    checker.Check(project, report);
+
+    REQUIRE(checker.GetCheckedEventsCount() == 1);
+    REQUIRE(checker.GetReusedEventsCount() == 3);
+    REQUIRE(report.Get(0).Count() == 1);
+    REQUIRE(report.Get(0).Get(0).GetActualValue() == "MyOtherSprite");
+  }
+
+  SECTION("It ignores disabled events") {
+    layout.GetEvents().GetEvent(0).SetDisabled(true);
+    checker.Check(project, report);
+
+    REQUIRE(checker.GetCheckedEventsCount() == 3);
+    REQUIRE(report.Get(0).Count() == 1);
+    REQUIRE(report.Get(0).Get(0).GetActualValue() == "MyVariable");
+  }
+}
@@ -6,15 +6,23 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 
 #include <algorithm>
+#include <cctype>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/ElseEvent.h"
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/EventsFunctionSelfCallChecker.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/SceneNameMangler.h"
 #include "GDCore/Project/Behavior.h"
@@ -30,10 +38,69 @@
 #include "GDCore/Project/PropertiesContainer.h"
 #include "GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/LinkedEventsCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 
 using namespace std;
 
+namespace {
+/**
+ * Check if the code of an argument can be repeated in an inlined body instead
+ * of being stored in a temporary: a number, a string without escaped
+ * characters or an identifier, which are evaluated without side effects.
+ */
+bool IsRepeatableArgument(const gd::String& code) {
+  const std::string& rawCode = code.Raw();
+  if (rawCode.empty()) return false;
+  if (rawCode.size() >= 2 && rawCode.front() == '"' && rawCode.back() == '"')
+    return rawCode.find_first_of("\"\\", 1) == rawCode.size() - 1;
+
+  for (char character : rawCode) {
+    if (!std::isalnum(static_cast<unsigned char>(character)) &&
+        character != '_' && character != '$' && character != '.')
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Replace the identifier (a name that is not part of a longer name, or a
+ * property of an object) by another one.
+ */
+gd::String ReplaceIdentifier(const gd::String& code,
+                             const gd::String& identifier,
+                             const gd::String& replacement) {
+  auto isIdentifierChar = [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' ||
+           c == '$';
+  };
+
+  const std::string& rawCode = code.Raw();
+  const std::string& rawIdentifier = identifier.Raw();
+  std::string result;
+  std::size_t lastEnd = 0;
+  std::size_t position = rawCode.find(rawIdentifier);
+  while (position != std::string::npos) {
+    std::size_t end = position + rawIdentifier.size();
+    bool isWholeIdentifier =
+        (position == 0 || (!isIdentifierChar(rawCode[position - 1]) &&
+                           rawCode[position - 1] != '.')) &&
+        (end == rawCode.size() || !isIdentifierChar(rawCode[end]));
+    if (isWholeIdentifier) {
+      result += rawCode.substr(lastEnd, position - lastEnd);
+      result += replacement.Raw();
+      lastEnd = end;
+    }
+    position =
+        rawCode.find(rawIdentifier, isWholeIdentifier ? end : position + 1);
+  }
+  result += rawCode.substr(lastEnd);
+
+  return gd::String::FromUTF8(result);
+}
+
+}  // namespace
+
 namespace gdjs {
 
 gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
@@ -51,7 +118,10 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   // Generate whole events code
   // Preprocessing then code generation can make changes to the events, so we
   // need to do the work on a copy of the events.
+  if (codeGenerator.ShouldGenerateEventsProfilingCode())
+    codeGenerator.IdentifyProfiledEvents(events);
   gd::EventsList generatedEvents = events;
+  codeGenerator.rootEvents = &generatedEvents;
   codeGenerator.PreprocessEventList(generatedEvents);
   gd::String wholeEventsCode =
       codeGenerator.GenerateEventsListCode(generatedEvents, context);
@@ -77,12 +147,50 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   gd::String idToCallbackMapCode;
   idToCallbackMapCode +=
       codeGenerator.GetCodeNamespace() + ".idToCallbackMap = new Map();\n";
+  // The callbacks of the linked events are registered in the code of the
+  // linked events: list it so that the runtime can find them.
+  if (!codeGenerator.linkedEventsCodeNames.empty()) {
+    gd::String linkedEventsCodeNamesCode;
+    for (const gd::String& name : codeGenerator.linkedEventsCodeNames) {
+      if (!linkedEventsCodeNamesCode.empty()) linkedEventsCodeNamesCode += ", ";
+      linkedEventsCodeNamesCode += codeGenerator.ConvertToStringExplicit(name);
+    }
+    idToCallbackMapCode += codeGenerator.GetCodeNamespace() +
+                           ".linkedEventsCodeNames = [" +
+                           linkedEventsCodeNamesCode + "];\n";
+  }
+
+  gd::String eventsProfilingCountersCode;
+  if (codeGenerator.ShouldGenerateEventsProfilingCode()) {
+    gd::String eventsIdsCode;
+    for (const gd::String& eventId : codeGenerator.GetProfiledEventsIds()) {
+      if (!eventsIdsCode.empty()) eventsIdsCode += ", ";
+      eventsIdsCode += codeGenerator.ConvertToStringExplicit(eventId);
+    }
+    eventsProfilingCountersCode +=
+        codeGenerator.GetCodeNamespace() +
+        ".eventsProfilingCounters = gdjs.EventsProfiler.registerEvents(" +
+        codeGenerator.ConvertToStringExplicit(codeGenerator.codeNamespace) +
+        ", [" + eventsIdsCode + "]);\n";
+  }
+
+  gd::String objectsNamesDeclarations;
+  for (std::size_t i = 0; i < codeGenerator.compactObjectsNames.size(); ++i) {
+    objectsNamesDeclarations +=
+        "const $n" + gd::String::From(i) + " = " +
+        codeGenerator.ConvertToStringExplicit(
+            codeGenerator.compactObjectsNames[i]) +
+        ";\n";
+  }
 
   gd::String output =
       // clang-format off
+      (codeGenerator.ShouldGenerateCompactCode() ? "const " : "") +
       codeGenerator.GetCodeNamespace() + " = {};\n" +
       localVariablesInitializationCode +
       idToCallbackMapCode +
+      eventsProfilingCountersCode +
+      objectsNamesDeclarations +
       globalDeclarations +
       globalObjectLists + "\n\n" +
       codeGenerator.GetCustomCodeOutsideMain() + "\n\n" +
@@ -98,6 +206,13 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
       "}\n";
   // clang-format on
 
+  // The whole code is in a function, so that the namespace and the lists of
+  // objects are local variables with short names.
+  if (codeGenerator.ShouldGenerateCompactCode()) {
+    output = codeGenerator.codeNamespace + " = (function() {\n" + output +
+             "return " + codeGenerator.GetCodeNamespace() + ";\n})();\n";
+  }
+
   return output;
 }
 
@@ -107,11 +222,18 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
     gd::DiagnosticReport& diagnosticReport,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    bool generateEventsProfilingCode,
+    bool generateCompactCode,
+    LinkedEventsCodeGenerator* linkedEventsCodeGenerator) {
   EventsCodeGenerator codeGenerator(project, scene);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetGenerateEventsProfilingCode(generateEventsProfilingCode);
+  codeGenerator.SetGenerateCompactCode(generateCompactCode);
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
+  codeGenerator.inlinedEventsFunctionsProject = &project;
+  codeGenerator.linkedEventsCodeGenerator = linkedEventsCodeGenerator;
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       codeGenerator,
@@ -127,6 +249,77 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
   return output;
 }
 
+gd::String EventsCodeGenerator::GenerateLinkedEventsCode(
+    const gd::Project& project,
+    const gd::Layout& scene,
+    const gd::EventsList& events,
+    const gd::String& codeNamespace,
+    std::set<gd::String>& includeFiles,
+    gd::DiagnosticReport& diagnosticReport,
+    LinkedEventsCodeGenerator& linkedEventsCodeGenerator,
+    bool compilationForRuntime,
+    bool generateEventsProfilingCode,
+    bool generateCompactCode) {
+  EventsCodeGenerator codeGenerator(project, scene);
+  codeGenerator.SetCodeNamespace(codeNamespace);
+  codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetGenerateEventsProfilingCode(generateEventsProfilingCode);
+  codeGenerator.SetGenerateCompactCode(generateCompactCode);
+  codeGenerator.SetDiagnosticReport(&diagnosticReport);
+  codeGenerator.inlinedEventsFunctionsProject = &project;
+  codeGenerator.linkedEventsCodeGenerator = &linkedEventsCodeGenerator;
+
+  // The once triggers are already started for this frame by the scene code.
+  gd::String output = GenerateEventsListCompleteFunctionCode(
+      codeGenerator,
+      codeGenerator.GetCodeNamespaceAccessor() + "func",
+      "runtimeScene",
+      "",
+      events,
+      "",
+      "return;\n");
+
+  includeFiles.insert(codeGenerator.GetIncludeFiles().begin(),
+                      codeGenerator.GetIncludeFiles().end());
+  return output;
+}
+
+bool EventsCodeGenerator::CanCallLinkedEventsFunction(
+    const gd::LinkEvent& linkEvent,
+    const gd::EventsList& eventsList,
+    std::size_t indexOfTheEventInThisList) {
+  // Events at the root start without any picked objects, so the linked events
+  // run the same way from a function.
+  if (!linkedEventsCodeGenerator || !HasProjectAndLayout() ||
+      &eventsList != rootEvents ||
+      linkEvent.GetIncludeConfig() == gd::LinkEvent::INCLUDE_BY_INDEX)
+    return false;
+
+  const gd::EventsList* linkedEvents = linkEvent.GetLinkedEvents(GetProject());
+  if (!linkedEvents || linkedEvents->IsEmpty()) return false;
+
+  // "Else" events are chained to the events before them in the same list.
+  if (dynamic_cast<const gd::ElseEvent*>(&linkedEvents->GetEvent(0)))
+    return false;
+  if (indexOfTheEventInThisList + 1 < eventsList.GetEventsCount() &&
+      dynamic_cast<const gd::ElseEvent*>(
+          &eventsList.GetEvent(indexOfTheEventInThisList + 1)))
+    return false;
+
+  return true;
+}
+
+gd::String EventsCodeGenerator::GenerateLinkedEventsFunctionCall(
+    const gd::LinkEvent& linkEvent) {
+  if (!linkedEventsCodeGenerator) return "";
+
+  gd::String linkedEventsCodeName =
+      linkedEventsCodeGenerator->GetLinkedEventsCodeName(
+          linkEvent, GetLayout(), *GetDiagnosticReport());
+  linkedEventsCodeNames.insert(linkedEventsCodeName);
+  return "gdjs." + linkedEventsCodeName + ".func(runtimeScene);\n";
+}
+
 gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
     gd::Project& project,
     const gd::EventsFunctionsExtension& eventsFunctionsExtension,
@@ -152,6 +345,7 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
   EventsCodeGenerator codeGenerator(projectScopedContainers);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.inlinedEventsFunctionsProject = &project;
 
   gd::DiagnosticReport diagnosticReport;
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
@@ -226,6 +420,7 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
   EventsCodeGenerator codeGenerator(projectScopedContainers);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.inlinedEventsFunctionsProject = &project;
 
   gd::DiagnosticReport diagnosticReport;
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
@@ -323,6 +518,7 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionCode(
   EventsCodeGenerator codeGenerator(projectScopedContainers);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.inlinedEventsFunctionsProject = &project;
 
   gd::DiagnosticReport diagnosticReport;
   codeGenerator.SetDiagnosticReport(&diagnosticReport);
@@ -756,13 +952,13 @@ EventsCodeGenerator::GenerateAllObjectsDeclarationsAndResets(
        &globalObjectLists,
        &globalObjectListsReset](const gd::Object& object) {
         // Generate declarations for the objects lists
+        gd::String objectListBaseName = GetObjectListBaseName(object.GetName());
         for (unsigned int j = 1; j <= maxDepthLevelReached; ++j) {
-          globalObjectLists += GetCodeNamespaceAccessor() +
-                               ManObjListName(object.GetName()) +
-                               gd::String::From(j) + "= [];\n";
-          globalObjectListsReset += GetCodeNamespaceAccessor() +
-                                    ManObjListName(object.GetName()) +
-                                    gd::String::From(j) + ".length = 0;\n";
+          globalObjectLists += (generateCompactCode ? "const " : "") +
+                               objectListBaseName + gd::String::From(j) +
+                               "= [];\n";
+          globalObjectListsReset += objectListBaseName + gd::String::From(j) +
+                                    ".length = 0;\n";
         }
       };
 
@@ -876,20 +1072,12 @@ gd::String EventsCodeGenerator::GenerateObjectCondition(
   }
   if (conditionInverted) predicate = GenerateNegatedPredicate(predicate);
 
+  // The loop is generated once for all the conditions run in it.
+  if (isGeneratingFusedObjectLoop) return predicate;
+
   // Generate whole condition code
-  conditionCode +=
-      "for (var i = 0, k = 0, l = " + GetObjectListName(objectName, context) +
-      ".length;i<l;++i) {\n";
-  conditionCode += "    if ( " + predicate + " ) {\n";
-  conditionCode += "        " +
-                   GenerateBooleanFullName(returnBoolean, context) +
-                   " = true;\n";
-  conditionCode += "        " + GetObjectListName(objectName, context) +
-                   "[k] = " + GetObjectListName(objectName, context) + "[i];\n";
-  conditionCode += "        ++k;\n";
-  conditionCode += "    }\n";
-  conditionCode += "}\n";
-  conditionCode += GetObjectListName(objectName, context) + ".length = k;\n";
+  conditionCode += GenerateObjectsListFilterCode(
+      GetObjectListName(objectName, context), predicate, returnBoolean, context);
 
   return conditionCode;
 }
@@ -923,24 +1111,84 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
   }
   if (conditionInverted) predicate = GenerateNegatedPredicate(predicate);
 
-  conditionCode +=
-      "for (var i = 0, k = 0, l = " + GetObjectListName(objectName, context) +
-      ".length;i<l;++i) {\n";
-  conditionCode += "    if ( " + predicate + " ) {\n";
-  conditionCode += "        " +
-                    GenerateBooleanFullName(returnBoolean, context) +
-                    " = true;\n";
-  conditionCode += "        " + GetObjectListName(objectName, context) +
-                    "[k] = " + GetObjectListName(objectName, context) +
-                    "[i];\n";
-  conditionCode += "        ++k;\n";
-  conditionCode += "    }\n";
-  conditionCode += "}\n";
-  conditionCode += GetObjectListName(objectName, context) + ".length = k;\n";
+  conditionCode += GenerateObjectsListFilterCode(
+      GetObjectListName(objectName, context), predicate, returnBoolean, context);
 
   return conditionCode;
 }
 
+gd::String EventsCodeGenerator::GenerateObjectsListFilterCode(
+    const gd::String& objectListName,
+    const gd::String& predicate,
+    const gd::String& returnBoolean,
+    gd::EventsCodeGenerationContext& context) {
+  gd::String filterCode;
+  filterCode +=
+      "for (var i = 0, k = 0, l = " + objectListName + ".length;i<l;++i) {\n";
+  filterCode += "    if ( " + predicate + " ) {\n";
+  filterCode += "        " + GenerateBooleanFullName(returnBoolean, context) +
+                " = true;\n";
+  filterCode += "        " + objectListName + "[k] = " + objectListName +
+                "[i];\n";
+  filterCode += "        ++k;\n";
+  filterCode += "    }\n";
+  filterCode += "}\n";
+  filterCode += objectListName + ".length = k;\n";
+
+  return filterCode;
+}
+
+gd::String EventsCodeGenerator::GenerateObjectsListLoopCode(
+    const gd::String& objectListName, const gd::String& code) {
+  return "for(var i = 0, len = " + objectListName +
+         ".length ;i < len;++i) {\n" + code + "}\n";
+}
+
+gd::String EventsCodeGenerator::GenerateObjectsInstructionCode(
+    const std::vector<gd::String>& objectNames,
+    const std::vector<gd::String>& objectsCodes,
+    gd::EventsCodeGenerationContext& context) {
+  if (objectNames.size() < minObjectsCountForGroupLoop ||
+      isGeneratingFusedObjectLoop)
+    return gd::EventsCodeGenerator::GenerateObjectsInstructionCode(
+        objectNames, objectsCodes, context);
+
+  // The code of a large group is generated once, for a loop over the lists of
+  // its objects, when the code of each object only differs by the name of its
+  // list.
+  const gd::String loopListName = "groupObjectsList";
+  gd::String loopCode;
+  gd::String listsNames;
+  for (std::size_t i = 0; i < objectNames.size(); ++i) {
+    gd::String objectListName = GetObjectListName(objectNames[i], context);
+    gd::String objectLoopCode =
+        ReplaceIdentifier(objectsCodes[i], objectListName, loopListName);
+    if (objectLoopCode == objectsCodes[i] ||
+        (i != 0 && objectLoopCode != loopCode))
+      return gd::EventsCodeGenerator::GenerateObjectsInstructionCode(
+          objectNames, objectsCodes, context);
+
+    loopCode = objectLoopCode;
+    if (i != 0) listsNames += ", ";
+    listsNames += objectListName;
+  }
+
+  // The array of the lists is declared once, so that running the loop does not
+  // allocate anything.
+  auto arrayName = objectsListsArraysNames.find(listsNames);
+  if (arrayName == objectsListsArraysNames.end()) {
+    gd::String name =
+        GetCodeNamespaceAccessor() + "objectsLists" +
+        gd::String::From(objectsListsArraysNames.size());
+    AddCustomCodeOutsideMain(name + " = [" + listsNames + "];\n");
+    arrayName = objectsListsArraysNames.insert(std::make_pair(listsNames, name))
+                    .first;
+  }
+
+  return "for (const " + loopListName + " of " + arrayName->second + ") {\n" +
+         loopCode + "}\n";
+}
+
 gd::String EventsCodeGenerator::GenerateRelationalOperation(
     const gd::String& relationalOperator,
     const gd::String& lhs,
@@ -1004,16 +1252,16 @@ gd::String EventsCodeGenerator::GenerateObjectAction(
            GenerateArgumentsList(arguments, 1) + ")";
   }
 
+  // The loop is generated once for all the actions run in it.
+  if (isGeneratingFusedObjectLoop) return "    " + call + ";\n";
+
   if (!optionalAsyncCallbackName.empty()) {
     actionCode += "{\nconst asyncTaskGroup = new gdjs.TaskGroup();\n";
     call = "asyncTaskGroup.addTask(" + call + ")";
   }
 
-  actionCode +=
-      "for(var i = 0, len = " + GetObjectListName(objectName, context) +
-      ".length ;i < len;++i) {\n";
-  actionCode += "    " + call + ";\n";
-  actionCode += "}\n";
+  actionCode += GenerateObjectsListLoopCode(
+      GetObjectListName(objectName, context), "    " + call + ";\n");
 
   if (!optionalAsyncCallbackName.empty() && !optionalAsyncCallbackId.empty()) {
     actionCode +=
@@ -1079,11 +1327,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
     call = "asyncTaskGroup.addTask(" + call + ")";
   }
 
-  actionCode +=
-      "for(var i = 0, len = " + GetObjectListName(objectName, context) +
-      ".length ;i < len;++i) {\n";
-  actionCode += "    " + call + ";\n";
-  actionCode += "}\n";
+  actionCode += GenerateObjectsListLoopCode(
+      GetObjectListName(objectName, context), "    " + call + ";\n");
 
   if (!optionalAsyncCallbackName.empty() &&
       !optionalAsyncCallbackId.empty()) {
@@ -1097,10 +1342,46 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
 
 gd::String EventsCodeGenerator::GetObjectListName(
     const gd::String& name, const gd::EventsCodeGenerationContext& context) {
-  return GetCodeNamespaceAccessor() + ManObjListName(name) +
+  return GetObjectListBaseName(name) +
          gd::String::From(context.GetLastDepthObjectListWasNeeded(name));
 }
 
+gd::String EventsCodeGenerator::GetOrConditionObjectListName(
+    const gd::String& name,
+    const gd::EventsCodeGenerationContext& parentContext) {
+  return GetObjectListBaseName(name) +
+         gd::String::From(parentContext.GetContextDepth()) + "_" +
+         gd::String::From(parentContext.GetCurrentConditionDepth()) + "final";
+}
+
+gd::String EventsCodeGenerator::GetObjectListBaseName(
+    const gd::String& objectName) {
+  if (!generateCompactCode)
+    return GetCodeNamespaceAccessor() + ManObjListName(objectName);
+
+  auto objectsListIndex = compactObjectsListsIndices.find(objectName);
+  if (objectsListIndex == compactObjectsListsIndices.end()) {
+    objectsListIndex =
+        compactObjectsListsIndices
+            .insert(std::make_pair(objectName,
+                                   compactObjectsListsIndices.size()))
+            .first;
+  }
+  return "$o" + gd::String::From(objectsListIndex->second) + "_";
+}
+
+gd::String EventsCodeGenerator::GenerateObjectNameCode(
+    const gd::String& objectName) {
+  if (!generateCompactCode) return ConvertToStringExplicit(objectName);
+
+  auto existingName = std::find(
+      compactObjectsNames.begin(), compactObjectsNames.end(), objectName);
+  std::size_t index = existingName - compactObjectsNames.begin();
+  if (existingName == compactObjectsNames.end())
+    compactObjectsNames.push_back(objectName);
+  return "$n" + gd::String::From(index);
+}
+
 gd::String EventsCodeGenerator::GenerateGetBehaviorNameCode(
     const gd::String& behaviorName) {
   if (HasProjectAndLayout()) {
@@ -1133,8 +1414,21 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
 
         //*Optimization*: Avoid expensive copy of the object list if we're using
         // the same list as the one from the parent context.
-        if (context.IsSameObjectsList(object, *context.GetParentContext()))
+        if (context.IsSameObjectsList(object, *context.GetParentContext())) {
+          // Count the copies avoided because the event does not modify the
+          // list. A context reusing its parent (like the one of actions) only
+          // avoids a copy if the parent has not already declared the list.
+          const auto &parentContext = *context.GetParentContext();
+          bool isDeclaredByReusedParent =
+              parentContext.GetContextDepth() == context.GetContextDepth() &&
+              parentContext.IsToBeDeclared(object);
+          if (GetDiagnosticReport() &&
+              context.IsObjectsListSharedWithParent(object) &&
+              !isDeclaredByReusedParent)
+            GetDiagnosticReport()->AddRemovedObjectsListCopy();
+
           return "/* Reuse " + objectListName + " */";
+        }
 
         gd::String copiedListName =
             GetObjectListName(object, *context.GetParentContext());
@@ -1182,7 +1476,7 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
 gd::String EventsCodeGenerator::GenerateAllInstancesGetterCode(
     const gd::String& objectName, gd::EventsCodeGenerationContext& context) {
   if (HasProjectAndLayout()) {
-    return "runtimeScene.getObjects(" + ConvertToStringExplicit(objectName) +
+    return "runtimeScene.getObjects(" + GenerateObjectNameCode(objectName) +
            ")";
   } else {
     return "eventsFunctionContext.getObjects(" +
@@ -1199,8 +1493,38 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // stress on the JS engines, we generate a new function for each list of
   // events.
 
-  gd::String code =
-      gd::EventsCodeGenerator::GenerateEventsListCode(events, context);
+  gd::String code;
+  bool isForwardingGroupEvent = false;
+  if (generateCompactCode)
+    code = GenerateForwardingGroupEventCode(events, context,
+                                            isForwardingGroupEvent);
+
+  // Lists of events only made of a group would only call the list of the
+  // events of the group: this call is used instead of a new function.
+  if (isForwardingGroupEvent) return code;
+
+  if (code.empty()) {
+    // The temporaries of the expressions inlined in these events are declared
+    // in the function of the list.
+    const gd::EventsCodeGenerationContext* parentEventsListFunctionContext =
+        eventsListFunctionContext;
+    std::vector<gd::String> temporaries;
+    temporaries.swap(eventsListFunctionTemporaries);
+    eventsListFunctionContext = &context;
+
+    code = gd::EventsCodeGenerator::GenerateEventsListCode(events, context);
+
+    eventsListFunctionContext = parentEventsListFunctionContext;
+    temporaries.swap(eventsListFunctionTemporaries);
+    if (!temporaries.empty()) {
+      gd::String declarationCode;
+      for (const gd::String& temporary : temporaries) {
+        declarationCode += declarationCode.empty() ? "let " : ", ";
+        declarationCode += temporary;
+      }
+      code = declarationCode + ";\n" + code;
+    }
+  }
 
   gd::String parametersCode = GenerateEventsParameters(context);
 
@@ -1223,6 +1547,49 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   return functionName + "(" + parametersCode + ");";
 }
 
+gd::String EventsCodeGenerator::GenerateForwardingGroupEventCode(
+    gd::EventsList& events,
+    gd::EventsCodeGenerationContext& context,
+    bool& isForwardingGroupEvent) {
+  isForwardingGroupEvent = false;
+
+  std::size_t groupEventIndex = events.size();
+  for (std::size_t eId = 0; eId < events.size(); ++eId) {
+    if (events[eId].IsDisabled() || !events[eId].IsExecutable()) continue;
+    if (groupEventIndex != events.size()) return "";
+    groupEventIndex = eId;
+  }
+  if (groupEventIndex == events.size()) return "";
+
+  // Groups with variables or measured by the profilers generate more code
+  // than the call to the list of their events.
+  auto* groupEvent = dynamic_cast<gd::GroupEvent*>(&events[groupEventIndex]);
+  if (!groupEvent || groupEvent->HasVariables() ||
+      ShouldGenerateEventsProfilingCode() ||
+      !GenerateProfilerSectionBegin(groupEvent->GetName()).empty() ||
+      !GenerateProfilerSectionEnd(groupEvent->GetName()).empty())
+    return "";
+
+  // The context is the one that the group would have as an event of the list.
+  gd::EventsCodeGenerationContext groupContext;
+  if (context.CanReuse() && groupEventIndex == events.size() - 1)
+    groupContext.Reuse(context);
+  else
+    groupContext.InheritsFrom(context);
+
+  gd::String subEventsCode =
+      GenerateEventsListCode(groupEvent->GetSubEvents(), groupContext);
+
+  gd::String declarationsCode = GenerateObjectsDeclarationCode(groupContext);
+  if (declarationsCode.empty()) {
+    isForwardingGroupEvent = true;
+    return subEventsCode;
+  }
+
+  return GenerateScopeBegin(groupContext) + "\n" + declarationsCode + "\n" +
+         subEventsCode + "\n" + GenerateScopeEnd(groupContext);
+}
+
 gd::String EventsCodeGenerator::GenerateConditionsListCode(
     gd::InstructionsList& conditions,
     gd::EventsCodeGenerationContext& context) {
@@ -1231,28 +1598,113 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
   outputCode +=
       GenerateBooleanInitializationToFalse("isConditionTrue", context);
 
-  for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
+  std::vector<std::size_t> evaluationOrder =
+      GetConditionsEvaluationOrder(conditions);
+  std::size_t nestedIfCount = 0;
+  for (std::size_t cId = 0; cId < conditions.size();) {
     if (cId != 0) {
       outputCode += "if (" +
                     GenerateBooleanFullName("isConditionTrue", context) +
                     ") {\n";
+      nestedIfCount++;
     }
-    gd::String conditionCode =
-        GenerateConditionCode(conditions[cId], "isConditionTrue", context);
-    if (!conditions[cId].GetType().empty()) {
+
+    // Consecutive conditions picking the instances of the same object check
+    // each instance in a single loop.
+    gd::String objectName = GetPerInstanceInstructionObjectName(
+        conditions[evaluationOrder[cId]], true, context);
+    std::size_t endId = cId + 1;
+    while (!objectName.empty() && endId < conditions.size() &&
+           GetPerInstanceInstructionObjectName(
+               conditions[evaluationOrder[endId]], true, context) ==
+               objectName)
+      endId++;
+
+    if (endId - cId > 1) {
+      gd::String predicate;
+      isGeneratingFusedObjectLoop = true;
+      for (std::size_t i = cId; i < endId; ++i) {
+        if (!predicate.empty()) predicate += " && ";
+        predicate += "(" +
+                     GenerateConditionCode(conditions[evaluationOrder[i]],
+                                           "isConditionTrue",
+                                           context) +
+                     ")";
+      }
+      isGeneratingFusedObjectLoop = false;
+
       outputCode +=
           GenerateBooleanFullName("isConditionTrue", context) + " = false;\n";
-      outputCode += conditionCode;
+      outputCode += GenerateObjectsListFilterCode(
+          GetObjectListName(objectName, context),
+          predicate,
+          "isConditionTrue",
+          context);
+    } else {
+      gd::Instruction& condition = conditions[evaluationOrder[cId]];
+      gd::String conditionCode =
+          GenerateConditionCode(condition, "isConditionTrue", context);
+      if (!condition.GetType().empty()) {
+        outputCode += GenerateBooleanFullName("isConditionTrue", context) +
+                      " = false;\n";
+        outputCode += conditionCode;
+      }
     }
+
+    cId = endId;
   }
   // Close nested "if".
-  for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
-    if (cId != 0) outputCode += "}\n";
-  }
+  for (std::size_t i = 0; i < nestedIfCount; ++i) outputCode += "}\n";
 
   maxConditionsListsSize = std::max(maxConditionsListsSize, conditions.size());
 
-  return outputCode;
+  return GenerateProfiledInstructionsListCode(conditions, true, outputCode);
+}
+
+gd::String EventsCodeGenerator::GenerateActionsListCode(
+    gd::InstructionsList& actions, gd::EventsCodeGenerationContext& context) {
+  gd::String outputCode;
+  for (std::size_t aId = 0; aId < actions.size();) {
+    // Consecutive actions run on each instance of the same object are run in
+    // a single loop, instead of a loop for each action.
+    gd::String objectName =
+        GetPerInstanceInstructionObjectName(actions[aId], false, context);
+    std::size_t endId = aId + 1;
+    while (!objectName.empty() && endId < actions.size() &&
+           GetPerInstanceInstructionObjectName(
+               actions[endId], false, context) == objectName)
+      endId++;
+
+    if (endId - aId > 1) {
+      gd::String loopCode;
+      isGeneratingFusedObjectLoop = true;
+      for (std::size_t i = aId; i < endId; ++i)
+        loopCode += GenerateActionCode(actions[i], context);
+      isGeneratingFusedObjectLoop = false;
+
+      outputCode += "{" +
+                    GenerateObjectsListLoopCode(
+                        GetObjectListName(objectName, context), loopCode) +
+                    "}\n";
+    } else {
+      gd::String actionCode = GenerateActionCode(actions[aId], context);
+
+      outputCode += "{";
+      if (actions[aId].GetType().empty()) {
+        // Deprecated way to cancel code generation - but still honor it.
+        // Can be removed once action is passed by const reference to
+        // GenerateActionCode.
+        outputCode += "/* Skipped action (empty type) */";
+      } else {
+        outputCode += actionCode;
+      }
+      outputCode += "}\n";
+    }
+
+    aId = endId;
+  }
+
+  return GenerateProfiledInstructionsListCode(actions, false, outputCode);
 }
 
 gd::String EventsCodeGenerator::GenerateParameterCodes(
@@ -1534,6 +1986,36 @@ gd::String EventsCodeGenerator::GenerateGetVariable(
   return output;
 }
 
+gd::String EventsCodeGenerator::GenerateVariableAccessor(gd::String childName) {
+  // The variable is likely to be a structure having this child: it's checked
+  // at runtime by `getStructureChild`, which falls back to `getChild`
+  // (converting the variable back to a structure) otherwise.
+  return ".getStructureChild(" + ConvertToStringExplicit(childName) + ")";
+}
+
+gd::String EventsCodeGenerator::GenerateVariableBracketAccessor(
+    gd::String expressionCode) {
+  // An integer literal is likely to be an index of an array, and a string
+  // literal the name of a child of a structure. Their accessors only have a
+  // fast path for these runtime types and use `getChild` for the others.
+  bool isIntegerLiteral =
+      !expressionCode.empty() && expressionCode.size() <= 9 &&
+      std::all_of(
+          expressionCode.begin(), expressionCode.end(), [](char32_t character) {
+            return character >= '0' && character <= '9';
+          });
+  if (isIntegerLiteral) return ".getArrayChild(" + expressionCode + ")";
+
+  bool isStringLiteral = expressionCode.size() >= 2 &&
+                         expressionCode[0] == '"' &&
+                         expressionCode.find('"', 1) == expressionCode.size() - 1;
+  if (isStringLiteral) return ".getStructureChild(" + expressionCode + ")";
+
+  // Otherwise, `getChild` allows to access a child with a number (an index,
+  // for an array) or a string (for a structure).
+  return ".getChild(" + expressionCode + ")";
+}
+
 gd::String EventsCodeGenerator::GenerateUpperScopeBooleanFullName(
     const gd::String& boolName,
     const gd::EventsCodeGenerationContext& context) {
@@ -1573,6 +2055,382 @@ gd::String EventsCodeGenerator::GenerateProfilerSectionEnd(
          ConvertToStringExplicit(section) + "); }";
 }
 
+bool EventsCodeGenerator::CanDeclareInlinedTemporaries(
+    const gd::EventsCodeGenerationContext& context) const {
+  for (const gd::EventsCodeGenerationContext* parentContext = &context;
+       parentContext;
+       parentContext = parentContext->GetParentContext()) {
+    if (parentContext == eventsListFunctionContext) return true;
+    // Asynchronous callbacks are generated in their own function.
+    if (parentContext->IsAsyncCallback()) return false;
+  }
+  return false;
+}
+
+gd::String EventsCodeGenerator::GenerateInlinedEventsFunctionCall(
+    const gd::String& functionType,
+    const gd::ParameterMetadataContainer& parameters,
+    const std::vector<gd::String>& argumentsCode,
+    const gd::String& objectName,
+    const gd::String& behaviorName,
+    gd::EventsCodeGenerationContext& context) {
+  if (!inlinedEventsFunctionsProject ||
+      notInlinedEventsFunctions.find(functionType) !=
+          notInlinedEventsFunctions.end())
+    return "";
+
+  // Find the function, which is either a free function
+  // ("Extension::Function") or a function of a behavior or an object
+  // ("Extension::Entity::Function").
+  const gd::Project& project = *inlinedEventsFunctionsProject;
+  const gd::String extensionName =
+      gd::PlatformExtension::GetExtensionFromFullObjectType(functionType);
+  gd::String functionName =
+      gd::PlatformExtension::GetObjectNameFromFullObjectType(functionType);
+  const gd::String entityName =
+      gd::PlatformExtension::GetExtensionFromFullObjectType(functionName);
+  if (!entityName.empty())
+    functionName =
+        gd::PlatformExtension::GetObjectNameFromFullObjectType(functionName);
+
+  const gd::EventsFunctionsExtension* eventsFunctionsExtension = nullptr;
+  const gd::EventsBasedBehavior* eventsBasedBehavior = nullptr;
+  const gd::EventsBasedObject* eventsBasedObject = nullptr;
+  const gd::EventsFunction* eventsFunction = nullptr;
+  if (project.HasEventsFunctionsExtensionNamed(extensionName)) {
+    eventsFunctionsExtension =
+        &project.GetEventsFunctionsExtension(extensionName);
+    const gd::EventsFunctionsContainer* eventsFunctions = nullptr;
+    if (entityName.empty()) {
+      eventsFunctions = &eventsFunctionsExtension->GetEventsFunctions();
+    } else if (!behaviorName.empty() &&
+               eventsFunctionsExtension->GetEventsBasedBehaviors().Has(
+                   entityName)) {
+      eventsBasedBehavior =
+          &eventsFunctionsExtension->GetEventsBasedBehaviors().Get(entityName);
+      eventsFunctions = &eventsBasedBehavior->GetEventsFunctions();
+    } else if (behaviorName.empty() &&
+               eventsFunctionsExtension->GetEventsBasedObjects().Has(
+                   entityName)) {
+      eventsBasedObject =
+          &eventsFunctionsExtension->GetEventsBasedObjects().Get(entityName);
+      eventsFunctions = &eventsBasedObject->GetEventsFunctions();
+    }
+    if (eventsFunctions &&
+        eventsFunctions->HasEventsFunctionNamed(functionName))
+      eventsFunction = &eventsFunctions->GetEventsFunction(functionName);
+  }
+  // Free functions are not called on an object.
+  if (!eventsFunction || entityName.empty() != objectName.empty()) {
+    notInlinedEventsFunctions.insert(functionType);
+    return "";
+  }
+
+  // The object and the behavior of the functions of objects and behaviors are
+  // their first parameters, given by the receiver of the call.
+  const std::size_t firstArgumentParameterIndex =
+      eventsBasedBehavior ? 2 : (eventsBasedObject ? 1 : 0);
+  const bool isExpression = eventsFunction->IsExpression();
+  const bool canDeclareTemporaries =
+      isExpression ? CanDeclareInlinedTemporaries(context) : true;
+
+  // The arguments are matched with the parameters of the function, skipping
+  // the code-only parameters: the scene, which is the same for the caller and
+  // the inlined code, and the context of the caller, not used by the inlined
+  // code.
+  const auto& functionParameters = eventsFunction->GetParameters();
+  std::map<gd::String, gd::String> argumentsNames;
+  std::vector<gd::String> temporaries;
+  gd::String temporariesCode;
+  std::size_t functionParameterIndex = 0;
+  for (std::size_t i = 0;
+       i < parameters.GetParametersCount() && i < argumentsCode.size();
+       ++i) {
+    const auto& parameter = parameters.GetParameter(i);
+    if (parameter.IsCodeOnly()) {
+      if (parameter.GetType() == "eventsFunctionContext" ||
+          (parameter.GetType() == "currentScene" &&
+           argumentsCode[i] == "runtimeScene"))
+        continue;
+      return "";
+    }
+
+    if (functionParameterIndex >= functionParameters.GetParametersCount())
+      return "";
+    const auto& functionParameter =
+        functionParameters.GetParameter(functionParameterIndex++);
+    if (functionParameterIndex <= firstArgumentParameterIndex) continue;
+
+    const gd::String& argumentCode = argumentsCode[i];
+    if (IsRepeatableArgument(argumentCode)) {
+      argumentsNames[functionParameter.GetName()] = argumentCode;
+      continue;
+    }
+    if (!canDeclareTemporaries) return "";
+
+    gd::String temporary =
+        isExpression ? "inlinedValue" +
+                           gd::String::From(inlinedTemporariesCount +
+                                            temporaries.size())
+                     : "inlinedArgument" + gd::String::From(temporaries.size());
+    temporaries.push_back(temporary);
+    argumentsNames[functionParameter.GetName()] = temporary;
+    temporariesCode += isExpression
+                           ? temporary + " = " + argumentCode + ", "
+                           : "const " + temporary + " = " + argumentCode + ";\n";
+  }
+  if (functionParameterIndex != functionParameters.GetParametersCount())
+    return "";
+
+  // The properties are read and changed on the behavior or the object on which
+  // the function is called: the current one in a loop on the instances, or
+  // else the first one.
+  gd::String propertiesHolderCode;
+  gd::String objectListName;
+  const bool isCalledOnCurrentObject = context.GetCurrentObject() == objectName;
+  if (!objectName.empty()) {
+    objectListName = GetObjectListName(objectName, context);
+    propertiesHolderCode =
+        objectListName + (isCalledOnCurrentObject ? "[i]" : "[0]");
+    if (eventsBasedBehavior)
+      propertiesHolderCode +=
+          ".getBehavior(" + GenerateGetBehaviorNameCode(behaviorName) + ")";
+  }
+
+  gd::String bodyCode =
+      GenerateInlinedEventsFunctionBody(*eventsFunctionsExtension,
+                                        eventsBasedBehavior,
+                                        eventsBasedObject,
+                                        *eventsFunction,
+                                        argumentsNames,
+                                        propertiesHolderCode);
+  if (bodyCode.empty()) {
+    notInlinedEventsFunctions.insert(functionType);
+    return "";
+  }
+
+  if (!isExpression) {
+    gd::String actionCode = "{\n" + temporariesCode + bodyCode + "}\n";
+    if (objectName.empty() || isGeneratingFusedObjectLoop) return actionCode;
+    return GenerateObjectsListLoopCode(objectListName, actionCode);
+  }
+
+  eventsListFunctionTemporaries.insert(eventsListFunctionTemporaries.end(),
+                                       temporaries.begin(),
+                                       temporaries.end());
+  inlinedTemporariesCount += temporaries.size();
+  gd::String expressionCode =
+      temporariesCode.empty() ? bodyCode
+                              : "(" + temporariesCode + bodyCode + ")";
+  if (objectName.empty() || isCalledOnCurrentObject) return expressionCode;
+
+  // Like for a call, nothing is evaluated when there is no instance.
+  return "((" + objectListName + ".length === 0) ? " +
+         (eventsFunction->GetExpressionType().IsNumber() ? "0" : "\"\"") +
+         " : " + expressionCode + ")";
+}
+
+gd::String EventsCodeGenerator::GenerateInlinedEventsFunctionBody(
+    const gd::EventsFunctionsExtension& eventsFunctionsExtension,
+    const gd::EventsBasedBehavior* eventsBasedBehavior,
+    const gd::EventsBasedObject* eventsBasedObject,
+    const gd::EventsFunction& eventsFunction,
+    const std::map<gd::String, gd::String>& argumentsNames,
+    const gd::String& propertiesHolderCode) {
+  // Above this size, the body is not worth being duplicated at each call.
+  const std::size_t maxInlinedBodySize = 300;
+
+  const bool isExpression = eventsFunction.IsExpression();
+  if ((!isExpression &&
+       eventsFunction.GetFunctionType() != gd::EventsFunction::Action) ||
+      eventsFunction.IsAsync())
+    return "";
+
+  const gd::Project& project = *inlinedEventsFunctionsProject;
+  if (eventsBasedBehavior
+          ? gd::EventsFunctionSelfCallChecker::
+                IsBehaviorFunctionOnlyCallingItself(project,
+                                                    eventsFunctionsExtension,
+                                                    *eventsBasedBehavior,
+                                                    eventsFunction)
+          : (eventsBasedObject
+                 ? gd::EventsFunctionSelfCallChecker::
+                       IsObjectFunctionOnlyCallingItself(
+                           project,
+                           eventsFunctionsExtension,
+                           *eventsBasedObject,
+                           eventsFunction)
+                 : gd::EventsFunctionSelfCallChecker::
+                       IsFreeFunctionOnlyCallingItself(
+                           project, eventsFunctionsExtension, eventsFunction)))
+    return "";
+
+  // Only functions made of a single event without conditions, returning an
+  // expression for expressions, can be inlined.
+  const gd::StandardEvent* inlinedEvent = nullptr;
+  const auto& events = eventsFunction.GetEvents();
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    const auto& event = events[i];
+    if (event.IsDisabled() || !event.IsExecutable()) continue;
+    if (inlinedEvent) return "";
+
+    inlinedEvent = dynamic_cast<const gd::StandardEvent*>(&event);
+    if (!inlinedEvent) return "";
+  }
+  if (!inlinedEvent || !inlinedEvent->GetConditions().IsEmpty() ||
+      !inlinedEvent->GetSubEvents().IsEmpty() ||
+      inlinedEvent->HasVariables() || inlinedEvent->GetActions().IsEmpty())
+    return "";
+
+  const bool isReturningNumber =
+      isExpression && eventsFunction.GetExpressionType().IsNumber();
+  if (isExpression) {
+    const gd::Instruction& returnAction = inlinedEvent->GetActions()[0];
+    if (inlinedEvent->GetActions().size() != 1 ||
+        returnAction.GetType() !=
+            (isReturningNumber ? "SetReturnNumber" : "SetReturnString") ||
+        returnAction.GetParametersCount() < 1)
+      return "";
+  }
+
+  // Objects and behaviors are only accessible through the context of the
+  // function, except the ones on which the function is called.
+  const auto& parameters = eventsFunction.GetParameters();
+  const std::size_t firstArgumentParameterIndex =
+      eventsBasedBehavior ? 2 : (eventsBasedObject ? 1 : 0);
+  for (std::size_t i = firstArgumentParameterIndex;
+       i < parameters.GetParametersCount();
+       ++i) {
+    const auto& parameterType = parameters.GetParameter(i).GetType();
+    if (gd::ParameterMetadata::IsObject(parameterType) ||
+        gd::ParameterMetadata::IsBehavior(parameterType))
+      return "";
+  }
+
+  gd::ObjectsContainer parameterObjectsAndGroups(
+      gd::ObjectsContainer::SourceType::Function);
+  gd::VariablesContainer parameterVariablesContainer(
+      gd::VariablesContainer::SourceType::Parameters);
+  gd::VariablesContainer propertyVariablesContainer(
+      gd::VariablesContainer::SourceType::Properties);
+  gd::ResourcesContainer parameterResourcesContainer(
+      gd::ResourcesContainer::SourceType::Parameters);
+  gd::ResourcesContainer propertyResourcesContainer(
+      gd::ResourcesContainer::SourceType::Properties);
+  auto projectScopedContainers =
+      eventsBasedBehavior
+          ? gd::ProjectScopedContainers::
+                MakeNewProjectScopedContainersForBehaviorEventsFunction(
+                    project,
+                    eventsFunctionsExtension,
+                    *eventsBasedBehavior,
+                    eventsFunction,
+                    parameterObjectsAndGroups,
+                    parameterVariablesContainer,
+                    propertyVariablesContainer,
+                    parameterResourcesContainer,
+                    propertyResourcesContainer)
+          : (eventsBasedObject
+                 ? gd::ProjectScopedContainers::
+                       MakeNewProjectScopedContainersForObjectEventsFunction(
+                           project,
+                           eventsFunctionsExtension,
+                           *eventsBasedObject,
+                           eventsFunction,
+                           parameterObjectsAndGroups,
+                           parameterVariablesContainer,
+                           propertyVariablesContainer,
+                           parameterResourcesContainer,
+                           propertyResourcesContainer)
+                 : gd::ProjectScopedContainers::
+                       MakeNewProjectScopedContainersForFreeEventsFunction(
+                           project,
+                           eventsFunctionsExtension,
+                           eventsFunction,
+                           parameterObjectsAndGroups,
+                           parameterVariablesContainer,
+                           parameterResourcesContainer));
+
+  EventsCodeGenerator functionCodeGenerator(projectScopedContainers);
+  functionCodeGenerator.SetCodeNamespace(
+      "gdjs.evtsExt__" +
+      EventsCodeNameMangler::GetMangledName(eventsFunctionsExtension.GetName()));
+  functionCodeGenerator.SetGenerateCodeForRuntime(GenerateCodeForRuntime());
+  functionCodeGenerator.inlinedArgumentsNames = argumentsNames;
+  functionCodeGenerator.inlinedPropertiesHolderCode = propertiesHolderCode;
+  gd::DiagnosticReport diagnosticReport;
+  functionCodeGenerator.SetDiagnosticReport(&diagnosticReport);
+
+  unsigned int maxDepthLevelReached = 0;
+  gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+  gd::InstructionsList actions = inlinedEvent->GetActions();
+  gd::String bodyCode =
+      isExpression
+          ? gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                functionCodeGenerator,
+                context,
+                isReturningNumber ? "number" : "string",
+                actions[0].GetParameter(0))
+          : functionCodeGenerator.GenerateActionsListCode(actions, context);
+
+  // Anything using the context of the function, the objects lists or code
+  // generated outside of the body can't be inlined. The scene of functions of
+  // behaviors and objects is the one of their instance, which can be
+  // different from the scene of the caller.
+  if (diagnosticReport.Count() > 0 ||
+      !context.GetObjectsListsToBeDeclared().empty() ||
+      !context.GetObjectsListsToBeEmptyIfJustDeclared().empty() ||
+      !context.GetObjectsListsToBeDeclaredEmpty().empty() ||
+      !functionCodeGenerator.GetCustomCodeOutsideMain().empty() ||
+      !functionCodeGenerator.GetCustomGlobalDeclaration().empty() ||
+      bodyCode.find("eventsFunctionContext") != gd::String::npos ||
+      bodyCode.find("EventsFunctionContext") != gd::String::npos ||
+      bodyCode.find(functionCodeGenerator.GetCodeNamespace()) !=
+          gd::String::npos ||
+      (!propertiesHolderCode.empty() &&
+       bodyCode.find("runtimeScene") != gd::String::npos) ||
+      bodyCode.size() > maxInlinedBodySize)
+    return "";
+
+  for (const gd::String& includeFile : functionCodeGenerator.GetIncludeFiles())
+    AddIncludeFile(includeFile);
+
+  if (!isExpression) return bodyCode;
+
+  // Cast the value like the return of the function would do.
+  return isReturningNumber ? "(Number(" + bodyCode + ") || 0)"
+                           : "(\"\" + (" + bodyCode + "))";
+}
+
+gd::String EventsCodeGenerator::GenerateEventsProfilingBegin(
+    std::size_t counterIndex, const gd::String& startTimeName) {
+  return "const " + startTimeName + " = gdjs.EventsProfiler.begin();\n";
+}
+
+gd::String EventsCodeGenerator::GenerateEventsProfilingEnd(
+    std::size_t counterIndex, const gd::String& startTimeName) {
+  return "gdjs.EventsProfiler.end(" + GetCodeNamespaceAccessor() +
+         "eventsProfilingCounters, " + gd::String::From(counterIndex) + ", " +
+         startTimeName + ");\n";
+}
+
+gd::String EventsCodeGenerator::GeneratePropertyHolderCode(
+    const gd::PropertiesContainer& propertiesContainer) {
+  const auto owner = propertiesContainer.GetOwner();
+  // Inlined functions use the behavior or the object they are called on.
+  if (!inlinedPropertiesHolderCode.empty() &&
+      (owner == gd::EventsFunctionsContainer::Behavior ||
+       owner == gd::EventsFunctionsContainer::Object))
+    return inlinedPropertiesHolderCode;
+
+  return owner == gd::EventsFunctionsContainer::Behavior
+             ? "eventsFunctionContext.getObjects(\"Object\")[0].getBehavior(" +
+                   GenerateGetBehaviorNameCode("Behavior") + ")"
+             : (owner == gd::EventsFunctionsContainer::Object
+                    ? "eventsFunctionContext.getObjects(\"Object\")[0]"
+                    : "eventsFunctionContext.getProperties()");
+}
+
 gd::String EventsCodeGenerator::GeneratePropertySetterWithoutCasting(
     const gd::PropertiesContainer& propertiesContainer,
     const gd::NamedPropertyDescriptor& property,
@@ -1582,13 +2440,7 @@ gd::String EventsCodeGenerator::GeneratePropertySetterWithoutCasting(
           .GetBottomMostPropertiesContainer() == &propertiesContainer;
 
   gd::String propertyHolderCode =
-      propertiesContainer.GetOwner() == gd::EventsFunctionsContainer::Behavior
-          ? "eventsFunctionContext.getObjects(\"Object\")[0].getBehavior(" +
-                GenerateGetBehaviorNameCode("Behavior") + ")"
-          : (propertiesContainer.GetOwner() ==
-                     gd::EventsFunctionsContainer::Object
-                 ? "eventsFunctionContext.getObjects(\"Object\")[0]"
-                 : "eventsFunctionContext.getProperties()");
+      GeneratePropertyHolderCode(propertiesContainer);
 
   gd::String propertySetterCode =
       propertyHolderCode + "." +
@@ -1609,13 +2461,7 @@ gd::String EventsCodeGenerator::GeneratePropertyGetterWithoutCasting(
           .GetBottomMostPropertiesContainer() == &propertiesContainer;
 
   gd::String propertyHolderCode =
-      propertiesContainer.GetOwner() == gd::EventsFunctionsContainer::Behavior
-          ? "eventsFunctionContext.getObjects(\"Object\")[0].getBehavior(" +
-                GenerateGetBehaviorNameCode("Behavior") + ")"
-          : (propertiesContainer.GetOwner() ==
-                     gd::EventsFunctionsContainer::Object
-                 ? "eventsFunctionContext.getObjects(\"Object\")[0]"
-                 : "eventsFunctionContext.getProperties()");
+      GeneratePropertyHolderCode(propertiesContainer);
 
   gd::String propertyGetterCode =
       propertyHolderCode + "." +
@@ -1671,6 +2517,10 @@ gd::String EventsCodeGenerator::GeneratePropertyGetter(
 
 gd::String EventsCodeGenerator::GenerateParameterGetterWithoutCasting(
     const gd::ParameterMetadata& parameter) {
+  auto inlinedArgumentName = inlinedArgumentsNames.find(parameter.GetName());
+  if (inlinedArgumentName != inlinedArgumentsNames.end())
+    return inlinedArgumentName->second;
+
   return "eventsFunctionContext.getArgument(" +
          ConvertToStringExplicit(parameter.GetName()) + ")";
 }
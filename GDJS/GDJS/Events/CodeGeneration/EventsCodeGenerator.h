@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -18,6 +19,7 @@ class EventsFunctionsContainer;
 class EventsFunction;
 class EventsBasedBehavior;
 class EventsBasedObject;
+class LinkEvent;
 class ObjectMetadata;
 class BehaviorMetadata;
 class InstructionMetadata;
@@ -28,6 +30,7 @@ class ParameterMetadataContainer;
 }  // namespace gd
 
 namespace gdjs {
+class LinkedEventsCodeGenerator;
 
 /**
  * \brief The class being responsible for generating JavaScript code from
@@ -45,15 +48,50 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param generateEventsProfilingCode Set this to true to measure the time
+   * spent in each event (see gdjs.EventsProfiler).
+   * \param generateCompactCode Set this to true to generate code that is
+   * smaller and faster to parse (see SetGenerateCompactCode).
+   * \param linkedEventsCodeGenerator If not null, the events linked at the
+   * root of the scene events are run by a function shared with the other
+   * links to the same events, instead of being inlined.
    *
    * \return JavaScript code
    */
-  static gd::String GenerateLayoutCode(const gd::Project& project,
-                                       const gd::Layout& scene,
-                                       const gd::String& codeNamespace,
-                                       std::set<gd::String>& includeFiles,
-                                       gd::DiagnosticReport& diagnosticReport,
-                                       bool compilationForRuntime = false);
+  static gd::String GenerateLayoutCode(
+      const gd::Project& project,
+      const gd::Layout& scene,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      gd::DiagnosticReport& diagnosticReport,
+      bool compilationForRuntime = false,
+      bool generateEventsProfilingCode = false,
+      bool generateCompactCode = false,
+      LinkedEventsCodeGenerator* linkedEventsCodeGenerator = nullptr);
+
+  /**
+   * Generate JavaScript for executing events linked from the root of the
+   * events of a scene, in a function that can be called by all the links to
+   * these events from scenes having the same objects context.
+   *
+   * \param scene The scene giving the objects context of the events.
+   * \param events The linked events.
+   * \param codeNamespace Where to store the function running the events.
+   *
+   * \return JavaScript code
+   * \see gdjs::LinkedEventsCodeGenerator
+   */
+  static gd::String GenerateLinkedEventsCode(
+      const gd::Project& project,
+      const gd::Layout& scene,
+      const gd::EventsList& events,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      gd::DiagnosticReport& diagnosticReport,
+      LinkedEventsCodeGenerator& linkedEventsCodeGenerator,
+      bool compilationForRuntime = false,
+      bool generateEventsProfilingCode = false,
+      bool generateCompactCode = false);
 
   /**
    * Generate JavaScript for executing events of an events based function.
@@ -157,6 +195,21 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       gd::EventsList& events,
       gd::EventsCodeGenerationContext& context) override;
 
+  /**
+   * \brief Generate the code of a list of events made of a single group,
+   * without the scope that the group would have as an event of the list.
+   *
+   * \param isForwardingGroupEvent Set to true if the returned code is only
+   * the call to the list of the events of the group, so that it can be used
+   * instead of a function calling it.
+   * \return The code of the group, or an empty string if the list is not made
+   * of a single group that can be generated this way.
+   */
+  gd::String GenerateForwardingGroupEventCode(
+      gd::EventsList& events,
+      gd::EventsCodeGenerationContext& context,
+      bool& isForwardingGroupEvent);
+
   /**
    * Generate code for executing a condition list
    *
@@ -170,6 +223,17 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       gd::InstructionsList& conditions,
       gd::EventsCodeGenerationContext& context) override;
 
+  /**
+   * Generate code for executing an action list.
+   *
+   * Consecutive actions run on each instance of the same object are run in a
+   * single loop over the instances (see
+   * gd::EventsCodeGenerator::GetPerInstanceInstructionObjectName).
+   */
+  virtual gd::String GenerateActionsListCode(
+      gd::InstructionsList& actions,
+      gd::EventsCodeGenerationContext& context) override;
+
   /**
    * \brief Generate the full name for accessing to a boolean variable used for
    * conditions.
@@ -200,6 +264,14 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& name,
       const gd::EventsCodeGenerationContext& context) override;
 
+  /**
+   * \brief Get the full name of the list gathering the instances picked by
+   * the sub-conditions of an "Or" condition.
+   */
+  gd::String GetOrConditionObjectListName(
+      const gd::String& name,
+      const gd::EventsCodeGenerationContext& parentContext);
+
   /**
    * \brief Get the namespace to be used to store code generated
    * objects/values/functions, with the extra "dot" at the end to be used to
@@ -217,7 +289,9 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    *
    * Example: "gdjs.something"
    */
-  virtual gd::String GetCodeNamespace() override { return codeNamespace; };
+  virtual gd::String GetCodeNamespace() override {
+    return generateCompactCode ? "$c" : codeNamespace;
+  };
 
   /**
    * \brief Specify the code namespace to use, useful for functions as it is not
@@ -229,6 +303,49 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
     codeNamespace = codeNamespace_;
   };
 
+  /**
+   * \brief Set if the generated code must be as small as possible, so that
+   * it's faster to download and parse when the game is launched.
+   *
+   * The code is then wrapped in a function where the namespace, the lists of
+   * objects and the names of objects are short local identifiers. Lists of
+   * events only calling another list of events are not generated.
+   *
+   * \note The code namespace is still filled with the functions of the code,
+   * so it can be used by the game as usual.
+   */
+  void SetGenerateCompactCode(bool enable) { generateCompactCode = enable; }
+
+  /**
+   * \brief Return true if the generated code must be as small as possible.
+   */
+  bool ShouldGenerateCompactCode() const { return generateCompactCode; }
+
+  /**
+   * \brief Return true if the link can be replaced by a call to a function
+   * running the linked events, shared with the other links to these events.
+   *
+   * This is only the case for links at the root of the events, where no
+   * objects are picked, and not chained to "Else" events.
+   */
+  bool CanCallLinkedEventsFunction(const gd::LinkEvent& linkEvent,
+                                   const gd::EventsList& eventsList,
+                                   std::size_t indexOfTheEventInThisList);
+
+  /**
+   * \brief Generate the call to the function running the linked events.
+   *
+   * \see CanCallLinkedEventsFunction
+   */
+  gd::String GenerateLinkedEventsFunctionCall(const gd::LinkEvent& linkEvent);
+
+  /**
+   * \brief Generate the code of the behavior, the object or the extension
+   * holding the properties of the given container.
+   */
+  gd::String GeneratePropertyHolderCode(
+      const gd::PropertiesContainer& propertiesContainer);
+
   virtual gd::String GeneratePropertySetterWithoutCasting(
       const gd::PropertiesContainer& propertiesContainer,
       const gd::NamedPropertyDescriptor& property,
@@ -307,6 +424,11 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& optionalAsyncCallbackName = "",
       const gd::String& optionalAsyncCallbackId = "") override;
 
+  virtual gd::String GenerateObjectsInstructionCode(
+      const std::vector<gd::String>& objectNames,
+      const std::vector<gd::String>& objectsCodes,
+      gd::EventsCodeGenerationContext& context) override;
+
   virtual gd::String GenerateGetBehaviorNameCode(
       const gd::String& behaviorName) override;
 
@@ -317,20 +439,10 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& objectName,
       bool hasChild) override;
 
-  virtual gd::String GenerateVariableAccessor(gd::String childName) override {
-    // This could be probably optimised by using `getChildNamed`.
-    return ".getChild(" + ConvertToStringExplicit(childName) + ")";
-  };
+  virtual gd::String GenerateVariableAccessor(gd::String childName) override;
 
   virtual gd::String GenerateVariableBracketAccessor(
-      gd::String expressionCode) override {
-    // This uses `getChild` which allows to access a child
-    // with a number (an index, for an array) or a string (for a structure).
-    // This could be optimised, if the type of the accessed variable AND the
-    // type of the index is known, so that `getChildAt` (for an array, with an
-    // index) or `getChildNamed` (for a structure, with a name) is used instead.
-    return ".getChild(" + expressionCode + ")";
-  };
+      gd::String expressionCode) override;
 
   virtual gd::String GenerateBadVariable() override {
     return "gdjs.VariablesContainer.badVariable";
@@ -377,6 +489,33 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   virtual gd::String GenerateProfilerSectionEnd(
       const gd::String& section) override;
 
+  /**
+   * \brief Replace the call to a small events function by its body.
+   *
+   * Expressions must only be made of an event setting the return value, and
+   * actions of an event without conditions. Functions of behaviors and objects
+   * can use the properties of the behavior or of the object, but none of the
+   * functions can use objects, variables of the extension or other functions.
+   *
+   * Arguments that are not a literal or an identifier are stored in
+   * temporaries before the body, so that they are evaluated once and in the
+   * same order as for a call. The temporaries of expressions are declared at
+   * the start of the function generated for the events list, and the ones of
+   * actions in a block around the body.
+   */
+  virtual gd::String GenerateInlinedEventsFunctionCall(
+      const gd::String& functionType,
+      const gd::ParameterMetadataContainer& parameters,
+      const std::vector<gd::String>& argumentsCode,
+      const gd::String& objectName,
+      const gd::String& behaviorName,
+      gd::EventsCodeGenerationContext& context) override;
+
+  virtual gd::String GenerateEventsProfilingBegin(
+      std::size_t counterIndex, const gd::String& startTimeName) override;
+  virtual gd::String GenerateEventsProfilingEnd(
+      std::size_t counterIndex, const gd::String& startTimeName) override;
+
   virtual gd::String GenerateRelationalOperation(
       const gd::String& relationalOperator,
       const gd::String& lhs,
@@ -475,6 +614,151 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
                              ///< used when generating events function.
 
  private:
+  /**
+   * The project containing the events functions that can be inlined, or
+   * nullptr if calls to events functions must not be inlined.
+   */
+  const gd::Project* inlinedEventsFunctionsProject = nullptr;
+
+  bool generateCompactCode = false;
+
+  /**
+   * The generator of the functions running the events linked at the root of
+   * the events, or nullptr if linked events must be inlined.
+   */
+  LinkedEventsCodeGenerator* linkedEventsCodeGenerator = nullptr;
+
+  /**
+   * The names, in `gdjs`, of the code of the linked events called by the
+   * generated code.
+   */
+  std::set<gd::String> linkedEventsCodeNames;
+
+  /**
+   * The events at the root of the generated function, once copied for the
+   * code generation.
+   */
+  const gd::EventsList* rootEvents = nullptr;
+
+  /**
+   * True when generating the code of instructions run in a single loop over
+   * the instances of their object: GenerateObjectCondition then only returns
+   * the predicate of the condition, and GenerateObjectAction the call for the
+   * current instance.
+   */
+  bool isGeneratingFusedObjectLoop = false;
+
+  /**
+   * \brief Generate the loop keeping in the objects list only the instances
+   * verifying the predicate.
+   */
+  gd::String GenerateObjectsListFilterCode(
+      const gd::String& objectListName,
+      const gd::String& predicate,
+      const gd::String& returnBoolean,
+      gd::EventsCodeGenerationContext& context);
+
+  /**
+   * \brief Generate the loop running the code for each instance of the
+   * objects list.
+   */
+  gd::String GenerateObjectsListLoopCode(const gd::String& objectListName,
+                                         const gd::String& code);
+
+  /**
+   * The minimum number of objects of a group for an instruction on the group
+   * to be generated as a loop over the lists of the objects, instead of the
+   * code of the instruction repeated for each object.
+   */
+  static constexpr std::size_t minObjectsCountForGroupLoop = 4;
+
+  /**
+   * The name of the arrays of objects lists declared for the loops over the
+   * objects of groups, by the (joined) names of the lists they contain.
+   */
+  std::map<gd::String, gd::String> objectsListsArraysNames;
+
+  /**
+   * When generating compact code, the index of the short name of the lists of
+   * each object, by object name.
+   */
+  std::map<gd::String, std::size_t> compactObjectsListsIndices;
+
+  /**
+   * When generating compact code, the names of the objects used by the code,
+   * stored in constants declared once. The index of each name is the index of
+   * its constant.
+   */
+  std::vector<gd::String> compactObjectsNames;
+
+  /**
+   * \brief Get the name of the lists of an object, without the depth.
+   */
+  gd::String GetObjectListBaseName(const gd::String& objectName);
+
+  /**
+   * \brief Get the code of the name of an object, to be used in expressions.
+   *
+   * When generating compact code, this is a constant declared once, instead
+   * of a string repeated everywhere.
+   */
+  gd::String GenerateObjectNameCode(const gd::String& objectName);
+
+  /**
+   * The types of the events functions that can't be inlined.
+   */
+  std::set<gd::String> notInlinedEventsFunctions;
+
+  /**
+   * When generating the body of an inlined function, the code of each
+   * argument (a literal, an identifier or a temporary), by parameter name.
+   */
+  std::map<gd::String, gd::String> inlinedArgumentsNames;
+
+  /**
+   * When generating the body of an inlined function of a behavior or of an
+   * object, the code of the behavior or of the object holding the properties.
+   */
+  gd::String inlinedPropertiesHolderCode;
+
+  /**
+   * The context given to the events list being generated in its own function,
+   * and the temporaries of inlined expressions to be declared at the start of
+   * this function.
+   */
+  const gd::EventsCodeGenerationContext* eventsListFunctionContext = nullptr;
+  std::vector<gd::String> eventsListFunctionTemporaries;
+
+  /**
+   * The number of temporaries used by inlined expressions, to give them
+   * unique names.
+   */
+  std::size_t inlinedTemporariesCount = 0;
+
+  /**
+   * \brief Check if the temporaries of inlined expressions can be used in the
+   * given context (i.e: it's not in an asynchronous callback generated outside
+   * of the function of the events list).
+   */
+  bool CanDeclareInlinedTemporaries(
+      const gd::EventsCodeGenerationContext& context) const;
+
+  /**
+   * \brief Generate the body of an events function to be inlined, using
+   * inlinedArgumentsNames and inlinedPropertiesHolderCode.
+   *
+   * \return The expression returned by the function (cast like the function
+   * would do) or the statements of its actions, or an empty string if the
+   * function can't be inlined.
+   */
+  gd::String GenerateInlinedEventsFunctionBody(
+      const gd::EventsFunctionsExtension& eventsFunctionsExtension,
+      const gd::EventsBasedBehavior* eventsBasedBehavior,
+      const gd::EventsBasedObject* eventsBasedObject,
+      const gd::EventsFunction& eventsFunction,
+      const std::map<gd::String, gd::String>& argumentsNames,
+      const gd::String& propertiesHolderCode);
+
   /**
    * \brief Generate the "eventsFunctionContext" object that allow a function
    * to provides access objects, object creation and access to arguments from
@@ -13,6 +13,7 @@
 #include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
 
 namespace gdjs {
+class LinkedEventsCodeGenerator;
 
 /**
  * \brief The class being responsible for generating JavaScript code for
@@ -24,7 +25,44 @@ namespace gdjs {
 class LayoutCodeGenerator {
  public:
   LayoutCodeGenerator(const gd::Project& project_)
-      : project(project_){};
+      : project(project_),
+        generateEventsProfilingCode(false),
+        generateCompactCode(false),
+        linkedEventsCodeGenerator(nullptr){};
+
+  /**
+   * \brief Set if the time spent in each event must be measured by the
+   * generated code (see gdjs.EventsProfiler).
+   */
+  LayoutCodeGenerator& SetGenerateEventsProfilingCode(bool enable) {
+    generateEventsProfilingCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the generated code must be as small as possible, to be
+   * faster to parse when the game is launched.
+   *
+   * \see gdjs::EventsCodeGenerator::SetGenerateCompactCode
+   */
+  LayoutCodeGenerator& SetGenerateCompactCode(bool enable) {
+    generateCompactCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set the generator of the functions running the events linked at
+   * the root of the scenes events, shared by all the links to the same events
+   * (instead of inlining the linked events at each link).
+   *
+   * \note The code of these functions must be exported along with the code
+   * of the scenes (see gdjs::LinkedEventsCodeGenerator::GetCode).
+   */
+  LayoutCodeGenerator& SetLinkedEventsCodeGenerator(
+      LinkedEventsCodeGenerator* linkedEventsCodeGenerator_) {
+    linkedEventsCodeGenerator = linkedEventsCodeGenerator_;
+    return *this;
+  }
 
   /**
    * \brief Generate the complete code for the events of the specified scene.
@@ -37,6 +75,9 @@ class LayoutCodeGenerator {
 
  private:
   const gd::Project& project;
+  bool generateEventsProfilingCode;
+  bool generateCompactCode;
+  LinkedEventsCodeGenerator* linkedEventsCodeGenerator;
 };
 
 }  // namespace gdjs
@@ -0,0 +1,76 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "LinkedEventsCodeGenerator.h"
+
+#include "EventsCodeGenerator.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/IDE/ContainersSignatureTools.h"
+#include "GDCore/IDE/SceneNameMangler.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+
+namespace gdjs {
+
+gd::String LinkedEventsCodeGenerator::GetLinkedEventsCodeName(
+    const gd::LinkEvent& linkEvent,
+    const gd::Layout& layout,
+    gd::DiagnosticReport& diagnosticReport) {
+  gd::String key =
+      linkEvent.GetTarget() + "\n" +
+      gd::String::From(static_cast<int>(linkEvent.GetIncludeConfig())) + "\n" +
+      linkEvent.GetEventsGroupName() + "\n" +
+      GetObjectsContextSignature(layout);
+
+  auto it = codeNames.find(key);
+  if (it != codeNames.end()) return it->second;
+
+  // Underscores of mangled names are always followed by a number, so this
+  // can't be the namespace of a scene.
+  gd::String mangledName = gd::SceneNameMangler::Get()->GetMangledSceneName(
+                               linkEvent.GetTarget()) +
+                           "_linkedEvents" +
+                           gd::String::From(codeNames.size()) + "Code";
+  gd::String codeNamespace = "gdjs." + mangledName;
+  // Register the name before generating the code, in case the linked events
+  // are linking themselves.
+  codeNames[key] = mangledName;
+
+  const gd::EventsList* linkedEvents = linkEvent.GetLinkedEvents(project);
+  if (!linkedEvents) return mangledName;
+
+  code += EventsCodeGenerator::GenerateLinkedEventsCode(
+      project,
+      layout,
+      *linkedEvents,
+      codeNamespace,
+      includeFiles,
+      diagnosticReport,
+      *this,
+      compilationForRuntime,
+      generateEventsProfilingCode,
+      generateCompactCode);
+
+  // Export the symbols to avoid them being stripped by the Closure Compiler:
+  code += "\ngdjs['" + mangledName + "'] = " + codeNamespace + ";\n";
+
+  return mangledName;
+}
+
+const gd::String& LinkedEventsCodeGenerator::GetObjectsContextSignature(
+    const gd::Layout& layout) {
+  auto it = objectsContextSignatures.find(&layout);
+  if (it != objectsContextSignatures.end()) return it->second;
+
+  gd::String signature;
+  gd::ContainersSignatureTools::AddObjectsSignature(layout.GetObjects(),
+                                                    signature);
+  gd::ContainersSignatureTools::AddVariablesSignature(layout.GetVariables(),
+                                                      signature);
+
+  return objectsContextSignatures[&layout] = signature;
+}
+
+}  // namespace gdjs
@@ -0,0 +1,118 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <set>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class DiagnosticReport;
+class Layout;
+class LinkEvent;
+class Project;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Generate the code of the events linked at the root of the events of
+ * scenes (usually external events) in functions shared by the links, instead
+ * of inlining the linked events at each link.
+ *
+ * A function is generated for each target of the links and for each objects
+ * context: scenes having the same objects, groups and variables share the
+ * same function, while others get their own function.
+ *
+ * \see gdjs::LayoutCodeGenerator::SetLinkedEventsCodeGenerator
+ */
+class LinkedEventsCodeGenerator {
+ public:
+  LinkedEventsCodeGenerator(const gd::Project& project_)
+      : project(project_),
+        generateEventsProfilingCode(false),
+        generateCompactCode(false),
+        compilationForRuntime(false){};
+
+  /**
+   * \brief Set if the time spent in each event must be measured by the
+   * generated code (see gdjs.EventsProfiler).
+   */
+  LinkedEventsCodeGenerator& SetGenerateEventsProfilingCode(bool enable) {
+    generateEventsProfilingCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the generated code must be as small as possible.
+   *
+   * \see gdjs::EventsCodeGenerator::SetGenerateCompactCode
+   */
+  LinkedEventsCodeGenerator& SetGenerateCompactCode(bool enable) {
+    generateCompactCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the code is generated for the runtime (and not for a
+   * preview).
+   */
+  LinkedEventsCodeGenerator& SetCompilationForRuntime(bool enable) {
+    compilationForRuntime = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Return the name, in `gdjs`, of the code running the events of the
+   * link, when the link is at the root of the events of the layout.
+   *
+   * The code is generated the first time a link to the same events is found
+   * in a layout having the same objects context.
+   */
+  gd::String GetLinkedEventsCodeName(
+      const gd::LinkEvent& linkEvent,
+      const gd::Layout& layout,
+      gd::DiagnosticReport& diagnosticReport);
+
+  /**
+   * \brief Return the code of all the functions generated so far.
+   */
+  const gd::String& GetCode() const { return code; }
+
+  /**
+   * \brief Return the files needed by the code of the functions.
+   */
+  const std::set<gd::String>& GetIncludeFiles() const { return includeFiles; }
+
+  /**
+   * \brief Return the number of functions generated so far.
+   */
+  std::size_t GetFunctionsCount() const { return codeNames.size(); }
+
+ private:
+  /**
+   * \brief Return a string identifying everything in the layout that can
+   * change the code generated for events: its objects (with their behaviors
+   * and variables), its groups and its variables.
+   */
+  const gd::String& GetObjectsContextSignature(const gd::Layout& layout);
+
+  const gd::Project& project;
+  bool generateEventsProfilingCode;
+  bool generateCompactCode;
+  bool compilationForRuntime;
+
+  std::map<gd::String, gd::String>
+      codeNames;  ///< The name of the code of each generated function, by
+                  ///< linked events and objects context.
+  std::map<const gd::Layout*, gd::String>
+      objectsContextSignatures;  ///< The signature of each layout.
+  gd::String code;
+  std::set<gd::String> includeFiles;
+};
+
+}  // namespace gdjs
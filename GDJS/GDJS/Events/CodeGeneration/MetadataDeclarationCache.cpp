@@ -0,0 +1,366 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2023 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "MetadataDeclarationCache.h"
+
+#include <functional>
+#include <utility>
+
+#include "GDCore/Extensions/Metadata/DependencyMetadata.h"
+#include "GDCore/Extensions/Metadata/MultipleInstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/SourceFileMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsContainer.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDJS/Events/CodeGeneration/MetadataDeclarationHelper.h"
+
+namespace gdjs {
+
+namespace {
+
+std::size_t GetHash(const gd::SerializerElement &element) {
+  return std::hash<gd::String>()(gd::Serializer::ToJSON(element));
+}
+
+void SerializeEventsFunctionDeclaration(
+    const gd::EventsFunctionsContainer &eventsFunctionsContainer,
+    const gd::EventsFunction &eventsFunction, gd::SerializerElement &element) {
+  element.SetAttribute("name", eventsFunction.GetName());
+  element.SetAttribute("fullName", eventsFunction.GetFullName());
+  element.SetAttribute("description", eventsFunction.GetDescription());
+  element.SetAttribute("sentence", eventsFunction.GetSentence());
+  element.SetAttribute("group", eventsFunction.GetGroup());
+  element.SetAttribute("getterName", eventsFunction.GetGetterName());
+  element.SetAttribute("helpUrl", eventsFunction.GetHelpUrl());
+  element.SetAttribute("functionType",
+                       static_cast<int>(eventsFunction.GetFunctionType()));
+  element.SetAttribute("private", eventsFunction.IsPrivate());
+  element.SetAttribute("async", eventsFunction.IsAsync());
+  element.SetAttribute("deprecated", eventsFunction.IsDeprecated());
+  element.SetAttribute("deprecationMessage",
+                       eventsFunction.GetDeprecationMessage());
+  eventsFunction.GetExpressionType().SerializeTo(
+      element.AddChild("expressionType"));
+  eventsFunction.GetParameters().SerializeParametersTo(
+      element.AddChild("parameters"));
+
+  // An action with an operator is declared using its getter.
+  if (eventsFunction.GetFunctionType() ==
+          gd::EventsFunction::ActionWithOperator &&
+      eventsFunctionsContainer.HasEventsFunctionNamed(
+          eventsFunction.GetGetterName())) {
+    const gd::EventsFunction &getterFunction =
+        eventsFunctionsContainer.GetEventsFunction(
+            eventsFunction.GetGetterName());
+    if (&getterFunction != &eventsFunction) {
+      SerializeEventsFunctionDeclaration(eventsFunctionsContainer,
+                                         getterFunction,
+                                         element.AddChild("getter"));
+    }
+  }
+}
+
+void SerializeEventsFunctionsDeclaration(
+    const gd::EventsFunctionsContainer &eventsFunctionsContainer,
+    gd::SerializerElement &element) {
+  element.ConsiderAsArrayOf("eventsFunction");
+  for (std::size_t i = 0;
+       i < eventsFunctionsContainer.GetEventsFunctionsCount(); ++i) {
+    SerializeEventsFunctionDeclaration(
+        eventsFunctionsContainer,
+        eventsFunctionsContainer.GetEventsFunction(i),
+        element.AddChild("eventsFunction"));
+  }
+}
+
+}  // namespace
+
+std::size_t MetadataDeclarationCache::GetExtensionHash(
+    const gd::EventsFunctionsExtension &eventsFunctionsExtension) {
+  gd::SerializerElement element;
+  element.SetAttribute("name", eventsFunctionsExtension.GetName());
+  element.SetAttribute("fullName", eventsFunctionsExtension.GetFullName());
+  element.SetAttribute("description",
+                       eventsFunctionsExtension.GetDescription());
+  element.SetAttribute("shortDescription",
+                       eventsFunctionsExtension.GetShortDescription());
+  element.SetAttribute("author", eventsFunctionsExtension.GetAuthor());
+  element.SetAttribute("helpPath", eventsFunctionsExtension.GetHelpPath());
+  element.SetAttribute("iconUrl", eventsFunctionsExtension.GetIconUrl());
+  element.SetAttribute("dimension", eventsFunctionsExtension.GetDimension());
+  element.SetAttribute("category", eventsFunctionsExtension.GetCategory());
+
+  gd::SerializerElement &tagsElement = element.AddChild("tags");
+  tagsElement.ConsiderAsArrayOf("tag");
+  for (const gd::String &tag : eventsFunctionsExtension.GetTags())
+    tagsElement.AddChild("tag").SetStringValue(tag);
+
+  gd::SerializerElement &dependenciesElement =
+      element.AddChild("dependencies");
+  dependenciesElement.ConsiderAsArrayOf("dependency");
+  for (const gd::DependencyMetadata &dependency :
+       eventsFunctionsExtension.GetAllDependencies()) {
+    gd::SerializerElement &dependencyElement =
+        dependenciesElement.AddChild("dependency");
+    dependencyElement.SetAttribute("name", dependency.GetName());
+    dependencyElement.SetAttribute("exportName", dependency.GetExportName());
+    dependencyElement.SetAttribute("version", dependency.GetVersion());
+    dependencyElement.SetAttribute("type", dependency.GetDependencyType());
+    dependencyElement.SetAttribute(
+        "onlyIfOtherDependencyIsExported",
+        dependency.GetOtherDependencyThatMustBeExported());
+    dependencyElement.SetAttribute(
+        "onlyIfSomeExtraSettingsNonEmpty",
+        dependency.IsOnlyIfSomeExtraSettingsNonEmpty());
+    gd::SerializerElement &extraSettingsElement =
+        dependencyElement.AddChild("extraSettings");
+    for (const auto &extraSetting : dependency.GetAllExtraSettings()) {
+      extraSettingsElement.AddChild(extraSetting.first)
+          .SetStringValue(extraSetting.second.GetValue());
+    }
+  }
+
+  gd::SerializerElement &sourceFilesElement = element.AddChild("sourceFiles");
+  sourceFilesElement.ConsiderAsArrayOf("sourceFile");
+  for (const gd::SourceFileMetadata &sourceFile :
+       eventsFunctionsExtension.GetAllSourceFiles()) {
+    sourceFile.SerializeTo(sourceFilesElement.AddChild("sourceFile"));
+  }
+
+  return GetHash(element);
+}
+
+std::size_t MetadataDeclarationCache::GetEventsFunctionHash(
+    const gd::EventsFunctionsContainer &eventsFunctionsContainer,
+    const gd::EventsFunction &eventsFunction) {
+  gd::SerializerElement element;
+  SerializeEventsFunctionDeclaration(eventsFunctionsContainer, eventsFunction,
+                                     element);
+  return GetHash(element);
+}
+
+std::size_t MetadataDeclarationCache::GetEventsBasedBehaviorHash(
+    const gd::EventsBasedBehavior &eventsBasedBehavior) {
+  gd::SerializerElement element;
+  element.SetAttribute("name", eventsBasedBehavior.GetName());
+  element.SetAttribute("fullName", eventsBasedBehavior.GetFullName());
+  element.SetAttribute("description", eventsBasedBehavior.GetDescription());
+  element.SetAttribute("iconUrl", eventsBasedBehavior.GetIconUrl());
+  element.SetAttribute("objectType", eventsBasedBehavior.GetObjectType());
+  element.SetAttribute("private", eventsBasedBehavior.IsPrivate());
+  element.SetAttribute(
+      "quickCustomizationVisibility",
+      static_cast<int>(eventsBasedBehavior.GetQuickCustomizationVisibility()));
+  eventsBasedBehavior.GetPropertyDescriptors().SerializeElementsTo(
+      "propertyDescriptor", element.AddChild("propertyDescriptors"));
+  eventsBasedBehavior.GetSharedPropertyDescriptors().SerializeElementsTo(
+      "propertyDescriptor", element.AddChild("sharedPropertyDescriptors"));
+  SerializeEventsFunctionsDeclaration(eventsBasedBehavior.GetEventsFunctions(),
+                                      element.AddChild("eventsFunctions"));
+
+  return GetHash(element);
+}
+
+std::size_t MetadataDeclarationCache::GetEventsBasedObjectHash(
+    const gd::EventsBasedObject &eventsBasedObject) {
+  gd::SerializerElement element;
+  element.SetAttribute("name", eventsBasedObject.GetName());
+  element.SetAttribute("fullName", eventsBasedObject.GetFullName());
+  element.SetAttribute("description", eventsBasedObject.GetDescription());
+  element.SetAttribute("iconUrl", eventsBasedObject.GetIconUrl());
+  element.SetAttribute("assetStoreTag", eventsBasedObject.GetAssetStoreTag());
+  element.SetAttribute("private", eventsBasedObject.IsPrivate());
+  element.SetAttribute("isRenderedIn3D", eventsBasedObject.IsRenderedIn3D());
+  element.SetAttribute("isAnimatable", eventsBasedObject.IsAnimatable());
+  element.SetAttribute("isTextContainer", eventsBasedObject.IsTextContainer());
+  element.SetAttribute("isInnerAreaFollowingParentSize",
+                       eventsBasedObject.IsInnerAreaFollowingParentSize());
+  eventsBasedObject.GetPropertyDescriptors().SerializeElementsTo(
+      "propertyDescriptor", element.AddChild("propertyDescriptors"));
+  SerializeEventsFunctionsDeclaration(eventsBasedObject.GetEventsFunctions(),
+                                      element.AddChild("eventsFunctions"));
+
+  return GetHash(element);
+}
+
+const std::map<gd::String, gd::String> &
+MetadataDeclarationCache::FindMangledNames(
+    const std::map<gd::String, std::map<gd::String, gd::String>>
+        &mangledNamesByName,
+    const gd::String &name) {
+  static const std::map<gd::String, gd::String> badMangledNames;
+
+  auto it = mangledNamesByName.find(name);
+  return it != mangledNamesByName.end() ? it->second : badMangledNames;
+}
+
+const std::map<gd::String, gd::String> &
+MetadataDeclarationCache::GetBehaviorMethodMangledNames(
+    const gd::String &extensionName, const gd::String &behaviorName) const {
+  static const std::map<gd::String, std::map<gd::String, gd::String>>
+      noMangledNames;
+
+  auto extensionHashesIt = extensionsHashes.find(extensionName);
+  return FindMangledNames(extensionHashesIt != extensionsHashes.end()
+                              ? extensionHashesIt->second
+                                    .behaviorMethodMangledNames
+                              : noMangledNames,
+                          behaviorName);
+}
+
+const std::map<gd::String, gd::String> &
+MetadataDeclarationCache::GetObjectMethodMangledNames(
+    const gd::String &extensionName, const gd::String &objectName) const {
+  static const std::map<gd::String, std::map<gd::String, gd::String>>
+      noMangledNames;
+
+  auto extensionHashesIt = extensionsHashes.find(extensionName);
+  return FindMangledNames(
+      extensionHashesIt != extensionsHashes.end()
+          ? extensionHashesIt->second.objectMethodMangledNames
+          : noMangledNames,
+      objectName);
+}
+
+void MetadataDeclarationCache::RemoveFreeFunctionMetadata(
+    gd::PlatformExtension &extension, const gd::String &functionName) {
+  const gd::String type = extension.GetNameSpace() + functionName;
+  extension.GetAllActions().erase(type);
+  extension.GetAllConditions().erase(type);
+  extension.GetAllExpressions().erase(type);
+  extension.GetAllStrExpressions().erase(type);
+}
+
+void MetadataDeclarationCache::DeclareExtension(
+    gd::Project &project, gd::PlatformExtension &extension,
+    const gd::EventsFunctionsExtension &eventsFunctionsExtension) {
+  lastDeclaredFreeFunctions.clear();
+  lastDeclaredEventsBasedBehaviors.clear();
+  lastDeclaredEventsBasedObjects.clear();
+
+  const std::size_t extensionHash = GetExtensionHash(eventsFunctionsExtension);
+  auto extensionHashesIt =
+      extensionsHashes.find(eventsFunctionsExtension.GetName());
+  wasLastExtensionFullyDeclared =
+      extensionHashesIt == extensionsHashes.end() ||
+      extensionHashesIt->second.extensionHash != extensionHash ||
+      extensionHashesIt->second.project != &project ||
+      extensionHashesIt->second.projectUuid != project.GetProjectUuid() ||
+      extensionHashesIt->second.locale != locale;
+  if (wasLastExtensionFullyDeclared) {
+    // Everything is declared using the extension information (namespace,
+    // icon...) so the extension is declared from scratch. This is also done
+    // for another project, as the metadata of behaviors and objects refer to
+    // it, and for another locale, as the metadata is translated.
+    extension = gd::PlatformExtension();
+    MetadataDeclarationHelper::DeclareExtension(extension,
+                                                eventsFunctionsExtension);
+
+    extensionsHashes.erase(eventsFunctionsExtension.GetName());
+  }
+  ExtensionHashes &previousHashes =
+      extensionsHashes[eventsFunctionsExtension.GetName()];
+  ExtensionHashes hashes;
+  hashes.project = &project;
+  hashes.projectUuid = project.GetProjectUuid();
+  hashes.locale = locale;
+  hashes.extensionHash = extensionHash;
+
+  const auto &eventsBasedBehaviors =
+      eventsFunctionsExtension.GetEventsBasedBehaviors();
+  for (std::size_t i = 0; i < eventsBasedBehaviors.GetCount(); ++i) {
+    const gd::EventsBasedBehavior &eventsBasedBehavior =
+        eventsBasedBehaviors.Get(i);
+    const gd::String &name = eventsBasedBehavior.GetName();
+    const std::size_t hash = GetEventsBasedBehaviorHash(eventsBasedBehavior);
+    hashes.eventsBasedBehaviorHashes[name] = hash;
+
+    auto previousHashIt = previousHashes.eventsBasedBehaviorHashes.find(name);
+    if (previousHashIt != previousHashes.eventsBasedBehaviorHashes.end() &&
+        previousHashIt->second == hash) {
+      hashes.behaviorMethodMangledNames[name] =
+          std::move(previousHashes.behaviorMethodMangledNames[name]);
+      continue;
+    }
+
+    MetadataDeclarationHelper::GenerateBehaviorMetadata(
+        project, extension, eventsFunctionsExtension, eventsBasedBehavior,
+        hashes.behaviorMethodMangledNames[name]);
+    lastDeclaredEventsBasedBehaviors.push_back(name);
+  }
+  for (const auto &previousHash : previousHashes.eventsBasedBehaviorHashes) {
+    if (hashes.eventsBasedBehaviorHashes.find(previousHash.first) ==
+        hashes.eventsBasedBehaviorHashes.end())
+      extension.RemoveBehavior(extension.GetNameSpace() + previousHash.first);
+  }
+
+  const auto &eventsBasedObjects =
+      eventsFunctionsExtension.GetEventsBasedObjects();
+  for (std::size_t i = 0; i < eventsBasedObjects.GetCount(); ++i) {
+    const gd::EventsBasedObject &eventsBasedObject = eventsBasedObjects.Get(i);
+    const gd::String &name = eventsBasedObject.GetName();
+    const std::size_t hash = GetEventsBasedObjectHash(eventsBasedObject);
+    hashes.eventsBasedObjectHashes[name] = hash;
+
+    auto previousHashIt = previousHashes.eventsBasedObjectHashes.find(name);
+    if (previousHashIt != previousHashes.eventsBasedObjectHashes.end() &&
+        previousHashIt->second == hash) {
+      hashes.objectMethodMangledNames[name] =
+          std::move(previousHashes.objectMethodMangledNames[name]);
+      continue;
+    }
+
+    MetadataDeclarationHelper::GenerateObjectMetadata(
+        project, extension, eventsFunctionsExtension, eventsBasedObject,
+        hashes.objectMethodMangledNames[name]);
+    lastDeclaredEventsBasedObjects.push_back(name);
+  }
+  for (const auto &previousHash : previousHashes.eventsBasedObjectHashes) {
+    if (hashes.eventsBasedObjectHashes.find(previousHash.first) ==
+        hashes.eventsBasedObjectHashes.end())
+      extension.RemoveObject(extension.GetNameSpace() + previousHash.first);
+  }
+
+  MetadataDeclarationHelper metadataDeclarationHelper;
+  const auto &freeEventsFunctions =
+      eventsFunctionsExtension.GetEventsFunctions();
+  for (std::size_t i = 0; i < freeEventsFunctions.GetEventsFunctionsCount();
+       ++i) {
+    const gd::EventsFunction &eventsFunction =
+        freeEventsFunctions.GetEventsFunction(i);
+    const gd::String &name = eventsFunction.GetName();
+    const std::size_t hash =
+        GetEventsFunctionHash(freeEventsFunctions, eventsFunction);
+    hashes.freeFunctionHashes[name] = hash;
+
+    auto previousHashIt = previousHashes.freeFunctionHashes.find(name);
+    if (previousHashIt != previousHashes.freeFunctionHashes.end()) {
+      if (previousHashIt->second == hash) continue;
+
+      // The function type may have changed (for example from an action to a
+      // condition): remove what was declared before.
+      RemoveFreeFunctionMetadata(extension, name);
+    }
+
+    metadataDeclarationHelper.GenerateFreeFunctionMetadata(
+        project, extension, eventsFunctionsExtension, eventsFunction);
+    lastDeclaredFreeFunctions.push_back(name);
+  }
+  for (const auto &previousHash : previousHashes.freeFunctionHashes) {
+    if (hashes.freeFunctionHashes.find(previousHash.first) ==
+        hashes.freeFunctionHashes.end())
+      RemoveFreeFunctionMetadata(extension, previousHash.first);
+  }
+
+  previousHashes = std::move(hashes);
+}
+
+}  // namespace gdjs
@@ -0,0 +1,205 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2023 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class PlatformExtension;
+class Project;
+class EventsFunctionsExtension;
+class EventsBasedBehavior;
+class EventsBasedObject;
+class EventsFunction;
+class EventsFunctionsContainer;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Declare the metadata of events functions extensions, only
+ * re-declaring what changed since the previous declaration.
+ *
+ * A content hash is kept for every free function, events-based behavior and
+ * events-based object of each declared extension. When an extension is
+ * declared again, only the functions, behaviors and objects with a different
+ * hash are re-declared (the metadata of a behavior or an object, with its
+ * properties and functions, is always re-declared as a whole). The ones that
+ * were removed from the extension are removed from the metadata.
+ *
+ * If the information of the extension itself (name, icon, dependencies...)
+ * changed, the whole extension is declared again from scratch, as every
+ * instruction depends on it. This is also the case if the extension is
+ * declared for another project (the metadata of behaviors and objects keep a
+ * reference to the project) or for another locale (the metadata contains
+ * translated strings).
+ *
+ * \see gdjs::MetadataDeclarationHelper
+ * \ingroup IDE
+ */
+class MetadataDeclarationCache {
+ public:
+  MetadataDeclarationCache(){};
+  virtual ~MetadataDeclarationCache(){};
+
+  /**
+   * \brief Declare the metadata of the events functions extension in \a
+   * extension.
+   *
+   * \a extension must be the platform extension used for the previous
+   * declaration of this events functions extension (or a new one if it was
+   * never declared or was forgotten).
+   */
+  void DeclareExtension(
+      gd::Project &project, gd::PlatformExtension &extension,
+      const gd::EventsFunctionsExtension &eventsFunctionsExtension);
+
+  /**
+   * \brief Set the locale used to translate the declared metadata.
+   *
+   * Extensions declared with another locale are declared again from scratch.
+   */
+  void SetLocale(const gd::String &locale_) { locale = locale_; };
+
+  /**
+   * \brief Return the locale used to translate the declared metadata.
+   */
+  const gd::String &GetLocale() const { return locale; };
+
+  /**
+   * \brief Forget the hashes of an extension, so that the next declaration
+   * declares everything again.
+   */
+  void ForgetExtension(const gd::String &extensionName) {
+    extensionsHashes.erase(extensionName);
+  };
+
+  /**
+   * \brief Forget the hashes of all the extensions.
+   */
+  void Clear() { extensionsHashes.clear(); };
+
+  /**
+   * \brief Return the names of the free functions that were (re)declared by
+   * the last call to DeclareExtension.
+   */
+  const std::vector<gd::String> &GetLastDeclaredFreeFunctions() const {
+    return lastDeclaredFreeFunctions;
+  };
+
+  /**
+   * \brief Return the names of the events-based behaviors that were
+   * (re)declared by the last call to DeclareExtension.
+   */
+  const std::vector<gd::String> &GetLastDeclaredEventsBasedBehaviors() const {
+    return lastDeclaredEventsBasedBehaviors;
+  };
+
+  /**
+   * \brief Return the names of the events-based objects that were
+   * (re)declared by the last call to DeclareExtension.
+   */
+  const std::vector<gd::String> &GetLastDeclaredEventsBasedObjects() const {
+    return lastDeclaredEventsBasedObjects;
+  };
+
+  /**
+   * \brief Return true if the last call to DeclareExtension declared the
+   * extension from scratch.
+   */
+  bool WasLastExtensionFullyDeclared() const {
+    return wasLastExtensionFullyDeclared;
+  };
+
+  /**
+   * \brief Return the mangled names of the methods of an events-based
+   * behavior, as filled when its metadata was last declared.
+   *
+   * This is needed to generate the code of the behavior, even when its
+   * metadata was not declared again.
+   */
+  const std::map<gd::String, gd::String> &GetBehaviorMethodMangledNames(
+      const gd::String &extensionName, const gd::String &behaviorName) const;
+
+  /**
+   * \brief Return the mangled names of the methods of an events-based
+   * object, as filled when its metadata was last declared.
+   *
+   * This is needed to generate the code of the object, even when its
+   * metadata was not declared again.
+   */
+  const std::map<gd::String, gd::String> &GetObjectMethodMangledNames(
+      const gd::String &extensionName, const gd::String &objectName) const;
+
+  /**
+   * \brief Compute a hash of everything used to declare the extension
+   * information, excluding its functions, behaviors and objects.
+   */
+  static std::size_t GetExtensionHash(
+      const gd::EventsFunctionsExtension &eventsFunctionsExtension);
+
+  /**
+   * \brief Compute a hash of everything used to declare the instruction or
+   * expression of an events function (the events are not part of it).
+   */
+  static std::size_t GetEventsFunctionHash(
+      const gd::EventsFunctionsContainer &eventsFunctionsContainer,
+      const gd::EventsFunction &eventsFunction);
+
+  /**
+   * \brief Compute a hash of everything used to declare an events-based
+   * behavior, including its properties and functions.
+   */
+  static std::size_t
+  GetEventsBasedBehaviorHash(const gd::EventsBasedBehavior &eventsBasedBehavior);
+
+  /**
+   * \brief Compute a hash of everything used to declare an events-based
+   * object, including its properties and functions.
+   */
+  static std::size_t
+  GetEventsBasedObjectHash(const gd::EventsBasedObject &eventsBasedObject);
+
+private:
+  struct ExtensionHashes {
+    const gd::Project *project = nullptr;
+    gd::String projectUuid;
+    gd::String locale;
+    std::size_t extensionHash = 0;
+    std::map<gd::String, std::size_t> freeFunctionHashes;
+    std::map<gd::String, std::size_t> eventsBasedBehaviorHashes;
+    std::map<gd::String, std::size_t> eventsBasedObjectHashes;
+    std::map<gd::String, std::map<gd::String, gd::String>>
+        behaviorMethodMangledNames;
+    std::map<gd::String, std::map<gd::String, gd::String>>
+        objectMethodMangledNames;
+  };
+
+  static const std::map<gd::String, gd::String> &FindMangledNames(
+      const std::map<gd::String, std::map<gd::String, gd::String>>
+          &mangledNamesByName,
+      const gd::String &name);
+
+  /**
+   * Remove the instructions and expressions declared for a free function.
+   */
+  static void RemoveFreeFunctionMetadata(gd::PlatformExtension &extension,
+                                         const gd::String &functionName);
+
+  std::map<gd::String, ExtensionHashes> extensionsHashes;
+  gd::String locale;
+
+  std::vector<gd::String> lastDeclaredFreeFunctions;
+  std::vector<gd::String> lastDeclaredEventsBasedBehaviors;
+  std::vector<gd::String> lastDeclaredEventsBasedObjects;
+  bool wasLastExtensionFullyDeclared = false;
+};
+
+}  // namespace gdjs
@@ -17,8 +17,12 @@ namespace gdjs {
 AdvancedExtension::AdvancedExtension() {
   gd::BuiltinExtensionsImplementer::ImplementsAdvancedExtension(*this);
 
-  GetAllActions()["SetReturnNumber"]
-      .SetCustomCodeGenerator([](gd::Instruction& instruction,
+  BindCodeGenerators(*this);
+}
+
+void AdvancedExtension::BindCodeGenerators(gd::PlatformExtension &extension) {
+  extension.GetAllActions()["SetReturnNumber"]
+      .SetCustomCodeGenerator([](const gd::Instruction& instruction,
                                  gd::EventsCodeGenerator& codeGenerator,
                                  gd::EventsCodeGenerationContext& context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -34,8 +38,8 @@ AdvancedExtension::AdvancedExtension() {
         return "eventsFunctionContext.returnValue = " + expressionCode + ";";
       });
 
-  GetAllActions()["SetReturnString"]
-      .SetCustomCodeGenerator([](gd::Instruction& instruction,
+  extension.GetAllActions()["SetReturnString"]
+      .SetCustomCodeGenerator([](const gd::Instruction& instruction,
                                  gd::EventsCodeGenerator& codeGenerator,
                                  gd::EventsCodeGenerationContext& context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -51,8 +55,8 @@ AdvancedExtension::AdvancedExtension() {
         return "eventsFunctionContext.returnValue = " + expressionCode + ";";
       });
 
-  GetAllActions()["SetReturnBoolean"]
-      .SetCustomCodeGenerator([](gd::Instruction& instruction,
+  extension.GetAllActions()["SetReturnBoolean"]
+      .SetCustomCodeGenerator([](const gd::Instruction& instruction,
                                  gd::EventsCodeGenerator& codeGenerator,
                                  gd::EventsCodeGenerationContext& context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -67,8 +71,8 @@ AdvancedExtension::AdvancedExtension() {
         return "eventsFunctionContext.returnValue = " + booleanCode + ";";
       });
 
-  GetAllActions()["CopyArgumentToVariable"]
-      .SetCustomCodeGenerator([](gd::Instruction &instruction,
+  extension.GetAllActions()["CopyArgumentToVariable"]
+      .SetCustomCodeGenerator([](const gd::Instruction &instruction,
                                  gd::EventsCodeGenerator &codeGenerator,
                                  gd::EventsCodeGenerationContext &context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -85,8 +89,8 @@ AdvancedExtension::AdvancedExtension() {
                parameter + "), " + variable + ", false);\n";
       });
 
-  GetAllActions()["CopyArgumentToVariable2"]
-      .SetCustomCodeGenerator([](gd::Instruction &instruction,
+  extension.GetAllActions()["CopyArgumentToVariable2"]
+      .SetCustomCodeGenerator([](const gd::Instruction &instruction,
                                  gd::EventsCodeGenerator &codeGenerator,
                                  gd::EventsCodeGenerationContext &context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -103,8 +107,8 @@ AdvancedExtension::AdvancedExtension() {
                parameter + "), " + variable + ", false);\n";
       });
 
-  GetAllActions()["CopyVariableToArgument"]
-      .SetCustomCodeGenerator([](gd::Instruction &instruction,
+  extension.GetAllActions()["CopyVariableToArgument"]
+      .SetCustomCodeGenerator([](const gd::Instruction &instruction,
                                  gd::EventsCodeGenerator &codeGenerator,
                                  gd::EventsCodeGenerationContext &context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -122,8 +126,8 @@ AdvancedExtension::AdvancedExtension() {
                "), false);\n";
       });
 
-  GetAllActions()["CopyVariableToArgument2"]
-      .SetCustomCodeGenerator([](gd::Instruction &instruction,
+  extension.GetAllActions()["CopyVariableToArgument2"]
+      .SetCustomCodeGenerator([](const gd::Instruction &instruction,
                                  gd::EventsCodeGenerator &codeGenerator,
                                  gd::EventsCodeGenerationContext &context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -141,8 +145,8 @@ AdvancedExtension::AdvancedExtension() {
                "), false);\n";
       });
 
-  GetAllConditions()["GetArgumentAsBoolean"]
-      .SetCustomCodeGenerator([](gd::Instruction& instruction,
+  extension.GetAllConditions()["GetArgumentAsBoolean"]
+      .SetCustomCodeGenerator([](const gd::Instruction& instruction,
                                  gd::EventsCodeGenerator& codeGenerator,
                                  gd::EventsCodeGenerationContext& context) {
         if (codeGenerator.HasProjectAndLayout()) {
@@ -163,7 +167,7 @@ AdvancedExtension::AdvancedExtension() {
         return outputCode;
       });
 
-  GetAllExpressions()["GetArgumentAsNumber"]
+  extension.GetAllExpressions()["GetArgumentAsNumber"]
       .GetCodeExtraInformation()
       .SetCustomCodeGenerator([](const std::vector<gd::Expression>& parameters,
                                  gd::EventsCodeGenerator& codeGenerator,
@@ -182,7 +186,7 @@ AdvancedExtension::AdvancedExtension() {
                ")) || 0)";
       });
 
-  GetAllStrExpressions()["GetArgumentAsString"]
+  extension.GetAllStrExpressions()["GetArgumentAsString"]
       .GetCodeExtraInformation()
       .SetCustomCodeGenerator([](const std::vector<gd::Expression>& parameters,
                                  gd::EventsCodeGenerator& codeGenerator,
@@ -201,8 +205,8 @@ AdvancedExtension::AdvancedExtension() {
                ")";
       });
 
-  GetAllConditions()["CompareArgumentAsNumber"]
-      .SetCustomCodeGenerator([](gd::Instruction &instruction,
+  extension.GetAllConditions()["CompareArgumentAsNumber"]
+      .SetCustomCodeGenerator([](const gd::Instruction &instruction,
                                  gd::EventsCodeGenerator &codeGenerator,
                                  gd::EventsCodeGenerationContext &context) {
         gd::String parameterNameCode =
@@ -232,8 +236,8 @@ AdvancedExtension::AdvancedExtension() {
                ");\n";
       });
 
-  GetAllConditions()["CompareArgumentAsString"]
-      .SetCustomCodeGenerator([](gd::Instruction &instruction,
+  extension.GetAllConditions()["CompareArgumentAsString"]
+      .SetCustomCodeGenerator([](const gd::Instruction &instruction,
                                  gd::EventsCodeGenerator &codeGenerator,
                                  gd::EventsCodeGenerationContext &context) {
         gd::String parameterNameCode =
@@ -18,6 +18,14 @@ class AdvancedExtension : public gd::PlatformExtension {
  public:
   AdvancedExtension();
   virtual ~AdvancedExtension(){};
+
+  /**
+   * \brief Set the code generators of the instructions and expressions
+   * reading or returning the arguments of events functions.
+   *
+   * \see gd::ExtensionBindingsRegistry
+   */
+  static void BindCodeGenerators(gd::PlatformExtension &extension);
 };
 
 }  // namespace gdjs
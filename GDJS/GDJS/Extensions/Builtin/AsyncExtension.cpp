@@ -15,7 +15,14 @@ namespace gdjs {
 AsyncExtension::AsyncExtension() {
   gd::BuiltinExtensionsImplementer::ImplementsAsyncExtension(*this);
 
-  GetAllEvents()["BuiltinAsync::Async"].SetCodeGenerator(
+  GetAllActions()["BuiltinAsync::ResolveAsyncEventsFunction"].SetFunctionName(
+      "gdjs.evtTools.common.resolveAsyncEventsFunction");
+
+  BindCodeGenerators(*this);
+}
+
+void AsyncExtension::BindCodeGenerators(gd::PlatformExtension &extension) {
+  extension.GetAllEvents()["BuiltinAsync::Async"].SetCodeGenerator(
       [](gd::BaseEvent &event_,
          gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &parentContext) {
@@ -78,9 +85,6 @@ AsyncExtension::AsyncExtension() {
         return "{\n" + parentAsyncObjectsListGetter + "{\n" +
                asyncContextBuilder + asyncActionCode + "}\n" + "}\n";
       });
-
-  GetAllActions()["BuiltinAsync::ResolveAsyncEventsFunction"].SetFunctionName(
-      "gdjs.evtTools.common.resolveAsyncEventsFunction");
 }
 
 }  // namespace gdjs
@@ -18,6 +18,14 @@ class AsyncExtension : public gd::PlatformExtension {
 public:
   AsyncExtension();
   virtual ~AsyncExtension(){};
+
+  /**
+   * \brief Set the code generator of the async event, which can't be
+   * stored in a gd::PlatformMetadataSnapshot.
+   *
+   * \see gd::ExtensionBindingsRegistry
+   */
+  static void BindCodeGenerators(gd::PlatformExtension &extension);
 };
 
 } // namespace gdjs
@@ -347,7 +347,18 @@ BaseObjectExtension::BaseObjectExtension() {
   objectConditions["ObjectVariableChildCount"].SetFunctionName(
       "getVariableChildCount");
 
-  GetAllActions()["MoveObjects"].SetCustomCodeGenerator(
+  BindCodeGenerators(*this);
+
+  // "AddForceTournePos" and "AddForceTourne" are deprecated and not implemented
+  StripUnimplementedInstructionsAndExpressions();
+}
+
+void BaseObjectExtension::BindCodeGenerators(
+    gd::PlatformExtension &extension) {
+  std::map<gd::String, gd::InstructionMetadata> &objectActions =
+      extension.GetAllActionsForObject("");
+
+  extension.GetAllActions()["MoveObjects"].SetCustomCodeGenerator(
       [](gd::Instruction &,
          gd::EventsCodeGenerator &,
          gd::EventsCodeGenerationContext &) {
@@ -359,7 +370,7 @@ BaseObjectExtension::BaseObjectExtension() {
   };
 
   objectActions["SetXY"].SetCustomCodeGenerator(
-      [&](gd::Instruction &instruction,
+      [&](const gd::Instruction &instruction,
           gd::EventsCodeGenerator &codeGenerator,
           gd::EventsCodeGenerationContext &context) -> gd::String {
         gd::String outputCode;
@@ -421,7 +432,7 @@ BaseObjectExtension::BaseObjectExtension() {
   // End of compatibility code
 
   objectActions["SetCenter"].SetCustomCodeGenerator(
-      [&](gd::Instruction &instruction,
+      [&](const gd::Instruction &instruction,
           gd::EventsCodeGenerator &codeGenerator,
           gd::EventsCodeGenerationContext &context) -> gd::String {
         gd::String outputCode;
@@ -476,9 +487,6 @@ BaseObjectExtension::BaseObjectExtension() {
 
         return outputCode;
       });
-
-  // "AddForceTournePos" and "AddForceTourne" are deprecated and not implemented
-  StripUnimplementedInstructionsAndExpressions();
 }
 
 } // namespace gdjs
@@ -18,6 +18,14 @@ class BaseObjectExtension : public gd::PlatformExtension {
  public:
   BaseObjectExtension();
   virtual ~BaseObjectExtension(){};
+
+  /**
+   * \brief Set the code generators of the object instructions that are not
+   * plain function calls (forces and positions).
+   *
+   * \see gd::ExtensionBindingsRegistry
+   */
+  static void BindCodeGenerators(gd::PlatformExtension &extension);
 };
 
 }  // namespace gdjs
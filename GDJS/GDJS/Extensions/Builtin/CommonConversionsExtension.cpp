@@ -32,8 +32,17 @@ CommonConversionsExtension::CommonConversionsExtension() {
       "gdjs.evtTools.network.jsonToVariableStructure");
   GetAllActions()["JSONToObjectVariableStructure"].SetFunctionName(
       "gdjs.evtTools.network.jsonToObjectVariableStructure");
+  GetAllStrExpressions()["GlobalVarToJSON"].SetFunctionName(
+      "gdjs.evtTools.network.variableStructureToJSON");
+  GetAllStrExpressions()["ObjectVarToJSON"].SetFunctionName(
+      "gdjs.evtTools.network.objectVariableStructureToJSON");
+
+  BindCodeGenerators(*this);
+}
 
-  GetAllStrExpressions()["ToJSON"].SetCustomCodeGenerator(
+void CommonConversionsExtension::BindCodeGenerators(
+    gd::PlatformExtension &extension) {
+  extension.GetAllStrExpressions()["ToJSON"].SetCustomCodeGenerator(
       [](const std::vector<gd::Expression> &parameters,
          gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
@@ -43,10 +52,6 @@ CommonConversionsExtension::CommonConversionsExtension() {
                                                               context) +
                ")";
       });
-  GetAllStrExpressions()["GlobalVarToJSON"].SetFunctionName(
-      "gdjs.evtTools.network.variableStructureToJSON");
-  GetAllStrExpressions()["ObjectVarToJSON"].SetFunctionName(
-      "gdjs.evtTools.network.objectVariableStructureToJSON");
 }
 
 }  // namespace gdjs
@@ -19,6 +19,13 @@ class CommonConversionsExtension : public gd::PlatformExtension {
  public:
   CommonConversionsExtension();
   virtual ~CommonConversionsExtension(){};
+
+  /**
+   * \brief Set the code generator of the ToJSON expression.
+   *
+   * \see gd::ExtensionBindingsRegistry
+   */
+  static void BindCodeGenerators(gd::PlatformExtension &extension);
 };
 
 }  // namespace gdjs
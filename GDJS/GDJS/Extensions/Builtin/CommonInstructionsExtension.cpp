@@ -47,8 +47,23 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
   GetAllConditions()["BuiltinCommonInstructions::Always"].SetFunctionName(
       "gdjs.evtTools.common.logicalNegation");
 
-  GetAllConditions()["Egal"].SetCustomCodeGenerator(
-      [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
+  AddEvent("JsCode", _("Javascript code"),
+           _("Insert some Javascript code into events"), "",
+           "res/source_cpp16.png",
+           std::shared_ptr<gd::BaseEvent>(new JsCodeEvent));
+
+  BindCodeGenerators(*this);
+}
+
+void CommonInstructionsExtension::BindCodeGenerators(
+    gd::PlatformExtension &extension) {
+  std::map<gd::String, gd::InstructionMetadata> &conditions =
+      extension.GetAllConditions();
+  std::map<gd::String, gd::EventMetadata> &events = extension.GetAllEvents();
+
+  conditions["Egal"].SetCustomCodeGenerator(
+      [](const gd::Instruction &instruction,
+         gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         gd::String value1Code =
             gd::ExpressionCodeGenerator::GenerateExpressionCode(
@@ -73,11 +88,12 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                    operatorString, value1Code, value2Code) +
                ");\n";
       });
-  GetAllConditions()["BuiltinCommonInstructions::CompareNumbers"]
-      .codeExtraInformation = GetAllConditions()["Egal"].codeExtraInformation;
+  conditions["BuiltinCommonInstructions::CompareNumbers"]
+      .codeExtraInformation = conditions["Egal"].codeExtraInformation;
 
-  GetAllConditions()["StrEqual"].SetCustomCodeGenerator(
-      [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
+  conditions["StrEqual"].SetCustomCodeGenerator(
+      [](const gd::Instruction &instruction,
+         gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         gd::String value1Code =
             gd::ExpressionCodeGenerator::GenerateExpressionCode(
@@ -102,16 +118,24 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                    operatorString, value1Code, value2Code) +
                ");\n";
       });
-  GetAllConditions()["BuiltinCommonInstructions::CompareStrings"]
+  conditions["BuiltinCommonInstructions::CompareStrings"]
       .codeExtraInformation =
-      GetAllConditions()["StrEqual"].codeExtraInformation;
+      conditions["StrEqual"].codeExtraInformation;
 
-  GetAllEvents()["BuiltinCommonInstructions::Link"]
+  events["BuiltinCommonInstructions::Link"]
       .SetCodeGenerator([](gd::BaseEvent &event_,
                            gd::EventsCodeGenerator &codeGenerator,
                            gd::EventsCodeGenerationContext &context) {
-        return "/*Link should not have any generated code. You probably "
-               "wrongly used a link in events without a layout.*/";
+        gdjs::EventsCodeGenerator &jsCodeGenerator =
+            dynamic_cast<gdjs::EventsCodeGenerator &>(codeGenerator);
+        gd::LinkEvent &event = dynamic_cast<gd::LinkEvent &>(event_);
+        // Links that are kept by the preprocessing call a shared function.
+        if (codeGenerator.HasProjectAndLayout())
+          return jsCodeGenerator.GenerateLinkedEventsFunctionCall(event);
+
+        return gd::String(
+            "/*Link should not have any generated code. You probably "
+            "wrongly used a link in events without a layout.*/");
       })
       .SetPreprocessing([](gd::BaseEvent &event_,
                            gd::EventsCodeGenerator &codeGenerator,
@@ -120,12 +144,18 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (!codeGenerator.HasProjectAndLayout())
           return;
 
+        gdjs::EventsCodeGenerator &jsCodeGenerator =
+            dynamic_cast<gdjs::EventsCodeGenerator &>(codeGenerator);
         gd::LinkEvent &event = dynamic_cast<gd::LinkEvent &>(event_);
+        if (jsCodeGenerator.CanCallLinkedEventsFunction(
+                event, eventList, indexOfTheEventInThisList))
+          return;
+
         event.ReplaceLinkByLinkedEvents(codeGenerator.GetProject(), eventList,
                                         indexOfTheEventInThisList);
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::Standard"].SetCodeGenerator(
+  events["BuiltinCommonInstructions::Standard"].SetCodeGenerator(
       [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         gd::StandardEvent &event = dynamic_cast<gd::StandardEvent &>(event_);
@@ -181,7 +211,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::Else"].SetCodeGenerator(
+  events["BuiltinCommonInstructions::Else"].SetCodeGenerator(
       [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         gd::ElseEvent &event = dynamic_cast<gd::ElseEvent &>(event_);
@@ -237,7 +267,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::Comment"].SetCodeGenerator(
+  events["BuiltinCommonInstructions::Comment"].SetCodeGenerator(
       [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         // If we do not add a code generator to the comments,
@@ -246,9 +276,12 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return "";
       });
 
-  GetAllConditions()["BuiltinCommonInstructions::Or"].SetCustomCodeGenerator(
+  conditions["BuiltinCommonInstructions::Or"].SetCustomCodeGenerator(
       [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &parentContext) {
+        gdjs::EventsCodeGenerator &jsCodeGenerator =
+            dynamic_cast<gdjs::EventsCodeGenerator &>(codeGenerator);
+
         // Conditions code
         gd::String conditionsCode;
         gd::InstructionsList &conditions = instruction.GetSubInstructions();
@@ -299,10 +332,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
             emptyListsNeeded.insert(*it);
             gd::String objList = codeGenerator.GetObjectListName(*it, context);
             gd::String finalObjList =
-                codeGenerator.GetCodeNamespaceAccessor() + ManObjListName(*it) +
-                gd::String::From(parentContext.GetContextDepth()) + "_" +
-                gd::String::From(parentContext.GetCurrentConditionDepth()) +
-                "final";
+                jsCodeGenerator.GetOrConditionObjectListName(*it,
+                                                             parentContext);
             conditionsCode += "    for (let j = 0, jLen = " + objList +
                               ".length; j < jLen ; ++j) {\n";
             conditionsCode += "        if ( " + finalObjList + ".indexOf(" +
@@ -319,7 +350,6 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         gd::String declarationsCode;
 
         // Declarations code
-        gd::String codeNamespace = codeGenerator.GetCodeNamespaceAccessor();
         for (set<gd::String>::iterator it = emptyListsNeeded.begin();
              it != emptyListsNeeded.end(); ++it) {
           //"OR" condition must declare objects list, but without getting
@@ -331,11 +361,10 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
           // incidence on further conditions, as conditions use "normal"
           // ones.
           gd::String finalObjList =
-              codeNamespace + ManObjListName(*it) +
-              gd::String::From(parentContext.GetContextDepth()) + "_" +
-              gd::String::From(parentContext.GetCurrentConditionDepth()) +
-              "final";
-          codeGenerator.AddGlobalDeclaration(finalObjList + " = [];\n");
+              jsCodeGenerator.GetOrConditionObjectListName(*it, parentContext);
+          codeGenerator.AddGlobalDeclaration(
+              (jsCodeGenerator.ShouldGenerateCompactCode() ? "const " : "") +
+              finalObjList + " = [];\n");
           declarationsCode += finalObjList + ".length = 0;\n";
         }
         declarationsCode += "let " +
@@ -354,10 +383,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         for (set<gd::String>::iterator it = emptyListsNeeded.begin();
              it != emptyListsNeeded.end(); ++it) {
           gd::String finalObjList =
-              codeNamespace + ManObjListName(*it) +
-              gd::String::From(parentContext.GetContextDepth()) + "_" +
-              gd::String::From(parentContext.GetCurrentConditionDepth()) +
-              "final";
+              jsCodeGenerator.GetOrConditionObjectListName(*it, parentContext);
           code += "gdjs.copyArray(" + finalObjList + ", " +
                   codeGenerator.GetObjectListName(*it, parentContext) + ");\n";
         }
@@ -366,7 +392,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return code;
       });
 
-  GetAllConditions()["BuiltinCommonInstructions::And"].SetCustomCodeGenerator(
+  conditions["BuiltinCommonInstructions::And"].SetCustomCodeGenerator(
       [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &parentContext) {
         gd::String outputCode;
@@ -384,7 +410,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllConditions()["BuiltinCommonInstructions::Not"].SetCustomCodeGenerator(
+  conditions["BuiltinCommonInstructions::Not"].SetCustomCodeGenerator(
       [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &parentContext) {
         gd::String outputCode;
@@ -403,7 +429,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllConditions()["BuiltinCommonInstructions::Once"].SetCustomCodeGenerator(
+  conditions["BuiltinCommonInstructions::Once"].SetCustomCodeGenerator(
       [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         size_t uniqueId = codeGenerator.GenerateSingleUsageUniqueIdFor(
@@ -419,7 +445,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::While"].SetCodeGenerator(
+  events["BuiltinCommonInstructions::While"].SetCodeGenerator(
       [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &parentContext) {
         gd::WhileEvent &event = dynamic_cast<gd::WhileEvent &>(event_);
@@ -438,6 +464,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         gd::EventsCodeGenerationContext context;
         context.InheritsFrom(parentContext);
         context.ForbidReuse();
+        context.HoistLoopInvariants();
 
         gd::String localVariablesInitializationCode = "";
         if (event_.HasVariables()) {
@@ -472,11 +499,14 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (!event.GetConditions().empty())
           ifPredicate =
               codeGenerator.GenerateBooleanFullName("isConditionTrue", context);
+        // Sub-events can be generated in another function.
+        context.StopHoistingLoopInvariants();
 
         // Write final code
         gd::String whileBoolean =
             codeGenerator.GenerateBooleanFullName("stopDoWhile", context);
         outputCode += localVariablesInitializationCode;
+        outputCode += GenerateLoopInvariantsDeclarationCode(context);
         if (hasIndexVariable) {
           outputCode += "let " + whileIndexVar + " = 0;\n";
         }
@@ -513,7 +543,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::ForEachChildVariable"]
+  events["BuiltinCommonInstructions::ForEachChildVariable"]
       .SetCodeGenerator([](gd::BaseEvent &event_,
                            gd::EventsCodeGenerator &codeGenerator,
                            gd::EventsCodeGenerationContext &parentContext) {
@@ -693,7 +723,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                                 event.GetIterableVariableName(), parentContext));
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::Repeat"].SetCodeGenerator(
+  events["BuiltinCommonInstructions::Repeat"].SetCodeGenerator(
       [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &parentContext) {
         gd::String outputCode;
@@ -711,6 +741,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         gd::EventsCodeGenerationContext context;
         context.InheritsFrom(parentContext);
         context.ForbidReuse();
+        context.HoistLoopInvariants();
 
         gd::String localVariablesInitializationCode = "";
         if (event_.HasVariables()) {
@@ -728,6 +759,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (!event.GetConditions().empty())
           ifPredicate =
               codeGenerator.GenerateBooleanFullName("isConditionTrue", context);
+        // Sub-events can be generated in another function.
+        context.StopHoistingLoopInvariants();
 
         // Prepare object declaration and sub events
         gd::String subevents =
@@ -749,6 +782,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         outputCode += localVariablesInitializationCode;
         outputCode +=
             "const " + repeatCountVar + " = " + repeatCountCode + ";\n";
+        outputCode += GenerateLoopInvariantsDeclarationCode(context);
         outputCode += "for (let " + repeatIndexVar + " = 0;" + repeatIndexVar +
                       " < " + repeatCountVar + ";++" + repeatIndexVar + ") {\n";
         outputCode += objectDeclaration;
@@ -777,7 +811,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::ForEach"].SetCodeGenerator(
+  events["BuiltinCommonInstructions::ForEach"].SetCodeGenerator(
       [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &parentContext) {
         gd::String outputCode;
@@ -800,6 +834,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         context.InheritsFrom(parentContext);
         context.ForbidReuse(); // TODO: This may not be necessary (to be
                                // investigated/heavily tested).
+        context.HoistLoopInvariants();
 
         gd::String localVariablesInitializationCode = "";
         if (event_.HasVariables()) {
@@ -815,10 +850,12 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         // expression code for evaluating the orderBy expression on each object.
         gd::String orderByExpressionCode;
         gd::String sortObjectDeclaration;
+        gd::String sortLoopInvariantsDeclaration;
         if (hasOrderBy) {
           gd::EventsCodeGenerationContext sortContext;
           sortContext.InheritsFrom(parentContext);
           sortContext.ForbidReuse();
+          sortContext.HoistLoopInvariants();
           for (unsigned int i = 0; i < realObjects.size(); ++i)
             sortContext.EmptyObjectsListNeeded(realObjects[i]);
 
@@ -828,6 +865,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   gd::Expression(event.GetOrderBy()));
           sortObjectDeclaration =
               codeGenerator.GenerateObjectsDeclarationCode(sortContext) + "\n";
+          sortLoopInvariantsDeclaration =
+              GenerateLoopInvariantsDeclarationCode(sortContext);
         }
 
         // Prepare conditions/actions codes
@@ -839,6 +878,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (!event.GetConditions().empty())
           ifPredicate =
               codeGenerator.GenerateBooleanFullName("isConditionTrue", context);
+        // Sub-events can be generated in another function.
+        context.StopHoistingLoopInvariants();
 
         // Prepare object declaration and sub events
         gd::String subevents =
@@ -866,26 +907,26 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
               event.GetLoopIndexVariableName(), context);
         }
 
-        // Declare additional variables for the orderBy sorting phase
-        gd::String forEachSortedList;
-        gd::String forEachSortKeysList;
-        gd::String forEachLimitVar;
+        // Declare additional variables for the orderBy sorting phase. The
+        // keys and the sorted indices are stored in buffers that are reused
+        // each time the event is run, to avoid allocations.
+        gd::String forEachSortBuffer;
+        gd::String forEachSortedCountVar;
         if (hasOrderBy) {
-          forEachSortedList =
-              codeGenerator.GetCodeNamespaceAccessor() + "forEachSorted" +
+          forEachSortBuffer =
+              codeGenerator.GetCodeNamespaceAccessor() + "forEachSortBuffer" +
               gd::String::From(context.GetContextDepth());
-          codeGenerator.AddGlobalDeclaration(forEachSortedList + " = [];\n");
-          forEachSortKeysList =
-              codeGenerator.GetCodeNamespaceAccessor() + "forEachSortKeys" +
+          codeGenerator.AddGlobalDeclaration(
+              forEachSortBuffer + " = new gdjs.SortedIndicesBuffer();\n");
+          forEachSortedCountVar =
+              codeGenerator.GetCodeNamespaceAccessor() + "forEachSortedCount" +
               gd::String::From(context.GetContextDepth());
-          codeGenerator.AddGlobalDeclaration(forEachSortKeysList + " = [];\n");
-          forEachLimitVar =
-              codeGenerator.GetCodeNamespaceAccessor() + "forEachLimit" +
-              gd::String::From(context.GetContextDepth());
-          codeGenerator.AddGlobalDeclaration(forEachLimitVar + " = 0;\n");
+          codeGenerator.AddGlobalDeclaration(forEachSortedCountVar +
+                                             " = 0;\n");
         }
 
         outputCode += localVariablesInitializationCode;
+        outputCode += GenerateLoopInvariantsDeclarationCode(context);
 
         // --- Build the combined objects list ---
         if (realObjects.size() != 1) {
@@ -916,18 +957,21 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
           // Build a combined list (always use forEachObjectsList for sorting)
           if (realObjects.size() == 1) {
             // For single object: copy to the combined list for uniform handling
-            outputCode += forEachObjectsList + ".length = 0;\n";
             outputCode +=
-                forEachObjectsList + ".push.apply(" + forEachObjectsList +
-                "," +
+                "gdjs.copyArray(" +
                 codeGenerator.GetObjectListName(realObjects[0], parentContext) +
-                ");\n";
+                ", " + forEachObjectsList + ");\n";
             outputCode += forEachTotalCountVar + " = " + forEachObjectsList +
                           ".length;\n";
           }
 
           // Evaluate the orderBy expression for each object and store in sort keys
-          outputCode += forEachSortKeysList + ".length = 0;\n";
+          // (in a block, as the loop invariants can have the same names as the
+          // ones of the main loop).
+          outputCode += "{\n";
+          outputCode += sortLoopInvariantsDeclaration;
+          outputCode +=
+              forEachSortBuffer + ".reserve(" + forEachTotalCountVar + ");\n";
           outputCode +=
               "for (" + forEachIndexVar + " = 0;" + forEachIndexVar + " < " +
               forEachTotalCountVar + ";++" + forEachIndexVar + ") {\n";
@@ -964,43 +1008,31 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
             }
           }
 
-          outputCode += forEachSortKeysList + ".push(" +
-                        orderByExpressionCode + ");\n";
+          outputCode += forEachSortBuffer + ".keys[" + forEachIndexVar +
+                        "] = " + orderByExpressionCode + ";\n";
           outputCode += "}\n"; // End of sort key evaluation loop
+          outputCode += "}\n";
 
-          // Build sorted indices and sort them
-          outputCode += forEachSortedList + ".length = 0;\n";
-          outputCode += "for (" + forEachIndexVar + " = 0;" +
-                        forEachIndexVar + " < " + forEachTotalCountVar + ";++" +
-                        forEachIndexVar + ") " + forEachSortedList + ".push(" +
-                        forEachIndexVar + ");\n";
-
+          // Sort the indices. With a limit, only the first objects are
+          // selected, without sorting all of them.
           gd::String isDesc =
               event.GetOrder() == "desc" ? "true" : "false";
-          outputCode +=
-              forEachSortedList + ".sort(function(a, b) { return " + isDesc +
-              " ? " + forEachSortKeysList + "[b] - " + forEachSortKeysList +
-              "[a] : " + forEachSortKeysList + "[a] - " +
-              forEachSortKeysList + "[b]; });\n";
-
-          // Apply limit
-          const bool hasLimit = !event.GetLimit().empty();
-          if (hasLimit) {
-            gd::String limitCode =
-                gd::ExpressionCodeGenerator::GenerateExpressionCode(
-                    codeGenerator, parentContext, "number",
-                    gd::Expression(event.GetLimit()));
-            outputCode += forEachLimitVar + " = " + limitCode + ";\n";
-            outputCode += "if (" + forEachLimitVar + " >= 0 && " +
-                          forEachSortedList + ".length > " + forEachLimitVar +
-                          ") " + forEachSortedList + ".length = " +
-                          forEachLimitVar + ";\n";
+          gd::String limitCode = "-1";
+          if (!event.GetLimit().empty()) {
+            limitCode = gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                codeGenerator, parentContext, "number",
+                gd::Expression(event.GetLimit()));
           }
+          outputCode += forEachSortedCountVar + " = " + forEachSortBuffer +
+                        ".sort(" + forEachTotalCountVar + ", " + isDesc +
+                        ", " + limitCode + ");\n";
 
           // Iterate through sorted indices
+          gd::String sortedIndex =
+              forEachSortBuffer + ".indices[" + forEachIndexVar + "]";
           outputCode +=
               "for (" + forEachIndexVar + " = 0;" + forEachIndexVar + " < " +
-              forEachSortedList + ".length;++" + forEachIndexVar + ") {\n";
+              forEachSortedCountVar + ";++" + forEachIndexVar + ") {\n";
 
           // Empty object lists and pick the right object
           outputCode += objectDeclaration;
@@ -1011,9 +1043,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   "forEachTemporary" +
                   gd::String::From(context.GetContextDepth());
               codeGenerator.AddGlobalDeclaration(temporary + " = null;\n");
-              outputCode +=
-                  temporary + " = " + forEachObjectsList + "[" +
-                  forEachSortedList + "[" + forEachIndexVar + "]];\n";
+              outputCode += temporary + " = " + forEachObjectsList + "[" +
+                            sortedIndex + "];\n";
               outputCode +=
                   codeGenerator.GetObjectListName(realObjects[0], context) +
                   ".push(" + temporary + ");\n";
@@ -1030,13 +1061,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
               }
               if (i != 0)
                 outputCode += "else ";
-              outputCode += "if (" + forEachSortedList + "[" + forEachIndexVar +
-                            "] < " + count + ") {\n";
+              outputCode += "if (" + sortedIndex + " < " + count + ") {\n";
               outputCode +=
                   "    " +
                   codeGenerator.GetObjectListName(realObjects[i], context) +
-                  ".push(" + forEachObjectsList + "[" + forEachSortedList +
-                  "[" + forEachIndexVar + "]]);\n";
+                  ".push(" + forEachObjectsList + "[" + sortedIndex + "]);\n";
               outputCode += "}\n";
             }
           }
@@ -1126,7 +1155,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  GetAllEvents()["BuiltinCommonInstructions::Group"].SetCodeGenerator(
+  events["BuiltinCommonInstructions::Group"].SetCodeGenerator(
       [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         gd::String outputCode;
@@ -1141,13 +1170,9 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         return outputCode;
       });
 
-  AddEvent("JsCode", _("Javascript code"),
-           _("Insert some Javascript code into events"), "",
-           "res/source_cpp16.png",
-           std::shared_ptr<gd::BaseEvent>(new JsCodeEvent))
-      .SetCodeGenerator([](gd::BaseEvent &event_,
-                           gd::EventsCodeGenerator &codeGenerator,
-                           gd::EventsCodeGenerationContext &parentContext) {
+  events["BuiltinCommonInstructions::JsCode"].SetCodeGenerator(
+      [](gd::BaseEvent &event_, gd::EventsCodeGenerator &codeGenerator,
+         gd::EventsCodeGenerationContext &parentContext) {
         JsCodeEvent &event = dynamic_cast<JsCodeEvent &>(event_);
 
         gd::String functionName = codeGenerator.GetCodeNamespaceAccessor() +
@@ -1266,4 +1291,14 @@ void CommonInstructionsExtension::GenerateLocalVariableInitializationCode(
   }
 }
 
+gd::String CommonInstructionsExtension::GenerateLoopInvariantsDeclarationCode(
+    const gd::EventsCodeGenerationContext &context) {
+  gd::String code;
+  for (const auto &loopInvariant : context.GetLoopInvariants()) {
+    code += "const " + loopInvariant.first + " = " + loopInvariant.second +
+            ";\n";
+  }
+  return code;
+}
+
 } // namespace gdjs
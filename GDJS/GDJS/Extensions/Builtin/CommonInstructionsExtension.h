@@ -7,6 +7,7 @@
 #include "GDCore/Extensions/PlatformExtension.h"
 
 namespace gd {
+class EventsCodeGenerationContext;
 class Variable;
 class VariablesContainer;
 }  
@@ -21,6 +22,14 @@ class CommonInstructionsExtension : public gd::PlatformExtension {
  public:
   CommonInstructionsExtension();
   virtual ~CommonInstructionsExtension(){};
+
+  /**
+   * \brief Set the code generators of the standard events and of the
+   * conditions combining other conditions.
+   *
+   * \see gd::ExtensionBindingsRegistry
+   */
+  static void BindCodeGenerators(gd::PlatformExtension &extension);
 private:
   static void GenerateLocalVariablesInitializationCode(
       gd::VariablesContainer &variablesContainer,
@@ -28,6 +37,8 @@ private:
   static void GenerateLocalVariableInitializationCode(gd::Variable &variable,
                                                       gd::String &code,
                                                       std::size_t depth = 0);
+  static gd::String GenerateLoopInvariantsDeclarationCode(
+      const gd::EventsCodeGenerationContext &context);
 };
 
 }  // namespace gdjs
@@ -23,8 +23,137 @@ namespace gdjs {
 VariablesExtension::VariablesExtension() {
   gd::BuiltinExtensionsImplementer::ImplementsVariablesExtension(*this);
 
-  GetAllConditions()["NumberVariable"].SetCustomCodeGenerator(
-      [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
+  GetAllStrExpressions()["VariableFirstString"].SetFunctionName(
+      "gdjs.evtTools.variable.getFirstVariableString");
+  GetAllExpressions()["VariableFirstNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.getFirstVariableNumber");
+  GetAllStrExpressions()["VariableLastString"].SetFunctionName(
+      "gdjs.evtTools.variable.getLastVariableString");
+  GetAllExpressions()["VariableLastNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.getLastVariableNumber");
+  GetAllConditions()["VariableChildCount"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableChildCount");
+  GetAllConditions()["VariableChildExists2"].SetFunctionName(
+      "gdjs.evtTools.variable.variableChildExists");
+  GetAllActions()["RemoveVariableChild"].SetFunctionName(
+      "gdjs.evtTools.variable.variableRemoveChild");
+  GetAllActions()["ClearVariableChildren"].SetFunctionName(
+      "gdjs.evtTools.variable.variableClearChildren");
+
+  GetAllActions()["PushVariable"].SetFunctionName(
+      "gdjs.evtTools.variable.variablePushCopy");
+  GetAllActions()["PushString"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["PushNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["PushBoolean"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["RemoveVariableAt"].SetFunctionName(
+      "gdjs.evtTools.variable.variableRemoveAt");
+
+  // Legacy instructions
+
+  GetAllConditions()["VarScene"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableNumber");
+  GetAllConditions()["VarSceneTxt"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableString");
+  GetAllConditions()["SceneVariableAsBoolean"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableBoolean");
+  GetAllConditions()["VarGlobal"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableNumber");
+  GetAllConditions()["VarGlobalTxt"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableString");
+  GetAllConditions()["GlobalVariableAsBoolean"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableBoolean");
+
+  GetAllExpressions()["GlobalVariableChildCount"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableChildCount");
+
+  GetAllExpressions()["Variable"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableNumber");
+  GetAllStrExpressions()["VariableString"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableString");
+  GetAllExpressions()["GlobalVariable"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableNumber");
+  GetAllStrExpressions()["GlobalVariableString"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableString");
+
+  GetAllStrExpressions()["GlobalVariableFirstString"].SetFunctionName(
+      "gdjs.evtTools.variable.getFirstVariableString");
+  GetAllExpressions()["GlobalVariableFirstNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.getFirstVariableNumber");
+  GetAllStrExpressions()["GlobalVariableLastString"].SetFunctionName(
+      "gdjs.evtTools.variable.getLastVariableString");
+  GetAllExpressions()["GlobalVariableLastNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.getLastVariableNumber");
+  GetAllStrExpressions()["SceneVariableFirstString"].SetFunctionName(
+      "gdjs.evtTools.variable.getFirstVariableString");
+  GetAllExpressions()["SceneVariableFirstNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.getFirstVariableNumber");
+  GetAllStrExpressions()["SceneVariableLastString"].SetFunctionName(
+      "gdjs.evtTools.variable.getLastVariableString");
+  GetAllExpressions()["SceneVariableLastNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.getLastVariableNumber");
+
+  GetAllConditions()["VarSceneDef"].SetFunctionName(
+      "gdjs.evtTools.variable.sceneVariableExists");
+  GetAllConditions()["VarGlobalDef"].SetFunctionName(
+      "gdjs.evtTools.variable.globalVariableExists");
+  GetAllConditions()["SceneVariableChildCount"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableChildCount");
+  GetAllConditions()["GlobalVariableChildCount"].SetFunctionName(
+      "gdjs.evtTools.variable.getVariableChildCount");
+
+  GetAllActions()["SetSceneVariableAsBoolean"].SetFunctionName(
+      "gdjs.evtTools.variable.setVariableBoolean");
+  GetAllActions()["SetGlobalVariableAsBoolean"].SetFunctionName(
+      "gdjs.evtTools.variable.setVariableBoolean");
+  GetAllActions()["ToggleSceneVariableAsBoolean"].SetFunctionName(
+      "gdjs.evtTools.variable.toggleVariableBoolean");
+  GetAllActions()["ToggleGlobalVariableAsBoolean"].SetFunctionName(
+      "gdjs.evtTools.variable.toggleVariableBoolean");
+
+  GetAllConditions()["VariableChildExists"].SetFunctionName(
+      "gdjs.evtTools.variable.variableChildExists");
+  GetAllConditions()["GlobalVariableChildExists"].SetFunctionName(
+      "gdjs.evtTools.variable.variableChildExists");
+  GetAllActions()["VariableRemoveChild"].SetFunctionName(
+      "gdjs.evtTools.variable.variableRemoveChild");
+  GetAllActions()["GlobalVariableRemoveChild"].SetFunctionName(
+      "gdjs.evtTools.variable.variableRemoveChild");
+  GetAllActions()["VariableClearChildren"].SetFunctionName(
+      "gdjs.evtTools.variable.variableClearChildren");
+  GetAllActions()["GlobalVariableClearChildren"].SetFunctionName(
+      "gdjs.evtTools.variable.variableClearChildren");
+
+  GetAllActions()["SceneVariablePush"].SetFunctionName(
+      "gdjs.evtTools.variable.variablePushCopy");
+  GetAllActions()["SceneVariablePushString"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["SceneVariablePushNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["SceneVariablePushBool"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["SceneVariableRemoveAt"].SetFunctionName(
+      "gdjs.evtTools.variable.variableRemoveAt");
+  GetAllActions()["GlobalVariablePush"].SetFunctionName(
+      "gdjs.evtTools.variable.variablePushCopy");
+  GetAllActions()["GlobalVariablePushString"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["GlobalVariablePushNumber"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["GlobalVariablePushBool"].SetFunctionName(
+      "gdjs.evtTools.variable.valuePush");
+  GetAllActions()["GlobalVariableRemoveAt"].SetFunctionName(
+      "gdjs.evtTools.variable.variableRemoveAt");
+
+  BindCodeGenerators(*this);
+}
+
+void VariablesExtension::BindCodeGenerators(gd::PlatformExtension &extension) {
+  extension.GetAllConditions()["NumberVariable"].SetCustomCodeGenerator(
+      [](const gd::Instruction &instruction,
+         gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         const auto &variableName = instruction.GetParameters()[0].GetPlainString();
         gd::String getterCode =
@@ -58,8 +187,9 @@ VariablesExtension::VariablesExtension() {
                                                          expressionCode) +
                ");\n";
       });
-  GetAllConditions()["StringVariable"].SetCustomCodeGenerator(
-      [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
+  extension.GetAllConditions()["StringVariable"].SetCustomCodeGenerator(
+      [](const gd::Instruction &instruction,
+         gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         const auto &variableName = instruction.GetParameters()[0].GetPlainString();
         gd::String getterCode =
@@ -93,8 +223,9 @@ VariablesExtension::VariablesExtension() {
                                                          expressionCode) +
                ");\n";
       });
-  GetAllConditions()["BooleanVariable"].SetCustomCodeGenerator(
-      [](gd::Instruction &instruction, gd::EventsCodeGenerator &codeGenerator,
+  extension.GetAllConditions()["BooleanVariable"].SetCustomCodeGenerator(
+      [](const gd::Instruction &instruction,
+         gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
         const auto &variableName = instruction.GetParameters()[0].GetPlainString();
         gd::String getterCode =
@@ -125,16 +256,7 @@ VariablesExtension::VariablesExtension() {
                getterCode + ";\n";
       });
 
-  GetAllStrExpressions()["VariableFirstString"].SetFunctionName(
-      "gdjs.evtTools.variable.getFirstVariableString");
-  GetAllExpressions()["VariableFirstNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.getFirstVariableNumber");
-  GetAllStrExpressions()["VariableLastString"].SetFunctionName(
-      "gdjs.evtTools.variable.getLastVariableString");
-  GetAllExpressions()["VariableLastNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.getLastVariableNumber");
-
-  GetAllExpressions()["VariableChildCount"].SetCustomCodeGenerator(
+  extension.GetAllExpressions()["VariableChildCount"].SetCustomCodeGenerator(
       [](const std::vector<gd::Expression> &parameters,
          gd::EventsCodeGenerator &codeGenerator,
          gd::EventsCodeGenerationContext &context) {
@@ -144,28 +266,9 @@ VariablesExtension::VariablesExtension() {
                                                               context) +
                ")";
       });
-  GetAllConditions()["VariableChildCount"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableChildCount");
-  GetAllConditions()["VariableChildExists2"].SetFunctionName(
-      "gdjs.evtTools.variable.variableChildExists");
-  GetAllActions()["RemoveVariableChild"].SetFunctionName(
-      "gdjs.evtTools.variable.variableRemoveChild");
-  GetAllActions()["ClearVariableChildren"].SetFunctionName(
-      "gdjs.evtTools.variable.variableClearChildren");
-
-  GetAllActions()["PushVariable"].SetFunctionName(
-      "gdjs.evtTools.variable.variablePushCopy");
-  GetAllActions()["PushString"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["PushNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["PushBoolean"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["RemoveVariableAt"].SetFunctionName(
-      "gdjs.evtTools.variable.variableRemoveAt");
 
-  GetAllActions()["SetBooleanVariable"].SetCustomCodeGenerator(
-      [](gd::Instruction& instruction,
+  extension.GetAllActions()["SetBooleanVariable"].SetCustomCodeGenerator(
+      [](const gd::Instruction& instruction,
          gd::EventsCodeGenerator& codeGenerator,
          gd::EventsCodeGenerationContext& context) {
 
@@ -221,8 +324,8 @@ VariablesExtension::VariablesExtension() {
         return gd::String("");
       });
 
-  GetAllActions()["SetNumberVariable"].SetCustomCodeGenerator(
-      [](gd::Instruction& instruction,
+  extension.GetAllActions()["SetNumberVariable"].SetCustomCodeGenerator(
+      [](const gd::Instruction& instruction,
          gd::EventsCodeGenerator& codeGenerator,
          gd::EventsCodeGenerationContext& context) {
 
@@ -281,8 +384,8 @@ VariablesExtension::VariablesExtension() {
         return gd::String("");
       });
 
-  GetAllActions()["SetStringVariable"].SetCustomCodeGenerator(
-      [](gd::Instruction& instruction,
+  extension.GetAllActions()["SetStringVariable"].SetCustomCodeGenerator(
+      [](const gd::Instruction& instruction,
          gd::EventsCodeGenerator& codeGenerator,
          gd::EventsCodeGenerationContext& context) {
   
@@ -335,104 +438,8 @@ VariablesExtension::VariablesExtension() {
         return gd::String("");
       });
 
-  // Legacy instructions
-
-  GetAllConditions()["VarScene"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableNumber");
-  GetAllConditions()["VarSceneTxt"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableString");
-  GetAllConditions()["SceneVariableAsBoolean"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableBoolean");
-  GetAllConditions()["VarGlobal"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableNumber");
-  GetAllConditions()["VarGlobalTxt"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableString");
-  GetAllConditions()["GlobalVariableAsBoolean"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableBoolean");
-
-  GetAllExpressions()["GlobalVariableChildCount"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableChildCount");
-
-  GetAllExpressions()["Variable"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableNumber");
-  GetAllStrExpressions()["VariableString"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableString");
-  GetAllExpressions()["GlobalVariable"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableNumber");
-  GetAllStrExpressions()["GlobalVariableString"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableString");
-
-  GetAllStrExpressions()["GlobalVariableFirstString"].SetFunctionName(
-      "gdjs.evtTools.variable.getFirstVariableString");
-  GetAllExpressions()["GlobalVariableFirstNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.getFirstVariableNumber");
-  GetAllStrExpressions()["GlobalVariableLastString"].SetFunctionName(
-      "gdjs.evtTools.variable.getLastVariableString");
-  GetAllExpressions()["GlobalVariableLastNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.getLastVariableNumber");
-  GetAllStrExpressions()["SceneVariableFirstString"].SetFunctionName(
-      "gdjs.evtTools.variable.getFirstVariableString");
-  GetAllExpressions()["SceneVariableFirstNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.getFirstVariableNumber");
-  GetAllStrExpressions()["SceneVariableLastString"].SetFunctionName(
-      "gdjs.evtTools.variable.getLastVariableString");
-  GetAllExpressions()["SceneVariableLastNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.getLastVariableNumber");
-
-  GetAllConditions()["VarSceneDef"].SetFunctionName(
-      "gdjs.evtTools.variable.sceneVariableExists");
-  GetAllConditions()["VarGlobalDef"].SetFunctionName(
-      "gdjs.evtTools.variable.globalVariableExists");
-  GetAllConditions()["SceneVariableChildCount"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableChildCount");
-  GetAllConditions()["GlobalVariableChildCount"].SetFunctionName(
-      "gdjs.evtTools.variable.getVariableChildCount");
-
-  GetAllActions()["SetSceneVariableAsBoolean"].SetFunctionName(
-      "gdjs.evtTools.variable.setVariableBoolean");
-  GetAllActions()["SetGlobalVariableAsBoolean"].SetFunctionName(
-      "gdjs.evtTools.variable.setVariableBoolean");
-  GetAllActions()["ToggleSceneVariableAsBoolean"].SetFunctionName(
-      "gdjs.evtTools.variable.toggleVariableBoolean");
-  GetAllActions()["ToggleGlobalVariableAsBoolean"].SetFunctionName(
-      "gdjs.evtTools.variable.toggleVariableBoolean");
-
-  GetAllConditions()["VariableChildExists"].SetFunctionName(
-      "gdjs.evtTools.variable.variableChildExists");
-  GetAllConditions()["GlobalVariableChildExists"].SetFunctionName(
-      "gdjs.evtTools.variable.variableChildExists");
-  GetAllActions()["VariableRemoveChild"].SetFunctionName(
-      "gdjs.evtTools.variable.variableRemoveChild");
-  GetAllActions()["GlobalVariableRemoveChild"].SetFunctionName(
-      "gdjs.evtTools.variable.variableRemoveChild");
-  GetAllActions()["VariableClearChildren"].SetFunctionName(
-      "gdjs.evtTools.variable.variableClearChildren");
-  GetAllActions()["GlobalVariableClearChildren"].SetFunctionName(
-      "gdjs.evtTools.variable.variableClearChildren");
-
-  GetAllActions()["SceneVariablePush"].SetFunctionName(
-      "gdjs.evtTools.variable.variablePushCopy");
-  GetAllActions()["SceneVariablePushString"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["SceneVariablePushNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["SceneVariablePushBool"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["SceneVariableRemoveAt"].SetFunctionName(
-      "gdjs.evtTools.variable.variableRemoveAt");
-  GetAllActions()["GlobalVariablePush"].SetFunctionName(
-      "gdjs.evtTools.variable.variablePushCopy");
-  GetAllActions()["GlobalVariablePushString"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["GlobalVariablePushNumber"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["GlobalVariablePushBool"].SetFunctionName(
-      "gdjs.evtTools.variable.valuePush");
-  GetAllActions()["GlobalVariableRemoveAt"].SetFunctionName(
-      "gdjs.evtTools.variable.variableRemoveAt");
-
-  GetAllActions()["ModVarScene"].SetCustomCodeGenerator(
-      [](gd::Instruction& instruction,
+  extension.GetAllActions()["ModVarScene"].SetCustomCodeGenerator(
+      [](const gd::Instruction& instruction,
          gd::EventsCodeGenerator& codeGenerator,
          gd::EventsCodeGenerationContext& context) {
         gd::String expressionCode =
@@ -463,8 +470,8 @@ VariablesExtension::VariablesExtension() {
         return gd::String("");
       });
 
-  GetAllActions()["ModVarSceneTxt"].SetCustomCodeGenerator(
-      [](gd::Instruction& instruction,
+  extension.GetAllActions()["ModVarSceneTxt"].SetCustomCodeGenerator(
+      [](const gd::Instruction& instruction,
          gd::EventsCodeGenerator& codeGenerator,
          gd::EventsCodeGenerationContext& context) {
         gd::String expressionCode =
@@ -489,8 +496,8 @@ VariablesExtension::VariablesExtension() {
         return gd::String("");
       });
 
-  GetAllActions()["ModVarGlobal"].SetCustomCodeGenerator(
-      [](gd::Instruction& instruction,
+  extension.GetAllActions()["ModVarGlobal"].SetCustomCodeGenerator(
+      [](const gd::Instruction& instruction,
          gd::EventsCodeGenerator& codeGenerator,
          gd::EventsCodeGenerationContext& context) {
         gd::String expressionCode =
@@ -521,9 +528,9 @@ VariablesExtension::VariablesExtension() {
         return gd::String("");
       });
 
-  GetAllActions()["ModVarGlobalTxt"]
+  extension.GetAllActions()["ModVarGlobalTxt"]
       .SetCustomCodeGenerator(
-          [](gd::Instruction& instruction,
+          [](const gd::Instruction& instruction,
              gd::EventsCodeGenerator& codeGenerator,
              gd::EventsCodeGenerationContext& context) {
             gd::String expressionCode =
@@ -19,6 +19,14 @@ class VariablesExtension : public gd::PlatformExtension {
  public:
   VariablesExtension();
   virtual ~VariablesExtension(){};
+
+  /**
+   * \brief Set the code generators of the variable instructions and
+   * expressions.
+   *
+   * \see gd::ExtensionBindingsRegistry
+   */
+  static void BindCodeGenerators(gd::PlatformExtension &extension);
 };
 
 }  // namespace gdjs
@@ -5,9 +5,12 @@
  */
 #include "GDJS/Extensions/JsPlatform.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
+#include "GDCore/Extensions/ExtensionBindingsRegistry.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/ExtensionsLoader.h"
+#include "GDCore/IDE/PlatformMetadataSnapshot.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/Log.h"
 
@@ -38,6 +41,7 @@
 #include "GDJS/Extensions/Builtin/Capacities/ScalableExtension.h"
 #include "GDJS/Extensions/Builtin/Capacities/OpacityExtension.h"
 #include "GDJS/Extensions/Builtin/Capacities/TextContainerExtension.h"
+#include "GDJS/Events/Builtin/JsCodeEvent.h"
 
 namespace gdjs {
 
@@ -67,76 +71,104 @@ gd::PlatformExtension *CreateGDJSParticleSystemExtension();
 }
 #endif
 
+std::vector<std::shared_ptr<gd::PlatformExtension>>
+JsPlatform::CreateBuiltinExtensions() {
+  std::vector<std::shared_ptr<gd::PlatformExtension>> extensions;
+  extensions.push_back(std::make_shared<BaseObjectExtension>());
+  extensions.push_back(std::make_shared<SpriteExtension>());
+  extensions.push_back(std::make_shared<CommonInstructionsExtension>());
+  extensions.push_back(std::make_shared<AsyncExtension>());
+  extensions.push_back(std::make_shared<CommonConversionsExtension>());
+  extensions.push_back(std::make_shared<VariablesExtension>());
+  extensions.push_back(std::make_shared<MouseExtension>());
+  extensions.push_back(std::make_shared<KeyboardExtension>());
+  extensions.push_back(std::make_shared<SceneExtension>());
+  extensions.push_back(std::make_shared<TimeExtension>());
+  extensions.push_back(std::make_shared<MathematicalToolsExtension>());
+  extensions.push_back(std::make_shared<CameraExtension>());
+  extensions.push_back(std::make_shared<AudioExtension>());
+  extensions.push_back(std::make_shared<FileExtension>());
+  extensions.push_back(std::make_shared<NetworkExtension>());
+  extensions.push_back(std::make_shared<WindowExtension>());
+  extensions.push_back(std::make_shared<StringInstructionsExtension>());
+  extensions.push_back(std::make_shared<AdvancedExtension>());
+  extensions.push_back(std::make_shared<ExternalLayoutsExtension>());
+  extensions.push_back(std::make_shared<AnimatableExtension>());
+  extensions.push_back(std::make_shared<EffectExtension>());
+  extensions.push_back(std::make_shared<FlippableExtension>());
+  extensions.push_back(std::make_shared<ResizableExtension>());
+  extensions.push_back(std::make_shared<ScalableExtension>());
+  extensions.push_back(std::make_shared<OpacityExtension>());
+  extensions.push_back(std::make_shared<TextContainerExtension>());
+  return extensions;
+}
+
+void JsPlatform::AddBuiltinExtensionsBindings(
+    gd::ExtensionBindingsRegistry &registry) {
+  gd::BuiltinExtensionsImplementer::AddBuiltinExtensionsBindings(registry);
+  registry.AddBindings("BuiltinObject", BaseObjectExtension::BindCodeGenerators)
+      .AddBindings("BuiltinCommonInstructions",
+                   CommonInstructionsExtension::BindCodeGenerators)
+      .AddBindings("BuiltinCommonInstructions",
+                   [](gd::PlatformExtension &extension) {
+                     extension.SetEventInstance(
+                         "BuiltinCommonInstructions::JsCode",
+                         std::make_shared<JsCodeEvent>());
+                   })
+      .AddBindings("BuiltinAsync", AsyncExtension::BindCodeGenerators)
+      .AddBindings("BuiltinCommonConversions",
+                   CommonConversionsExtension::BindCodeGenerators)
+      .AddBindings("BuiltinVariables", VariablesExtension::BindCodeGenerators)
+      .AddBindings("BuiltinAdvanced", AdvancedExtension::BindCodeGenerators);
+}
+
+void JsPlatform::SerializeBuiltinExtensionsTo(gd::SerializerElement &snapshot) {
+  gd::PlatformMetadataSnapshot::SerializeTo(CreateBuiltinExtensions(),
+                                            snapshot);
+}
+
+std::vector<gd::String> JsPlatform::FindBuiltinExtensionsSnapshotDifferences(
+    const gd::SerializerElement &snapshot) {
+  gd::ExtensionBindingsRegistry registry;
+  AddBuiltinExtensionsBindings(registry);
+  return gd::PlatformMetadataSnapshot::FindDifferences(
+      CreateBuiltinExtensions(), snapshot, registry);
+}
+
 void JsPlatform::ReloadBuiltinExtensions() {
   // Adding built-in extensions.
   std::cout << "* Loading builtin extensions... ";
   std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new BaseObjectExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SpriteExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AsyncExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonConversionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new VariablesExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new MouseExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new KeyboardExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SceneExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new TimeExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new MathematicalToolsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new CameraExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AudioExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new FileExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new NetworkExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new WindowExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new StringInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AdvancedExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ExternalLayoutsExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new AnimatableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new EffectExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new FlippableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ResizableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ScalableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new OpacityExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new TextContainerExtension));
-  std::cout.flush();
+  for (const auto &extension : CreateBuiltinExtensions()) {
+    AddExtension(extension);
+    std::cout.flush();
+  }
   std::cout << "done." << std::endl;
 
+  LoadOtherExtensions();
+};
+
+bool JsPlatform::ReloadBuiltinExtensionsFrom(
+    const gd::SerializerElement &snapshot) {
+  gd::ExtensionBindingsRegistry registry;
+  AddBuiltinExtensionsBindings(registry);
+  std::vector<std::shared_ptr<gd::PlatformExtension>> extensions;
+  std::cout << "* Restoring builtin extensions... ";
+  std::cout.flush();
+  if (!gd::PlatformMetadataSnapshot::UnserializeFrom(
+          snapshot, registry, extensions)) {
+    std::cout << "failed." << std::endl;
+    return false;
+  }
+
+  for (const auto &extension : extensions) AddExtension(extension);
+  std::cout << "done." << std::endl;
+
+  LoadOtherExtensions();
+  return true;
+}
+
+void JsPlatform::LoadOtherExtensions() {
 #if defined(EMSCRIPTEN) // When compiling with emscripten, hardcode extensions
                         // to load.
   std::cout << "* Loading other extensions... ";
@@ -194,7 +226,7 @@ void JsPlatform::ReloadBuiltinExtensions() {
   std::cout.flush();
 #endif
   std::cout << "done." << std::endl;
-};
+}
 
 void JsPlatform::AddNewExtension(const gd::PlatformExtension &extension) {
   AddExtension(std::shared_ptr<gd::PlatformExtension>(
@@ -203,6 +235,12 @@ void JsPlatform::AddNewExtension(const gd::PlatformExtension &extension) {
 
 JsPlatform::JsPlatform() : gd::Platform() { ReloadBuiltinExtensions(); }
 
+JsPlatform::JsPlatform(const gd::SerializerElement &builtinExtensionsSnapshot)
+    : gd::Platform() {
+  if (!ReloadBuiltinExtensionsFrom(builtinExtensionsSnapshot))
+    ReloadBuiltinExtensions();
+}
+
 JsPlatform &JsPlatform::Get() {
   if (!singleton)
     singleton = new JsPlatform;
@@ -210,6 +248,13 @@ JsPlatform &JsPlatform::Get() {
   return *singleton;
 }
 
+JsPlatform &JsPlatform::CreateSingleton(
+    const gd::SerializerElement &builtinExtensionsSnapshot) {
+  if (!singleton) singleton = new JsPlatform(builtinExtensionsSnapshot);
+
+  return *singleton;
+}
+
 void JsPlatform::DestroySingleton() {
   if (singleton) {
     delete singleton;
@@ -10,6 +10,11 @@
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Tools/Localization.h"
 
+namespace gd {
+class ExtensionBindingsRegistry;
+class SerializerElement;
+}  // namespace gd
+
 namespace gdjs {
 
 /**
@@ -53,11 +58,52 @@ class GD_API JsPlatform : public gd::Platform {
    */
   virtual void ReloadBuiltinExtensions();
 
+  /**
+   * \brief Load the built-in extensions from a snapshot made with
+   * SerializeBuiltinExtensionsTo, which is faster than declaring them.
+   *
+   * \return false if the snapshot can't be used (nothing is loaded then).
+   * \see gd::PlatformMetadataSnapshot
+   */
+  bool ReloadBuiltinExtensionsFrom(const gd::SerializerElement& snapshot);
+
+  /**
+   * \brief Serialize the metadata declared by the built-in extensions, to be
+   * restored at startup with ReloadBuiltinExtensionsFrom.
+   */
+  static void SerializeBuiltinExtensionsTo(gd::SerializerElement& snapshot);
+
+  /**
+   * \brief Compare a snapshot of the built-in extensions with their
+   * declarations.
+   *
+   * \return A description of each difference (empty if the snapshot can be
+   * used).
+   */
+  static std::vector<gd::String> FindBuiltinExtensionsSnapshotDifferences(
+      const gd::SerializerElement& snapshot);
+
+  /**
+   * \brief Register the code generators and instances of the built-in
+   * extensions, bound to the extensions restored from a snapshot.
+   */
+  static void AddBuiltinExtensionsBindings(
+      gd::ExtensionBindingsRegistry& registry);
+
   /**
    * Get access to the JsPlatform instance (JsPlatform is a singleton).
    */
   static JsPlatform& Get();
 
+  /**
+   * \brief Create the JsPlatform instance with the built-in extensions
+   * restored from a snapshot (or declared if the snapshot can't be used).
+   *
+   * \note Nothing is done if the instance already exists.
+   */
+  static JsPlatform& CreateSingleton(
+      const gd::SerializerElement& builtinExtensionsSnapshot);
+
   /**
    * \brief Destroy the singleton.
    *
@@ -66,9 +112,18 @@ class GD_API JsPlatform : public gd::Platform {
   static void DestroySingleton();
 
   JsPlatform();
+  explicit JsPlatform(const gd::SerializerElement& builtinExtensionsSnapshot);
   virtual ~JsPlatform(){};
 
  private:
+  static std::vector<std::shared_ptr<gd::PlatformExtension>>
+  CreateBuiltinExtensions();
+
+  /**
+   * \brief Load the extensions which are not built-in but hardcoded in the
+   * platform (when compiled with Emscripten).
+   */
+  void LoadOtherExtensions();
 
   static JsPlatform* singleton;
 };
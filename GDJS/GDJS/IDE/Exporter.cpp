@@ -129,7 +129,10 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
                                  codeOutputDir,
                                  includesFiles,
                                  wholeProjectDiagnosticReport,
-                                 false)) {
+                                 false,
+                                 options.shouldGenerateEventsProfilingCode,
+                                 options.shouldGenerateCompactEventsCode,
+                                 options.shouldShareLinkedEventsCode)) {
       gd::LogError(_("Error during exporting! Unable to export events:\n") +
                    lastError);
       return false;
@@ -10,6 +10,7 @@
 #endif
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <sstream>
@@ -48,6 +49,7 @@
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/LinkedEventsCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
 
@@ -57,7 +59,9 @@ double GetTimeNow() {
   double currentTime = emscripten_get_now();
   return currentTime;
 #else
-  return 0;
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
 #endif
 }
 double GetTimeSpent(double previousTime) { return GetTimeNow() - previousTime; }
@@ -277,7 +281,8 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                           codeOutputDir,
                           includesFiles,
                           wholeProjectDiagnosticReport,
-                          true)) {
+                          true,
+                          options.shouldGenerateEventsProfilingCode)) {
       return false;
     }
     previousTime = LogTimeSpent("Events code export", previousTime);
@@ -1333,9 +1338,18 @@ bool ExporterHelper::ExportScenesEventsCode(
     gd::String outputDir,
     std::vector<gd::String> &includesFiles,
     gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
-    bool exportForPreview) {
+    bool exportForPreview,
+    bool generateEventsProfilingCode,
+    bool generateCompactCode,
+    bool shareLinkedEventsCode) {
   fs.MkDir(outputDir);
 
+  LinkedEventsCodeGenerator linkedEventsCodeGenerator(project);
+  linkedEventsCodeGenerator.SetGenerateEventsProfilingCode(
+      generateEventsProfilingCode);
+  linkedEventsCodeGenerator.SetGenerateCompactCode(generateCompactCode);
+  linkedEventsCodeGenerator.SetCompilationForRuntime(!exportForPreview);
+
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     std::set<gd::String> eventsIncludes;
     const gd::Layout &layout = project.GetLayout(i);
@@ -1345,6 +1359,12 @@ bool ExporterHelper::ExportScenesEventsCode(
         wholeProjectDiagnosticReport.AddNewDiagnosticReportForScene(
             layout.GetName());
     LayoutCodeGenerator layoutCodeGenerator(project);
+    layoutCodeGenerator.SetGenerateEventsProfilingCode(
+        generateEventsProfilingCode);
+    layoutCodeGenerator.SetGenerateCompactCode(generateCompactCode);
+    if (shareLinkedEventsCode)
+      layoutCodeGenerator.SetLinkedEventsCodeGenerator(
+          &linkedEventsCodeGenerator);
     gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
         layout, eventsIncludes, diagnosticReport, !exportForPreview);
     gd::String filename =
@@ -1356,7 +1376,11 @@ bool ExporterHelper::ExportScenesEventsCode(
         gd::String::From(GetTimeSpent(sceneStartTime)) + "ms, " +
         gd::String::From(CountEventsRecursively(layout.GetEvents())) +
         " events, " + gd::String::From(eventsOutput.size() / 1024) +
-        " KB generated code");
+        " KB generated code, " +
+        gd::String::From(diagnosticReport.GetRemovedObjectsListsCopiesCount()) +
+        " objects lists copies removed, " +
+        gd::String::From(diagnosticReport.GetReorderedConditionsCount()) +
+        " conditions lists reordered");
 
     // Export the code
     if (fs.WriteToFile(filename, eventsOutput)) {
@@ -1369,6 +1393,26 @@ bool ExporterHelper::ExportScenesEventsCode(
     }
   }
 
+  if (linkedEventsCodeGenerator.GetFunctionsCount() > 0) {
+    gd::LogStatus(
+        "  Linked events: " +
+        gd::String::From(linkedEventsCodeGenerator.GetFunctionsCount()) +
+        " shared functions, " +
+        gd::String::From(linkedEventsCodeGenerator.GetCode().size() / 1024) +
+        " KB generated code");
+
+    gd::String filename = outputDir + "/linkedEventsCode.js";
+    if (fs.WriteToFile(filename, linkedEventsCodeGenerator.GetCode())) {
+      for (auto &include : linkedEventsCodeGenerator.GetIncludeFiles())
+        InsertUnique(includesFiles, include);
+
+      InsertUnique(includesFiles, filename);
+    } else {
+      lastError = _("Unable to write ") + filename;
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -208,6 +208,15 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the events code should measure the time spent in each
+   * event, and in its conditions and actions (see gdjs.EventsProfiler).
+   */
+  PreviewExportOptions &SetShouldGenerateEventsProfilingCode(bool enable) {
+    shouldGenerateEventsProfilingCode = enable;
+    return *this;
+  }
+
   /**
    * \brief Set if the export should show the full loading screen (false
    * by default, skipping the minimum duration and GDevelop logo).
@@ -395,6 +404,7 @@ struct PreviewExportOptions {
   bool shouldReloadProjectData = true;
   bool shouldReloadLibraries = true;
   bool shouldGenerateScenesEventsCode = true;
+  bool shouldGenerateEventsProfilingCode = false;
   bool fullLoadingScreen;
   bool isDevelopmentEnvironment;
   bool isInGameEdition;
@@ -456,11 +466,42 @@ struct ExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the events code should measure the time spent in each
+   * event, and in its conditions and actions (see gdjs.EventsProfiler).
+   */
+  ExportOptions &SetShouldGenerateEventsProfilingCode(bool enable) {
+    shouldGenerateEventsProfilingCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the events code should be made as small as possible, to be
+   * faster to parse when the game is launched.
+   */
+  ExportOptions &SetShouldGenerateCompactEventsCode(bool enable) {
+    shouldGenerateCompactEventsCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the events linked at the root of the scenes events should
+   * be generated once, in functions shared by the scenes, instead of being
+   * inlined in each scene.
+   */
+  ExportOptions &SetShouldShareLinkedEventsCode(bool enable) {
+    shouldShareLinkedEventsCode = enable;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String target;
   gd::String fallbackAuthorUsername;
   gd::String fallbackAuthorId;
+  bool shouldGenerateEventsProfilingCode = false;
+  bool shouldGenerateCompactEventsCode = false;
+  bool shouldShareLinkedEventsCode = false;
 };
 
 /**
@@ -585,13 +626,23 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   * \param generateEventsProfilingCode Set to true to measure the time spent in
+   * each event.
+   * \param generateCompactCode Set to true to make the code as small as
+   * possible.
+   * \param shareLinkedEventsCode Set to true to generate the events linked at
+   * the root of the scenes events in functions shared by the scenes, saved in
+   * "linkedEventsCode.js".
    */
   bool ExportScenesEventsCode(
       const gd::Project &project,
       gd::String outputDir,
       std::vector<gd::String> &includesFiles,
       gd::WholeProjectDiagnosticReport &wholeProjectDiagnosticReport,
-      bool exportForPreview);
+      bool exportForPreview,
+      bool generateEventsProfilingCode = false,
+      bool generateCompactCode = false,
+      bool shareLinkedEventsCode = false);
 
   /**
    * \brief Add the project effects include files.
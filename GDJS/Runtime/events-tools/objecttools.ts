@@ -629,6 +629,148 @@ namespace gdjs {
     }
   }
 
+  /**
+   * Buffers used by the events code to order objects by a key (for example
+   * for a "For each object" event with an "order by" expression), without
+   * allocating memory each time the objects are ordered.
+   *
+   * Set the keys of the elements in `keys` (after calling `reserve`), then
+   * call `sort` to get in `indices` the indices of the elements ordered by
+   * their keys.
+   * @category Utils > JavaScript
+   */
+  export class SortedIndicesBuffer {
+    /** The key of each element. */
+    keys: Float64Array = new Float64Array(16);
+    /** The indices of the elements, ordered by `sort`. */
+    indices: Uint32Array = new Uint32Array(16);
+    private _mergedIndices: Uint32Array = new Uint32Array(16);
+
+    /**
+     * The biggest limit for which the first elements are selected by
+     * insertion (which takes a time proportional to the number of elements
+     * times the limit) instead of ordering all the elements.
+     */
+    static maxPartialSelectionLimit: integer = 16;
+
+    /**
+     * Make sure that the buffers can store the keys and indices of `count`
+     * elements. The keys already set are lost if the buffers are enlarged.
+     */
+    reserve(count: integer): void {
+      if (count <= this.keys.length) return;
+
+      let capacity = this.keys.length;
+      while (capacity < count) capacity *= 2;
+      this.keys = new Float64Array(capacity);
+      this.indices = new Uint32Array(capacity);
+      this._mergedIndices = new Uint32Array(capacity);
+    }
+
+    /**
+     * Order the indices of the `count` first elements by their keys. Elements
+     * with the same key are kept in the same order.
+     * @param count The number of elements, with their keys set in `keys`.
+     * @param descending true to order the elements from the biggest key to
+     * the smallest one.
+     * @param limit If positive, only the `limit` first elements are ordered
+     * (using a partial selection when the limit is small, faster than ordering
+     * all the elements). A fractional limit is rounded down.
+     * @returns The number of indices ordered in `indices`.
+     */
+    sort(count: integer, descending: boolean, limit: integer): integer {
+      const flooredLimit = Math.floor(limit);
+      const orderedCount =
+        flooredLimit >= 0 && flooredLimit < count ? flooredLimit : count;
+      if (
+        orderedCount < count &&
+        orderedCount <= SortedIndicesBuffer.maxPartialSelectionLimit
+      ) {
+        return this._selectFirsts(count, descending, orderedCount);
+      }
+
+      const indices = this.indices;
+      for (let i = 0; i < count; ++i) indices[i] = i;
+      this._mergeSort(count, descending);
+      return orderedCount;
+    }
+
+    /**
+     * Bottom-up merge sort, which is stable, using `_mergedIndices` as
+     * temporary storage.
+     */
+    private _mergeSort(count: integer, descending: boolean): void {
+      const keys = this.keys;
+      let source = this.indices;
+      let destination = this._mergedIndices;
+      for (let width = 1; width < count; width *= 2) {
+        for (let start = 0; start < count; start += 2 * width) {
+          const middle = Math.min(start + width, count);
+          const end = Math.min(start + 2 * width, count);
+          let left = start;
+          let right = middle;
+          for (let k = start; k < end; ++k) {
+            // Take the right element only if strictly before the left one,
+            // so that the order of equal elements is kept.
+            if (
+              left < middle &&
+              (right >= end ||
+                !(descending
+                  ? keys[source[right]] > keys[source[left]]
+                  : keys[source[right]] < keys[source[left]]))
+            ) {
+              destination[k] = source[left++];
+            } else {
+              destination[k] = source[right++];
+            }
+          }
+        }
+        const swapped = source;
+        source = destination;
+        destination = swapped;
+      }
+
+      if (source !== this.indices) {
+        for (let i = 0; i < count; ++i) this.indices[i] = source[i];
+      }
+    }
+
+    /**
+     * Keep in `indices` the `limit` first elements, in order, by inserting
+     * each element after the ones that are not after it.
+     */
+    private _selectFirsts(
+      count: integer,
+      descending: boolean,
+      limit: integer
+    ): integer {
+      if (limit <= 0) return 0;
+
+      const keys = this.keys;
+      const indices = this.indices;
+      let selectedCount = 0;
+      for (let i = 0; i < count; ++i) {
+        const key = keys[i];
+        if (selectedCount === limit) {
+          // Elements not strictly before the last selected one are skipped.
+          const lastKey = keys[indices[limit - 1]];
+          if (!(descending ? key > lastKey : key < lastKey)) continue;
+        }
+
+        let position = selectedCount === limit ? limit - 1 : selectedCount;
+        while (position > 0) {
+          const previousKey = keys[indices[position - 1]];
+          if (!(descending ? key > previousKey : key < previousKey)) break;
+          indices[position] = indices[position - 1];
+          position--;
+        }
+        indices[position] = i;
+        if (selectedCount < limit) selectedCount++;
+      }
+      return selectedCount;
+    }
+  }
+
   const logger = new gdjs.Logger('LongLivedObjectsLists');
   /**
    * @category Core Engine > Object
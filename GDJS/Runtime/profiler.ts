@@ -290,4 +290,143 @@ namespace gdjs {
       outputs.push.apply(outputs, subsectionsOutputs);
     }
   }
+
+  /**
+   * The time spent in an event (including its sub-events), in its conditions
+   * and in its actions, as measured by `gdjs.EventsProfiler`.
+   * @category Debugging > Profiler
+   */
+  export type EventMeasure = {
+    /** The persistent UUID of the event. */
+    eventId: string;
+    time: float;
+    count: integer;
+    conditionsTime: float;
+    conditionsCount: integer;
+    actionsTime: float;
+    actionsCount: integer;
+  };
+
+  /**
+   * Measures the time spent in each event, when the events code was generated
+   * with the events profiling hooks.
+   *
+   * Measures are stored in a typed array of counters for each events sheet:
+   * the hooks don't allocate anything and only read the time during the
+   * sampled frames.
+   * @category Debugging > Profiler
+   */
+  export class EventsProfiler {
+    /** The profiled events and their counters, for each events sheet. */
+    static _eventsSheets: Record<
+      string,
+      { eventsIds: Array<string>; counters: Float64Array }
+    > = {};
+
+    /** Sample a frame every `_samplingInterval` frames (0 to disable). */
+    static _samplingInterval: integer = 0;
+    static _framesCount: integer = 0;
+    static _isSampling: boolean = false;
+
+    static _getTimeNow: () => float =
+      typeof performance !== 'undefined' &&
+      typeof performance.now === 'function'
+        ? performance.now.bind(performance)
+        : Date.now;
+
+    /**
+     * Called by the generated code to get the counters of its events.
+     * @param sheetName The name of the events sheet (the code namespace).
+     * @param eventsIds The identifier of each profiled event.
+     */
+    static registerEvents(
+      sheetName: string,
+      eventsIds: Array<string>
+    ): Float64Array {
+      // For each event: the time and the count of the measures of the whole
+      // event, of its conditions and of its actions.
+      const counters = new Float64Array(eventsIds.length * 6);
+      EventsProfiler._eventsSheets[sheetName] = { eventsIds, counters };
+      return counters;
+    }
+
+    /**
+     * Set how often frames are measured.
+     * @param samplingInterval 1 to measure every frame, N to measure one frame
+     * out of N, 0 to stop measuring.
+     */
+    static setSamplingInterval(samplingInterval: integer): void {
+      EventsProfiler._samplingInterval = samplingInterval;
+      EventsProfiler._framesCount = 0;
+      EventsProfiler._isSampling = false;
+    }
+
+    /**
+     * To be called before the events of a frame are run, to decide if they
+     * must be measured.
+     */
+    static beginFrame(): void {
+      if (EventsProfiler._samplingInterval <= 0) {
+        EventsProfiler._isSampling = false;
+        return;
+      }
+      EventsProfiler._isSampling =
+        EventsProfiler._framesCount % EventsProfiler._samplingInterval === 0;
+      EventsProfiler._framesCount++;
+    }
+
+    /**
+     * Called by the generated code before a measured part of an event.
+     * @returns The current time, or -1 if the frame is not sampled.
+     */
+    static begin(): float {
+      return EventsProfiler._isSampling ? EventsProfiler._getTimeNow() : -1;
+    }
+
+    /**
+     * Called by the generated code after a measured part of an event.
+     */
+    static end(
+      counters: Float64Array,
+      counterIndex: integer,
+      startTime: float
+    ): void {
+      if (startTime < 0) return;
+      counters[counterIndex * 2] += EventsProfiler._getTimeNow() - startTime;
+      counters[counterIndex * 2 + 1]++;
+    }
+
+    /**
+     * Return the measures of the events of an events sheet.
+     * @param sheetName The name of the events sheet (the code namespace).
+     */
+    static getEventsMeasures(sheetName: string): Array<EventMeasure> {
+      const eventsSheet = EventsProfiler._eventsSheets[sheetName];
+      if (!eventsSheet) return [];
+
+      const { eventsIds, counters } = eventsSheet;
+      const measures: Array<EventMeasure> = [];
+      for (let i = 0; i < eventsIds.length; i++) {
+        measures.push({
+          eventId: eventsIds[i],
+          time: counters[i * 6],
+          count: counters[i * 6 + 1],
+          conditionsTime: counters[i * 6 + 2],
+          conditionsCount: counters[i * 6 + 3],
+          actionsTime: counters[i * 6 + 4],
+          actionsCount: counters[i * 6 + 5],
+        });
+      }
+      return measures;
+    }
+
+    /**
+     * Reset the measures of all the events.
+     */
+    static reset(): void {
+      for (const sheetName in EventsProfiler._eventsSheets) {
+        EventsProfiler._eventsSheets[sheetName].counters.fill(0);
+      }
+    }
+  }
 }
@@ -7,19 +7,49 @@ namespace gdjs {
   const logger = new gdjs.Logger('RuntimeScene');
   const setupWarningLogger = new gdjs.Logger('RuntimeScene (setup warnings)');
 
+  type AsyncCallback = (
+    runtimeScene: gdjs.RuntimeScene,
+    asyncObjectsList: gdjs.LongLivedObjectsList
+  ) => void;
+
+  /**
+   * Add the callbacks of the asynchronous actions of some events generated
+   * code to a map, including the ones of the linked events run by this code
+   * (they are registered in the code of the linked events).
+   */
+  const addEventsCodeCallbacks = (
+    eventsCode: any,
+    idToCallbackMap: Map<string, AsyncCallback>,
+    visitedEventsCodes: Set<any>
+  ) => {
+    if (!eventsCode || visitedEventsCodes.has(eventsCode)) return;
+    visitedEventsCodes.add(eventsCode);
+
+    if (eventsCode.idToCallbackMap) {
+      eventsCode.idToCallbackMap.forEach(
+        (callback: AsyncCallback, id: string) => {
+          idToCallbackMap.set(id, callback);
+        }
+      );
+    }
+    if (eventsCode.linkedEventsCodeNames) {
+      for (const linkedEventsCodeName of eventsCode.linkedEventsCodeNames) {
+        addEventsCodeCallbacks(
+          gdjs[linkedEventsCodeName],
+          idToCallbackMap,
+          visitedEventsCodes
+        );
+      }
+    }
+  };
+
   /**
    * A scene being played, containing instances of objects rendered on screen.
    * @category Core Engine > Scene
    */
   export class RuntimeScene extends gdjs.RuntimeInstanceContainer {
     _eventsFunction: null | ((runtimeScene: RuntimeScene) => void) = null;
-    _idToCallbackMap: null | Map<
-      string,
-      (
-        runtimeScene: gdjs.RuntimeScene,
-        asyncObjectsList: gdjs.LongLivedObjectsList
-      ) => void
-    > = null;
+    _idToCallbackMap: null | Map<string, AsyncCallback> = null;
     _renderer: RuntimeSceneRenderer;
     _debuggerRenderer: gdjs.DebuggerRenderer;
     _variables: gdjs.VariablesContainer;
@@ -356,8 +386,12 @@ namespace gdjs {
       const module = gdjs[sceneData.mangledName + 'Code'];
       if (module && module.func) {
         this._eventsFunction = module.func;
-        this._idToCallbackMap =
-          gdjs[sceneData.mangledName + 'Code'].idToCallbackMap;
+        if (module.linkedEventsCodeNames) {
+          this._idToCallbackMap = new Map();
+          addEventsCodeCallbacks(module, this._idToCallbackMap, new Set());
+        } else {
+          this._idToCallbackMap = module.idToCallbackMap;
+        }
       } else {
         setupWarningLogger.warn(
           'No function found for running logic of scene ' + this._name
@@ -420,7 +454,10 @@ namespace gdjs {
       if (this._profiler) {
         this._profiler.begin('events');
       }
-      if (this._eventsFunction !== null) this._eventsFunction(this);
+      if (this._eventsFunction !== null) {
+        gdjs.EventsProfiler.beginFrame();
+        this._eventsFunction(this);
+      }
       if (this._profiler) {
         this._profiler.end('events');
       }
@@ -476,6 +476,41 @@ namespace gdjs {
       }
     }
 
+    /**
+     * Get the child with the specified name, like `getChild`.
+     *
+     * This is used by the generated code to access a child by its name:
+     * when the variable is a structure having this child, it's returned without
+     * any conversion. Otherwise, `getChild` is used.
+     *
+     * @returns The child variable
+     */
+    getStructureChild(childName: string): gdjs.Variable {
+      if (this._type === 'structure') {
+        const child = this._children[childName];
+        if (child !== undefined && child !== null) return child;
+      }
+      return this.getChild(childName);
+    }
+
+    /**
+     * Get the child at the specified index, like `getChild`.
+     *
+     * This is used by the generated code to access a child with an integer
+     * literal: when the variable is an array having this child, it's returned
+     * without parsing the index. Otherwise, `getChild` is used (so that a
+     * structure can still have a child named after this index).
+     *
+     * @returns The child variable
+     */
+    getArrayChild(index: integer): gdjs.Variable {
+      if (this._type === 'array') {
+        const child = this._childrenArray[index];
+        if (child !== undefined && child !== null) return child;
+      }
+      return this.getChild(index);
+    }
+
     /**
      * Get the child with the specified name.
      *
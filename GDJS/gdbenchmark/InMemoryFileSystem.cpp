@@ -0,0 +1,106 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "InMemoryFileSystem.h"
+
+#undef CopyFile  // Disable an annoying macro
+
+namespace gdjs {
+
+bool InMemoryFileSystem::DirExists(const gd::String &path) {
+  if (directories.find(path) != directories.end()) return true;
+
+  // A directory containing a file exists, even if it was not created.
+  auto file = files.lower_bound(path + "/");
+  return file != files.end() && file->first.Raw().compare(
+                                    0, path.Raw().size() + 1,
+                                    (path + "/").Raw()) == 0;
+}
+
+bool InMemoryFileSystem::ClearDir(const gd::String &directory) {
+  gd::String prefix = directory + "/";
+  auto file = files.lower_bound(prefix);
+  while (file != files.end() &&
+         file->first.Raw().compare(0, prefix.Raw().size(), prefix.Raw()) == 0)
+    file = files.erase(file);
+
+  return true;
+}
+
+gd::String InMemoryFileSystem::FileNameFrom(const gd::String &file) {
+  std::size_t lastSeparator = file.Raw().find_last_of('/');
+  if (lastSeparator == std::string::npos) return file;
+
+  return gd::String::FromUTF8(file.Raw().substr(lastSeparator + 1));
+}
+
+gd::String InMemoryFileSystem::DirNameFrom(const gd::String &file) {
+  std::size_t lastSeparator = file.Raw().find_last_of('/');
+  if (lastSeparator == std::string::npos) return ".";
+
+  return gd::String::FromUTF8(file.Raw().substr(0, lastSeparator));
+}
+
+bool InMemoryFileSystem::MakeAbsolute(gd::String &filename,
+                                      const gd::String &baseDirectory) {
+  if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+  return true;
+}
+
+bool InMemoryFileSystem::MakeRelative(gd::String &filename,
+                                      const gd::String &baseDirectory) {
+  gd::String prefix = baseDirectory + "/";
+  if (filename.Raw().compare(0, prefix.Raw().size(), prefix.Raw()) == 0)
+    filename = gd::String::FromUTF8(filename.Raw().substr(prefix.Raw().size()));
+  return true;
+}
+
+bool InMemoryFileSystem::CopyFile(const gd::String &file,
+                                  const gd::String &destination) {
+  auto source = files.find(file);
+  if (source == files.end()) return false;
+
+  files[destination] = source->second;
+  return true;
+}
+
+gd::String InMemoryFileSystem::ReadFile(const gd::String &file) {
+  auto source = files.find(file);
+  return source != files.end() ? source->second : "";
+}
+
+std::vector<gd::String> InMemoryFileSystem::ReadDir(
+    const gd::String &path, const gd::String &extension) {
+  std::vector<gd::String> directoryFiles;
+  gd::String prefix = path + "/";
+  gd::String upperCaseExtension = extension.UpperCase();
+  for (auto file = files.lower_bound(prefix);
+       file != files.end() &&
+       file->first.Raw().compare(0, prefix.Raw().size(), prefix.Raw()) == 0;
+       ++file) {
+    gd::String name =
+        gd::String::FromUTF8(file->first.Raw().substr(prefix.Raw().size()));
+    if (name.find("/") != gd::String::npos) continue;
+
+    gd::String upperCaseName = name.UpperCase();
+    if (upperCaseExtension.empty() ||
+        (upperCaseName.size() >= upperCaseExtension.size() &&
+         upperCaseName.substr(upperCaseName.size() -
+                              upperCaseExtension.size()) ==
+             upperCaseExtension))
+      directoryFiles.push_back(file->first);
+  }
+
+  return directoryFiles;
+}
+
+std::size_t InMemoryFileSystem::GetFilesSize() const {
+  std::size_t size = 0;
+  for (const auto &file : files) size += file.second.Raw().size();
+
+  return size;
+}
+
+}  // namespace gdjs
@@ -0,0 +1,61 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+
+namespace gdjs {
+
+/**
+ * \brief A file system keeping the files in memory, so that benchmarks of the
+ * exporters don't measure the time spent writing on the disk.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  InMemoryFileSystem(){};
+  virtual ~InMemoryFileSystem(){};
+
+  void MkDir(const gd::String& path) override { directories.insert(path); }
+  bool DirExists(const gd::String& path) override;
+  bool FileExists(const gd::String& path) override {
+    return files.find(path) != files.end();
+  }
+  bool ClearDir(const gd::String& directory) override;
+  gd::String GetTempDir() override { return "/tmp"; }
+  gd::String FileNameFrom(const gd::String& file) override;
+  gd::String DirNameFrom(const gd::String& file) override;
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool IsAbsolute(const gd::String& filename) override {
+    return filename.empty() || filename[0] == '/';
+  }
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool CopyFile(const gd::String& file, const gd::String& destination) override;
+  bool WriteToFile(const gd::String& file, const gd::String& content) override {
+    files[file] = content;
+    return true;
+  }
+  gd::String ReadFile(const gd::String& file) override;
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension = "") override;
+
+  /**
+   * \brief Return the total size of the files, in bytes.
+   */
+  std::size_t GetFilesSize() const;
+
+ private:
+  std::map<gd::String, gd::String> files;
+  std::set<gd::String> directories;
+};
+
+}  // namespace gdjs
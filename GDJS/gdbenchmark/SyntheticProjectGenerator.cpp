@@ -0,0 +1,178 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "SyntheticProjectGenerator.h"
+
+#include <vector>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesContainer.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const std::vector<gd::String> &parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+
+const gd::String &GetStandardEventType() {
+  static const gd::String type = "BuiltinCommonInstructions::Standard";
+  return type;
+}
+
+}  // namespace
+
+namespace gdjs {
+
+void SyntheticProjectGenerator::Options::SerializeTo(
+    gd::SerializerElement &element) const {
+  element.AddChild("scenesCount").SetIntValue(scenesCount);
+  element.AddChild("eventsCountPerScene").SetIntValue(eventsCountPerScene);
+  element.AddChild("eventsDepth").SetIntValue(eventsDepth);
+  element.AddChild("objectsCountPerScene").SetIntValue(objectsCountPerScene);
+  element.AddChild("variablesCount").SetIntValue(variablesCount);
+  element.AddChild("extensionsCount").SetIntValue(extensionsCount);
+  element.AddChild("functionsCountPerExtension")
+      .SetIntValue(functionsCountPerExtension);
+}
+
+void SyntheticProjectGenerator::Options::UnserializeFrom(
+    const gd::SerializerElement &element) {
+  scenesCount = element.GetChild("scenesCount").GetIntValue();
+  eventsCountPerScene = element.GetChild("eventsCountPerScene").GetIntValue();
+  eventsDepth = element.GetChild("eventsDepth").GetIntValue();
+  objectsCountPerScene = element.GetChild("objectsCountPerScene").GetIntValue();
+  variablesCount = element.GetChild("variablesCount").GetIntValue();
+  extensionsCount = element.GetChild("extensionsCount").GetIntValue();
+  functionsCountPerExtension =
+      element.GetChild("functionsCountPerExtension").GetIntValue();
+}
+
+void SyntheticProjectGenerator::FillProject(gd::Project &project,
+                                            const Options &options) {
+  for (std::size_t i = 0; i < options.variablesCount; ++i)
+    project.GetVariables().InsertNew(GetGlobalVariableName(i)).SetValue(i);
+
+  // Each function changes a global variable with its parameter.
+  for (std::size_t i = 0; i < options.extensionsCount; ++i) {
+    auto &extension = project.InsertNewEventsFunctionsExtension(
+        GetExtensionName(i), i);
+    for (std::size_t j = 0; j < options.functionsCountPerExtension; ++j) {
+      auto &function = extension.GetEventsFunctions().InsertNewEventsFunction(
+          GetFunctionName(j), j);
+      function.SetFunctionType(gd::EventsFunction::Action);
+      function.GetParameters().AddNewParameter("Value").SetType("expression");
+
+      gd::StandardEvent event;
+      event.SetType(GetStandardEventType());
+      if (options.variablesCount > 0) {
+        event.GetActions().Insert(MakeInstruction(
+            "SetNumberVariable",
+            {GetGlobalVariableName(j % options.variablesCount), "+",
+             "Value"}));
+      }
+      function.GetEvents().InsertEvent(event);
+    }
+  }
+
+  for (std::size_t i = 0; i < options.objectsCountPerScene; ++i) {
+    project.GetResourcesManager().AddResource(
+        "Image" + gd::String::From(i),
+        "Image" + gd::String::From(i) + ".png",
+        "image");
+  }
+
+  for (std::size_t i = 0; i < options.scenesCount; ++i) {
+    auto &layout =
+        project.InsertNewLayout("Scene" + gd::String::From(i), i);
+
+    auto &group =
+        layout.GetObjects().GetObjectGroups().InsertNew(GetGroupName(), 0);
+    for (std::size_t j = 0; j < options.objectsCountPerScene; ++j) {
+      auto &object = layout.GetObjects().InsertNewObject(
+          project, "Sprite", GetObjectName(j), j);
+      group.AddObject(GetObjectName(j));
+
+      auto *spriteObject =
+          dynamic_cast<gd::SpriteObject *>(&object.GetConfiguration());
+      if (spriteObject) {
+        gd::Sprite sprite;
+        sprite.SetImageName("Image" + gd::String::From(j));
+        gd::Animation animation;
+        animation.SetDirectionsCount(1);
+        animation.GetDirection(0).AddSprite(sprite);
+        spriteObject->GetAnimations().AddAnimation(animation);
+      }
+    }
+
+    for (std::size_t j = 0; j < options.variablesCount; ++j)
+      layout.GetVariables().InsertNew(GetSceneVariableName(j)).SetValue(j);
+
+    for (std::size_t j = 0; j < options.eventsCountPerScene; ++j)
+      AddEvents(layout.GetEvents(), options, j, options.eventsDepth);
+  }
+}
+
+void SyntheticProjectGenerator::AddEvents(gd::EventsList &events,
+                                          const Options &options,
+                                          std::size_t eventIndex,
+                                          std::size_t depth) {
+  if (depth == 0) return;
+
+  gd::StandardEvent event;
+  event.SetType(GetStandardEventType());
+  if (options.objectsCountPerScene > 0) {
+    gd::String objectName =
+        GetObjectName(eventIndex % options.objectsCountPerScene);
+    event.GetConditions().Insert(
+        MakeInstruction("PosX", {objectName, "<", "1000"}));
+    event.GetActions().Insert(MakeInstruction("SetX", {objectName, "+", "1"}));
+    if (eventIndex % 4 == 0) {
+      event.GetActions().Insert(
+          MakeInstruction("SetY", {GetGroupName(), "+", "1"}));
+    }
+  }
+  if (options.variablesCount > 0) {
+    std::size_t variableIndex = eventIndex % options.variablesCount;
+    event.GetActions().Insert(MakeInstruction(
+        "SetNumberVariable",
+        {GetSceneVariableName(variableIndex), "+",
+         GetGlobalVariableName(variableIndex) + " * 2 + 1"}));
+  }
+  if (options.extensionsCount > 0 && options.functionsCountPerExtension > 0) {
+    gd::String functionType =
+        GetExtensionName(eventIndex % options.extensionsCount) +
+        "::" + GetFunctionName(eventIndex % options.functionsCountPerExtension);
+    event.GetActions().Insert(
+        MakeInstruction(functionType, {"", gd::String::From(depth), ""}));
+  }
+
+  AddEvents(event.GetSubEvents(), options, eventIndex + 1, depth - 1);
+  events.InsertEvent(event);
+}
+
+}  // namespace gdjs
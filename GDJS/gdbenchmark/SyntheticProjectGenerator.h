@@ -0,0 +1,110 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class EventsList;
+class Project;
+class SerializerElement;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Fill projects with generated content, to measure the performance of
+ * the tools working on large projects.
+ *
+ * Each scene has objects (all in a group), variables and events using them.
+ * Each event has sub-events nested up to the wanted depth. The events also
+ * call the functions of generated events functions extensions.
+ */
+class SyntheticProjectGenerator {
+ public:
+  struct Options {
+    Options()
+        : scenesCount(10),
+          eventsCountPerScene(100),
+          eventsDepth(3),
+          objectsCountPerScene(50),
+          variablesCount(50),
+          extensionsCount(10),
+          functionsCountPerExtension(5){};
+
+    std::size_t scenesCount;
+    std::size_t eventsCountPerScene;  ///< The number of events at the root of
+                                      ///< each scene.
+    std::size_t eventsDepth;  ///< The number of nested levels of each event
+                              ///< (1 for no sub-events).
+    std::size_t objectsCountPerScene;  ///< All the objects of a scene are
+                                       ///< also put in a group.
+    std::size_t variablesCount;  ///< The number of global variables, and of
+                                 ///< variables in each scene.
+    std::size_t extensionsCount;
+    std::size_t functionsCountPerExtension;
+
+    void SerializeTo(gd::SerializerElement &element) const;
+    void UnserializeFrom(const gd::SerializerElement &element);
+  };
+
+  /**
+   * \brief Fill the project, which must be using the JS platform, with the
+   * generated scenes and extensions.
+   */
+  static void FillProject(gd::Project &project, const Options &options);
+
+  /**
+   * \brief Return the name of the object of a scene.
+   */
+  static gd::String GetObjectName(std::size_t index) {
+    return "Object" + gd::String::From(index);
+  }
+
+  /**
+   * \brief Return the name of the group containing all the objects of a
+   * scene.
+   */
+  static gd::String GetGroupName() { return "AllObjects"; }
+
+  /**
+   * \brief Return the name of a global variable.
+   */
+  static gd::String GetGlobalVariableName(std::size_t index) {
+    return "GlobalVariable" + gd::String::From(index);
+  }
+
+  /**
+   * \brief Return the name of a scene variable.
+   */
+  static gd::String GetSceneVariableName(std::size_t index) {
+    return "SceneVariable" + gd::String::From(index);
+  }
+
+  /**
+   * \brief Return the name of a generated events functions extension.
+   */
+  static gd::String GetExtensionName(std::size_t index) {
+    return "BenchmarkExtension" + gd::String::From(index);
+  }
+
+  /**
+   * \brief Return the name of a function of a generated extension.
+   */
+  static gd::String GetFunctionName(std::size_t index) {
+    return "Function" + gd::String::From(index);
+  }
+
+ private:
+  static void AddEvents(gd::EventsList &events,
+                        const Options &options,
+                        std::size_t eventIndex,
+                        std::size_t depth);
+};
+
+}  // namespace gdjs
@@ -0,0 +1,493 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+/**
+ * @file gdbenchmark: measure the time spent and the memory allocated by the
+ * tools working on a whole project (serialization, code generation,
+ * refactoring...), on a generated project of the chosen size.
+ *
+ *     gdbenchmark --scenes 10 --events 100 --runs 5 --output results.json
+ *
+ * The results are printed as JSON. When a previous result is given with
+ * `--baseline`, each step is compared to it and the process fails if a step
+ * is slower or allocates more than the baseline (with a tolerance).
+ *
+ * Allocations are only counted when GDevelop is built with the
+ * `GD_ALLOCATION_COUNTING` CMake option (see gd::AllocationCounters).
+ *
+ * The logs of the tools are written to the standard error.
+ */
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "GDCore/Events/CodeGeneration/DiagnosticReport.h"
+#include "GDCore/Extensions/Metadata/AbstractFunctionMetadata.h"
+#include "GDCore/Extensions/Metadata/MultipleInstructionMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/UsedExtensionsFinder.h"
+#include "GDCore/IDE/PlatformManager.h"
+#include "GDCore/IDE/Project/SceneResourcesFinder.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/AllocationCounters.h"
+#include "GDJS/Events/CodeGeneration/MetadataDeclarationHelper.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/ExporterHelper.h"
+#include "InMemoryFileSystem.h"
+#include "SyntheticProjectGenerator.h"
+
+namespace {
+
+struct PhaseResult {
+  gd::String name;
+  std::vector<double> times;  ///< In milliseconds.
+  gd::AllocationCounts counts;
+
+  double GetMedianTime() const {
+    std::vector<double> sortedTimes = times;
+    std::sort(sortedTimes.begin(), sortedTimes.end());
+    std::size_t middle = sortedTimes.size() / 2;
+    return sortedTimes.size() % 2
+               ? sortedTimes[middle]
+               : (sortedTimes[middle - 1] + sortedTimes[middle]) / 2;
+  }
+
+  void SerializeTo(gd::SerializerElement &element) const {
+    element.AddChild("name").SetStringValue(name);
+    element.AddChild("time").SetDoubleValue(GetMedianTime());
+    element.AddChild("minTime").SetDoubleValue(
+        *std::min_element(times.begin(), times.end()));
+    element.AddChild("maxTime").SetDoubleValue(
+        *std::max_element(times.begin(), times.end()));
+    element.AddChild("allocationsCount").SetDoubleValue(counts.allocationsCount);
+    element.AddChild("allocatedBytes").SetDoubleValue(counts.allocatedBytes);
+    element.AddChild("peakBytes").SetDoubleValue(counts.peakBytes);
+  }
+};
+
+/**
+ * \brief Run the phase as many times as asked, measuring the time of each run
+ * and the allocations of the first one (if GDevelop is built with the
+ * allocation counting). \a prepare is called, without being measured, before
+ * each run.
+ */
+PhaseResult MeasurePhase(const gd::String &name,
+                         std::size_t runsCount,
+                         std::function<void()> prepare,
+                         std::function<void()> run) {
+  PhaseResult result;
+  result.name = name;
+  for (std::size_t i = 0; i < runsCount; ++i) {
+    prepare();
+
+    if (i == 0) gd::AllocationCounters::BeginPhase(name);
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto end = std::chrono::steady_clock::now();
+    if (i == 0) gd::AllocationCounters::EndPhase();
+
+    result.times.push_back(
+        std::chrono::duration<double, std::milli>(end - start).count());
+  }
+  result.counts = gd::AllocationCounters::GetPhaseCounts(name);
+
+  std::cerr << name << ": " << result.GetMedianTime() << "ms";
+  if (gd::AllocationCounters::IsEnabled())
+    std::cerr << ", " << result.counts.allocationsCount << " allocations";
+  std::cerr << std::endl;
+  return result;
+}
+
+void DeclareEventsFunctionsExtensions(gd::Project &project) {
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(i);
+    gd::PlatformExtension extension;
+    gdjs::MetadataDeclarationHelper::DeclareExtension(extension,
+                                                      eventsFunctionsExtension);
+    gdjs::MetadataDeclarationHelper helper;
+    const auto &functions = eventsFunctionsExtension.GetEventsFunctions();
+    for (std::size_t j = 0; j < functions.GetEventsFunctionsCount(); ++j) {
+      helper.GenerateFreeFunctionMetadata(project,
+                                          extension,
+                                          eventsFunctionsExtension,
+                                          functions.GetEventsFunction(j));
+    }
+    gdjs::JsPlatform::Get().AddNewExtension(extension);
+  }
+}
+
+void RenameGlobalVariable(gd::Project &project,
+                          const gd::String &oldName,
+                          const gd::String &newName) {
+  auto &variables = project.GetVariables();
+  variables.ResetPersistentUuid();
+  gd::SerializerElement originalSerializedVariables;
+  variables.SerializeTo(originalSerializedVariables);
+
+  variables.Rename(oldName, newName);
+  auto changeset =
+      gd::WholeProjectRefactorer::ComputeChangesetForVariablesContainer(
+          originalSerializedVariables, variables);
+  gd::WholeProjectRefactorer::ApplyRefactoringForVariablesContainer(
+      project, variables, changeset, originalSerializedVariables);
+}
+
+void RenameObjectOrGroup(gd::Project &project,
+                         gd::Layout &layout,
+                         const gd::String &oldName,
+                         const gd::String &newName,
+                         bool isObjectGroup) {
+  if (isObjectGroup)
+    layout.GetObjects().GetObjectGroups().Get(oldName).SetName(newName);
+  else
+    layout.GetObjects().GetObject(oldName).SetName(newName);
+
+  gd::WholeProjectRefactorer::ObjectOrGroupRenamedInScene(
+      project, layout, oldName, newName, isObjectGroup);
+}
+
+void RenameEventsFunction(gd::Project &project,
+                          const gd::String &oldName,
+                          const gd::String &newName) {
+  auto &eventsFunctionsExtension = project.GetEventsFunctionsExtension(0);
+  gd::WholeProjectRefactorer::RenameEventsFunction(
+      project, eventsFunctionsExtension, oldName, newName);
+  eventsFunctionsExtension.GetEventsFunctions()
+      .GetEventsFunction(oldName)
+      .SetName(newName);
+}
+
+/**
+ * \brief Compare the results to a baseline, and return true if there is no
+ * regression.
+ *
+ * Allocations are only compared if they were counted for both.
+ */
+bool CompareToBaseline(const std::vector<PhaseResult> &results,
+                       const gd::SerializerElement &baselineElement,
+                       double tolerance,
+                       gd::SerializerElement &comparisonElement) {
+  bool compareAllocations =
+      gd::AllocationCounters::IsEnabled() &&
+      baselineElement.HasChild("allocationCounting") &&
+      baselineElement.GetChild("allocationCounting").GetBoolValue();
+  comparisonElement.AddChild("tolerance").SetDoubleValue(tolerance);
+  auto &phasesElement = comparisonElement.AddChild("phases");
+  phasesElement.ConsiderAsArray();
+  auto &regressionsElement = comparisonElement.AddChild("regressions");
+  regressionsElement.ConsiderAsArray();
+
+  const auto &baselinePhasesElement = baselineElement.GetChild("phases");
+  baselinePhasesElement.ConsiderAsArray();
+  bool hasRegressions = false;
+  for (const auto &result : results) {
+    for (std::size_t i = 0; i < baselinePhasesElement.GetChildrenCount(); ++i) {
+      const auto &baselinePhaseElement = baselinePhasesElement.GetChild(i);
+      if (baselinePhaseElement.GetChild("name").GetStringValue() != result.name)
+        continue;
+
+      auto &phaseElement = phasesElement.AddChild("");
+      phaseElement.AddChild("name").SetStringValue(result.name);
+
+      auto compare = [&](const gd::String &metric, double current) {
+        double baseline = baselinePhaseElement.GetChild(metric).GetDoubleValue();
+        double ratio = baseline > 0 ? current / baseline : 1;
+        phaseElement.AddChild(metric + "Ratio").SetDoubleValue(ratio);
+        if (ratio <= 1 + tolerance) return;
+
+        hasRegressions = true;
+        auto &regressionElement = regressionsElement.AddChild("");
+        regressionElement.AddChild("name").SetStringValue(result.name);
+        regressionElement.AddChild("metric").SetStringValue(metric);
+        regressionElement.AddChild("baseline").SetDoubleValue(baseline);
+        regressionElement.AddChild("current").SetDoubleValue(current);
+      };
+      compare("time", result.GetMedianTime());
+      if (compareAllocations) {
+        compare("allocationsCount", result.counts.allocationsCount);
+        compare("peakBytes", result.counts.peakBytes);
+      }
+    }
+  }
+
+  return !hasRegressions;
+}
+
+/**
+ * \brief Mark the serialized project as saved by a recent version of
+ * GDevelop.
+ *
+ * Native builds are versioned 0.0.0, so the generated project would be
+ * loaded as a very old project and its instructions "updated" by the
+ * compatibility code.
+ */
+void MarkAsSavedByRecentVersion(gd::SerializerElement &projectElement) {
+  auto &versionElement = projectElement.GetChild("gdVersion");
+  versionElement.SetAttribute("major", 5);
+  versionElement.SetAttribute("minor", 6);
+  versionElement.SetAttribute("build", 300);
+  versionElement.SetAttribute("revision", 0);
+}
+
+void PrintUsage() {
+  std::cerr
+      << "Usage: gdbenchmark [options]\n"
+         "  --scenes <n>           The number of scenes.\n"
+         "  --events <n>           The number of events at the root of each "
+         "scene.\n"
+         "  --depth <n>            The number of nested levels of each "
+         "event.\n"
+         "  --objects <n>          The number of objects in each scene (all "
+         "in a group).\n"
+         "  --variables <n>        The number of global and scene "
+         "variables.\n"
+         "  --extensions <n>       The number of events functions "
+         "extensions.\n"
+         "  --functions <n>        The number of functions in each "
+         "extension.\n"
+         "  --runs <n>             The number of runs of each step (default: "
+         "5).\n"
+         "  --output <file>        Write the results to a file instead of the "
+         "standard output.\n"
+         "  --baseline <file>      Compare the results to previous results.\n"
+         "  --tolerance <ratio>    The allowed increase compared to the "
+         "baseline (default: 0.2).\n"
+      << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  gdjs::SyntheticProjectGenerator::Options options;
+  std::size_t runsCount = 5;
+  gd::String outputFile;
+  gd::String baselineFile;
+  double tolerance = 0.2;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string argument = argv[i];
+    if (argument == "--help") {
+      PrintUsage();
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      std::cerr << "Unknown or incomplete argument: " << argument << std::endl;
+      PrintUsage();
+      return 2;
+    }
+
+    std::string value = argv[++i];
+    if (argument == "--scenes") {
+      options.scenesCount = std::stoul(value);
+    } else if (argument == "--events") {
+      options.eventsCountPerScene = std::stoul(value);
+    } else if (argument == "--depth") {
+      options.eventsDepth = std::stoul(value);
+    } else if (argument == "--objects") {
+      options.objectsCountPerScene = std::stoul(value);
+    } else if (argument == "--variables") {
+      options.variablesCount = std::stoul(value);
+    } else if (argument == "--extensions") {
+      options.extensionsCount = std::stoul(value);
+    } else if (argument == "--functions") {
+      options.functionsCountPerExtension = std::stoul(value);
+    } else if (argument == "--runs") {
+      runsCount = std::max<std::size_t>(1, std::stoul(value));
+    } else if (argument == "--output") {
+      outputFile = gd::String::FromUTF8(value);
+    } else if (argument == "--baseline") {
+      baselineFile = gd::String::FromUTF8(value);
+    } else if (argument == "--tolerance") {
+      tolerance = std::stod(value);
+    } else {
+      std::cerr << "Unknown argument: " << argument << std::endl;
+      PrintUsage();
+      return 2;
+    }
+  }
+
+  // Keep the standard output for the results.
+  std::ostream output(std::cout.rdbuf());
+  std::cout.rdbuf(std::cerr.rdbuf());
+
+  gd::PlatformManager::Get()->AddPlatform(
+      std::shared_ptr<gd::Platform>(&gdjs::JsPlatform::Get()));
+
+  gd::Project generatedProject;
+  generatedProject.AddPlatform(gdjs::JsPlatform::Get());
+  gdjs::SyntheticProjectGenerator::FillProject(generatedProject, options);
+
+  gd::AllocationCounters::Reset();
+  std::vector<PhaseResult> results;
+  gd::SerializerElement serializedProject;
+  results.push_back(MeasurePhase(
+      "SerializeTo",
+      runsCount,
+      [&]() { serializedProject = gd::SerializerElement(); },
+      [&]() { generatedProject.SerializeTo(serializedProject); }));
+  MarkAsSavedByRecentVersion(serializedProject);
+
+  gd::String projectJson;
+  results.push_back(MeasurePhase(
+      "ToJSON", runsCount, []() {}, [&]() {
+        projectJson = gd::Serializer::ToJSON(serializedProject);
+      }));
+
+  gd::SerializerElement parsedProject;
+  results.push_back(MeasurePhase(
+      "FromJSON", runsCount, []() {}, [&]() {
+        parsedProject = gd::Serializer::FromJSON(projectJson);
+      }));
+
+  std::unique_ptr<gd::Project> project;
+  results.push_back(MeasurePhase(
+      "UnserializeFrom",
+      runsCount,
+      [&]() {
+        project.reset(new gd::Project);
+        project->AddPlatform(gdjs::JsPlatform::Get());
+      },
+      [&]() { project->UnserializeFrom(parsedProject); }));
+
+  results.push_back(MeasurePhase(
+      "DeclareExtensions", runsCount, []() {}, [&]() {
+        DeclareEventsFunctionsExtensions(*project);
+      }));
+
+  std::unique_ptr<gdjs::InMemoryFileSystem> fs;
+  std::size_t generatedCodeSize = 0;
+  results.push_back(MeasurePhase(
+      "ExportScenesEventsCode",
+      runsCount,
+      [&]() { fs.reset(new gdjs::InMemoryFileSystem); },
+      [&]() {
+        gdjs::ExporterHelper helper(*fs, "/gdjs", "/code");
+        std::vector<gd::String> includesFiles;
+        gd::WholeProjectDiagnosticReport wholeProjectDiagnosticReport;
+        helper.ExportScenesEventsCode(*project,
+                                      "/code",
+                                      includesFiles,
+                                      wholeProjectDiagnosticReport,
+                                      false);
+        generatedCodeSize = fs->GetFilesSize();
+      }));
+
+  results.push_back(MeasurePhase(
+      "UsedExtensionsFinder", runsCount, []() {}, [&]() {
+        gd::UsedExtensionsFinder::ScanProject(*project);
+      }));
+
+  results.push_back(MeasurePhase(
+      "SceneResourcesFinder", runsCount, []() {}, [&]() {
+        for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i)
+          gd::SceneResourcesFinder::FindSceneResources(
+              *project, project->GetLayout(i), false);
+      }));
+
+  // Each refactoring is done twice, to get back to the original project.
+  if (project->GetLayoutsCount() > 0 && options.objectsCountPerScene > 0) {
+    gd::String objectName =
+        gdjs::SyntheticProjectGenerator::GetObjectName(0);
+    results.push_back(MeasurePhase(
+        "ObjectOrGroupRenamedInScene", runsCount, []() {}, [&]() {
+          auto &layout = project->GetLayout(0);
+          RenameObjectOrGroup(
+              *project, layout, objectName, "Renamed" + objectName, false);
+          RenameObjectOrGroup(
+              *project, layout, "Renamed" + objectName, objectName, false);
+          gd::String groupName =
+              gdjs::SyntheticProjectGenerator::GetGroupName();
+          RenameObjectOrGroup(
+              *project, layout, groupName, "Renamed" + groupName, true);
+          RenameObjectOrGroup(
+              *project, layout, "Renamed" + groupName, groupName, true);
+        }));
+  }
+  if (options.variablesCount > 0) {
+    gd::String variableName =
+        gdjs::SyntheticProjectGenerator::GetGlobalVariableName(0);
+    results.push_back(MeasurePhase(
+        "ApplyRefactoringForVariablesContainer", runsCount, []() {}, [&]() {
+          RenameGlobalVariable(*project, variableName, "Renamed" + variableName);
+          RenameGlobalVariable(*project, "Renamed" + variableName, variableName);
+        }));
+  }
+  if (options.extensionsCount > 0 && options.functionsCountPerExtension > 0) {
+    gd::String functionName =
+        gdjs::SyntheticProjectGenerator::GetFunctionName(0);
+    results.push_back(MeasurePhase(
+        "RenameEventsFunction", runsCount, []() {}, [&]() {
+          RenameEventsFunction(*project, functionName, "Renamed" + functionName);
+          RenameEventsFunction(*project, "Renamed" + functionName, functionName);
+        }));
+  }
+
+  gd::SerializerElement resultsElement;
+  options.SerializeTo(resultsElement.AddChild("options"));
+  resultsElement.AddChild("runsCount").SetIntValue(runsCount);
+  resultsElement.AddChild("allocationCounting")
+      .SetBoolValue(gd::AllocationCounters::IsEnabled());
+  resultsElement.AddChild("projectJsonSize").SetIntValue(projectJson.size());
+  resultsElement.AddChild("generatedCodeSize").SetIntValue(generatedCodeSize);
+  auto &phasesElement = resultsElement.AddChild("phases");
+  phasesElement.ConsiderAsArray();
+  for (const auto &result : results)
+    result.SerializeTo(phasesElement.AddChild(""));
+
+  bool success = true;
+  if (!baselineFile.empty()) {
+    std::ifstream baselineStream(baselineFile.c_str());
+    std::stringstream baselineContent;
+    baselineContent << baselineStream.rdbuf();
+    gd::SerializerElement baselineElement = gd::Serializer::FromJSON(
+        gd::String::FromUTF8(baselineContent.str()));
+
+    gdjs::SyntheticProjectGenerator::Options baselineOptions;
+    baselineOptions.UnserializeFrom(baselineElement.GetChild("options"));
+    gd::SerializerElement optionsElement, baselineOptionsElement;
+    options.SerializeTo(optionsElement);
+    baselineOptions.SerializeTo(baselineOptionsElement);
+    if (!baselineStream.is_open() ||
+        gd::Serializer::ToJSON(optionsElement) !=
+            gd::Serializer::ToJSON(baselineOptionsElement)) {
+      std::cerr << "The baseline can't be read or was made with other options."
+                << std::endl;
+      success = false;
+    } else {
+      success = CompareToBaseline(results,
+                                  baselineElement,
+                                  tolerance,
+                                  resultsElement.AddChild("comparison"));
+    }
+  }
+
+  gd::String resultsJson = gd::Serializer::ToJSON(resultsElement);
+  if (outputFile.empty()) {
+    output << resultsJson << std::endl;
+  } else {
+    std::ofstream outputStream(outputFile.c_str());
+    outputStream << resultsJson << std::endl;
+  }
+
+  return success ? 0 : 1;
+}
@@ -0,0 +1,251 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "EventsFunctionsExtensionsLoader.h"
+
+#include <cctype>
+#include <map>
+#include <set>
+
+#include "GDCore/Extensions/Metadata/AbstractFunctionMetadata.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/MultipleInstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/EventsFunctionsExtensionCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/MetadataDeclarationHelper.h"
+#include "GDJS/Events/CodeGeneration/ObjectCodeGenerator.h"
+#include "GDJS/Extensions/JsPlatform.h"
+
+namespace gdjs {
+
+gd::String EventsFunctionsExtensionsLoader::GetIncludeFileFor(
+    const gd::String &codeNamespace) const {
+  // Make a file name from the namespace, like the IDE does.
+  std::string slug;
+  for (char character : codeNamespace.Raw()) {
+    slug += std::isalnum(static_cast<unsigned char>(character))
+                ? static_cast<char>(
+                      std::tolower(static_cast<unsigned char>(character)))
+                : '-';
+  }
+
+  return codeOutputDir + "/" + gd::String::FromUTF8(slug) + ".js";
+}
+
+gd::String EventsFunctionsExtensionsLoader::GetEventsFunctionsExtensionsSignature(
+    const gd::Project &project) {
+  gd::String signature;
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    gd::SerializerElement element;
+    project.GetEventsFunctionsExtension(i).SerializeTo(element);
+    signature += gd::Serializer::ToJSON(element);
+  }
+
+  return signature;
+}
+
+void EventsFunctionsExtensionsLoader::UnloadEventsFunctionsExtensions() {
+  for (const auto &extensionName : loadedExtensionNames)
+    JsPlatform::Get().RemoveExtension(extensionName);
+
+  loadedExtensionNames.clear();
+  loadedExtensionsSignature.clear();
+}
+
+bool EventsFunctionsExtensionsLoader::LoadProjectEventsFunctionsExtensions(
+    gd::Project &project) {
+  lastError.clear();
+  lastLoadReusedExtensions = false;
+
+  gd::String signature = GetEventsFunctionsExtensionsSignature(project);
+  if (!loadedExtensionNames.empty() && signature == loadedExtensionsSignature) {
+    lastLoadReusedExtensions = true;
+    return true;
+  }
+
+  UnloadEventsFunctionsExtensions();
+  if (!fs.DirExists(codeOutputDir)) fs.MkDir(codeOutputDir);
+
+  // First pass: declare all the extensions without generating code, as the
+  // events of the functions can use functions of the other extensions.
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    const auto &eventsFunctionsExtension =
+        project.GetEventsFunctionsExtension(i);
+    gd::PlatformExtension extension;
+    GenerateEventsFunctionsExtension(
+        project, extension, eventsFunctionsExtension, false);
+    JsPlatform::Get().AddNewExtension(extension);
+    loadedExtensionNames.push_back(eventsFunctionsExtension.GetName());
+  }
+
+  // Second pass: declare the extensions again, with the include files needed
+  // by the generated code.
+  bool success = true;
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    gd::PlatformExtension extension;
+    success &= GenerateEventsFunctionsExtension(
+        project, extension, project.GetEventsFunctionsExtension(i), true);
+    JsPlatform::Get().AddNewExtension(extension);
+  }
+
+  if (success) loadedExtensionsSignature = signature;
+  return success;
+}
+
+bool EventsFunctionsExtensionsLoader::GenerateEventsFunctionsExtension(
+    gd::Project &project,
+    gd::PlatformExtension &extension,
+    const gd::EventsFunctionsExtension &eventsFunctionsExtension,
+    bool generateCode) {
+  MetadataDeclarationHelper::DeclareExtension(extension,
+                                              eventsFunctionsExtension);
+  gd::String codeNamespacePrefix =
+      MetadataDeclarationHelper::GetExtensionCodeNamespacePrefix(
+          eventsFunctionsExtension);
+
+  // Using a behavior, an object or a free function of the extension always
+  // includes the free functions of the extension.
+  std::vector<gd::String> extensionIncludeFiles;
+  const auto &freeEventsFunctions = eventsFunctionsExtension.GetEventsFunctions();
+  for (std::size_t i = 0; i < freeEventsFunctions.GetEventsFunctionsCount();
+       ++i) {
+    extensionIncludeFiles.push_back(
+        GetIncludeFileFor(MetadataDeclarationHelper::GetFreeFunctionCodeName(
+            eventsFunctionsExtension,
+            freeEventsFunctions.GetEventsFunction(i))));
+  }
+
+  bool success = true;
+  auto writeCode = [this, &success](const gd::String &includeFile,
+                                    const gd::String &code) {
+    if (!fs.WriteToFile(includeFile, code)) {
+      lastError += "Unable to write the generated code to " + includeFile +
+                   ".\n";
+      success = false;
+    }
+  };
+
+  for (std::size_t i = 0;
+       i < eventsFunctionsExtension.GetEventsBasedBehaviors().GetCount();
+       ++i) {
+    const auto &eventsBasedBehavior =
+        eventsFunctionsExtension.GetEventsBasedBehaviors().Get(i);
+    std::map<gd::String, gd::String> behaviorMethodMangledNames;
+    auto &behaviorMetadata = MetadataDeclarationHelper::GenerateBehaviorMetadata(
+        project,
+        extension,
+        eventsFunctionsExtension,
+        eventsBasedBehavior,
+        behaviorMethodMangledNames);
+
+    gd::String codeNamespace =
+        MetadataDeclarationHelper::GetBehaviorFunctionCodeNamespace(
+            eventsBasedBehavior, codeNamespacePrefix);
+    gd::String includeFile = GetIncludeFileFor(codeNamespace);
+    behaviorMetadata.AddIncludeFile(includeFile);
+    for (const auto &extensionIncludeFile : extensionIncludeFiles)
+      behaviorMetadata.AddIncludeFile(extensionIncludeFile);
+
+    if (generateCode) {
+      std::set<gd::String> includeFiles;
+      BehaviorCodeGenerator behaviorCodeGenerator(project);
+      // Always generate the code for runtime, as it is used for both previews
+      // and exports.
+      gd::String code = behaviorCodeGenerator.GenerateRuntimeBehaviorCompleteCode(
+          eventsFunctionsExtension,
+          eventsBasedBehavior,
+          codeNamespace,
+          behaviorMethodMangledNames,
+          includeFiles,
+          true);
+      for (const auto &requiredIncludeFile : includeFiles)
+        behaviorMetadata.AddIncludeFile(requiredIncludeFile);
+
+      writeCode(includeFile, code);
+    }
+  }
+
+  for (std::size_t i = 0;
+       i < eventsFunctionsExtension.GetEventsBasedObjects().GetCount();
+       ++i) {
+    const auto &eventsBasedObject =
+        eventsFunctionsExtension.GetEventsBasedObjects().Get(i);
+    std::map<gd::String, gd::String> objectMethodMangledNames;
+    auto &objectMetadata = MetadataDeclarationHelper::GenerateObjectMetadata(
+        project,
+        extension,
+        eventsFunctionsExtension,
+        eventsBasedObject,
+        objectMethodMangledNames);
+
+    gd::String codeNamespace =
+        MetadataDeclarationHelper::GetObjectFunctionCodeNamespace(
+            eventsBasedObject, codeNamespacePrefix);
+    gd::String includeFile = GetIncludeFileFor(codeNamespace);
+    objectMetadata.AddIncludeFile(includeFile);
+    for (const auto &extensionIncludeFile : extensionIncludeFiles)
+      objectMetadata.AddIncludeFile(extensionIncludeFile);
+
+    if (generateCode) {
+      std::set<gd::String> includeFiles;
+      ObjectCodeGenerator objectCodeGenerator(project);
+      gd::String code = objectCodeGenerator.GenerateRuntimeObjectCompleteCode(
+          eventsFunctionsExtension,
+          eventsBasedObject,
+          codeNamespace,
+          objectMethodMangledNames,
+          includeFiles,
+          true);
+      for (const auto &requiredIncludeFile : includeFiles)
+        objectMetadata.AddIncludeFile(requiredIncludeFile);
+
+      writeCode(includeFile, code);
+    }
+  }
+
+  MetadataDeclarationHelper metadataDeclarationHelper;
+  for (std::size_t i = 0; i < freeEventsFunctions.GetEventsFunctionsCount();
+       ++i) {
+    const auto &eventsFunction = freeEventsFunctions.GetEventsFunction(i);
+    auto &functionMetadata =
+        metadataDeclarationHelper.GenerateFreeFunctionMetadata(
+            project, extension, eventsFunctionsExtension, eventsFunction);
+    for (const auto &extensionIncludeFile : extensionIncludeFiles)
+      functionMetadata.AddIncludeFile(extensionIncludeFile);
+
+    if (generateCode) {
+      std::set<gd::String> includeFiles;
+      EventsFunctionsExtensionCodeGenerator codeGenerator(project);
+      gd::String code = codeGenerator.GenerateFreeEventsFunctionCompleteCode(
+          eventsFunctionsExtension,
+          eventsFunction,
+          MetadataDeclarationHelper::GetFreeFunctionCodeNamespace(
+              eventsFunction, codeNamespacePrefix),
+          includeFiles,
+          true);
+      for (const auto &requiredIncludeFile : includeFiles)
+        functionMetadata.AddIncludeFile(requiredIncludeFile);
+
+      writeCode(extensionIncludeFiles[i], code);
+    }
+  }
+
+  return success;
+}
+
+}  // namespace gdjs
@@ -0,0 +1,106 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class AbstractFileSystem;
+class EventsFunctionsExtension;
+class PlatformExtension;
+class Project;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Load the events functions extensions of a project in the JS platform
+ * and write the code generated for their functions, behaviors and objects.
+ *
+ * This is the native counterpart of the loader used by the IDE: extensions
+ * are first all declared (so that functions can use the functions of other
+ * extensions), then declared again with the include files of the generated
+ * code.
+ *
+ * The loaded extensions are kept between calls: if the events functions
+ * extensions of a project are the same as the ones loaded for the previous
+ * call, nothing is declared nor generated again.
+ */
+class EventsFunctionsExtensionsLoader {
+ public:
+  /**
+   * \param fileSystem The file system used to write the generated code.
+   * \param codeOutputDirectory The absolute path of the directory where the
+   * generated code is written.
+   */
+  EventsFunctionsExtensionsLoader(gd::AbstractFileSystem &fileSystem,
+                                  const gd::String &codeOutputDirectory)
+      : fs(fileSystem),
+        codeOutputDir(codeOutputDirectory),
+        lastLoadReusedExtensions(false){};
+  virtual ~EventsFunctionsExtensionsLoader(){};
+
+  /**
+   * \brief Load the events functions extensions of the project, unloading the
+   * ones loaded for another project.
+   *
+   * \return true if the code of all the extensions was generated and written.
+   */
+  bool LoadProjectEventsFunctionsExtensions(gd::Project &project);
+
+  /**
+   * \brief Unload all the extensions loaded by this loader.
+   */
+  void UnloadEventsFunctionsExtensions();
+
+  /**
+   * \brief Return true if the last call to LoadProjectEventsFunctionsExtensions
+   * reused the extensions already loaded.
+   */
+  bool HasLastLoadReusedExtensions() const { return lastLoadReusedExtensions; }
+
+  /**
+   * \brief Return the error that occurred during the last load.
+   */
+  const gd::String &GetLastError() const { return lastError; }
+
+  /**
+   * \brief Return the path of the file where the code of a namespace is
+   * written.
+   */
+  gd::String GetIncludeFileFor(const gd::String &codeNamespace) const;
+
+ private:
+  /**
+   * \brief Declare the metadata of an extension, its behaviors, its objects
+   * and its free functions, and generate their code if \a generateCode is
+   * true.
+   */
+  bool GenerateEventsFunctionsExtension(
+      gd::Project &project,
+      gd::PlatformExtension &extension,
+      const gd::EventsFunctionsExtension &eventsFunctionsExtension,
+      bool generateCode);
+
+  /**
+   * \brief Return the serialized content of all the events functions
+   * extensions of a project.
+   */
+  static gd::String GetEventsFunctionsExtensionsSignature(
+      const gd::Project &project);
+
+  gd::AbstractFileSystem &fs;
+  gd::String codeOutputDir;
+  gd::String loadedExtensionsSignature;  ///< The events functions extensions
+                                         ///< that are currently loaded.
+  std::vector<gd::String> loadedExtensionNames;
+  bool lastLoadReusedExtensions;
+  gd::String lastError;
+};
+
+}  // namespace gdjs
@@ -0,0 +1,142 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "HeadlessExporter.h"
+
+#include <chrono>
+#include <memory>
+
+#include "GDCore/IDE/ExtensionsLoader.h"
+#include "GDCore/IDE/PlatformManager.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/Exporter.h"
+#include "GDJS/IDE/ExporterHelper.h"
+
+namespace {
+double GetTimeNow() {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace
+
+namespace gdjs {
+
+void HeadlessExportRequest::UnserializeFrom(
+    const gd::SerializerElement &element) {
+  projectFile = element.GetChild("project").GetStringValue();
+  exportPath = element.GetChild("output").GetStringValue();
+  if (element.HasChild("target"))
+    target = element.GetChild("target").GetStringValue();
+  if (element.HasChild("layout"))
+    layoutName = element.GetChild("layout").GetStringValue();
+}
+
+HeadlessExporter::HeadlessExporter(
+    const gd::String &gdjsRoot_,
+    const gd::String &extensionsDirectory,
+    const gd::SerializerElement *builtinExtensionsSnapshot)
+    : gdjsRoot(gdjsRoot_),
+      eventsFunctionsExtensionsLoader(
+          fs, fs.GetTempDir() + "/GDGeneratedEventsFunctions") {
+  fs.MakeAbsolute(gdjsRoot, LocalFileSystem::GetCurrentDir());
+  InitializePlatform(extensionsDirectory, builtinExtensionsSnapshot);
+}
+
+HeadlessExporter::~HeadlessExporter() { fs.RemoveTempDir(); }
+
+void HeadlessExporter::InitializePlatform(
+    const gd::String &extensionsDirectory,
+    const gd::SerializerElement *builtinExtensionsSnapshot) {
+  static bool initialized = false;
+  if (initialized) return;
+
+  initialized = true;
+  if (builtinExtensionsSnapshot)
+    JsPlatform::CreateSingleton(*builtinExtensionsSnapshot);
+  // The platform is a singleton: let the platform manager destroy it as the
+  // platform loader does, instead of deleting it.
+  gd::PlatformManager::Get()->AddPlatform(
+      std::shared_ptr<gd::Platform>(&JsPlatform::Get(), [](gd::Platform *) {
+        JsPlatform::DestroySingleton();
+      }));
+  if (!extensionsDirectory.empty()) {
+    gd::ExtensionsLoader::LoadAllExtensions(
+        extensionsDirectory, JsPlatform::Get(), true);
+    gd::ExtensionsLoader::ExtensionsLoadingDone(extensionsDirectory);
+  }
+}
+
+bool HeadlessExporter::Export(const HeadlessExportRequest &request,
+                              gd::SerializerElement &result) {
+  double startTime = GetTimeNow();
+  bool success = false;
+  gd::String error;
+  double loadProjectTime = 0;
+  double loadExtensionsTime = 0;
+  double exportTime = 0;
+
+  gd::String projectFile = request.projectFile;
+  gd::String exportPath = request.exportPath;
+  fs.MakeAbsolute(projectFile, LocalFileSystem::GetCurrentDir());
+  fs.MakeAbsolute(exportPath, LocalFileSystem::GetCurrentDir());
+
+  if (request.projectFile.empty() || request.exportPath.empty()) {
+    error = "A project file and an output directory must be specified.";
+  } else if (!fs.FileExists(projectFile)) {
+    error = "The project file \"" + projectFile + "\" does not exist.";
+  } else {
+    double stepStartTime = GetTimeNow();
+    gd::Project project;
+    project.AddPlatform(JsPlatform::Get());
+    project.UnserializeFrom(gd::Serializer::FromJSON(fs.ReadFile(projectFile)));
+    // Resources are found relatively to the project file.
+    project.SetProjectFile(projectFile);
+    loadProjectTime = GetTimeNow() - stepStartTime;
+
+    stepStartTime = GetTimeNow();
+    bool extensionsLoaded =
+        eventsFunctionsExtensionsLoader.LoadProjectEventsFunctionsExtensions(
+            project);
+    loadExtensionsTime = GetTimeNow() - stepStartTime;
+    result.AddChild("reusedExtensions")
+        .SetBoolValue(eventsFunctionsExtensionsLoader
+                          .HasLastLoadReusedExtensions());
+
+    if (!extensionsLoaded) {
+      error = eventsFunctionsExtensionsLoader.GetLastError();
+    } else {
+      stepStartTime = GetTimeNow();
+      Exporter exporter(fs, gdjsRoot);
+      if (request.target == "preview") {
+        PreviewExportOptions options(project, exportPath);
+        options.SetLayoutName(request.layoutName);
+        success = exporter.ExportProjectForPixiPreview(options);
+      } else {
+        ExportOptions options(project, exportPath);
+        options.SetTarget(request.target == "html5" ? "" : request.target);
+        success = exporter.ExportWholePixiProject(options);
+      }
+      exportTime = GetTimeNow() - stepStartTime;
+
+      if (!success) error = exporter.GetLastError();
+    }
+  }
+
+  result.AddChild("success").SetBoolValue(success);
+  result.AddChild("error").SetStringValue(error);
+  result.AddChild("project").SetStringValue(projectFile);
+  result.AddChild("target").SetStringValue(request.target);
+  result.AddChild("loadProjectTime").SetDoubleValue(loadProjectTime);
+  result.AddChild("loadExtensionsTime").SetDoubleValue(loadExtensionsTime);
+  result.AddChild("exportTime").SetDoubleValue(exportTime);
+  result.AddChild("totalTime").SetDoubleValue(GetTimeNow() - startTime);
+  return success;
+}
+
+}  // namespace gdjs
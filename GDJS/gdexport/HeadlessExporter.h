@@ -0,0 +1,88 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include "EventsFunctionsExtensionsLoader.h"
+#include "GDCore/String.h"
+#include "LocalFileSystem.h"
+
+namespace gd {
+class SerializerElement;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief The description of an export done by gdjs::HeadlessExporter.
+ */
+struct HeadlessExportRequest {
+  HeadlessExportRequest() : target("html5"){};
+
+  /**
+   * \brief Read a request from its JSON representation, for example
+   * `{"project": "game.json", "output": "export", "target": "preview"}`.
+   */
+  void UnserializeFrom(const gd::SerializerElement &element);
+
+  gd::String projectFile;  ///< The path to the project JSON file.
+  gd::String exportPath;   ///< The directory where the game is exported.
+  gd::String target;  ///< `html5`, `cordova`, `electron`,
+                      ///< `facebookInstantGames` or `preview`.
+  gd::String layoutName;  ///< The scene to launch, for a preview.
+};
+
+/**
+ * \brief Export projects to HTML5 games, outside of the IDE.
+ *
+ * The JS platform (with the extensions) is initialized once, and the events
+ * functions extensions are kept loaded between exports, so that an instance
+ * can be reused to export the same project again at a lower cost.
+ */
+class HeadlessExporter {
+ public:
+  /**
+   * \param gdjsRoot The directory containing the built GDJS runtime (in a
+   * "Runtime" folder).
+   * \param extensionsDirectory The directory where the native extensions are
+   * loaded from, or an empty string to only use the builtin extensions.
+   * \param builtinExtensionsSnapshot If not null, the snapshot the builtin
+   * extensions are restored from (see gdjs::JsPlatform::CreateSingleton).
+   */
+  HeadlessExporter(
+      const gd::String &gdjsRoot,
+      const gd::String &extensionsDirectory,
+      const gd::SerializerElement *builtinExtensionsSnapshot = nullptr);
+
+  /**
+   * \brief Remove the temporary files of the process (including the code
+   * generated for the events functions extensions).
+   */
+  virtual ~HeadlessExporter();
+
+  /**
+   * \brief Export a project, and store the result of the export (success,
+   * error and time spent in milliseconds in each step) in \a result.
+   *
+   * \return true if the export succeeded.
+   */
+  bool Export(const HeadlessExportRequest &request,
+              gd::SerializerElement &result);
+
+ private:
+  /**
+   * \brief Register the JS platform and load the native extensions, the first
+   * time an exporter is created.
+   */
+  static void InitializePlatform(
+      const gd::String &extensionsDirectory,
+      const gd::SerializerElement *builtinExtensionsSnapshot);
+
+  LocalFileSystem fs;
+  gd::String gdjsRoot;
+  EventsFunctionsExtensionsLoader eventsFunctionsExtensionsLoader;
+};
+
+}  // namespace gdjs
@@ -0,0 +1,276 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "LocalFileSystem.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#undef CopyFile  // Disable an annoying macro
+
+namespace {
+
+std::vector<std::string> SplitPath(const std::string &path) {
+  std::vector<std::string> segments;
+  std::string segment;
+  std::istringstream stream(path);
+  while (std::getline(stream, segment, '/')) {
+    if (!segment.empty()) segments.push_back(segment);
+  }
+  return segments;
+}
+
+}  // namespace
+
+namespace gdjs {
+
+gd::String LocalFileSystem::GetCurrentDir() {
+  char buffer[PATH_MAX];
+  if (getcwd(buffer, PATH_MAX) == nullptr) return "/";
+
+  return gd::String::FromUTF8(buffer);
+}
+
+gd::String LocalFileSystem::NormalizeAbsolutePath(const gd::String &path) {
+  std::vector<std::string> segments;
+  for (const auto &segment : SplitPath(path.Raw())) {
+    if (segment == ".") continue;
+    if (segment == "..") {
+      if (!segments.empty()) segments.pop_back();
+      continue;
+    }
+    segments.push_back(segment);
+  }
+
+  std::string normalizedPath;
+  for (const auto &segment : segments) normalizedPath += "/" + segment;
+  return gd::String::FromUTF8(normalizedPath.empty() ? "/" : normalizedPath);
+}
+
+bool LocalFileSystem::RemoveRecursively(const gd::String &path) {
+  struct stat pathStat;
+  if (lstat(path.c_str(), &pathStat) != 0) return errno == ENOENT;
+
+  if (S_ISDIR(pathStat.st_mode)) {
+    DIR *directory = opendir(path.c_str());
+    if (directory == nullptr) return false;
+
+    bool success = true;
+    while (struct dirent *entry = readdir(directory)) {
+      std::string name = entry->d_name;
+      if (name == "." || name == "..") continue;
+      success &= RemoveRecursively(path + "/" + gd::String::FromUTF8(name));
+    }
+    closedir(directory);
+
+    return success && rmdir(path.c_str()) == 0;
+  }
+
+  return unlink(path.c_str()) == 0;
+}
+
+void LocalFileSystem::MkDir(const gd::String &path) {
+  std::string currentPath = path.Raw().size() > 0 && path.Raw()[0] == '/'
+                                ? ""
+                                : ".";
+  for (const auto &segment : SplitPath(path.Raw())) {
+    currentPath += "/" + segment;
+    if (mkdir(currentPath.c_str(), 0755) != 0 && errno != EEXIST) {
+      std::cout << "mkDir(" << path << ") failed: " << strerror(errno)
+                << std::endl;
+      return;
+    }
+  }
+}
+
+bool LocalFileSystem::DirExists(const gd::String &path) {
+  struct stat pathStat;
+  return stat(path.c_str(), &pathStat) == 0 && S_ISDIR(pathStat.st_mode);
+}
+
+bool LocalFileSystem::FileExists(const gd::String &path) {
+  struct stat pathStat;
+  return stat(path.c_str(), &pathStat) == 0 && S_ISREG(pathStat.st_mode);
+}
+
+bool LocalFileSystem::ClearDir(const gd::String &directory) {
+  if (!DirExists(directory)) {
+    MkDir(directory);
+    return DirExists(directory);
+  }
+
+  DIR *dir = opendir(directory.c_str());
+  if (dir == nullptr) return false;
+
+  bool success = true;
+  while (struct dirent *entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name == "." || name == "..") continue;
+    success &= RemoveRecursively(directory + "/" + gd::String::FromUTF8(name));
+  }
+  closedir(dir);
+
+  if (!success) std::cout << "clearDir(" << directory << ") failed." << std::endl;
+  return success;
+}
+
+gd::String LocalFileSystem::GetTempDir() {
+  const char *tmpDir = getenv("TMPDIR");
+  gd::String baseDir =
+      tmpDir && tmpDir[0] != '\0' ? gd::String::FromUTF8(tmpDir) : "/tmp";
+
+  // Use a directory for each process, so that exports running in parallel on
+  // the same machine don't write in the same temporary files.
+  return NormalizeAbsolutePath(baseDir) + "/GDTMP-" +
+         gd::String::From(getpid());
+}
+
+bool LocalFileSystem::RemoveTempDir() {
+  return RemoveRecursively(GetTempDir());
+}
+
+gd::String LocalFileSystem::FileNameFrom(const gd::String &file) {
+  std::size_t lastSeparator = file.Raw().find_last_of('/');
+  if (lastSeparator == std::string::npos) return file;
+
+  return gd::String::FromUTF8(file.Raw().substr(lastSeparator + 1));
+}
+
+gd::String LocalFileSystem::DirNameFrom(const gd::String &file) {
+  std::size_t lastSeparator = file.Raw().find_last_of('/');
+  if (lastSeparator == std::string::npos) return ".";
+  if (lastSeparator == 0) return "/";
+
+  return gd::String::FromUTF8(file.Raw().substr(0, lastSeparator));
+}
+
+bool LocalFileSystem::MakeAbsolute(gd::String &filename,
+                                   const gd::String &baseDirectory) {
+  gd::String absoluteBaseDirectory = baseDirectory;
+  if (!IsAbsolute(absoluteBaseDirectory) || absoluteBaseDirectory.empty())
+    absoluteBaseDirectory = GetCurrentDir() + "/" + absoluteBaseDirectory;
+
+  filename = NormalizeAbsolutePath(
+      IsAbsolute(filename) && !filename.empty()
+          ? filename
+          : absoluteBaseDirectory + "/" + NormalizeSeparator(filename));
+  return true;
+}
+
+bool LocalFileSystem::IsAbsolute(const gd::String &filename) {
+  return filename.empty() || filename.Raw()[0] == '/';
+}
+
+bool LocalFileSystem::MakeRelative(gd::String &filename,
+                                   const gd::String &baseDirectory) {
+  gd::String absoluteFilename = filename;
+  gd::String absoluteBaseDirectory = baseDirectory;
+  MakeAbsolute(absoluteFilename, GetCurrentDir());
+  MakeAbsolute(absoluteBaseDirectory, GetCurrentDir());
+
+  std::vector<std::string> fileSegments = SplitPath(absoluteFilename.Raw());
+  std::vector<std::string> baseSegments =
+      SplitPath(absoluteBaseDirectory.Raw());
+  std::size_t commonSegmentsCount = 0;
+  while (commonSegmentsCount < fileSegments.size() &&
+         commonSegmentsCount < baseSegments.size() &&
+         fileSegments[commonSegmentsCount] ==
+             baseSegments[commonSegmentsCount])
+    commonSegmentsCount++;
+
+  std::string relativeFilename;
+  for (std::size_t i = commonSegmentsCount; i < baseSegments.size(); ++i)
+    relativeFilename += relativeFilename.empty() ? ".." : "/..";
+  for (std::size_t i = commonSegmentsCount; i < fileSegments.size(); ++i)
+    relativeFilename +=
+        (relativeFilename.empty() ? "" : "/") + fileSegments[i];
+
+  filename = gd::String::FromUTF8(relativeFilename);
+  return true;
+}
+
+bool LocalFileSystem::CopyFile(const gd::String &file,
+                               const gd::String &destination) {
+  if (file == destination) return true;
+
+  gd::String destinationDirectory = DirNameFrom(destination);
+  if (!DirExists(destinationDirectory)) MkDir(destinationDirectory);
+
+  std::ifstream source(file.c_str(), std::ios::binary);
+  std::ofstream target(destination.c_str(),
+                       std::ios::binary | std::ios::trunc);
+  if (!source.is_open() || !target.is_open()) {
+    std::cout << "copyFile(" << file << ", " << destination
+              << ") failed: unable to open the files." << std::endl;
+    return false;
+  }
+
+  // Streaming an empty file would mark the target stream as failed.
+  if (source.peek() != std::ifstream::traits_type::eof())
+    target << source.rdbuf();
+  return target.good();
+}
+
+bool LocalFileSystem::WriteToFile(const gd::String &file,
+                                  const gd::String &content) {
+  gd::String directory = DirNameFrom(file);
+  if (!DirExists(directory)) MkDir(directory);
+
+  std::ofstream target(file.c_str(), std::ios::binary | std::ios::trunc);
+  if (!target.is_open()) {
+    std::cout << "writeToFile(" << file << ", ...) failed." << std::endl;
+    return false;
+  }
+
+  target << content.Raw();
+  return target.good();
+}
+
+gd::String LocalFileSystem::ReadFile(const gd::String &file) {
+  std::ifstream source(file.c_str(), std::ios::binary);
+  if (!source.is_open()) {
+    std::cout << "readFile(" << file << ") failed." << std::endl;
+    return "";
+  }
+
+  std::ostringstream content;
+  content << source.rdbuf();
+  return gd::String::FromUTF8(content.str());
+}
+
+std::vector<gd::String> LocalFileSystem::ReadDir(const gd::String &path,
+                                                 const gd::String &extension) {
+  std::vector<gd::String> files;
+  DIR *directory = opendir(path.c_str());
+  if (directory == nullptr) return files;
+
+  gd::String upperCaseExtension = extension.UpperCase();
+  while (struct dirent *entry = readdir(directory)) {
+    gd::String name = gd::String::FromUTF8(entry->d_name);
+    if (name == "." || name == "..") continue;
+
+    gd::String upperCaseName = name.UpperCase();
+    if (upperCaseExtension.empty() ||
+        (upperCaseName.size() >= upperCaseExtension.size() &&
+         upperCaseName.substr(upperCaseName.size() -
+                              upperCaseExtension.size()) ==
+             upperCaseExtension))
+      files.push_back(path + "/" + name);
+  }
+  closedir(directory);
+
+  return files;
+}
+
+}  // namespace gdjs
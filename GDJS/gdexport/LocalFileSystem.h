@@ -0,0 +1,72 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+
+namespace gdjs {
+
+/**
+ * \brief Give access to the local filesystem to the exporters, when running
+ * natively (outside of the IDE).
+ *
+ * Paths are always using "/" as a separator. Directories are created when
+ * needed (when writing or copying a file), like the LocalFileSystem used by
+ * the IDE.
+ *
+ * \note Only POSIX systems are supported.
+ */
+class LocalFileSystem : public gd::AbstractFileSystem {
+ public:
+  LocalFileSystem(){};
+  virtual ~LocalFileSystem(){};
+
+  void MkDir(const gd::String& path) override;
+  bool DirExists(const gd::String& path) override;
+  bool FileExists(const gd::String& path) override;
+  bool ClearDir(const gd::String& directory) override;
+  gd::String GetTempDir() override;
+  gd::String FileNameFrom(const gd::String& file) override;
+  gd::String DirNameFrom(const gd::String& file) override;
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool IsAbsolute(const gd::String& filename) override;
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool CopyFile(const gd::String& file, const gd::String& destination) override;
+  bool WriteToFile(const gd::String& file, const gd::String& content) override;
+  gd::String ReadFile(const gd::String& file) override;
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension = "") override;
+
+  /**
+   * \brief Return the absolute path of the current working directory.
+   */
+  static gd::String GetCurrentDir();
+
+  /**
+   * \brief Remove the temporary directory of the process (see GetTempDir),
+   * with all its content.
+   */
+  bool RemoveTempDir();
+
+ private:
+  /**
+   * \brief Resolve the "." and ".." of an absolute path and remove the
+   * duplicated and trailing separators.
+   */
+  static gd::String NormalizeAbsolutePath(const gd::String& path);
+
+  /**
+   * \brief Remove a file or a directory with all its content.
+   */
+  static bool RemoveRecursively(const gd::String& path);
+};
+
+}  // namespace gdjs
@@ -0,0 +1,326 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+/**
+ * @file gdexport: export GDevelop projects to HTML5 games from the command
+ * line, without the IDE.
+ *
+ * A single export is done with:
+ *
+ *     gdexport --project game.json --output export [--target html5|preview]
+ *
+ * With `--server` (or `--socket <path>`), the exporter stays alive and reads
+ * export requests, one JSON object per line, from the standard input (or from
+ * the connections to the Unix socket). Each request is answered with a line
+ * containing the result of the export, with the time spent in each step.
+ * Keeping the same process avoids initializing the platform and loading the
+ * extensions again for every export.
+ *
+ * The metadata of the builtin extensions can be stored in a binary snapshot
+ * with `--dump-platform-snapshot <file>` (typically at build time), and
+ * restored at startup with `--platform-snapshot <file>` instead of being
+ * declared again. `--check-platform-snapshot <file>` reports the differences
+ * between a snapshot and the declarations of the builtin extensions.
+ *
+ * The logs of the exporter are written to the standard error, so that the
+ * standard output only contains the results.
+ */
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "GDCore/Serialization/BinarySerializer.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "HeadlessExporter.h"
+
+namespace {
+
+/**
+ * \brief Set when the server is interrupted (SIGINT or SIGTERM), so that it
+ * stops and the exporter removes its temporary files.
+ */
+volatile std::sig_atomic_t stopRequested = 0;
+
+void RequestStop(int) { stopRequested = 1; }
+
+/**
+ * \brief Stop the server on SIGINT or SIGTERM. The blocking calls are not
+ * restarted, so that a server waiting for a request stops too.
+ */
+void HandleStopSignals() {
+  struct sigaction action;
+  std::memset(&action, 0, sizeof(action));
+  action.sa_handler = RequestStop;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+}
+
+void PrintUsage() {
+  std::cerr
+      << "Usage: gdexport [options]\n"
+         "  --project <file>       The project JSON file to export.\n"
+         "  --output <directory>   The directory where the game is exported.\n"
+         "  --target <target>      html5 (default), cordova, electron,\n"
+         "                         facebookInstantGames or preview.\n"
+         "  --layout <name>        The scene to launch, for a preview.\n"
+         "  --gdjs-root <dir>      The directory containing the built GDJS\n"
+         "                         Runtime (default: ./JsPlatform).\n"
+         "  --extensions <dir>     The directory of the native extensions to\n"
+         "                         load (default: none).\n"
+         "  --server               Read requests from the standard input.\n"
+         "  --socket <path>        Read requests from a Unix socket.\n"
+         "  --platform-snapshot <file>\n"
+         "                         Restore the builtin extensions from a\n"
+         "                         snapshot instead of declaring them.\n"
+         "  --dump-platform-snapshot <file>\n"
+         "                         Write the snapshot of the builtin\n"
+         "                         extensions and exit.\n"
+         "  --check-platform-snapshot <file>\n"
+         "                         Check that a snapshot matches the builtin\n"
+         "                         extensions and exit.\n"
+      << std::endl;
+}
+
+/**
+ * \brief Handle a request line, and return the line to send back (without
+ * the end of line). Set \a quit to true if the server must stop.
+ */
+std::string HandleRequestLine(gdjs::HeadlessExporter &exporter,
+                              const std::string &line,
+                              bool &quit) {
+  gd::SerializerElement requestElement =
+      gd::Serializer::FromJSON(gd::String::FromUTF8(line));
+  if (requestElement.HasChild("command") &&
+      requestElement.GetChild("command").GetStringValue() == "quit") {
+    quit = true;
+    return "{\"success\":true}";
+  }
+
+  gdjs::HeadlessExportRequest request;
+  request.UnserializeFrom(requestElement);
+  gd::SerializerElement result;
+  exporter.Export(request, result);
+  return gd::Serializer::ToJSON(result).ToUTF8();
+}
+
+void RunStdinServer(gdjs::HeadlessExporter &exporter, std::ostream &output) {
+  std::string line;
+  bool quit = false;
+  while (!quit && !stopRequested && std::getline(std::cin, line)) {
+    if (line.empty()) continue;
+    output << HandleRequestLine(exporter, line, quit) << std::endl;
+  }
+}
+
+bool ReadPlatformSnapshot(const gd::String &path,
+                          gd::SerializerElement &snapshot) {
+  std::ifstream file(path.c_str(), std::ios::binary);
+  std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+  if (!file.good() && !file.eof()) return false;
+
+  return !buffer.empty() && gd::BinarySerializer::DeserializeFromBinaryBuffer(
+                                buffer.data(), buffer.size(), snapshot);
+}
+
+bool WritePlatformSnapshot(const gd::String &path) {
+  gd::SerializerElement snapshot;
+  gdjs::JsPlatform::SerializeBuiltinExtensionsTo(snapshot);
+  std::vector<uint8_t> buffer;
+  gd::BinarySerializer::SerializeToBinaryBuffer(snapshot, buffer);
+
+  std::ofstream file(path.c_str(), std::ios::binary);
+  file.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+  return file.good();
+}
+
+bool CheckPlatformSnapshot(const gd::String &path) {
+  gd::SerializerElement snapshot;
+  if (!ReadPlatformSnapshot(path, snapshot)) {
+    std::cerr << "Unable to read the platform snapshot " << path << std::endl;
+    return false;
+  }
+
+  std::vector<gd::String> differences =
+      gdjs::JsPlatform::FindBuiltinExtensionsSnapshotDifferences(snapshot);
+  for (const gd::String &difference : differences)
+    std::cerr << difference << std::endl;
+  return differences.empty();
+}
+
+bool WriteAll(int fileDescriptor, const std::string &content) {
+  std::size_t written = 0;
+  while (written < content.size()) {
+    ssize_t count = write(
+        fileDescriptor, content.data() + written, content.size() - written);
+    if (count <= 0) return false;
+    written += count;
+  }
+  return true;
+}
+
+bool RunSocketServer(gdjs::HeadlessExporter &exporter,
+                     const gd::String &socketPath) {
+  sockaddr_un address;
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (socketPath.Raw().size() >= sizeof(address.sun_path)) {
+    std::cerr << "The socket path is too long." << std::endl;
+    return false;
+  }
+  std::strncpy(
+      address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+  // A client disconnecting before reading its result must not stop the server.
+  signal(SIGPIPE, SIG_IGN);
+
+  int serverSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+  unlink(socketPath.c_str());
+  if (serverSocket < 0 ||
+      bind(serverSocket, reinterpret_cast<sockaddr *>(&address),
+           sizeof(address)) != 0 ||
+      listen(serverSocket, 8) != 0) {
+    std::cerr << "Unable to listen on " << socketPath << ": "
+              << std::strerror(errno) << std::endl;
+    if (serverSocket >= 0) close(serverSocket);
+    return false;
+  }
+
+  // Connections are handled one after the other, as exports share the
+  // platform and can't run in parallel.
+  bool quit = false;
+  while (!quit && !stopRequested) {
+    int connection = accept(serverSocket, nullptr, nullptr);
+    if (connection < 0) continue;
+
+    std::string pending;
+    char buffer[4096];
+    ssize_t count;
+    while (!quit && !stopRequested &&
+           (count = read(connection, buffer, sizeof(buffer))) > 0) {
+      pending.append(buffer, count);
+      std::size_t lineEnd;
+      while (!quit && (lineEnd = pending.find('\n')) != std::string::npos) {
+        std::string line = pending.substr(0, lineEnd);
+        pending.erase(0, lineEnd + 1);
+        if (line.empty()) continue;
+        if (!WriteAll(connection,
+                      HandleRequestLine(exporter, line, quit) + "\n"))
+          break;
+      }
+    }
+    close(connection);
+  }
+
+  close(serverSocket);
+  unlink(socketPath.c_str());
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  gdjs::HeadlessExportRequest request;
+  gd::String gdjsRoot = "./JsPlatform";
+  gd::String extensionsDirectory;
+  gd::String socketPath;
+  gd::String platformSnapshotPath;
+  gd::String dumpPlatformSnapshotPath;
+  gd::String checkPlatformSnapshotPath;
+  bool server = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--server") {
+      server = true;
+    } else if (argument == "--help") {
+      PrintUsage();
+      return 0;
+    } else if (hasValue && argument == "--project") {
+      request.projectFile = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--output") {
+      request.exportPath = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--target") {
+      request.target = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--layout") {
+      request.layoutName = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--gdjs-root") {
+      gdjsRoot = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--extensions") {
+      extensionsDirectory = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--socket") {
+      socketPath = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--platform-snapshot") {
+      platformSnapshotPath = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--dump-platform-snapshot") {
+      dumpPlatformSnapshotPath = gd::String::FromUTF8(argv[++i]);
+    } else if (hasValue && argument == "--check-platform-snapshot") {
+      checkPlatformSnapshotPath = gd::String::FromUTF8(argv[++i]);
+    } else {
+      std::cerr << "Unknown or incomplete argument: " << argument << std::endl;
+      PrintUsage();
+      return 2;
+    }
+  }
+
+  // Keep the standard output for the results: everything logged by the
+  // exporter goes to the standard error.
+  std::ostream output(std::cout.rdbuf());
+  std::cout.rdbuf(std::cerr.rdbuf());
+
+  if (!dumpPlatformSnapshotPath.empty()) {
+    if (WritePlatformSnapshot(dumpPlatformSnapshotPath)) return 0;
+
+    std::cerr << "Unable to write the platform snapshot "
+              << dumpPlatformSnapshotPath << std::endl;
+    return 1;
+  }
+  if (!checkPlatformSnapshotPath.empty())
+    return CheckPlatformSnapshot(checkPlatformSnapshotPath) ? 0 : 1;
+
+  gd::SerializerElement platformSnapshot;
+  if (!platformSnapshotPath.empty() &&
+      !ReadPlatformSnapshot(platformSnapshotPath, platformSnapshot)) {
+    std::cerr << "Unable to read the platform snapshot " << platformSnapshotPath
+              << ", the builtin extensions will be declared." << std::endl;
+    platformSnapshotPath.clear();
+  }
+
+  gdjs::HeadlessExporter exporter(
+      gdjsRoot,
+      extensionsDirectory,
+      platformSnapshotPath.empty() ? nullptr : &platformSnapshot);
+  HandleStopSignals();
+  if (!socketPath.empty()) return RunSocketServer(exporter, socketPath) ? 0 : 1;
+  if (server) {
+    RunStdinServer(exporter, output);
+    return 0;
+  }
+
+  if (request.projectFile.empty() || request.exportPath.empty()) {
+    PrintUsage();
+    return 2;
+  }
+
+  gd::SerializerElement result;
+  bool success = exporter.Export(request, result);
+  output << gd::Serializer::ToJSON(result) << std::endl;
+  return success ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+describe('gdjs.SortedIndicesBuffer', function () {
+  const objectsCount = 2000;
+  const keys = [];
+  for (let i = 0; i < objectsCount; i++) keys.push(Math.random() * 1000);
+
+  // The code that was generated for "For each object" events with an
+  // "order by" expression, allocating a comparison function and growing
+  // arrays each time the event is run.
+  const sortKeys = [];
+  const sortedIndices = [];
+  const sortWithArrays = (descending, limit) => {
+    sortKeys.length = 0;
+    for (let i = 0; i < objectsCount; i++) sortKeys.push(keys[i]);
+    sortedIndices.length = 0;
+    for (let i = 0; i < objectsCount; i++) sortedIndices.push(i);
+    sortedIndices.sort(function (a, b) {
+      return descending ? sortKeys[b] - sortKeys[a] : sortKeys[a] - sortKeys[b];
+    });
+    if (limit >= 0 && sortedIndices.length > limit) sortedIndices.length = limit;
+    return sortedIndices.length;
+  };
+
+  const buffer = new gdjs.SortedIndicesBuffer();
+  const sortWithBuffer = (descending, limit) => {
+    buffer.reserve(objectsCount);
+    for (let i = 0; i < objectsCount; i++) buffer.keys[i] = keys[i];
+    return buffer.sort(objectsCount, descending, limit);
+  };
+
+  // Heap usage is only available in Chrome, and is not precise: it gives
+  // an idea of the garbage produced, to be collected later.
+  const getUsedHeapSize = () =>
+    performance.memory ? performance.memory.usedJSHeapSize : 0;
+  const measureGarbage = (title, fn) => {
+    const usedHeapSizeBefore = getUsedHeapSize();
+    for (let i = 0; i < 1000; i++) fn();
+    console.log(
+      title +
+        ': ' +
+        Math.max(0, getUsedHeapSize() - usedHeapSizeBefore) +
+        ' bytes not yet collected after 1000 runs'
+    );
+  };
+
+  it('benchmark ordering objects', function () {
+    this.timeout(40000);
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 20,
+      iterationsCount: 200,
+    });
+    benchmarkSuite
+      .add('sort with arrays', () => sortWithArrays(false, -1))
+      .add('sort with SortedIndicesBuffer', () => sortWithBuffer(false, -1))
+      .add('sort with arrays, 10 first', () => sortWithArrays(true, 10))
+      .add('sort with SortedIndicesBuffer, 10 first', () =>
+        sortWithBuffer(true, 10)
+      );
+
+    console.log(benchmarkSuite.run());
+
+    measureGarbage('sort with arrays', () => sortWithArrays(false, -1));
+    measureGarbage('sort with SortedIndicesBuffer', () =>
+      sortWithBuffer(false, -1)
+    );
+  });
+});
@@ -246,3 +246,51 @@ describe('gdjs.evtTools.object', function () {
     );
   });
 });
+
+describe('gdjs.SortedIndicesBuffer', function () {
+  const sort = (buffer, keys, descending, limit) => {
+    buffer.reserve(keys.length);
+    for (let i = 0; i < keys.length; i++) buffer.keys[i] = keys[i];
+    const count = buffer.sort(keys.length, descending, limit);
+    return Array.from(buffer.indices.subarray(0, count));
+  };
+
+  it('orders the indices by keys, keeping the order of equal keys', function () {
+    const buffer = new gdjs.SortedIndicesBuffer();
+    expect(sort(buffer, [3, 1, 2, 1, 3], false, -1)).to.eql([1, 3, 2, 0, 4]);
+    expect(sort(buffer, [3, 1, 2, 1, 3], true, -1)).to.eql([0, 4, 2, 1, 3]);
+    expect(sort(buffer, [], false, -1)).to.eql([]);
+  });
+
+  it('only orders the first elements when there is a limit', function () {
+    const buffer = new gdjs.SortedIndicesBuffer();
+    expect(sort(buffer, [3, 1, 2, 1, 3], false, 2)).to.eql([1, 3]);
+    expect(sort(buffer, [3, 1, 2, 1, 3], true, 3)).to.eql([0, 4, 2]);
+    expect(sort(buffer, [3, 1, 2, 1, 3], true, 10)).to.eql([0, 4, 2, 1, 3]);
+    expect(sort(buffer, [3, 1, 2], false, 0)).to.eql([]);
+  });
+
+  it('rounds down fractional limits', function () {
+    const buffer = new gdjs.SortedIndicesBuffer();
+    expect(sort(buffer, [3, 1, 2, 1, 3], false, 2.7)).to.eql([1, 3]);
+    expect(sort(buffer, [3, 1, 2, 1, 3], true, 0.5)).to.eql([]);
+    expect(sort(buffer, [3, 1, 2, 1, 3], false, 4.5)).to.eql([1, 3, 2, 0]);
+    expect(sort(buffer, [3, 1, 2, 1, 3], false, 5.5)).to.eql([
+      1, 3, 2, 0, 4,
+    ]);
+  });
+
+  it('gives the same order as Array.prototype.sort for many elements', function () {
+    const buffer = new gdjs.SortedIndicesBuffer();
+    const keys = [];
+    for (let i = 0; i < 1000; i++) keys.push((i * 7919) % 101);
+    const expectedIndices = keys
+      .map((key, index) => index)
+      .sort((a, b) => keys[a] - keys[b]);
+
+    expect(sort(buffer, keys, false, -1)).to.eql(expectedIndices);
+    // Small limits select the first elements, bigger ones order all of them.
+    expect(sort(buffer, keys, false, 5)).to.eql(expectedIndices.slice(0, 5));
+    expect(sort(buffer, keys, false, 50)).to.eql(expectedIndices.slice(0, 50));
+  });
+});
@@ -0,0 +1,90 @@
+// @ts-check
+describe('gdjs.EventsProfiler', () => {
+  const originalGetTimeNow = gdjs.EventsProfiler._getTimeNow;
+  let timeNow = 0;
+  beforeEach(() => {
+    gdjs.EventsProfiler._getTimeNow = () => timeNow;
+  });
+  afterEach(() => {
+    gdjs.EventsProfiler._getTimeNow = originalGetTimeNow;
+    gdjs.EventsProfiler.setSamplingInterval(0);
+  });
+
+  /**
+   * Simulate what the generated code does for an event: measure the whole
+   * event, and its conditions.
+   * @param {Float64Array} counters
+   * @param {number} eventIndex
+   * @param {number} conditionsDuration
+   * @param {number} actionsDuration
+   */
+  const runEvent = (
+    counters,
+    eventIndex,
+    conditionsDuration,
+    actionsDuration
+  ) => {
+    const eventStartTime = gdjs.EventsProfiler.begin();
+    const conditionsStartTime = gdjs.EventsProfiler.begin();
+    timeNow += conditionsDuration;
+    gdjs.EventsProfiler.end(counters, eventIndex * 3 + 1, conditionsStartTime);
+    const actionsStartTime = gdjs.EventsProfiler.begin();
+    timeNow += actionsDuration;
+    gdjs.EventsProfiler.end(counters, eventIndex * 3 + 2, actionsStartTime);
+    gdjs.EventsProfiler.end(counters, eventIndex * 3, eventStartTime);
+  };
+
+  it('measures the events of the sampled frames', () => {
+    const counters = gdjs.EventsProfiler.registerEvents('gdjs.MySceneCode', [
+      'first-event-uuid',
+      'second-event-uuid',
+    ]);
+    expect(counters.length).to.be(12);
+
+    gdjs.EventsProfiler.setSamplingInterval(2);
+    for (let frame = 0; frame < 4; frame++) {
+      gdjs.EventsProfiler.beginFrame();
+      runEvent(counters, 0, 1, 2);
+      runEvent(counters, 1, 0.5, 0);
+    }
+
+    // Only frames 0 and 2 are measured.
+    const measures = gdjs.EventsProfiler.getEventsMeasures('gdjs.MySceneCode');
+    expect(measures).to.eql([
+      {
+        eventId: 'first-event-uuid',
+        time: 6,
+        count: 2,
+        conditionsTime: 2,
+        conditionsCount: 2,
+        actionsTime: 4,
+        actionsCount: 2,
+      },
+      {
+        eventId: 'second-event-uuid',
+        time: 1,
+        count: 2,
+        conditionsTime: 1,
+        conditionsCount: 2,
+        actionsTime: 0,
+        actionsCount: 2,
+      },
+    ]);
+  });
+
+  it('does not measure anything when sampling is disabled', () => {
+    const counters = gdjs.EventsProfiler.registerEvents('gdjs.MySceneCode', [
+      'event-uuid',
+    ]);
+
+    gdjs.EventsProfiler.setSamplingInterval(0);
+    gdjs.EventsProfiler.beginFrame();
+    expect(gdjs.EventsProfiler.begin()).to.be(-1);
+    runEvent(counters, 0, 1, 1);
+
+    expect(Array.from(counters)).to.eql([0, 0, 0, 0, 0, 0]);
+    expect(gdjs.EventsProfiler.getEventsMeasures('gdjs.UnknownCode')).to.eql(
+      []
+    );
+  });
+});
@@ -186,4 +186,46 @@ describe('gdjs.RuntimeScene integration tests', function () {
       expect(runtimeScene.hasLayer('MyOtherLayer')).to.be(true);
     });
   });
+
+  describe('Events generated code', function () {
+    afterEach(() => {
+      delete gdjs['MySceneCode'];
+      delete gdjs['MyEvents_linkedEvents0Code'];
+      delete gdjs['MyEvents_linkedEvents1Code'];
+    });
+
+    it('finds the callbacks of the async actions of the linked events', function () {
+      const sceneCallback = () => {};
+      const linkedEventsCallback = () => {};
+      const nestedLinkedEventsCallback = () => {};
+      gdjs['MySceneCode'] = {
+        func: () => {},
+        idToCallbackMap: new Map([['1', sceneCallback]]),
+        linkedEventsCodeNames: ['MyEvents_linkedEvents0Code'],
+      };
+      gdjs['MyEvents_linkedEvents0Code'] = {
+        func: () => {},
+        idToCallbackMap: new Map([['2', linkedEventsCallback]]),
+        linkedEventsCodeNames: ['MyEvents_linkedEvents1Code'],
+      };
+      gdjs['MyEvents_linkedEvents1Code'] = {
+        func: () => {},
+        idToCallbackMap: new Map([['3', nestedLinkedEventsCallback]]),
+        linkedEventsCodeNames: ['MyEvents_linkedEvents0Code'],
+      };
+
+      const runtimeGame = gdjs.getPixiRuntimeGame();
+      const runtimeScene = new gdjs.RuntimeScene(runtimeGame);
+      runtimeScene.setEventsGeneratedCodeFunction(
+        /** @type {any} */ ({ mangledName: 'MyScene' })
+      );
+
+      const idToCallbackMap = runtimeScene._idToCallbackMap;
+      if (!idToCallbackMap) throw new Error('Expected callbacks to be found.');
+      expect(idToCallbackMap.size).to.be(3);
+      expect(idToCallbackMap.get('1')).to.be(sceneCallback);
+      expect(idToCallbackMap.get('2')).to.be(linkedEventsCallback);
+      expect(idToCallbackMap.get('3')).to.be(nestedLinkedEventsCallback);
+    });
+  });
 });
@@ -130,6 +130,40 @@ describe('gdjs.Variable', function () {
     expect(structure.getAllChildrenArray()[0].getAsString()).to.be('Hello');
   });
 
+  it('gives children like getChild when their parent has another type', function () {
+    const structure = new gdjs.Variable({
+      type: 'structure',
+      children: [{ name: 'foo', value: 'Hello', type: 'string' }],
+    });
+    const array = new gdjs.Variable({
+      type: 'array',
+      children: [{ value: 'Hello', type: 'string' }],
+    });
+
+    expect(structure.getStructureChild('foo')).to.be(structure.getChild('foo'));
+    expect(array.getArrayChild(0)).to.be(array.getChild(0));
+
+    // Missing children are added.
+    structure.getStructureChild('bar').setString('World');
+    expect(structure.getChild('bar').getAsString()).to.be('World');
+    array.getArrayChild(1).setString('World');
+    expect(array.getChildrenCount()).to.be(2);
+
+    // The parents are converted when they changed of type.
+    structure.setNumber(1);
+    structure.getStructureChild('foo').setString('Hello');
+    expect(structure.getType()).to.be('structure');
+    expect(structure.getChild('foo').getAsString()).to.be('Hello');
+
+    // A structure can have a child named after an index.
+    structure.getArrayChild(0).setString('Zero');
+    expect(structure.getType()).to.be('structure');
+    expect(structure.getChild('0').getAsString()).to.be('Zero');
+
+    // An array gives its child at an index written as a name.
+    expect(array.getStructureChild('1').getAsString()).to.be('World');
+  });
+
   it('can be serialized to JSON', function () {
     var structure = new gdjs.Variable({ value: '0' });
 
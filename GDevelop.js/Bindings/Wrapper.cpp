@@ -68,6 +68,7 @@
 #include <GDCore/IDE/PropertyFunctionGenerator.h>
 #include <GDCore/IDE/UnfilledRequiredBehaviorPropertyProblem.h>
 #include <GDCore/IDE/VariableInstructionSwitcher.h>
+#include <GDCore/IDE/WholeProjectDiagnosticsChecker.h>
 #include <GDCore/IDE/WholeProjectRefactorer.h>
 #include <GDCore/Project/Behavior.h>
 #include <GDCore/Project/MemoryTrackedRegistry.h>
@@ -110,10 +111,13 @@
 #include <GDCore/Serialization/BinarySerializer.h>
 #include <GDCore/IDE/ObjectAssetSerializer.h>
 #include <GDCore/IDE/Events/ExtensionDependencyCache.h>
+#include <GDCore/Tools/AllocationCounters.h>
 #include <GDJS/Events/Builtin/JsCodeEvent.h>
 #include <GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/EventsFunctionsExtensionCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/LayoutCodeGenerator.h>
+#include <GDJS/Events/CodeGeneration/LinkedEventsCodeGenerator.h>
+#include <GDJS/Events/CodeGeneration/MetadataDeclarationCache.h>
 #include <GDJS/Events/CodeGeneration/MetadataDeclarationHelper.h>
 #include <GDJS/Events/CodeGeneration/ObjectCodeGenerator.h>
 #include <GDJS/IDE/Exporter.h>
@@ -512,6 +516,8 @@ typedef gd::SerializableWithNameList<gd::EventsBasedObject>
     EventsBasedObjectsList;
 typedef ProjectDiagnostic::ErrorType
     ProjectDiagnostic_ErrorType;
+typedef InstructionMetadata::EvaluationCost
+    InstructionMetadata_EvaluationCost;
 typedef ExpressionCompletionDescription::CompletionKind
     ExpressionCompletionDescription_CompletionKind;
 typedef std::vector<gd::ExpressionCompletionDescription>
@@ -601,6 +607,31 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
 
 #define WRAPPED_at(a) at(a).get()
 
+#define WRAPPED_GetInstancesFields(                                         \
+    fieldsPtr, indicesPtr, maxInstancesCount, layerNames, objectNames)      \
+  GetInstancesFields(reinterpret_cast<double *>(fieldsPtr),                 \
+                     reinterpret_cast<int32_t *>(indicesPtr),               \
+                     maxInstancesCount,                                     \
+                     layerNames,                                            \
+                     objectNames)
+#define WRAPPED_GetLayerInstancesFields(layerName,                          \
+                                        fieldsPtr,                          \
+                                        indicesPtr,                         \
+                                        maxInstancesCount,                  \
+                                        layerNames,                         \
+                                        objectNames)                        \
+  GetLayerInstancesFields(layerName,                                        \
+                          reinterpret_cast<double *>(fieldsPtr),            \
+                          reinterpret_cast<int32_t *>(indicesPtr),          \
+                          maxInstancesCount,                                \
+                          layerNames,                                       \
+                          objectNames)
+#define WRAPPED_SetInstancesFields(fieldsPtr, instancesCount) \
+  SetInstancesFields(reinterpret_cast<const double *>(fieldsPtr), instancesCount)
+#define WRAPPED_SetLayerInstancesFields(layerName, fieldsPtr, instancesCount) \
+  SetLayerInstancesFields(                                                    \
+      layerName, reinterpret_cast<const double *>(fieldsPtr), instancesCount)
+
 #define MAP_getOrCreate(key) operator[](key)
 #define MAP_get(key) find(key)->second
 #define MAP_set(key, value) [key] = value
@@ -951,6 +982,16 @@ typedef std::vector<gd::PropertyDescriptorChoice> VectorPropertyDescriptorChoice
 #define STATIC_getDeadContextId getDeadContextId
 #define STATIC_getDeadContextTimeMs getDeadContextTimeMs
 
+// AllocationCounters
+#define STATIC_IsEnabled IsEnabled
+#define STATIC_Reset Reset
+#define STATIC_GetCounts GetCounts
+#define STATIC_BeginPhase BeginPhase
+#define STATIC_EndPhase EndPhase
+#define STATIC_HasPhase HasPhase
+#define STATIC_GetPhaseCounts GetPhaseCounts
+#define STATIC_GetPhaseNames GetPhaseNames
+
 // We postfix some methods with "At" as Javascript does not support overloading
 #define GetLayoutAt GetLayout
 #define GetExternalEventsAt GetExternalEvents
@@ -171,6 +171,22 @@ class Variable {
     return this._children[childName];
   }
 
+  /**
+   * @param {string} childName
+   * @returns {Variable}
+   */
+  getStructureChild(childName) {
+    return this.getChild(childName);
+  }
+
+  /**
+   * @param {number} index
+   * @returns {Variable}
+   */
+  getArrayChild(index) {
+    return this.getChild(index);
+  }
+
   getAllChildren() {
     return this._children;
   }
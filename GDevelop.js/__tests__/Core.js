@@ -770,6 +770,72 @@ describe('libGD.js', function () {
       expect(container.serializeTo).not.toBe(undefined);
       expect(container.unserializeFrom).not.toBe(undefined);
     });
+    it('can read and change the fields of instances in bulk', function () {
+      const bulkContainer = new gd.InitialInstancesContainer();
+      const instance1 = bulkContainer.insertNewInitialInstance();
+      instance1.setObjectName('MyObject1');
+      instance1.setX(10);
+      instance1.setZOrder(4);
+      const instance2 = bulkContainer.insertNewInitialInstance();
+      instance2.setObjectName('MyObject2');
+      instance2.setLayer('OtherLayer');
+      instance2.setHasCustomSize(true);
+      instance2.setCustomWidth(32);
+      instance2.setCustomHeight(16);
+
+      const layerNames = new gd.VectorString();
+      layerNames.push_back('');
+      layerNames.push_back('OtherLayer');
+      const objectNames = new gd.VectorString();
+      objectNames.push_back('MyObject2');
+
+      const fieldsPtr = gd._malloc(2 * 7 * 8);
+      const indicesPtr = gd._malloc(2 * 2 * 4);
+      expect(
+        bulkContainer.getInstancesFields(
+          fieldsPtr,
+          indicesPtr,
+          2,
+          layerNames,
+          objectNames
+        )
+      ).toBe(2);
+      let fields = new Float64Array(gd.HEAPU8.buffer, fieldsPtr, 2 * 7);
+      let indices = new Int32Array(gd.HEAPU8.buffer, indicesPtr, 2 * 2);
+      expect(Array.from(fields)).toEqual([
+        10, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 32, 16, 0,
+      ]);
+      expect(Array.from(indices)).toEqual([0, -1, 1, 0]);
+
+      expect(
+        bulkContainer.getLayerInstancesFields(
+          'OtherLayer',
+          fieldsPtr,
+          indicesPtr,
+          2,
+          layerNames,
+          objectNames
+        )
+      ).toBe(1);
+      fields = new Float64Array(gd.HEAPU8.buffer, fieldsPtr, 7);
+      fields[0] = 100;
+      fields[1] = 200;
+      fields[4] = 64;
+      expect(
+        bulkContainer.setLayerInstancesFields('OtherLayer', fieldsPtr, 1)
+      ).toBe(1);
+      expect(instance1.getX()).toBe(10);
+      expect(instance2.getX()).toBe(100);
+      expect(instance2.getY()).toBe(200);
+      expect(instance2.getCustomWidth()).toBe(64);
+      expect(instance2.getCustomHeight()).toBe(16);
+
+      gd._free(fieldsPtr);
+      gd._free(indicesPtr);
+      layerNames.delete();
+      objectNames.delete();
+      bulkContainer.delete();
+    });
 
     afterAll(function () {
       container.delete();
@@ -292,6 +292,293 @@ describe('libGD.js - GDJS related tests', function () {
 
       expect(code).toMatch('elseEventsChainSatisfied');
     });
+
+    it('can generate events profiling hooks identifying events by their UUID', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+
+      const firstEvent = layout
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      const secondEvent = layout
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 1);
+      const condition = new gd.Instruction();
+      condition.setType('BuiltinCommonInstructions::Always');
+      gd.asStandardEvent(secondEvent).getConditions().insert(condition, 0);
+      condition.delete();
+
+      const generateCode = () => {
+        const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+        layoutCodeGenerator.setGenerateEventsProfilingCode(true);
+        const diagnosticReport = new gd.DiagnosticReport();
+        const includeFiles = new gd.SetString();
+        const code = layoutCodeGenerator.generateLayoutCompleteCode(
+          layout,
+          includeFiles,
+          diagnosticReport,
+          true
+        );
+        includeFiles.delete();
+        diagnosticReport.delete();
+        layoutCodeGenerator.delete();
+        return code;
+      };
+
+      const code = generateCode();
+      const firstEventUuid = firstEvent.getPersistentUuid();
+      const secondEventUuid = secondEvent.getPersistentUuid();
+      expect(firstEventUuid).not.toBe('');
+      expect(secondEventUuid).not.toBe('');
+      expect(code).toMatch(
+        `gdjs.EventsProfiler.registerEvents("gdjs.SceneCode", ` +
+          `["${firstEventUuid}", "${secondEventUuid}"]);`
+      );
+      // The hooks of the whole second event and of its conditions.
+      expect(code).toMatch('= gdjs.EventsProfiler.begin();');
+      expect(code).toMatch(
+        /gdjs\.EventsProfiler\.end\(gdjs\.SceneCode\.eventsProfilingCounters, 3, eventsProfilingStart\d+\);/
+      );
+      expect(code).toMatch(
+        /gdjs\.EventsProfiler\.end\(gdjs\.SceneCode\.eventsProfilingCounters, 4, eventsProfilingStart\d+\);/
+      );
+
+      // Inserting an event doesn't change the identifiers of the others.
+      layout
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      const newCode = generateCode();
+      expect(firstEvent.getPersistentUuid()).toBe(firstEventUuid);
+      expect(newCode).toMatch(`"${firstEventUuid}", "${secondEventUuid}"]);`);
+
+      project.delete();
+    });
+    it('can generate compact code for a layout', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout
+        .getObjects()
+        .insertNewObject(project, 'Sprite', 'MyObject', 0);
+
+      const eventsSerializerElement = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [],
+          actions: [
+            {
+              type: { value: 'Delete' },
+              parameters: ['MyObject', ''],
+            },
+          ],
+        },
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [
+            {
+              type: { value: 'BuiltinCommonInstructions::Or' },
+              parameters: [],
+              subInstructions: [
+                {
+                  type: { value: 'PosX' },
+                  parameters: ['MyObject', '<', '0'],
+                },
+                {
+                  type: { value: 'PosX' },
+                  parameters: ['MyObject', '>', '100'],
+                },
+              ],
+            },
+          ],
+          actions: [
+            {
+              type: { value: 'Delete' },
+              parameters: ['MyObject', ''],
+            },
+          ],
+        },
+      ]);
+      layout.getEvents().unserializeFrom(project, eventsSerializerElement);
+      eventsSerializerElement.delete();
+
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      layoutCodeGenerator.setGenerateCompactCode(true);
+      const diagnosticReport = new gd.DiagnosticReport();
+      const includeFiles = new gd.SetString();
+      const code = layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        includeFiles,
+        diagnosticReport,
+        true
+      );
+      includeFiles.delete();
+      diagnosticReport.delete();
+      layoutCodeGenerator.delete();
+      project.delete();
+
+      // Objects names and lists are stored in constants of a closure.
+      expect(code).toMatch('gdjs.SceneCode = (function() {');
+      expect(code).toMatch('const $n0 = "MyObject";');
+      expect(code).toMatch('runtimeScene.getObjects($n0)');
+      expect(code).not.toMatch('gdjs.SceneCode.GDMyObjectObjects');
+
+      // The lists gathering the instances picked by "Or" conditions too.
+      expect(code).toMatch(/const \$o0_1_\d+final = \[\];/);
+      expect(code).toMatch(/gdjs\.copyArray\(\$o0_1_\d+final, \$o0_1\);/);
+      expect(code).not.toMatch(/GDMyObjectObjects\d+_\d+final/);
+    });
+    it('can generate the code of linked events once for scenes with the same objects', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const externalEvents = project.insertNewExternalEvents('Common', 0);
+      const serializedExternalEventsEvents = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [],
+          actions: [
+            {
+              type: { value: 'Delete' },
+              parameters: ['MyObject', ''],
+            },
+          ],
+          events: [],
+        },
+      ]);
+      externalEvents
+        .getEvents()
+        .unserializeFrom(project, serializedExternalEventsEvents);
+      serializedExternalEventsEvents.delete();
+
+      const serializedLayoutEvents = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Link',
+          target: 'Common',
+        },
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [],
+          actions: [],
+          events: [
+            {
+              type: 'BuiltinCommonInstructions::Link',
+              target: 'Common',
+            },
+          ],
+        },
+      ]);
+      const layouts = ['Scene1', 'Scene2', 'Scene3'].map((name, index) => {
+        const layout = project.insertNewLayout(name, index);
+        layout.getObjects().insertNewObject(project, 'Sprite', 'MyObject', 0);
+        layout.getEvents().unserializeFrom(project, serializedLayoutEvents);
+        return layout;
+      });
+      serializedLayoutEvents.delete();
+      // The last scene has a different objects context.
+      layouts[2].getVariables().insertNew('MyVariable', 0);
+
+      const linkedEventsCodeGenerator = new gd.LinkedEventsCodeGenerator(
+        project
+      );
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      layoutCodeGenerator.setLinkedEventsCodeGenerator(
+        linkedEventsCodeGenerator
+      );
+      const diagnosticReport = new gd.DiagnosticReport();
+      const includeFiles = new gd.SetString();
+      const codes = layouts.map((layout) =>
+        layoutCodeGenerator.generateLayoutCompleteCode(
+          layout,
+          includeFiles,
+          diagnosticReport,
+          true
+        )
+      );
+      const linkedEventsCode = linkedEventsCodeGenerator.getCode();
+      const functionsCount = linkedEventsCodeGenerator.getFunctionsCount();
+      includeFiles.delete();
+      diagnosticReport.delete();
+      layoutCodeGenerator.delete();
+      linkedEventsCodeGenerator.delete();
+      project.delete();
+
+      // Links at the root of the events call a function shared by the scenes
+      // having the same objects context.
+      expect(functionsCount).toBe(2);
+      expect(codes[0]).toMatch('gdjs.Common_linkedEvents0Code.func(runtimeScene);');
+      expect(codes[1]).toMatch('gdjs.Common_linkedEvents0Code.func(runtimeScene);');
+      expect(codes[2]).toMatch('gdjs.Common_linkedEvents1Code.func(runtimeScene);');
+      // The runtime looks for the callbacks of the async actions in the code
+      // of the linked events called by the scene.
+      expect(codes[0]).toMatch(
+        'gdjs.Scene1Code.linkedEventsCodeNames = ["Common_linkedEvents0Code"];'
+      );
+      expect(codes[2]).toMatch(
+        'gdjs.Scene3Code.linkedEventsCodeNames = ["Common_linkedEvents1Code"];'
+      );
+      expect(linkedEventsCode).toMatch(
+        'gdjs.Common_linkedEvents0Code.func = function(runtimeScene) {'
+      );
+      expect(linkedEventsCode).toMatch(
+        'gdjs.Common_linkedEvents0Code.GDMyObjectObjects1[i].deleteFromScene(runtimeScene);'
+      );
+
+      // Links in sub-events are still inlined, as objects can be picked by
+      // their parent events.
+      expect(codes[0]).toMatch(
+        'gdjs.Scene1Code.GDMyObjectObjects1[i].deleteFromScene(runtimeScene);'
+      );
+    });
+    it('runs consecutive instructions on an object in a single loop', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      layout
+        .getObjects()
+        .insertNewObject(project, 'Sprite', 'MyObject', 0);
+
+      const evt = layout
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      const insertInstruction = (instructions, type, parameters) => {
+        const instruction = new gd.Instruction();
+        instruction.setType(type);
+        instruction.setParametersCount(parameters.length);
+        parameters.forEach((parameter, index) =>
+          instruction.setParameter(index, parameter)
+        );
+        instructions.insert(instruction, instructions.size());
+        instruction.delete();
+      };
+      const conditions = gd.asStandardEvent(evt).getConditions();
+      insertInstruction(conditions, 'PosX', ['MyObject', '>', '1']);
+      insertInstruction(conditions, 'PosY', ['MyObject', '<', '2']);
+      const actions = gd.asStandardEvent(evt).getActions();
+      insertInstruction(actions, 'SetX', ['MyObject', '=', '3']);
+      insertInstruction(actions, 'SetY', ['MyObject', '=', 'MyObject.X()']);
+      insertInstruction(actions, 'Delete', ['MyObject', '']);
+
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      const diagnosticReport = new gd.DiagnosticReport();
+      const code = layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        new gd.SetString(),
+        diagnosticReport,
+        true
+      );
+      diagnosticReport.delete();
+      layoutCodeGenerator.delete();
+      project.delete();
+
+      const objectsList = 'gdjs.SceneCode.GDMyObjectObjects1';
+      expect(code).toMatch(
+        `if ( (${objectsList}[i].getX() > 1) && (${objectsList}[i].getY() < 2) ) {`
+      );
+      expect(code).toMatch(
+        `{for(var i = 0, len = ${objectsList}.length ;i < len;++i) {\n` +
+          `    ${objectsList}[i].setX(3);\n` +
+          `    ${objectsList}[i].setY((${objectsList}[i].getX()));\n` +
+          `}\n`
+      );
+      // Deleting objects changes the objects lists: it's run in its own loop.
+      expect(code).toMatch(`${objectsList}[i].deleteFromScene(runtimeScene);`);
+    });
     it('does not generate code for improperly set up actions/conditions', function () {
       const project = gd.ProjectHelper.createNewGDJSProject();
       const layout = project.insertNewLayout('Scene', 0);
@@ -0,0 +1,106 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+const { makeBenchmarkSuite } = require('../TestUtils/BenchmarkSuite.js');
+
+describe.skip('GDJS compact events code benchmarks', function () {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  const objectsCount = 50;
+  const eventsCount = 500;
+
+  const makeProjectWithLargeScene = () => {
+    const project = gd.ProjectHelper.createNewGDJSProject();
+    const layout = project.insertNewLayout('Scene', 0);
+    for (let i = 0; i < objectsCount; i++) {
+      layout
+        .getObjects()
+        .insertNewObject(project, 'Sprite', 'MyObject' + i, i);
+    }
+
+    for (let i = 0; i < eventsCount; i++) {
+      const evt = gd.asStandardEvent(
+        layout
+          .getEvents()
+          .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', i)
+      );
+      const objectName = 'MyObject' + (i % objectsCount);
+      const otherObjectName = 'MyObject' + ((i + 1) % objectsCount);
+
+      const condition = new gd.Instruction();
+      condition.setType('PosX');
+      condition.setParametersCount(3);
+      condition.setParameter(0, objectName);
+      condition.setParameter(1, '<');
+      condition.setParameter(2, '' + i);
+      evt.getConditions().insert(condition, 0);
+      condition.delete();
+
+      const action = new gd.Instruction();
+      action.setType('SetX');
+      action.setParametersCount(3);
+      action.setParameter(0, objectName);
+      action.setParameter(1, '=');
+      action.setParameter(2, otherObjectName + '.X() + 1');
+      evt.getActions().insert(action, 0);
+      action.delete();
+
+      const subEvent = gd.asStandardEvent(
+        evt
+          .getSubEvents()
+          .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0)
+      );
+      const subAction = new gd.Instruction();
+      subAction.setType('Delete');
+      subAction.setParametersCount(2);
+      subAction.setParameter(0, otherObjectName);
+      subAction.setParameter(1, '');
+      subEvent.getActions().insert(subAction, 0);
+      subAction.delete();
+    }
+    return project;
+  };
+
+  const generateCode = (project, generateCompactCode) => {
+    const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+    layoutCodeGenerator.setGenerateCompactCode(generateCompactCode);
+    const diagnosticReport = new gd.DiagnosticReport();
+    const includes = new gd.SetString();
+    const code = layoutCodeGenerator.generateLayoutCompleteCode(
+      project.getLayout('Scene'),
+      includes,
+      diagnosticReport,
+      true
+    );
+    includes.delete();
+    diagnosticReport.delete();
+    layoutCodeGenerator.delete();
+    return code;
+  };
+
+  it('Benchmark parsing the code of a large scene', function () {
+    const project = makeProjectWithLargeScene();
+    const code = generateCode(project, false);
+    const compactCode = generateCode(project, true);
+    project.delete();
+
+    console.log(
+      'Code size: ' + code.length + ' - compact code size: ' + compactCode.length
+    );
+
+    // Changing the code at each iteration avoids the compilation cache.
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 5,
+      iterationsCount: 20,
+    })
+      .add('parse the code', (i) => {
+        new Function('gdjs', '// ' + i + '\n' + code);
+      })
+      .add('parse the compact code', (i) => {
+        new Function('gdjs', '// ' + i + '\n' + compactCode);
+      });
+
+    console.log(benchmarkSuite.run());
+  });
+});
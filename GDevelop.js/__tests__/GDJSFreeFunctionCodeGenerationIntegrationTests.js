@@ -5,6 +5,7 @@ const {
 const { makeMinimalGDJSMock } = require('../TestUtils/GDJSMocks.js');
 const {
   generateCompiledEventsForEventsBasedBehavior,
+  generateCompiledEventsForLayout,
 } = require('../TestUtils/CodeGenerationHelpers.js');
 
 describe('libGD.js - GDJS Free Function Code Generation integration tests', function () {
@@ -242,6 +243,257 @@ describe('libGD.js - GDJS Free Function Code Generation integration tests', func
         .getAsNumber()
     ).toBe(456);
   });
+
+  describe('Inlined expression functions', () => {
+    /**
+     * Create an extension with:
+     * - "Combine", an expression returning `First * 10 + Second`, which is
+     *   small enough to be inlined,
+     * - "Next", an expression with 2 actions, which is never inlined.
+     * and declare their metadata on the platform, like the IDE does.
+     */
+    const makeProjectWithInlinableFunction = () => {
+      const project = new gd.ProjectHelper.createNewGDJSProject();
+      const eventsFunctionsExtension =
+        project.insertNewEventsFunctionsExtension('MyExtension', 0);
+      const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
+
+      const combineFunction = freeEventsFunctions.insertNewEventsFunction(
+        'Combine',
+        0
+      );
+      combineFunction.setFunctionType(gd.EventsFunction.Expression);
+      const combineEventsSerializerElement = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [],
+          actions: [
+            {
+              type: { value: 'SetReturnNumber' },
+              parameters: ['First * 10 + Second'],
+            },
+          ],
+        },
+      ]);
+      combineFunction
+        .getEvents()
+        .unserializeFrom(project, combineEventsSerializerElement);
+      combineEventsSerializerElement.delete();
+      combineFunction
+        .getParameters()
+        .insertNewParameter('First', 0)
+        .setType('number');
+      combineFunction
+        .getParameters()
+        .insertNewParameter('Second', 1)
+        .setType('number');
+
+      const nextFunction = freeEventsFunctions.insertNewEventsFunction(
+        'Next',
+        1
+      );
+      nextFunction.setFunctionType(gd.EventsFunction.Expression);
+      const nextEventsSerializerElement = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [],
+          actions: [
+            {
+              type: { value: 'SetNumberVariable' },
+              parameters: ['Counter', '+', '1'],
+            },
+            {
+              type: { value: 'SetReturnNumber' },
+              parameters: ['Counter'],
+            },
+          ],
+        },
+      ]);
+      nextFunction
+        .getEvents()
+        .unserializeFrom(project, nextEventsSerializerElement);
+      nextEventsSerializerElement.delete();
+      eventsFunctionsExtension
+        .getSceneVariables()
+        .insertNew('Counter', 0)
+        .setValue(0);
+
+      const platformExtension = new gd.PlatformExtension();
+      gd.MetadataDeclarationHelper.declareExtension(
+        platformExtension,
+        eventsFunctionsExtension
+      );
+      const metadataDeclarationHelper = new gd.MetadataDeclarationHelper();
+      metadataDeclarationHelper.generateFreeFunctionMetadata(
+        project,
+        platformExtension,
+        eventsFunctionsExtension,
+        combineFunction
+      );
+      metadataDeclarationHelper.generateFreeFunctionMetadata(
+        project,
+        platformExtension,
+        eventsFunctionsExtension,
+        nextFunction
+      );
+      metadataDeclarationHelper.delete();
+      gd.JsPlatform.get().addNewExtension(platformExtension);
+      platformExtension.delete();
+
+      return project;
+    };
+
+    const generateAndRunLayoutEvents = (project, layout, events) => {
+      const layoutEventsSerializerElement = gd.Serializer.fromJSObject(events);
+      layout.getEvents().unserializeFrom(project, layoutEventsSerializerElement);
+      layoutEventsSerializerElement.delete();
+
+      const serializedProjectElement = new gd.SerializerElement();
+      project.serializeTo(serializedProjectElement);
+      const serializedSceneElement = new gd.SerializerElement();
+      layout.serializeTo(serializedSceneElement);
+      const { gdjs, runtimeScene } = makeMinimalGDJSMock({
+        gameData: JSON.parse(gd.Serializer.toJSON(serializedProjectElement)),
+        sceneData: JSON.parse(gd.Serializer.toJSON(serializedSceneElement)),
+      });
+      serializedProjectElement.delete();
+      serializedSceneElement.delete();
+
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      const includeFiles = new gd.SetString();
+      const diagnosticReport = new gd.DiagnosticReport();
+      const code = layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        includeFiles,
+        diagnosticReport,
+        true
+      );
+      diagnosticReport.delete();
+      includeFiles.delete();
+      layoutCodeGenerator.delete();
+
+      // "Next" is not inlined: replace it by a function recording the order
+      // of its calls.
+      const nextCalls = [];
+      gdjs.evtsExt__MyExtension__Next = {
+        func: () => {
+          nextCalls.push(nextCalls.length + 1);
+          return nextCalls.length;
+        },
+      };
+
+      const runCompiledEvents = generateCompiledEventsForLayout(
+        gd,
+        project,
+        layout
+      );
+      runCompiledEvents(gdjs, runtimeScene);
+
+      return { code, runtimeScene, nextCalls };
+    };
+
+    afterEach(() => {
+      gd.JsPlatform.get().removeExtension('MyExtension');
+    });
+
+    it('replaces calls to small expression functions by their body', () => {
+      const project = makeProjectWithInlinableFunction();
+      const layout = project.insertNewLayout('MyScene', 0);
+      layout.getVariables().insertNew('Result', 0).setValue(0);
+
+      const { code, runtimeScene } = generateAndRunLayoutEvents(
+        project,
+        layout,
+        [
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [
+              {
+                type: { value: 'SetNumberVariable' },
+                parameters: ['Result', '=', 'MyExtension::Combine(1, 2)'],
+              },
+            ],
+          },
+        ]
+      );
+      project.delete();
+
+      expect(code).toContain(
+        '((runtimeScene, inlinedArgument0, inlinedArgument1) => ' +
+          '(Number(inlinedArgument0 * 10 + inlinedArgument1) || 0))' +
+          '(runtimeScene, 1, 2)'
+      );
+      expect(code).not.toContain('gdjs.evtsExt__MyExtension__Combine.func');
+      expect(code).toContain('gdjs.evtsExt__MyExtension__Next.func');
+      expect(runtimeScene.getVariables().get('Result').getAsNumber()).toBe(12);
+    });
+
+    it('evaluates the arguments of inlined functions once and in order', () => {
+      const project = makeProjectWithInlinableFunction();
+      const layout = project.insertNewLayout('MyScene', 0);
+      layout.getVariables().insertNew('Result', 0).setValue(0);
+
+      const { runtimeScene, nextCalls } = generateAndRunLayoutEvents(
+        project,
+        layout,
+        [
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [
+              {
+                type: { value: 'SetNumberVariable' },
+                parameters: [
+                  'Result',
+                  '=',
+                  'MyExtension::Combine(MyExtension::Next(), MyExtension::Next())',
+                ],
+              },
+            ],
+          },
+        ]
+      );
+      project.delete();
+
+      expect(nextCalls).toEqual([1, 2]);
+      expect(runtimeScene.getVariables().get('Result').getAsNumber()).toBe(12);
+    });
+
+    it('uses the arguments even if the caller has variables with the same names as the parameters', () => {
+      const project = makeProjectWithInlinableFunction();
+      const layout = project.insertNewLayout('MyScene', 0);
+      layout.getVariables().insertNew('Result', 0).setValue(0);
+      layout.getVariables().insertNew('First', 1).setValue(1);
+      layout.getVariables().insertNew('Second', 2).setValue(2);
+
+      const { runtimeScene } = generateAndRunLayoutEvents(project, layout, [
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          // The local variable hides the scene variable in the caller, but
+          // not in the function.
+          variables: [{ name: 'First', type: 'number', value: 3 }],
+          conditions: [],
+          actions: [
+            {
+              type: { value: 'SetNumberVariable' },
+              parameters: [
+                'Result',
+                '=',
+                'MyExtension::Combine(Second, First) * 100 + ' +
+                  'MyExtension::Combine(First, Second)',
+              ],
+            },
+          ],
+        },
+      ]);
+      project.delete();
+
+      expect(runtimeScene.getVariables().get('Result').getAsNumber()).toBe(
+        23 * 100 + 32
+      );
+    });
+  });
 });
 
 function generatedFreeFunction(
@@ -3,6 +3,7 @@ const { makeMinimalGDJSMock } = require('../TestUtils/GDJSMocks');
 const {
   generateCompiledEventsForEventsFunction,
   generateCompiledEventsFromSerializedEvents,
+  generateCompiledEventsForLayout,
 } = require('../TestUtils/CodeGenerationHelpers.js');
 
 describe('libGD.js - GDJS Object Code Generation integration tests', function () {
@@ -666,4 +667,168 @@ describe('libGD.js - GDJS Object Code Generation integration tests', function ()
       project.delete();
     });
   });
+
+  describe('Objects lists of sub-events', () => {
+    it('uses the objects picked by the parent in sub-events not modifying them', function () {
+      const eventsSerializerElement = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [
+            {
+              type: { value: 'VarObjet' },
+              parameters: ['MyParamObject', 'PleaseCountMe', '=', '1'],
+            },
+          ],
+          actions: [],
+          events: [
+            {
+              // This event only reads the objects picked by its parent.
+              type: 'BuiltinCommonInstructions::Standard',
+              conditions: [],
+              actions: [
+                {
+                  type: { value: 'ModVarObjet' },
+                  parameters: ['MyParamObject', 'Picked', '=', '1'],
+                },
+              ],
+              events: [],
+            },
+            {
+              // This event picks some of the objects picked by its parent.
+              type: 'BuiltinCommonInstructions::Standard',
+              conditions: [
+                {
+                  type: { value: 'VarObjet' },
+                  parameters: ['MyParamObject', 'PleaseCountMeToo', '=', '1'],
+                },
+              ],
+              actions: [
+                {
+                  type: { value: 'ModVarObjet' },
+                  parameters: ['MyParamObject', 'PickedToo', '=', '1'],
+                },
+              ],
+              events: [],
+            },
+            {
+              // This event must not be affected by the picking of the
+              // previous one.
+              type: 'BuiltinCommonInstructions::Standard',
+              conditions: [],
+              actions: [
+                {
+                  type: { value: 'ModVarObjet' },
+                  parameters: ['MyParamObject', 'PickedAgain', '=', '1'],
+                },
+              ],
+              events: [],
+            },
+          ],
+        },
+      ]);
+
+      const project = new gd.ProjectHelper.createNewGDJSProject();
+      const eventsFunction = new gd.EventsFunction();
+      eventsFunction
+        .getEvents()
+        .unserializeFrom(project, eventsSerializerElement);
+
+      eventsFunction
+        .getParameters()
+        .insertNewParameter('MyParamObject', 0)
+        .setType('object');
+
+      const runCompiledEvents = generateCompiledEventsForEventsFunction(
+        gd,
+        project,
+        eventsFunction
+      );
+
+      const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+      const myObjectA1 = runtimeScene.createObject('MyObjectA');
+      const myObjectA2 = runtimeScene.createObject('MyObjectA');
+      const myObjectA3 = runtimeScene.createObject('MyObjectA');
+      const objectsLists = gdjs.Hashtable.newFrom({
+        MyObjectA: [myObjectA1, myObjectA2, myObjectA3],
+      });
+
+      myObjectA1.getVariables().get('PleaseCountMe').setNumber(1);
+      myObjectA2.getVariables().get('PleaseCountMe').setNumber(1);
+      myObjectA2.getVariables().get('PleaseCountMeToo').setNumber(1);
+
+      runCompiledEvents(gdjs, runtimeScene, [objectsLists]);
+
+      expect(myObjectA1.getVariables().get('Picked').getAsNumber()).toBe(1);
+      expect(myObjectA2.getVariables().get('Picked').getAsNumber()).toBe(1);
+      expect(myObjectA3.getVariables().get('Picked').getAsNumber()).toBe(0);
+      expect(myObjectA1.getVariables().get('PickedToo').getAsNumber()).toBe(0);
+      expect(myObjectA2.getVariables().get('PickedToo').getAsNumber()).toBe(1);
+      expect(myObjectA3.getVariables().get('PickedToo').getAsNumber()).toBe(0);
+      expect(myObjectA1.getVariables().get('PickedAgain').getAsNumber()).toBe(1);
+      expect(myObjectA2.getVariables().get('PickedAgain').getAsNumber()).toBe(1);
+      expect(myObjectA3.getVariables().get('PickedAgain').getAsNumber()).toBe(0);
+
+      eventsFunction.delete();
+      project.delete();
+    });
+  });
+
+  describe('Object groups', () => {
+    it('runs the instructions on each object of a large group', function () {
+      const project = new gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      const group = layout
+        .getObjects()
+        .getObjectGroups()
+        .insertNew('MyObjectGroup', 0);
+      const objectNames = [];
+      for (let i = 0; i < 8; i++) {
+        const objectName = 'MyObject' + i;
+        layout.getObjects().insertNewObject(project, 'Sprite', objectName, i);
+        group.addObject(objectName);
+        objectNames.push(objectName);
+      }
+      const serializedLayoutEvents = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [
+            {
+              type: { value: 'PosX' },
+              parameters: ['MyObjectGroup', '<', '100'],
+            },
+          ],
+          actions: [
+            {
+              type: { value: 'SetX' },
+              parameters: ['MyObjectGroup', '+', 'MyObjectGroup.X() + 1'],
+            },
+          ],
+        },
+      ]);
+      layout.getEvents().unserializeFrom(project, serializedLayoutEvents);
+      serializedLayoutEvents.delete();
+
+      const runCompiledEvents = generateCompiledEventsForLayout(
+        gd,
+        project,
+        layout
+      );
+      project.delete();
+
+      const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+      runtimeScene.getOnceTriggers().startNewFrame();
+      const instances = objectNames.map((objectName, i) => {
+        const instance = runtimeScene.createObject(objectName);
+        instance.setX(i % 2 ? 200 : 10);
+        return instance;
+      });
+
+      runCompiledEvents(gdjs, runtimeScene);
+
+      // Only the objects of the group picked by the condition were moved.
+      instances.forEach((instance, i) => {
+        expect(instance.getX()).toBe(i % 2 ? 200 : 21);
+      });
+    });
+  });
 });
@@ -0,0 +1,125 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+const { makeBenchmarkSuite } = require('../TestUtils/BenchmarkSuite.js');
+const { makeMinimalGDJSMock } = require('../TestUtils/GDJSMocks');
+const {
+  generateCompiledEventsForLayout,
+} = require('../TestUtils/CodeGenerationHelpers.js');
+
+describe.skip('GDJS object groups events code benchmarks', function () {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  const objectsCount = 200;
+  const instancesCountPerObject = 5;
+
+  const makeMoveObjectsEvent = (objectName) => ({
+    type: 'BuiltinCommonInstructions::Standard',
+    conditions: [
+      {
+        type: { value: 'PosX' },
+        parameters: [objectName, '<', '1000'],
+      },
+    ],
+    actions: [
+      {
+        type: { value: 'SetX' },
+        parameters: [objectName, '+', '1'],
+      },
+    ],
+  });
+
+  /**
+   * Make a scene moving all its objects, either with a single event on a group
+   * containing all the objects, or with an event for each object.
+   */
+  const makeProjectWithObjects = (useGroup) => {
+    const project = gd.ProjectHelper.createNewGDJSProject();
+    const layout = project.insertNewLayout('Scene', 0);
+    const group = layout
+      .getObjects()
+      .getObjectGroups()
+      .insertNew('MyObjectGroup', 0);
+    const events = [];
+    for (let i = 0; i < objectsCount; i++) {
+      const objectName = 'MyObject' + i;
+      layout.getObjects().insertNewObject(project, 'Sprite', objectName, i);
+      group.addObject(objectName);
+      if (!useGroup) events.push(makeMoveObjectsEvent(objectName));
+    }
+    if (useGroup) events.push(makeMoveObjectsEvent('MyObjectGroup'));
+
+    const serializedLayoutEvents = gd.Serializer.fromJSObject(events);
+    layout.getEvents().unserializeFrom(project, serializedLayoutEvents);
+    serializedLayoutEvents.delete();
+
+    return project;
+  };
+
+  const generateCode = (project) => {
+    const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+    const diagnosticReport = new gd.DiagnosticReport();
+    const includes = new gd.SetString();
+    const code = layoutCodeGenerator.generateLayoutCompleteCode(
+      project.getLayout('Scene'),
+      includes,
+      diagnosticReport,
+      true
+    );
+    includes.delete();
+    diagnosticReport.delete();
+    layoutCodeGenerator.delete();
+    return code;
+  };
+
+  const makeRunningScene = (project) => {
+    const runCompiledEvents = generateCompiledEventsForLayout(
+      gd,
+      project,
+      project.getLayout('Scene')
+    );
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    for (let i = 0; i < objectsCount; i++) {
+      for (let j = 0; j < instancesCountPerObject; j++) {
+        runtimeScene.createObject('MyObject' + i).setX(j);
+      }
+    }
+    return () => {
+      runtimeScene.getOnceTriggers().startNewFrame();
+      runCompiledEvents(gdjs, runtimeScene);
+    };
+  };
+
+  it('Benchmark the code of an event on a large group', function () {
+    const groupProject = makeProjectWithObjects(true);
+    const objectsProject = makeProjectWithObjects(false);
+
+    console.log(
+      'Code size with a group of ' +
+        objectsCount +
+        ' objects: ' +
+        generateCode(groupProject).length +
+        ' - code size with an event for each object: ' +
+        generateCode(objectsProject).length
+    );
+
+    const runGroupScene = makeRunningScene(groupProject);
+    const runObjectsScene = makeRunningScene(objectsProject);
+    groupProject.delete();
+    objectsProject.delete();
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 10,
+      iterationsCount: 100,
+    })
+      .add('run a frame of the event on the group', () => {
+        runGroupScene();
+      })
+      .add('run a frame of the events on each object', () => {
+        runObjectsScene();
+      });
+
+    console.log(benchmarkSuite.run());
+  });
+});
@@ -475,6 +475,34 @@ describe('libGD.js - GDJS Code Generation integration tests', function () {
     ).toBe(1);
   });
 
+  it('can generate accessors to the children of declared structures and arrays', function () {
+    const playerVariable = scene.getVariables().insertNew('Player', 0);
+    playerVariable.getChild('Stats').getChild('Health').setValue(10);
+    const inventoryVariable = scene.getVariables().insertNew('Inventory', 1);
+    inventoryVariable.castTo('array');
+    inventoryVariable.pushNew().setValue(1);
+    inventoryVariable.pushNew().setValue(2);
+    inventoryVariable.pushNew().getChild('Count').setValue(3);
+
+    const runtimeScene = generateAndRunActionsForLayout([
+      {
+        type: { value: 'SetNumberVariable' },
+        parameters: ['Player.Stats.Health', '+', 'Inventory[1 + 1].Count'],
+      },
+      {
+        type: { value: 'SetNumberVariable' },
+        // This child is not declared.
+        parameters: ['Player.Stats.Mana', '=', 'Inventory[1] + 5'],
+      },
+    ]);
+    const statsVariable = runtimeScene
+      .getVariables()
+      .get('Player')
+      .getChild('Stats');
+    expect(statsVariable.getChild('Health').getAsNumber()).toBe(13);
+    expect(statsVariable.getChild('Mana').getAsNumber()).toBe(7);
+  });
+
   it('can generate a local variable condition giving precedence to the closest local variable', function () {
     scene.getVariables().insertNew('SuccessVariable', 0).setValue(0);
 
@@ -0,0 +1,192 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+
+describe('MetadataDeclarationCache', () => {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  const makeExtensionWithFunctions = (project) => {
+    const eventsFunctionsExtension = project.insertNewEventsFunctionsExtension(
+      'MyExtension',
+      0
+    );
+    const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
+    freeEventsFunctions
+      .insertNewEventsFunction('MyAction', 0)
+      .setFunctionType(gd.EventsFunction.Action);
+    freeEventsFunctions
+      .insertNewEventsFunction('MyCondition', 1)
+      .setFunctionType(gd.EventsFunction.Condition);
+    eventsFunctionsExtension
+      .getEventsBasedBehaviors()
+      .insertNew('MyBehavior', 0);
+
+    return eventsFunctionsExtension;
+  };
+
+  it('declares everything the first time', () => {
+    const project = new gd.Project();
+    const extension = new gd.PlatformExtension();
+    const eventsFunctionsExtension = makeExtensionWithFunctions(project);
+
+    const cache = new gd.MetadataDeclarationCache();
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+
+    expect(cache.wasLastExtensionFullyDeclared()).toBe(true);
+    expect(cache.getLastDeclaredFreeFunctions().toJSArray()).toEqual([
+      'MyAction',
+      'MyCondition',
+    ]);
+    expect(cache.getLastDeclaredEventsBasedBehaviors().toJSArray()).toEqual([
+      'MyBehavior',
+    ]);
+    expect(
+      extension.getAllActions().has('MyExtension::MyAction')
+    ).toBe(true);
+    expect(
+      extension.getAllConditions().has('MyExtension::MyCondition')
+    ).toBe(true);
+    expect(extension.getBehaviorsTypes().toJSArray()).toEqual([
+      'MyExtension::MyBehavior',
+    ]);
+
+    cache.delete();
+    extension.delete();
+    project.delete();
+  });
+
+  it('only redeclares what changed', () => {
+    const project = new gd.Project();
+    const extension = new gd.PlatformExtension();
+    const eventsFunctionsExtension = makeExtensionWithFunctions(project);
+
+    const cache = new gd.MetadataDeclarationCache();
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+
+    // Nothing changed.
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+    expect(cache.wasLastExtensionFullyDeclared()).toBe(false);
+    expect(cache.getLastDeclaredFreeFunctions().size()).toBe(0);
+    expect(cache.getLastDeclaredEventsBasedBehaviors().size()).toBe(0);
+    expect(
+      extension.getAllActions().has('MyExtension::MyAction')
+    ).toBe(true);
+
+    // Change a function: it becomes a condition.
+    const action = eventsFunctionsExtension
+      .getEventsFunctions()
+      .getEventsFunction('MyAction');
+    action.setFunctionType(gd.EventsFunction.Condition);
+    action.setFullName('My updated function');
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+    expect(cache.getLastDeclaredFreeFunctions().toJSArray()).toEqual([
+      'MyAction',
+    ]);
+    expect(cache.getLastDeclaredEventsBasedBehaviors().size()).toBe(0);
+    expect(
+      extension.getAllActions().has('MyExtension::MyAction')
+    ).toBe(false);
+    expect(
+      extension
+        .getAllConditions()
+        .get('MyExtension::MyAction')
+        .getFullName()
+    ).toBe('My updated function');
+
+    // Remove a function and the behavior.
+    eventsFunctionsExtension
+      .getEventsFunctions()
+      .removeEventsFunction('MyCondition');
+    eventsFunctionsExtension.getEventsBasedBehaviors().remove('MyBehavior');
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+    expect(
+      extension.getAllConditions().has('MyExtension::MyCondition')
+    ).toBe(false);
+    expect(extension.getBehaviorsTypes().size()).toBe(0);
+
+    // Change the extension itself.
+    eventsFunctionsExtension.setIconUrl('my-icon.png');
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+    expect(cache.wasLastExtensionFullyDeclared()).toBe(true);
+    expect(cache.getLastDeclaredFreeFunctions().toJSArray()).toEqual([
+      'MyAction',
+    ]);
+
+    cache.delete();
+    extension.delete();
+    project.delete();
+  });
+
+  it('declares everything again for another project or locale', () => {
+    const project = new gd.Project();
+    const extension = new gd.PlatformExtension();
+    const eventsFunctionsExtension = makeExtensionWithFunctions(project);
+
+    const cache = new gd.MetadataDeclarationCache();
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+
+    // The behavior metadata refers to the project, so another project
+    // must declare everything again.
+    const otherProject = new gd.Project();
+    cache.declareExtension(otherProject, extension, eventsFunctionsExtension);
+    expect(cache.wasLastExtensionFullyDeclared()).toBe(true);
+    expect(cache.getLastDeclaredEventsBasedBehaviors().toJSArray()).toEqual([
+      'MyBehavior',
+    ]);
+    cache.declareExtension(otherProject, extension, eventsFunctionsExtension);
+    expect(cache.wasLastExtensionFullyDeclared()).toBe(false);
+
+    // Metadata is translated, so another locale must declare everything
+    // again.
+    cache.setLocale('fr');
+    cache.declareExtension(otherProject, extension, eventsFunctionsExtension);
+    expect(cache.wasLastExtensionFullyDeclared()).toBe(true);
+    expect(cache.getLastDeclaredFreeFunctions().toJSArray()).toEqual([
+      'MyAction',
+      'MyCondition',
+    ]);
+
+    cache.delete();
+    otherProject.delete();
+    extension.delete();
+    project.delete();
+  });
+
+  it('keeps the mangled names of the methods of behaviors', () => {
+    const project = new gd.Project();
+    const extension = new gd.PlatformExtension();
+    const eventsFunctionsExtension = makeExtensionWithFunctions(project);
+    eventsFunctionsExtension
+      .getEventsBasedBehaviors()
+      .get('MyBehavior')
+      .getEventsFunctions()
+      .insertNewEventsFunction('MyMethod', 0);
+
+    const cache = new gd.MetadataDeclarationCache();
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+    const mangledName = cache
+      .getBehaviorMethodMangledNames('MyExtension', 'MyBehavior')
+      .get('MyMethod');
+    expect(mangledName).not.toBe('');
+
+    // The behavior is not declared again, but its mangled names are kept.
+    cache.declareExtension(project, extension, eventsFunctionsExtension);
+    expect(cache.getLastDeclaredEventsBasedBehaviors().size()).toBe(0);
+    expect(
+      cache
+        .getBehaviorMethodMangledNames('MyExtension', 'MyBehavior')
+        .get('MyMethod')
+    ).toBe(mangledName);
+    expect(
+      cache
+        .getBehaviorMethodMangledNames('MyExtension', 'UnknownBehavior')
+        .keys()
+        .size()
+    ).toBe(0);
+
+    cache.delete();
+    extension.delete();
+    project.delete();
+  });
+});
@@ -0,0 +1,135 @@
+const initializeGDevelopJs = require('../../Binaries/embuild/GDevelop.js/libGD.js');
+const { makeBenchmarkSuite } = require('../TestUtils/BenchmarkSuite.js');
+
+describe.skip('MetadataDeclarationCache benchmarks', function () {
+  let gd = null;
+  beforeAll(async () => {
+    gd = await initializeGDevelopJs();
+  });
+
+  const extensionsCount = 80;
+  const functionsCount = 40;
+  const behaviorsCount = 5;
+  const behaviorFunctionsCount = 20;
+
+  const makeProjectWithLargeExtensions = () => {
+    const project = new gd.Project();
+    for (let i = 0; i < extensionsCount; i++) {
+      const eventsFunctionsExtension = project.insertNewEventsFunctionsExtension(
+        'Extension' + i,
+        i
+      );
+      const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
+      for (let j = 0; j < functionsCount; j++) {
+        const eventsFunction = freeEventsFunctions.insertNewEventsFunction(
+          'Function' + j,
+          j
+        );
+        eventsFunction.setFunctionType(
+          j % 2 ? gd.EventsFunction.Action : gd.EventsFunction.Condition
+        );
+        eventsFunction.setFullName('Function ' + j);
+        eventsFunction
+          .getParameters()
+          .addNewParameter('Parameter')
+          .setType('number');
+      }
+      for (let j = 0; j < behaviorsCount; j++) {
+        const eventsBasedBehavior = eventsFunctionsExtension
+          .getEventsBasedBehaviors()
+          .insertNew('Behavior' + j, j);
+        const behaviorEventsFunctions = eventsBasedBehavior.getEventsFunctions();
+        for (let k = 0; k < behaviorFunctionsCount; k++) {
+          behaviorEventsFunctions
+            .insertNewEventsFunction('Function' + k, k)
+            .setFunctionType(gd.EventsFunction.Action);
+        }
+        gd.WholeProjectRefactorer.ensureBehaviorEventsFunctionsProperParameters(
+          eventsFunctionsExtension,
+          eventsBasedBehavior
+        );
+      }
+    }
+    return project;
+  };
+
+  const declareExtensionFromScratch = (project, eventsFunctionsExtension) => {
+    const extension = new gd.PlatformExtension();
+    gd.MetadataDeclarationHelper.declareExtension(
+      extension,
+      eventsFunctionsExtension
+    );
+    const eventsBasedBehaviors = eventsFunctionsExtension.getEventsBasedBehaviors();
+    for (let i = 0; i < eventsBasedBehaviors.getCount(); i++) {
+      const behaviorMethodMangledNames = new gd.MapStringString();
+      gd.MetadataDeclarationHelper.generateBehaviorMetadata(
+        project,
+        extension,
+        eventsFunctionsExtension,
+        eventsBasedBehaviors.getAt(i),
+        behaviorMethodMangledNames
+      );
+      behaviorMethodMangledNames.delete();
+    }
+    const metadataDeclarationHelper = new gd.MetadataDeclarationHelper();
+    const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
+    for (let i = 0; i < freeEventsFunctions.getEventsFunctionsCount(); i++) {
+      metadataDeclarationHelper.generateFreeFunctionMetadata(
+        project,
+        extension,
+        eventsFunctionsExtension,
+        freeEventsFunctions.getEventsFunctionAt(i)
+      );
+    }
+    metadataDeclarationHelper.delete();
+    return extension;
+  };
+
+  it('Benchmark redeclaring an extension after editing one function', function () {
+    const project = makeProjectWithLargeExtensions();
+    const editedExtension = project.getEventsFunctionsExtensionAt(0);
+    const editedFunction = editedExtension
+      .getEventsFunctions()
+      .getEventsFunctionAt(0);
+
+    const cache = new gd.MetadataDeclarationCache();
+    const extensions = [];
+    for (let i = 0; i < extensionsCount; i++) {
+      const extension = new gd.PlatformExtension();
+      cache.declareExtension(
+        project,
+        extension,
+        project.getEventsFunctionsExtensionAt(i)
+      );
+      extensions.push(extension);
+    }
+
+    const benchmarkSuite = makeBenchmarkSuite({
+      benchmarksCount: 5,
+      iterationsCount: 20,
+    })
+      .add('declare all extensions from scratch', (i) => {
+        editedFunction.setFullName('Edited function ' + i);
+        for (let j = 0; j < extensionsCount; j++) {
+          declareExtensionFromScratch(
+            project,
+            project.getEventsFunctionsExtensionAt(j)
+          ).delete();
+        }
+      })
+      .add('declare the edited extension from scratch', (i) => {
+        editedFunction.setFullName('Edited function ' + i);
+        declareExtensionFromScratch(project, editedExtension).delete();
+      })
+      .add('declare the edited extension with MetadataDeclarationCache', (i) => {
+        editedFunction.setFullName('Edited function ' + i);
+        cache.declareExtension(project, extensions[0], editedExtension);
+      });
+
+    console.log(benchmarkSuite.run());
+
+    extensions.forEach((extension) => extension.delete());
+    cache.delete();
+    project.delete();
+  });
+});
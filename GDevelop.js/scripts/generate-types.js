@@ -192,6 +192,23 @@ type ObjectsContainer_SourceType = 0 | 1 | 2 | 3 | 4`
       ].join('\n'),
       'types/gdobjectscontainerslist.js'
     );
+    fs.writeFileSync(
+      'types/instructionmetadata_evaluationcost.js',
+      `// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InstructionMetadata_EvaluationCost = 0 | 1 | 2 | 3`
+    );
+    shell.sed(
+      '-i',
+      'declare class gdInstructionMetadata extends gdAbstractFunctionMetadata {',
+      [
+        'declare class gdInstructionMetadata extends gdAbstractFunctionMetadata {',
+        '  static UnknownCost: 0;',
+        '  static Cheap: 1;',
+        '  static Medium: 2;',
+        '  static Expensive: 3;',
+      ].join('\n'),
+      'types/gdinstructionmetadata.js'
+    );
     fs.writeFileSync(
       'types/projectdiagnostic_errortype.js',
       `// Automatically generated by GDevelop.js/scripts/generate-types.js
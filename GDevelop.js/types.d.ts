@@ -71,6 +71,13 @@ export enum ResourcesContainer_SourceType {
   Properties = 3,
 }
 
+export enum InstructionMetadata_EvaluationCost {
+  UnknownCost = 0,
+  Cheap = 1,
+  Medium = 2,
+  Expensive = 3,
+}
+
 export enum QuickCustomization_Visibility {
   Default = 0,
   Visible = 1,
@@ -715,6 +722,7 @@ export class ProjectScopedContainers extends EmscriptenObject {
   getObjectsContainersList(): ObjectsContainersList;
   getVariablesContainersList(): VariablesContainersList;
   getResourcesContainersList(): ResourcesContainersList;
+  getVersion(): number;
   getScopeSceneName(): string;
   getScopeExternalEventsName(): string;
   getScopeExtensionName(): string;
@@ -1356,6 +1364,10 @@ export class InitialInstancesContainer extends EmscriptenObject {
   renameInstancesOfObject(oldName: string, newName: string): void;
   removeInstance(inst: InitialInstance): void;
   getLayerInstancesCount(layerName: string): number;
+  getInstancesFields(fieldsPtr: number, indicesPtr: number, maxInstancesCount: number, layerNames: VectorString, objectNames: VectorString): number;
+  getLayerInstancesFields(layerName: string, fieldsPtr: number, indicesPtr: number, maxInstancesCount: number, layerNames: VectorString, objectNames: VectorString): number;
+  setInstancesFields(fieldsPtr: number, instancesCount: number): number;
+  setLayerInstancesFields(layerName: string, fieldsPtr: number, instancesCount: number): number;
   insertNewInitialInstance(): InitialInstance;
   insertInitialInstance(inst: InitialInstance): InitialInstance;
   serializeTo(element: SerializerElement): void;
@@ -1486,6 +1498,7 @@ export class Instruction extends EmscriptenObject {
 export class Expression extends EmscriptenObject {
   getPlainString(): string;
   getRootNode(): ExpressionNode;
+  getSharedRootNode(): ExpressionNode;
 }
 
 export class VectorPairStringTextFormatting extends EmscriptenObject {
@@ -1568,6 +1581,10 @@ export class InstructionMetadata extends AbstractFunctionMetadata {
   markAsSimple(): InstructionMetadata;
   markAsAdvanced(): InstructionMetadata;
   markAsComplex(): InstructionMetadata;
+  setEvaluationCost(evaluationCost: InstructionMetadata_EvaluationCost): InstructionMetadata;
+  getEvaluationCost(): InstructionMetadata_EvaluationCost;
+  markAsPure(): InstructionMetadata;
+  isPure(): boolean;
   getCodeExtraInformation(): InstructionMetadata;
   setFunctionName(functionName_: string): InstructionMetadata;
   setAsyncFunctionName(functionName_: string): InstructionMetadata;
@@ -1968,6 +1985,7 @@ export class EventsList extends EmscriptenObject {
   getEventsCount(): number;
   contains(event: BaseEvent, recursive: boolean): boolean;
   moveEventToAnotherEventsList(eventToMove: BaseEvent, newEventsList: EventsList, newPosition: number): boolean;
+  resetPersistentUuid(): EventsList;
   isEmpty(): boolean;
   clear(): void;
   serializeTo(element: SerializerElement): void;
@@ -1995,6 +2013,8 @@ export class BaseEvent extends EmscriptenObject {
   unserializeFrom(project: Project, element: SerializerElement): void;
   getAiGeneratedEventId(): string;
   setAiGeneratedEventId(aiGeneratedEventId: string): void;
+  getPersistentUuid(): string;
+  resetPersistentUuid(): BaseEvent;
 }
 
 export class StandardEvent extends BaseEvent {
@@ -2357,6 +2377,8 @@ export class DiagnosticReport extends EmscriptenObject {
   get(index: number): ProjectDiagnostic;
   count(): number;
   getSceneName(): string;
+  getReorderedConditionsCount(): number;
+  getReorderedConditions(index: number): string;
 }
 
 export class WholeProjectDiagnosticReport extends EmscriptenObject {
@@ -2365,6 +2387,14 @@ export class WholeProjectDiagnosticReport extends EmscriptenObject {
   hasAnyIssue(): boolean;
 }
 
+export class WholeProjectDiagnosticsChecker extends EmscriptenObject {
+  constructor();
+  check(project: Project, wholeProjectDiagnosticReport: WholeProjectDiagnosticReport): void;
+  clearCache(): void;
+  getCheckedEventsCount(): number;
+  getReusedEventsCount(): number;
+}
+
 export class ExpressionParserError extends EmscriptenObject {
   getType(): ExpressionParserError_ErrorType;
   getMessage(): string;
@@ -3267,6 +3297,17 @@ export class ParticleEmitterObject extends ObjectConfiguration {
 export class LayoutCodeGenerator extends EmscriptenObject {
   constructor(project: Project);
   generateLayoutCompleteCode(layout: Layout, includes: SetString, diagnosticReport: DiagnosticReport, compilationForRuntime: boolean): string;
+  setGenerateCompactCode(enable: boolean): LayoutCodeGenerator;
+  setGenerateEventsProfilingCode(enable: boolean): LayoutCodeGenerator;
+  setLinkedEventsCodeGenerator(linkedEventsCodeGenerator: LinkedEventsCodeGenerator): LayoutCodeGenerator;
+}
+
+export class LinkedEventsCodeGenerator extends EmscriptenObject {
+  constructor(project: Project);
+  setGenerateCompactCode(enable: boolean): LinkedEventsCodeGenerator;
+  setCompilationForRuntime(enable: boolean): LinkedEventsCodeGenerator;
+  getCode(): string;
+  getFunctionsCount(): number;
 }
 
 export class BehaviorCodeGenerator extends EmscriptenObject {
@@ -3310,6 +3351,7 @@ export class PreviewExportOptions extends EmscriptenObject {
   setShouldReloadProjectData(enable: boolean): PreviewExportOptions;
   setShouldReloadLibraries(enable: boolean): PreviewExportOptions;
   setShouldGenerateScenesEventsCode(enable: boolean): PreviewExportOptions;
+  setShouldGenerateEventsProfilingCode(enable: boolean): PreviewExportOptions;
   setNativeMobileApp(enable: boolean): PreviewExportOptions;
   setFullLoadingScreen(enable: boolean): PreviewExportOptions;
   setIsDevelopmentEnvironment(enable: boolean): PreviewExportOptions;
@@ -3333,6 +3375,9 @@ export class ExportOptions extends EmscriptenObject {
   constructor(project: Project, outputPath: string);
   setFallbackAuthor(id: string, username: string): ExportOptions;
   setTarget(target: string): ExportOptions;
+  setShouldGenerateEventsProfilingCode(enable: boolean): ExportOptions;
+  setShouldGenerateCompactEventsCode(enable: boolean): ExportOptions;
+  setShouldShareLinkedEventsCode(enable: boolean): ExportOptions;
 }
 
 export class Exporter extends EmscriptenObject {
@@ -3391,6 +3436,21 @@ export class MetadataDeclarationHelper extends EmscriptenObject {
   static shiftSentenceParamIndexes(sentence: string, offset: number): string;
 }
 
+export class MetadataDeclarationCache extends EmscriptenObject {
+  constructor();
+  declareExtension(project: Project, extension: PlatformExtension, eventsFunctionsExtension: EventsFunctionsExtension): void;
+  setLocale(locale: string): void;
+  getLocale(): string;
+  forgetExtension(extensionName: string): void;
+  clear(): void;
+  getLastDeclaredFreeFunctions(): VectorString;
+  getLastDeclaredEventsBasedBehaviors(): VectorString;
+  getLastDeclaredEventsBasedObjects(): VectorString;
+  wasLastExtensionFullyDeclared(): boolean;
+  getBehaviorMethodMangledNames(extensionName: string, behaviorName: string): MapStringString;
+  getObjectMethodMangledNames(extensionName: string, objectName: string): MapStringString;
+}
+
 export class MemoryTrackedRegistry extends EmscriptenObject {
   static add(ptr: number, className: string): void;
   static remove(ptr: number, className: string): void;
@@ -3405,6 +3465,23 @@ export class MemoryTrackedRegistry extends EmscriptenObject {
   static getDeadContextTimeMs(ptr: number, className: string): number;
 }
 
+export class AllocationCounts extends EmscriptenObject {
+  getAllocationsCount(): number;
+  getAllocatedBytes(): number;
+  getPeakBytes(): number;
+}
+
+export class AllocationCounters extends EmscriptenObject {
+  static isEnabled(): boolean;
+  static reset(): void;
+  static getCounts(): AllocationCounts;
+  static beginPhase(name: string): void;
+  static endPhase(): void;
+  static hasPhase(name: string): boolean;
+  static getPhaseCounts(name: string): AllocationCounts;
+  static getPhaseNames(): VectorString;
+}
+
 export function toNewVectorString(): VectorString;
 
 export function getTypeOfBehavior(layout: ObjectsContainer, name: string, searchInGroups: boolean): string;
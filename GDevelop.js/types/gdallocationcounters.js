@@ -0,0 +1,13 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdAllocationCounters {
+  static isEnabled(): boolean;
+  static reset(): void;
+  static getCounts(): gdAllocationCounts;
+  static beginPhase(name: string): void;
+  static endPhase(): void;
+  static hasPhase(name: string): boolean;
+  static getPhaseCounts(name: string): gdAllocationCounts;
+  static getPhaseNames(): gdVectorString;
+  delete(): void;
+  ptr: number;
+};
@@ -0,0 +1,8 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdAllocationCounts {
+  getAllocationsCount(): number;
+  getAllocatedBytes(): number;
+  getPeakBytes(): number;
+  delete(): void;
+  ptr: number;
+};
@@ -20,6 +20,8 @@ declare class gdBaseEvent extends gdBaseEvent {
   unserializeFrom(project: gdProject, element: gdSerializerElement): void;
   getAiGeneratedEventId(): string;
   setAiGeneratedEventId(aiGeneratedEventId: string): void;
+  getPersistentUuid(): string;
+  resetPersistentUuid(): gdBaseEvent;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
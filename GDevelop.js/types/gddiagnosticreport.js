@@ -4,6 +4,8 @@ declare class gdDiagnosticReport {
   get(index: number): gdProjectDiagnostic;
   count(): number;
   getSceneName(): string;
+  getReorderedConditionsCount(): number;
+  getReorderedConditions(index: number): string;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
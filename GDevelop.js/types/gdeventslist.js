@@ -10,6 +10,7 @@ declare class gdEventsList {
   getEventsCount(): number;
   contains(event: gdBaseEvent, recursive: boolean): boolean;
   moveEventToAnotherEventsList(eventToMove: gdBaseEvent, newEventsList: gdEventsList, newPosition: number): boolean;
+  resetPersistentUuid(): gdEventsList;
   isEmpty(): boolean;
   clear(): void;
   serializeTo(element: gdSerializerElement): void;
@@ -3,6 +3,9 @@ declare class gdExportOptions {
   constructor(project: gdProject, outputPath: string): void;
   setFallbackAuthor(id: string, username: string): gdExportOptions;
   setTarget(target: string): gdExportOptions;
+  setShouldGenerateEventsProfilingCode(enable: boolean): gdExportOptions;
+  setShouldGenerateCompactEventsCode(enable: boolean): gdExportOptions;
+  setShouldShareLinkedEventsCode(enable: boolean): gdExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
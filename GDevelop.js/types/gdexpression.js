@@ -2,6 +2,7 @@
 declare class gdExpression {
   getPlainString(): string;
   getRootNode(): gdExpressionNode;
+  getSharedRootNode(): gdExpressionNode;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
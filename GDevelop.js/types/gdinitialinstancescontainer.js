@@ -14,6 +14,10 @@ declare class gdInitialInstancesContainer {
   renameInstancesOfObject(oldName: string, newName: string): void;
   removeInstance(inst: gdInitialInstance): void;
   getLayerInstancesCount(layerName: string): number;
+  getInstancesFields(fieldsPtr: number, indicesPtr: number, maxInstancesCount: number, layerNames: gdVectorString, objectNames: gdVectorString): number;
+  getLayerInstancesFields(layerName: string, fieldsPtr: number, indicesPtr: number, maxInstancesCount: number, layerNames: gdVectorString, objectNames: gdVectorString): number;
+  setInstancesFields(fieldsPtr: number, instancesCount: number): number;
+  setLayerInstancesFields(layerName: string, fieldsPtr: number, instancesCount: number): number;
   insertNewInitialInstance(): gdInitialInstance;
   insertInitialInstance(inst: gdInitialInstance): gdInitialInstance;
   serializeTo(element: gdSerializerElement): void;
@@ -1,5 +1,9 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdInstructionMetadata extends gdAbstractFunctionMetadata {
+  static UnknownCost: 0;
+  static Cheap: 1;
+  static Medium: 2;
+  static Expensive: 3;
   constructor(): void;
   getFullName(): string;
   getDescription(): string;
@@ -43,6 +47,10 @@ declare class gdInstructionMetadata extends gdAbstractFunctionMetadata {
   markAsSimple(): gdInstructionMetadata;
   markAsAdvanced(): gdInstructionMetadata;
   markAsComplex(): gdInstructionMetadata;
+  setEvaluationCost(evaluationCost: InstructionMetadata_EvaluationCost): gdInstructionMetadata;
+  getEvaluationCost(): InstructionMetadata_EvaluationCost;
+  markAsPure(): gdInstructionMetadata;
+  isPure(): boolean;
   getCodeExtraInformation(): gdInstructionMetadata;
   setFunctionName(functionName_: string): gdInstructionMetadata;
   setAsyncFunctionName(functionName_: string): gdInstructionMetadata;
@@ -2,6 +2,9 @@
 declare class gdLayoutCodeGenerator {
   constructor(project: gdProject): void;
   generateLayoutCompleteCode(layout: gdLayout, includes: gdSetString, diagnosticReport: gdDiagnosticReport, compilationForRuntime: boolean): string;
+  setGenerateCompactCode(enable: boolean): gdLayoutCodeGenerator;
+  setGenerateEventsProfilingCode(enable: boolean): gdLayoutCodeGenerator;
+  setLinkedEventsCodeGenerator(linkedEventsCodeGenerator: gdLinkedEventsCodeGenerator): gdLayoutCodeGenerator;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
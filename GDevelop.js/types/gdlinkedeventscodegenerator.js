@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdLinkedEventsCodeGenerator {
+  constructor(project: gdProject): void;
+  setGenerateCompactCode(enable: boolean): gdLinkedEventsCodeGenerator;
+  setCompilationForRuntime(enable: boolean): gdLinkedEventsCodeGenerator;
+  getCode(): string;
+  getFunctionsCount(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,17 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdMetadataDeclarationCache {
+  constructor(): void;
+  declareExtension(project: gdProject, extension: gdPlatformExtension, eventsFunctionsExtension: gdEventsFunctionsExtension): void;
+  setLocale(locale: string): void;
+  getLocale(): string;
+  forgetExtension(extensionName: string): void;
+  clear(): void;
+  getLastDeclaredFreeFunctions(): gdVectorString;
+  getLastDeclaredEventsBasedBehaviors(): gdVectorString;
+  getLastDeclaredEventsBasedObjects(): gdVectorString;
+  wasLastExtensionFullyDeclared(): boolean;
+  getBehaviorMethodMangledNames(extensionName: string, behaviorName: string): gdMapStringString;
+  getObjectMethodMangledNames(extensionName: string, objectName: string): gdMapStringString;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
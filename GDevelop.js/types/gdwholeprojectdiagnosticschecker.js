@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdWholeProjectDiagnosticsChecker {
+  constructor(): void;
+  check(project: gdProject, wholeProjectDiagnosticReport: gdWholeProjectDiagnosticReport): void;
+  clearCache(): void;
+  getCheckedEventsCount(): number;
+  getReusedEventsCount(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
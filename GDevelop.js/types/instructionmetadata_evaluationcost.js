@@ -0,0 +1,2 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+type InstructionMetadata_EvaluationCost = 0 | 1 | 2 | 3
\ No newline at end of file
@@ -166,6 +166,7 @@ declare class libGDevelop {
   InstructionSentenceFormatter: Class<gdInstructionSentenceFormatter>;
   ParameterOptions: Class<gdParameterOptions>;
   AbstractFunctionMetadata: Class<gdAbstractFunctionMetadata>;
+  InstructionMetadata_EvaluationCost: Class<InstructionMetadata_EvaluationCost>;
   InstructionMetadata: Class<gdInstructionMetadata>;
   ExpressionMetadata: Class<gdExpressionMetadata>;
   MultipleInstructionMetadata: Class<gdMultipleInstructionMetadata>;
@@ -229,6 +230,7 @@ declare class libGDevelop {
   ProjectDiagnostic: Class<gdProjectDiagnostic>;
   DiagnosticReport: Class<gdDiagnosticReport>;
   WholeProjectDiagnosticReport: Class<gdWholeProjectDiagnosticReport>;
+  WholeProjectDiagnosticsChecker: Class<gdWholeProjectDiagnosticsChecker>;
   ExpressionParserError_ErrorType: Class<ExpressionParserError_ErrorType>;
   ExpressionParserError: Class<gdExpressionParserError>;
   VectorExpressionParserError: Class<gdVectorExpressionParserError>;
@@ -307,6 +309,7 @@ declare class libGDevelop {
   ParticleEmitterObject_RendererType: Class<ParticleEmitterObject_RendererType>;
   ParticleEmitterObject: Class<gdParticleEmitterObject>;
   LayoutCodeGenerator: Class<gdLayoutCodeGenerator>;
+  LinkedEventsCodeGenerator: Class<gdLinkedEventsCodeGenerator>;
   BehaviorCodeGenerator: Class<gdBehaviorCodeGenerator>;
   // $FlowFixMe[cannot-resolve-name]
   ObjectCodeGenerator: Class<gdObjectCodeGenerator>;
@@ -317,5 +320,8 @@ declare class libGDevelop {
   Exporter: Class<gdExporter>;
   JsCodeEvent: Class<gdJsCodeEvent>;
   MetadataDeclarationHelper: Class<gdMetadataDeclarationHelper>;
+  MetadataDeclarationCache: Class<gdMetadataDeclarationCache>;
   MemoryTrackedRegistry: Class<gdMemoryTrackedRegistry>;
+  AllocationCounts: Class<gdAllocationCounts>;
+  AllocationCounters: Class<gdAllocationCounters>;
 };
\ No newline at end of file
@@ -73,6 +73,33 @@ export const loadProjectEventsFunctionsExtensions = (
   );
 };
 
+// The metadata of extensions reloaded without generating code is declared
+// incrementally: only the functions, behaviors and objects that changed are
+// declared again. The platform extension filled for each extension is kept
+// to be updated by the next reload.
+let metadataDeclarationCache: ?gdMetadataDeclarationCache = null;
+const declaredPlatformExtensions: {
+  [string]: {|
+    extension: gdPlatformExtension,
+    extensionIncludeFiles: Array<string>,
+  |},
+} = {};
+
+const getMetadataDeclarationCache = (): gdMetadataDeclarationCache => {
+  if (!metadataDeclarationCache)
+    metadataDeclarationCache = new gd.MetadataDeclarationCache();
+  return metadataDeclarationCache;
+};
+
+const forgetDeclaredPlatformExtension = (extensionName: string) => {
+  const declaredPlatformExtension = declaredPlatformExtensions[extensionName];
+  if (!declaredPlatformExtension) return;
+
+  getMetadataDeclarationCache().forgetExtension(extensionName);
+  declaredPlatformExtension.extension.delete();
+  delete declaredPlatformExtensions[extensionName];
+};
+
 /**
  * Load an event-function extension metadata without generating the code.
  */
@@ -82,13 +109,97 @@ export const reloadProjectEventsFunctionsExtensionMetadata = (
   eventsFunctionCodeWriter: EventsFunctionCodeWriter,
   i18n: I18nType
 ): void => {
-  const extension = generateEventsFunctionExtensionMetadata(
+  const cache = getMetadataDeclarationCache();
+  const extensionName = eventsFunctionsExtension.getName();
+  const options = { eventsFunctionCodeWriter, i18n };
+  const extensionIncludeFiles = getExtensionIncludeFiles(
     project,
     eventsFunctionsExtension,
-    { eventsFunctionCodeWriter, i18n }
+    options
   );
+
+  const previouslyDeclaredPlatformExtension =
+    declaredPlatformExtensions[extensionName];
+  if (
+    previouslyDeclaredPlatformExtension &&
+    previouslyDeclaredPlatformExtension.extensionIncludeFiles.join('\n') !==
+      extensionIncludeFiles.join('\n')
+  ) {
+    // All the metadata includes the extension include files: declare
+    // everything again.
+    forgetDeclaredPlatformExtension(extensionName);
+  }
+  if (!declaredPlatformExtensions[extensionName]) {
+    cache.forgetExtension(extensionName);
+    declaredPlatformExtensions[extensionName] = {
+      extension: new gd.PlatformExtension(),
+      extensionIncludeFiles,
+    };
+  }
+  const { extension } = declaredPlatformExtensions[extensionName];
+
+  cache.setLocale(i18n.language || '');
+  cache.declareExtension(project, extension, eventsFunctionsExtension);
+
+  // Add the include files to the metadata that was declared again.
+  const codeGenerationContext = {
+    codeNamespacePrefix: gd.MetadataDeclarationHelper.getExtensionCodeNamespacePrefix(
+      eventsFunctionsExtension
+    ),
+    extensionIncludeFiles,
+  };
+  cache
+    .getLastDeclaredEventsBasedBehaviors()
+    .toJSArray()
+    .forEach(behaviorName => {
+      addBehaviorIncludeFiles(
+        extension.getBehaviorMetadata(
+          gd.PlatformExtension.getBehaviorFullType(extensionName, behaviorName)
+        ),
+        eventsFunctionsExtension.getEventsBasedBehaviors().get(behaviorName),
+        options,
+        codeGenerationContext
+      );
+    });
+  cache
+    .getLastDeclaredEventsBasedObjects()
+    .toJSArray()
+    .forEach(objectName => {
+      addObjectIncludeFiles(
+        extension.getObjectMetadata(
+          gd.PlatformExtension.getObjectFullType(extensionName, objectName)
+        ),
+        eventsFunctionsExtension.getEventsBasedObjects().get(objectName),
+        options,
+        codeGenerationContext
+      );
+    });
+  const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
+  cache
+    .getLastDeclaredFreeFunctions()
+    .toJSArray()
+    .forEach(functionName => {
+      // A function can be declared as an instruction and an expression.
+      const type = extension.getNameSpace() + functionName;
+      [
+        extension.getAllActions(),
+        extension.getAllConditions(),
+        extension.getAllExpressions(),
+        extension.getAllStrExpressions(),
+      ].forEach(instructionsOrExpressions => {
+        if (!instructionsOrExpressions.has(type)) return;
+
+        addFreeFunctionIncludeFiles(
+          instructionsOrExpressions.get(type),
+          eventsFunctionsExtension,
+          freeEventsFunctions.getEventsFunction(functionName),
+          options,
+          codeGenerationContext
+        );
+      });
+    });
+
   gd.JsPlatform.get().addNewExtension(extension);
-  extension.delete();
 };
 
 const loadProjectEventsFunctionsExtension = (
@@ -231,90 +342,6 @@ const generateEventsFunctionExtension = (
     });
 };
 
-/**
- * Generate the metadata for the events based extension
- */
-const generateEventsFunctionExtensionMetadata = (
-  project: gdProject,
-  eventsFunctionsExtension: gdEventsFunctionsExtension,
-  options: Options
-): gdPlatformExtension => {
-  const extension = new gd.PlatformExtension();
-  gd.MetadataDeclarationHelper.declareExtension(
-    extension,
-    eventsFunctionsExtension
-  );
-
-  const codeNamespacePrefix = gd.MetadataDeclarationHelper.getExtensionCodeNamespacePrefix(
-    eventsFunctionsExtension
-  );
-
-  const extensionIncludeFiles = getExtensionIncludeFiles(
-    project,
-    eventsFunctionsExtension,
-    options
-  );
-  const codeGenerationContext = {
-    codeNamespacePrefix,
-    extensionIncludeFiles,
-  };
-
-  // Generate all behaviors and their functions
-  mapVector(
-    eventsFunctionsExtension.getEventsBasedBehaviors(),
-    eventsBasedBehavior => {
-      const behaviorMethodMangledNames = new gd.MapStringString();
-      generateBehaviorMetadata(
-        project,
-        extension,
-        eventsFunctionsExtension,
-        eventsBasedBehavior,
-        options,
-        codeGenerationContext,
-        behaviorMethodMangledNames
-      );
-      behaviorMethodMangledNames.delete();
-      return;
-    }
-  );
-  // Generate all objects and their functions
-  mapVector(
-    eventsFunctionsExtension.getEventsBasedObjects(),
-    eventsBasedObject => {
-      const objectMethodMangledNames = new gd.MapStringString();
-      generateObjectMetadata(
-        project,
-        extension,
-        eventsFunctionsExtension,
-        eventsBasedObject,
-        options,
-        codeGenerationContext,
-        objectMethodMangledNames
-      );
-      objectMethodMangledNames.delete();
-      return;
-    }
-  );
-  // Generate all free functions
-  const metadataDeclarationHelper = new gd.MetadataDeclarationHelper();
-  const freeEventsFunctions = eventsFunctionsExtension.getEventsFunctions();
-  mapFor(0, freeEventsFunctions.getEventsFunctionsCount(), i => {
-    const eventsFunction = freeEventsFunctions.getEventsFunctionAt(i);
-    return generateFreeFunctionMetadata(
-      project,
-      extension,
-      eventsFunctionsExtension,
-      eventsFunction,
-      options,
-      codeGenerationContext,
-      metadataDeclarationHelper
-    );
-  });
-  metadataDeclarationHelper.delete();
-
-  return extension;
-};
-
 const generateFreeFunction = (
   project: gdProject,
   extension: gdPlatformExtension,
@@ -425,6 +452,31 @@ const generateFreeFunctionMetadata = (
     eventsFunctionsExtension,
     eventsFunction
   );
+  const functionFile = addFreeFunctionIncludeFiles(
+    instructionOrExpression,
+    eventsFunctionsExtension,
+    eventsFunction,
+    options,
+    codeGenerationContext
+  );
+
+  // Skip code generation if no events function writer is provided.
+  // This is the case during the "first pass", where all events functions extensions
+  // are loaded as extensions but not code generated, as events in functions could
+  // themselves be using functions that are not yet available in extensions.
+  return {
+    functionFile: functionFile,
+    functionMetadata: instructionOrExpression,
+  };
+};
+
+const addFreeFunctionIncludeFiles = (
+  instructionOrExpression: gdAbstractFunctionMetadata,
+  eventsFunctionsExtension: gdEventsFunctionsExtension,
+  eventsFunction: gdEventsFunction,
+  options: Options,
+  codeGenerationContext: CodeGenerationContext
+): string => {
   const functionName = gd.MetadataDeclarationHelper.getFreeFunctionCodeName(
     eventsFunctionsExtension,
     eventsFunction
@@ -439,14 +491,7 @@ const generateFreeFunctionMetadata = (
     instructionOrExpression.addIncludeFile(includeFile);
   });
 
-  // Skip code generation if no events function writer is provided.
-  // This is the case during the "first pass", where all events functions extensions
-  // are loaded as extensions but not code generated, as events in functions could
-  // themselves be using functions that are not yet available in extensions.
-  return {
-    functionFile: functionFile,
-    functionMetadata: instructionOrExpression,
-  };
+  return functionFile;
 };
 
 function generateBehavior(
@@ -533,7 +578,22 @@ function generateBehaviorMetadata(
     eventsBasedBehavior,
     behaviorMethodMangledNames
   );
+  addBehaviorIncludeFiles(
+    behaviorMetadata,
+    eventsBasedBehavior,
+    options,
+    codeGenerationContext
+  );
+
+  return behaviorMetadata;
+}
 
+function addBehaviorIncludeFiles(
+  behaviorMetadata: gdBehaviorMetadata,
+  eventsBasedBehavior: gdEventsBasedBehavior,
+  options: Options,
+  codeGenerationContext: CodeGenerationContext
+): void {
   const codeNamespace = gd.MetadataDeclarationHelper.getBehaviorFunctionCodeNamespace(
     eventsBasedBehavior,
     codeGenerationContext.codeNamespacePrefix
@@ -548,8 +608,6 @@ function generateBehaviorMetadata(
   codeGenerationContext.extensionIncludeFiles.forEach(includeFile => {
     behaviorMetadata.addIncludeFile(includeFile);
   });
-
-  return behaviorMetadata;
 }
 
 function generateObject(
@@ -636,7 +694,22 @@ function generateObjectMetadata(
     eventsBasedObject,
     objectMethodMangledNames
   );
+  addObjectIncludeFiles(
+    objectMetadata,
+    eventsBasedObject,
+    options,
+    codeGenerationContext
+  );
+
+  return objectMetadata;
+}
 
+function addObjectIncludeFiles(
+  objectMetadata: gdObjectMetadata,
+  eventsBasedObject: gdEventsBasedObject,
+  options: Options,
+  codeGenerationContext: CodeGenerationContext
+): void {
   const codeNamespace = gd.MetadataDeclarationHelper.getObjectFunctionCodeNamespace(
     eventsBasedObject,
     codeGenerationContext.codeNamespacePrefix
@@ -652,8 +725,6 @@ function generateObjectMetadata(
   codeGenerationContext.extensionIncludeFiles.forEach(includeFile => {
     objectMetadata.addIncludeFile(includeFile);
   });
-
-  return objectMetadata;
 }
 
 /**
@@ -664,9 +735,9 @@ export const unloadProjectEventsFunctionsExtensions = (
 ): Promise<Array<void>> => {
   return Promise.all(
     mapFor(0, project.getEventsFunctionsExtensionsCount(), i => {
-      gd.JsPlatform.get().removeExtension(
-        project.getEventsFunctionsExtensionAt(i).getName()
-      );
+      const extensionName = project.getEventsFunctionsExtensionAt(i).getName();
+      forgetDeclaredPlatformExtension(extensionName);
+      gd.JsPlatform.get().removeExtension(extensionName);
     })
   );
 };
@@ -678,6 +749,7 @@ export const unloadProjectEventsFunctionsExtension = (
   project: gdProject,
   extensionName: string
 ): void => {
+  forgetDeclaredPlatformExtension(extensionName);
   gd.JsPlatform.get().removeExtension(extensionName);
 };
 
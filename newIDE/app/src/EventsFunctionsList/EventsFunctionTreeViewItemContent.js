@@ -564,6 +564,7 @@ export class EventsFunctionTreeViewItemContent implements TreeViewItemContent {
       eventsFunctionsContainer.getEventsFunctionsCount()
     );
     newEventsFunction.setName(newName);
+    newEventsFunction.getEvents().resetPersistentUuid();
     const newFunctionFolderOrFunction = eventsFunctionsContainer
       .getRootFolder()
       .getFunctionNamed(newName);
@@ -151,6 +151,8 @@ export const pasteEventsFromClipboardInSelection = (
     'unserializeFrom',
     project
   );
+  // Pasted events are new events, not the copied ones.
+  eventsList.resetPersistentUuid();
 
   lastSelectEventContext.eventsList.insertEvents(
     eventsList,
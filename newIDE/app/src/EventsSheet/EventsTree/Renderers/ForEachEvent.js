@@ -283,7 +283,7 @@ export default class ForEachEvent extends React.Component<
         'number',
         ''
       );
-      orderByExpression.getRootNode().visit(orderByValidator);
+      orderByExpression.getSharedRootNode().visit(orderByValidator);
       isOrderByValid = orderByValidator.getAllErrors().size() === 0;
       orderByValidator.delete();
     }
@@ -296,7 +296,7 @@ export default class ForEachEvent extends React.Component<
         'number',
         ''
       );
-      limitExpression.getRootNode().visit(limitValidator);
+      limitExpression.getSharedRootNode().visit(limitValidator);
       isLimitValid = limitValidator.getAllErrors().size() === 0;
       limitValidator.delete();
     }
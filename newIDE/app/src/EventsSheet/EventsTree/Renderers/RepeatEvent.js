@@ -127,7 +127,7 @@ export default class RepeatEvent extends React.Component<
       'number',
       ''
     );
-    expression.getRootNode().visit(expressionValidator);
+    expression.getSharedRootNode().visit(expressionValidator);
     const isExpressionValid = expressionValidator.getAllErrors().size() === 0;
     expressionValidator.delete();
 
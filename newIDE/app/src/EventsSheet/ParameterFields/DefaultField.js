@@ -88,7 +88,7 @@ export const renderInlineDefaultField = ({
       }),
       applySyntaxColoring({
         text: value,
-        rootNode: expression.getRootNode(),
+        rootNode: expression.getSharedRootNode(),
         rootType: parameterMetadata.getValueTypeMetadata().getName(),
         platform: scope.project.getCurrentPlatform(),
         projectScopedContainers: projectScopedContainersAccessor.get(),
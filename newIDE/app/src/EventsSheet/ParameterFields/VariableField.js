@@ -785,7 +785,7 @@ export const renderVariableWithIcon = (
                 }),
                 applySyntaxColoring({
                   text: value,
-                  rootNode: expression.getRootNode(),
+                  rootNode: expression.getSharedRootNode(),
                   rootType: parameterMetadata.getValueTypeMetadata().getName(),
                   platform: scope.project.getCurrentPlatform(),
                   projectScopedContainers: projectScopedContainersAccessor.get(),
@@ -22,6 +22,8 @@ export class ProjectScopedContainersAccessor {
   _parameterResourcesContainer: gdResourcesContainer | null;
   _propertyResourcesContainer: gdResourcesContainer | null;
   _eventPath: Array<gdBaseEvent>;
+  _projectScopedContainers: gdProjectScopedContainers | null = null;
+  _projectScopedContainersVersion: number = 0;
 
   constructor(
     scope: EventsScope,
@@ -47,7 +49,41 @@ export class ProjectScopedContainersAccessor {
     return this._scope;
   }
 
+  /**
+   * Return the containers of the scope.
+   *
+   * The containers are built once and reused by the calls made in the same
+   * task, as long as they are unchanged. They are a temporary of the bindings,
+   * overwritten when containers are built by another accessor: they must not be
+   * kept.
+   */
   get(): gdProjectScopedContainers {
+    const cachedProjectScopedContainers = this._projectScopedContainers;
+    // Each built scope has its own version, which also changes with the
+    // containers of the scope: a different version means that the scope was
+    // overwritten or modified.
+    if (
+      cachedProjectScopedContainers &&
+      cachedProjectScopedContainers.getVersion() ===
+        this._projectScopedContainersVersion
+    ) {
+      return cachedProjectScopedContainers;
+    }
+
+    const projectScopedContainers = this._makeNewProjectScopedContainers();
+    if (!this._projectScopedContainers) {
+      // Some changes (like properties) are not tracked by the version:
+      // don't reuse the scope after the current task.
+      Promise.resolve().then(() => {
+        this._projectScopedContainers = null;
+      });
+    }
+    this._projectScopedContainers = projectScopedContainers;
+    this._projectScopedContainersVersion = projectScopedContainers.getVersion();
+    return projectScopedContainers;
+  }
+
+  _makeNewProjectScopedContainers(): gdProjectScopedContainers {
     let projectScopedContainers;
     const {
       project,
@@ -206,6 +206,8 @@ export class ExternalEventsTreeViewItemContent implements TreeViewItemContent {
     );
     // Unserialization has overwritten the name.
     newExternalEvents.setName(newName);
+    // The pasted events are new events, not the copied ones.
+    newExternalEvents.getEvents().resetPersistentUuid();
 
     this._onProjectItemModified();
     this.props.editName(getExternalEventsTreeViewItemId(newExternalEvents));
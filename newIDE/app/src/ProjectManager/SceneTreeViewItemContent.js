@@ -279,6 +279,8 @@ export class SceneTreeViewItemContent implements TreeViewItemContent {
     // Unserialization has overwritten the name.
     newScene.setName(newName);
     newScene.updateBehaviorsSharedData(project);
+    // The events of the new scene are not the copied ones.
+    newScene.getEvents().resetPersistentUuid();
 
     this._onProjectItemModified();
     this.props.editName(getSceneTreeViewItemId(newScene));
@@ -302,6 +304,8 @@ export class SceneTreeViewItemContent implements TreeViewItemContent {
     // Unserialization has overwritten the name.
     newScene.setName(newName);
     newScene.updateBehaviorsSharedData(project);
+    // The events of the new scene are not the copied ones.
+    newScene.getEvents().resetPersistentUuid();
 
     this._onProjectItemModified();
     this.props.editName(getSceneTreeViewItemId(newScene));